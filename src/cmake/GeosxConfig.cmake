@@ -7,6 +7,7 @@ set( PREPROCESSOR_DEFINES ARRAY_BOUNDS_CHECK
                           HYPRE
                           HYPRE_CUDA
                           MATHPRESSO
+                          MIXED_PRECISION_FLUID
                           METIS
                           MPI
                           OPENMP
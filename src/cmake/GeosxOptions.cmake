@@ -6,6 +6,8 @@ message( "CMAKE_HOST_APPLE = ${CMAKE_HOST_APPLE}" )
 ### OPTIONS ###
 option( GEOSX_ENABLE_FPE "" ON )
 
+option( GEOSX_ENABLE_MIXED_PRECISION_FLUID "Stores multiphase fluid property derivatives in single precision" OFF )
+
 option( ENABLE_CALIPER "" OFF )
 
 option( ENABLE_MATHPRESSO "" ON )
@@ -540,6 +540,8 @@ if(DEFINED VTK_DIR)
                  NO_DEFAULT_PATH)
 
     set( VTK_TARGETS
+         VTK::FiltersExtraction
+         VTK::FiltersGeneral
          VTK::FiltersParallelDIY2
          VTK::IOLegacy
          VTK::IOParallelXML
@@ -0,0 +1,113 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "benchmarks/benchmarkUtils.hpp"
+#include "dataRepository/BufferOps.hpp"
+#include "dataRepository/BufferOpsDevice.hpp"
+
+#include <random>
+
+using namespace geosx;
+using namespace geosx::benchmarking;
+
+/// The number of components of the packed field, as for a displacement or a velocity
+constexpr localIndex NUM_COMPONENTS = 3;
+
+void fillRandom( array2d< real64 > & field )
+{
+  std::mt19937_64 gen( 2021 );
+  std::uniform_real_distribution< real64 > dis( -1.0, 1.0 );
+  for( localIndex i = 0; i < field.size( 0 ); ++i )
+  {
+    for( localIndex j = 0; j < field.size( 1 ); ++j )
+    {
+      field( i, j ) = dis( gen );
+    }
+  }
+}
+
+/// Every other index is sent, which is representative of the ghosting pattern of a structured partition
+array1d< localIndex > makePackList( localIndex const size )
+{
+  array1d< localIndex > indices;
+  for( localIndex i = 0; i < size; i += 2 )
+  {
+    indices.emplace_back( i );
+  }
+  return indices;
+}
+
+void packUnpack( ::benchmark::State & state )
+{
+  localIndex const size = state.range( 0 );
+  array2d< real64 > field( size, NUM_COMPONENTS );
+  array2d< real64 > unpacked( size, NUM_COMPONENTS );
+  fillRandom( field );
+
+  buffer_unit_type * nullBuffer = nullptr;
+  localIndex const bufferSize = bufferOps::Pack< false >( nullBuffer, field.toViewConst() );
+  buffer_type buffer( bufferSize );
+
+  for( auto _ : state )
+  {
+    buffer_unit_type * packBuffer = buffer.data();
+    bufferOps::Pack< true >( packBuffer, field.toViewConst() );
+    buffer_unit_type const * unpackBuffer = buffer.data();
+    bufferOps::Unpack( unpackBuffer, unpacked );
+    ::benchmark::DoNotOptimize( unpacked.data() );
+    ::benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed( state.iterations() * 2 * bufferSize );
+  setThroughput( state, "values/s", size * NUM_COMPONENTS );
+}
+
+void packUnpackByIndexDevice( ::benchmark::State & state )
+{
+  localIndex const size = state.range( 0 );
+  array2d< real64 > field( size, NUM_COMPONENTS );
+  array2d< real64 > unpacked( size, NUM_COMPONENTS );
+  fillRandom( field );
+  array1d< localIndex > const indices = makePackList( size );
+
+  buffer_unit_type * nullBuffer = nullptr;
+  parallelDeviceEvents sizeEvents;
+  localIndex const bufferSize =
+    bufferOps::PackByIndexDevice< false >( nullBuffer, field.toViewConst(), indices.toViewConst(), sizeEvents );
+  buffer_type buffer( bufferSize );
+
+  for( auto _ : state )
+  {
+    parallelDeviceEvents packEvents;
+    buffer_unit_type * packBuffer = buffer.data();
+    bufferOps::PackByIndexDevice< true >( packBuffer, field.toViewConst(), indices.toViewConst(), packEvents );
+    waitAllDeviceEvents( packEvents );
+
+    parallelDeviceEvents unpackEvents;
+    buffer_unit_type const * unpackBuffer = buffer.data();
+    bufferOps::UnpackByIndexDevice( unpackBuffer, unpacked.toView(), indices.toViewConst(), unpackEvents );
+    waitAllDeviceEvents( unpackEvents );
+  }
+
+  state.SetBytesProcessed( state.iterations() * 2 * bufferSize );
+  setThroughput( state, "values/s", indices.size() * NUM_COMPONENTS );
+}
+
+BENCHMARK( packUnpack )->RangeMultiplier( 8 )->Range( 1 << 12, 1 << 21 );
+BENCHMARK( packUnpackByIndexDevice )->RangeMultiplier( 8 )->Range( 1 << 12, 1 << 21 );
+
+int main( int argc, char * * argv )
+{
+  return runBenchmarks( argc, argv );
+}
@@ -0,0 +1,242 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "benchmarks/benchmarkUtils.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseFVM.hpp"
+
+using namespace geosx;
+using namespace geosx::benchmarking;
+
+/// CO2-brine tables written into files before the problems are set up
+char const * pvtLiquidTableContent = "DensityFun PhillipsBrineDensity 1e6 1.5e7 5e4 367.15 369.15 1 0.2\n"
+                                     "ViscosityFun PhillipsBrineViscosity 0.1";
+char const * pvtGasTableContent = "DensityFun SpanWagnerCO2Density 1e6 1.5e7 5e4 367.15 369.15 1\n"
+                                  "ViscosityFun FenghourCO2Viscosity 1e6 1.5e7 5e4 367.15 369.15 1";
+char const * co2FlashTableContent = "FlashModel CO2Solubility 1e6 1.5e7 5e4 367.15 369.15 1 0.15";
+
+string co2BrineXML( localIndex const n )
+{
+  std::ostringstream os;
+  os << "<Problem>\n"
+     << "  <Solvers gravityVector=\"{ 0.0, 0.0, -9.81 }\">\n"
+     << "    <CompositionalMultiphaseFVM name=\"compflow\"\n"
+     << "                                discretization=\"fluidTPFA\"\n"
+     << "                                targetRegions=\"{region}\"\n"
+     << "                                temperature=\"368.15\"\n"
+     << "                                useMass=\"1\">\n"
+     << "      <NonlinearSolverParameters newtonMaxIter=\"1\"/>\n"
+     << "      <LinearSolverParameters directParallel=\"0\"/>\n"
+     << "    </CompositionalMultiphaseFVM>\n"
+     << "  </Solvers>\n"
+     << internalMeshXML( n, "cb1" )
+     << "  <NumericalMethods>\n"
+     << "    <FiniteVolume>\n"
+     << "      <TwoPointFluxApproximation name=\"fluidTPFA\"/>\n"
+     << "    </FiniteVolume>\n"
+     << "  </NumericalMethods>\n"
+     << "  <ElementRegions>\n"
+     << "    <CellElementRegion name=\"region\" cellBlocks=\"{cb1}\" materialList=\"{fluid, rock, relperm}\"/>\n"
+     << "  </ElementRegions>\n"
+     << "  <Constitutive>\n"
+     << "    <CO2BrinePhillipsFluid name=\"fluid\"\n"
+     << "                           phaseNames=\"{gas, water}\"\n"
+     << "                           componentNames=\"{co2, water}\"\n"
+     << "                           componentMolarWeight=\"{44e-3, 18e-3}\"\n"
+     << "                           phasePVTParaFiles=\"{pvtgas.txt, pvtliquid.txt}\"\n"
+     << "                           flashModelParaFile=\"co2flash.txt\"/>\n"
+     << "    <CompressibleSolidConstantPermeability name=\"rock\"\n"
+     << "                                           solidModelName=\"nullSolid\"\n"
+     << "                                           porosityModelName=\"rockPorosity\"\n"
+     << "                                           permeabilityModelName=\"rockPerm\"/>\n"
+     << "    <NullModel name=\"nullSolid\"/>\n"
+     << "    <PressurePorosity name=\"rockPorosity\"\n"
+     << "                      defaultReferencePorosity=\"0.2\"\n"
+     << "                      referencePressure=\"0.0\"\n"
+     << "                      compressibility=\"1.0e-9\"/>\n"
+     << "    <ConstantPermeability name=\"rockPerm\"\n"
+     << "                          permeabilityComponents=\"{1.0e-13, 1.0e-13, 1.0e-13}\"/>\n"
+     << "    <BrooksCoreyRelativePermeability name=\"relperm\"\n"
+     << "                                     phaseNames=\"{gas, water}\"\n"
+     << "                                     phaseMinVolumeFraction=\"{0.05, 0.1}\"\n"
+     << "                                     phaseRelPermExponent=\"{2.0, 2.0}\"\n"
+     << "                                     phaseRelPermMaxValue=\"{0.8, 0.9}\"/>\n"
+     << "  </Constitutive>\n"
+     << "  <FieldSpecifications>\n"
+     << "    <FieldSpecification name=\"initialPressure\"\n"
+     << "                        initialCondition=\"1\"\n"
+     << "                        setNames=\"{all}\"\n"
+     << "                        objectPath=\"ElementRegions/region/cb1\"\n"
+     << "                        fieldName=\"pressure\"\n"
+     << "                        functionName=\"initialPressureFunc\"\n"
+     << "                        scale=\"1.2e7\"/>\n"
+     << "    <FieldSpecification name=\"initialComposition_co2\"\n"
+     << "                        initialCondition=\"1\"\n"
+     << "                        setNames=\"{all}\"\n"
+     << "                        objectPath=\"ElementRegions/region/cb1\"\n"
+     << "                        fieldName=\"globalCompFraction\"\n"
+     << "                        component=\"0\"\n"
+     << "                        scale=\"0.3\"/>\n"
+     << "    <FieldSpecification name=\"initialComposition_water\"\n"
+     << "                        initialCondition=\"1\"\n"
+     << "                        setNames=\"{all}\"\n"
+     << "                        objectPath=\"ElementRegions/region/cb1\"\n"
+     << "                        fieldName=\"globalCompFraction\"\n"
+     << "                        component=\"1\"\n"
+     << "                        scale=\"0.7\"/>\n"
+     << "  </FieldSpecifications>\n"
+     << "  <Functions>\n"
+     << "    <TableFunction name=\"initialPressureFunc\"\n"
+     << "                   inputVarNames=\"{elementCenter}\"\n"
+     << "                   coordinates=\"{0.0, " << n << "}\"\n"
+     << "                   values=\"{1.0, 0.5}\"/>\n"
+     << "  </Functions>\n"
+     << "</Problem>";
+  return os.str();
+}
+
+/**
+ * @brief The CO2-brine problem set up on a n x n x n cube, ready for the assembly of its first Newton iteration.
+ */
+class CO2BrineProblem
+{
+public:
+
+  explicit CO2BrineProblem( localIndex const n ):
+    m_state( std::make_unique< CommandLineOptions >( commandLineOptions() ) )
+  {
+    writeTableToFile( "pvtliquid.txt", pvtLiquidTableContent );
+    writeTableToFile( "pvtgas.txt", pvtGasTableContent );
+    writeTableToFile( "co2flash.txt", co2FlashTableContent );
+
+    setupProblemFromXML( m_state.getProblemManager(), co2BrineXML( n ) );
+    m_solver = &m_state.getProblemManager().getPhysicsSolverManager().getGroup< CompositionalMultiphaseFVM >( "compflow" );
+
+    DomainPartition & domain = getDomain();
+    m_solver->setupSystem( domain,
+                           m_solver->getDofManager(),
+                           m_solver->getLocalMatrix(),
+                           m_solver->getSystemRhs(),
+                           m_solver->getSystemSolution() );
+    m_solver->implicitStepSetup( 0.0, dt, domain );
+  }
+
+  DomainPartition & getDomain() { return m_state.getProblemManager().getDomainPartition(); }
+
+  CompositionalMultiphaseFVM & getSolver() { return *m_solver; }
+
+  template< typename LAMBDA >
+  void forTargetSubRegions( LAMBDA && lambda )
+  {
+    m_solver->forMeshTargets( getDomain().getMeshBodies(),
+                              [&]( string const,
+                                   MeshLevel & mesh,
+                                   arrayView1d< string const > const & regionNames )
+    {
+      mesh.getElemManager().forElementSubRegions( regionNames,
+                                                  [&]( localIndex const,
+                                                       ElementSubRegionBase & subRegion )
+      {
+        lambda( subRegion );
+      } );
+    } );
+  }
+
+  static constexpr real64 dt = 1.0e4;
+
+private:
+
+  GeosxState m_state;
+  CompositionalMultiphaseFVM * m_solver;
+};
+
+constexpr real64 CO2BrineProblem::dt;
+
+void co2BrineFluidUpdate( ::benchmark::State & state )
+{
+  localIndex const n = state.range( 0 );
+  CO2BrineProblem problem( n );
+  CompositionalMultiphaseFVM & solver = problem.getSolver();
+
+  for( auto _ : state )
+  {
+    problem.forTargetSubRegions( [&]( ElementSubRegionBase & subRegion )
+    {
+      solver.updateFluidModel( subRegion );
+    } );
+  }
+
+  setThroughput( state, "cells/s", n * n * n );
+}
+
+void phaseVolumeFraction( ::benchmark::State & state )
+{
+  localIndex const n = state.range( 0 );
+  CO2BrineProblem problem( n );
+  CompositionalMultiphaseFVM & solver = problem.getSolver();
+
+  for( auto _ : state )
+  {
+    problem.forTargetSubRegions( [&]( ElementSubRegionBase & subRegion )
+    {
+      solver.updatePhaseVolumeFraction( subRegion );
+    } );
+  }
+
+  setThroughput( state, "cells/s", n * n * n );
+}
+
+void faceBasedAssembly( ::benchmark::State & state )
+{
+  localIndex const n = state.range( 0 );
+  CO2BrineProblem problem( n );
+  CompositionalMultiphaseFVM & solver = problem.getSolver();
+  DomainPartition & domain = problem.getDomain();
+
+  CRSMatrix< real64, globalIndex > & localMatrix = solver.getLocalMatrix();
+  array1d< real64 > localRhs( localMatrix.numRows() );
+
+  // the matrix and residual are not zeroed between the iterations, the flux kernel only accumulates into them
+  for( auto _ : state )
+  {
+    solver.assembleFluxTerms( CO2BrineProblem::dt,
+                              domain,
+                              solver.getDofManager(),
+                              localMatrix.toViewConstSizes(),
+                              localRhs.toView() );
+  }
+
+  setThroughput( state, "cells/s", n * n * n );
+  setThroughput( state, "connections/s", 3 * n * n * ( n - 1 ) );
+}
+
+BENCHMARK( co2BrineFluidUpdate )
+  ->ArgName( "n" )
+  ->RangeMultiplier( 2 )->Range( MIN_CELLS_PER_AXIS, MAX_CELLS_PER_AXIS )
+  ->Unit( ::benchmark::kMillisecond );
+
+BENCHMARK( phaseVolumeFraction )
+  ->ArgName( "n" )
+  ->RangeMultiplier( 2 )->Range( MIN_CELLS_PER_AXIS, MAX_CELLS_PER_AXIS )
+  ->Unit( ::benchmark::kMillisecond );
+
+BENCHMARK( faceBasedAssembly )
+  ->ArgName( "n" )
+  ->RangeMultiplier( 2 )->Range( MIN_CELLS_PER_AXIS, MAX_CELLS_PER_AXIS )
+  ->Unit( ::benchmark::kMillisecond );
+
+int main( int argc, char * * argv )
+{
+  return runBenchmarks( argc, argv );
+}
@@ -0,0 +1,197 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "benchmarks/benchmarkUtils.hpp"
+#include "constitutive/solid/DruckerPrager.hpp"
+#include "constitutive/solid/ModifiedCamClay.hpp"
+#include "finiteElement/kernelInterface/KernelBase.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsSmallStrainExplicitNewmarkKernel.hpp"
+
+using namespace geosx;
+using namespace geosx::benchmarking;
+using namespace geosx::constitutive;
+
+/// The number of quadrature points of a trilinear hexahedron
+constexpr localIndex NUM_QUADRATURE_POINTS = 8;
+
+string explicitSolidMechanicsXML( localIndex const n )
+{
+  std::ostringstream os;
+  os << "<Problem>\n"
+     << "  <Solvers gravityVector=\"{ 0.0, 0.0, 0.0 }\">\n"
+     << "    <SolidMechanics_LagrangianFEM name=\"lagsolve\"\n"
+     << "                                  timeIntegrationOption=\"ExplicitDynamic\"\n"
+     << "                                  discretization=\"FE1\"\n"
+     << "                                  targetRegions=\"{region}\"/>\n"
+     << "  </Solvers>\n"
+     << internalMeshXML( n, "cb1" )
+     << "  <NumericalMethods>\n"
+     << "    <FiniteElements>\n"
+     << "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+     << "    </FiniteElements>\n"
+     << "  </NumericalMethods>\n"
+     << "  <ElementRegions>\n"
+     << "    <CellElementRegion name=\"region\" cellBlocks=\"{cb1}\" materialList=\"{shale}\"/>\n"
+     << "  </ElementRegions>\n"
+     << "  <Constitutive>\n"
+     << "    <ElasticIsotropic name=\"shale\"\n"
+     << "                      defaultDensity=\"2700\"\n"
+     << "                      defaultBulkModulus=\"5.5556e9\"\n"
+     << "                      defaultShearModulus=\"4.16667e9\"/>\n"
+     << "  </Constitutive>\n"
+     << "</Problem>";
+  return os.str();
+}
+
+void explicitSmallStrain( ::benchmark::State & state )
+{
+  localIndex const n = state.range( 0 );
+  real64 const dt = 1.0e-6;
+
+  GeosxState geosxState( std::make_unique< CommandLineOptions >( commandLineOptions() ) );
+  ProblemManager & problemManager = geosxState.getProblemManager();
+  setupProblemFromXML( problemManager, explicitSolidMechanicsXML( n ) );
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+  SolidMechanicsLagrangianFEM & solver =
+    problemManager.getPhysicsSolverManager().getGroup< SolidMechanicsLagrangianFEM >( "lagsolve" );
+
+  // on a single rank, no element is attached to a send/receive node and this list covers the whole mesh
+  string const elementListName = SolidMechanicsLagrangianFEM::viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString();
+
+  for( auto _ : state )
+  {
+    solver.forMeshTargets( domain.getMeshBodies(),
+                           [&]( string const,
+                                MeshLevel & mesh,
+                                arrayView1d< string const > const & regionNames )
+    {
+      auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainFactory( dt, elementListName );
+      finiteElement::
+        regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                      constitutive::SolidBase,
+                                      CellElementSubRegion >( mesh,
+                                                              regionNames,
+                                                              solver.getDiscretizationName(),
+                                                              SolidMechanicsLagrangianFEM::viewKeyStruct::solidMaterialNamesString(),
+                                                              kernelFactory );
+    } );
+  }
+
+  setThroughput( state, "cells/s", n * n * n );
+}
+
+template< typename SOLID_TYPE >
+struct SolidModelInput;
+
+template<>
+struct SolidModelInput< DruckerPrager >
+{
+  static constexpr char const * xml =
+    "<Constitutive>"
+    "  <DruckerPrager name=\"solid\""
+    "                 defaultDensity=\"2700\""
+    "                 defaultBulkModulus=\"1.0e9\""
+    "                 defaultShearModulus=\"1.0e9\""
+    "                 defaultCohesion=\"1.0e5\""
+    "                 defaultFrictionAngle=\"15.27\""
+    "                 defaultDilationAngle=\"15.0\""
+    "                 defaultHardeningRate=\"0.01\"/>"
+    "</Constitutive>";
+};
+
+template<>
+struct SolidModelInput< ModifiedCamClay >
+{
+  static constexpr char const * xml =
+    "<Constitutive>"
+    "  <ModifiedCamClay name=\"solid\""
+    "                   defaultDensity=\"2700\""
+    "                   defaultRefPressure=\"-1.0\""
+    "                   defaultRefStrainVol=\"0\""
+    "                   defaultShearModulus=\"200.0\""
+    "                   defaultPreConsolidationPressure=\"-1.1\""
+    "                   defaultCslSlope=\"1.2\""
+    "                   defaultVirginCompressionIndex=\"0.003\""
+    "                   defaultRecompressionIndex=\"0.002\"/>"
+    "</Constitutive>";
+};
+
+constexpr char const * SolidModelInput< DruckerPrager >::xml;
+constexpr char const * SolidModelInput< ModifiedCamClay >::xml;
+
+template< typename SOLID_TYPE >
+void plasticSmallStrainUpdate( ::benchmark::State & state )
+{
+  localIndex const n = state.range( 0 );
+  localIndex const numElems = n * n * n;
+
+  conduit::Node node;
+  dataRepository::Group rootGroup( "root", node );
+  ConstitutiveManager constitutiveManager( "constitutive", &rootGroup );
+
+  string const inputStream = SolidModelInput< SOLID_TYPE >::xml;
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlDocument.load_buffer( inputStream.c_str(), inputStream.size() );
+  xmlWrapper::xmlNode xmlConstitutiveNode = xmlDocument.child( "Constitutive" );
+  constitutiveManager.processInputFileRecursive( xmlConstitutiveNode );
+  constitutiveManager.postProcessInputRecursive();
+
+  dataRepository::Group disc( "discretization", &rootGroup );
+  disc.resize( numElems );
+
+  SOLID_TYPE & solid = constitutiveManager.getConstitutiveRelation< SOLID_TYPE >( "solid" );
+  solid.allocateConstitutiveData( disc, NUM_QUADRATURE_POINTS );
+  typename SOLID_TYPE::KernelWrapper const solidWrapper = solid.createKernelUpdates();
+
+  for( auto _ : state )
+  {
+    // the converged state is never saved, so that every iteration performs the same (plastic) returns
+    forAll< parallelDevicePolicy<> >( numElems, [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      real64 const strainIncrement[6] = { -1.0e-3, 5.0e-4, 5.0e-4, 0.0, 0.0, 1.0e-4 };
+      real64 stress[6]{};
+      real64 stiffness[6][6]{};
+      for( localIndex q = 0; q < NUM_QUADRATURE_POINTS; ++q )
+      {
+        solidWrapper.smallStrainUpdate( k, q, strainIncrement, stress, stiffness );
+      }
+    } );
+  }
+
+  setThroughput( state, "cells/s", numElems );
+  setThroughput( state, "updates/s", numElems * NUM_QUADRATURE_POINTS );
+}
+
+BENCHMARK( explicitSmallStrain )
+  ->ArgName( "n" )
+  ->RangeMultiplier( 2 )->Range( MIN_CELLS_PER_AXIS, MAX_CELLS_PER_AXIS )
+  ->Unit( ::benchmark::kMillisecond );
+
+BENCHMARK_TEMPLATE( plasticSmallStrainUpdate, DruckerPrager )
+  ->ArgName( "n" )
+  ->RangeMultiplier( 2 )->Range( MIN_CELLS_PER_AXIS, MAX_CELLS_PER_AXIS )
+  ->Unit( ::benchmark::kMillisecond );
+
+BENCHMARK_TEMPLATE( plasticSmallStrainUpdate, ModifiedCamClay )
+  ->ArgName( "n" )
+  ->RangeMultiplier( 2 )->Range( MIN_CELLS_PER_AXIS, MAX_CELLS_PER_AXIS )
+  ->Unit( ::benchmark::kMillisecond );
+
+int main( int argc, char * * argv )
+{
+  return runBenchmarks( argc, argv );
+}
@@ -0,0 +1,127 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "benchmarks/benchmarkUtils.hpp"
+#include "functions/FunctionManager.hpp"
+#include "functions/TableFunction.hpp"
+
+#include <random>
+
+using namespace geosx;
+using namespace geosx::benchmarking;
+
+/// The number of interpolation points along each axis of the tables
+constexpr localIndex NUM_AXIS_POINTS = 64;
+
+/// The number of table evaluations performed by each iteration
+constexpr localIndex NUM_EVALUATIONS = 1 << 20;
+
+/**
+ * @brief Create a table of @p numDims dimensions with NUM_AXIS_POINTS points per axis on [0, 1]^numDims.
+ */
+TableFunction & createTable( FunctionManager & functionManager, integer const numDims )
+{
+  array1d< real64_array > coordinates( numDims );
+  localIndex numValues = 1;
+  for( integer dim = 0; dim < numDims; ++dim )
+  {
+    coordinates[dim].resize( NUM_AXIS_POINTS );
+    for( localIndex i = 0; i < NUM_AXIS_POINTS; ++i )
+    {
+      coordinates[dim][i] = static_cast< real64 >( i ) / ( NUM_AXIS_POINTS - 1 );
+    }
+    numValues *= NUM_AXIS_POINTS;
+  }
+
+  real64_array values( numValues );
+  for( localIndex i = 0; i < numValues; ++i )
+  {
+    values[i] = std::sin( 0.001 * i );
+  }
+
+  TableFunction & table = dynamicCast< TableFunction & >( *functionManager.createChild( "TableFunction", "table" ) );
+  table.setTableCoordinates( coordinates );
+  table.setTableValues( values );
+  table.setInterpolationMethod( TableFunction::InterpolationType::Linear );
+  table.reInitializeFunction();
+  return table;
+}
+
+/// The evaluation points are randomly scattered, which defeats any locality in the interval search
+array2d< real64 > createInputs( integer const numDims )
+{
+  std::mt19937_64 gen( 2021 );
+  std::uniform_real_distribution< real64 > dis( -0.05, 1.05 );
+  array2d< real64 > inputs( NUM_EVALUATIONS, numDims );
+  for( localIndex i = 0; i < NUM_EVALUATIONS; ++i )
+  {
+    for( integer dim = 0; dim < numDims; ++dim )
+    {
+      inputs( i, dim ) = dis( gen );
+    }
+  }
+  return inputs;
+}
+
+void tableInterpolation( ::benchmark::State & state )
+{
+  integer const numDims = LvArray::integerConversion< integer >( state.range( 0 ) );
+  bool const computeDerivatives = state.range( 1 ) != 0;
+
+  GeosxState geosxState( std::make_unique< CommandLineOptions >( commandLineOptions() ) );
+  FunctionManager & functionManager = FunctionManager::getInstance();
+
+  TableFunction const & table = createTable( functionManager, numDims );
+  TableFunction::KernelWrapper const tableWrapper = table.createKernelWrapper();
+
+  array2d< real64 > const inputs = createInputs( numDims );
+  array1d< real64 > results( NUM_EVALUATIONS );
+  array2d< real64 > derivatives( NUM_EVALUATIONS, numDims );
+
+  arrayView2d< real64 const > const inputsView = inputs.toViewConst();
+  arrayView1d< real64 > const resultsView = results.toView();
+  arrayView2d< real64 > const derivativesView = derivatives.toView();
+
+  for( auto _ : state )
+  {
+    if( computeDerivatives )
+    {
+      forAll< parallelDevicePolicy<> >( NUM_EVALUATIONS, [=] GEOSX_HOST_DEVICE ( localIndex const i )
+      {
+        resultsView[i] = tableWrapper.compute( inputsView[i], derivativesView[i] );
+      } );
+    }
+    else
+    {
+      forAll< parallelDevicePolicy<> >( NUM_EVALUATIONS, [=] GEOSX_HOST_DEVICE ( localIndex const i )
+      {
+        resultsView[i] = tableWrapper.compute( inputsView[i] );
+      } );
+    }
+  }
+
+  setThroughput( state, "evaluations/s", NUM_EVALUATIONS );
+}
+
+BENCHMARK( tableInterpolation )
+  ->ArgNames( { "dims", "derivatives" } )
+  ->Args( { 1, 0 } )->Args( { 1, 1 } )
+  ->Args( { 2, 0 } )->Args( { 2, 1 } )
+  ->Args( { 3, 0 } )->Args( { 3, 1 } )
+  ->Unit( ::benchmark::kMillisecond );
+
+int main( int argc, char * * argv )
+{
+  return runBenchmarks( argc, argv );
+}
@@ -0,0 +1,167 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkUtils.hpp
+ */
+
+#ifndef GEOSX_BENCHMARKS_BENCHMARKUTILS_HPP_
+#define GEOSX_BENCHMARKS_BENCHMARKUTILS_HPP_
+
+#include "constitutive/ConstitutiveManager.hpp"
+#include "dataRepository/xmlWrapper.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/MeshManager.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <sstream>
+
+namespace geosx
+{
+
+namespace benchmarking
+{
+
+/// The smallest number of cells along each axis of the synthetic meshes
+constexpr localIndex MIN_CELLS_PER_AXIS = 8;
+
+/// The largest number of cells along each axis of the synthetic meshes
+constexpr localIndex MAX_CELLS_PER_AXIS = 64;
+
+/**
+ * @brief Get the command line options shared by all the problems set up by a benchmark executable.
+ * @return the command line options
+ */
+inline CommandLineOptions & commandLineOptions()
+{
+  static CommandLineOptions options;
+  return options;
+}
+
+/**
+ * @brief Write the XML block of a cube mesh made of n x n x n hexahedra in a single cell block.
+ * @param n the number of cells along each axis
+ * @param cellBlockName the name of the cell block
+ * @return the InternalMesh XML block
+ */
+inline string internalMeshXML( localIndex const n, string const & cellBlockName )
+{
+  std::ostringstream os;
+  os << "  <Mesh>\n"
+     << "    <InternalMesh name=\"mesh\"\n"
+     << "                  elementTypes=\"{C3D8}\"\n"
+     << "                  xCoords=\"{0, " << n << "}\"\n"
+     << "                  yCoords=\"{0, " << n << "}\"\n"
+     << "                  zCoords=\"{0, " << n << "}\"\n"
+     << "                  nx=\"{" << n << "}\"\n"
+     << "                  ny=\"{" << n << "}\"\n"
+     << "                  nz=\"{" << n << "}\"\n"
+     << "                  cellBlockNames=\"{" << cellBlockName << "}\"/>\n"
+     << "  </Mesh>\n";
+  return os.str();
+}
+
+/**
+ * @brief Set up a problem from an XML string, up to and including the application of the initial conditions.
+ * @param problemManager the problem manager of the benchmark state
+ * @param xmlInput the input XML
+ */
+inline void setupProblemFromXML( ProblemManager & problemManager, string const & xmlInput )
+{
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( xmlInput.c_str(), xmlInput.size() );
+  GEOSX_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() << " at offset " << xmlResult.offset );
+
+  int const mpiSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
+
+  dataRepository::Group & commandLine =
+    problemManager.getGroup< dataRepository::Group >( problemManager.groupKeys.commandLine );
+
+  commandLine.registerWrapper< integer >( problemManager.viewKeys.xPartitionsOverride.key() ).
+    setApplyDefaultValue( mpiSize );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( dataRepository::keys::ProblemManager );
+  problemManager.processInputFileRecursive( xmlProblemNode );
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+
+  constitutive::ConstitutiveManager & constitutiveManager = domain.getConstitutiveManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( constitutiveManager.getName().c_str());
+  constitutiveManager.processInputFileRecursive( topLevelNode );
+
+  MeshManager & meshManager = problemManager.getGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager.generateMeshLevels( domain );
+
+  ElementRegionManager & elementManager = domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager();
+  topLevelNode = xmlProblemNode.child( elementManager.getName().c_str());
+  elementManager.processInputFileRecursive( topLevelNode );
+
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+}
+
+/**
+ * @brief Write a PVT/flash parameter file next to the benchmark executable.
+ * @param filename the name of the file
+ * @param content the content of the file
+ */
+inline void writeTableToFile( string const & filename, char const * const content )
+{
+  std::ofstream os( filename );
+  GEOSX_ERROR_IF( !os.is_open(), "Unable to open file " << filename );
+  os << content;
+}
+
+/**
+ * @brief Report the throughput of a benchmark, as a number of items processed per second.
+ * @param state the benchmark state
+ * @param name the name of the counter, e.g. "cells/s"
+ * @param itemsPerIteration the number of items processed by each iteration
+ */
+inline void setThroughput( ::benchmark::State & state, string const & name, localIndex const itemsPerIteration )
+{
+  state.counters[ name ] = ::benchmark::Counter( static_cast< double >( itemsPerIteration ),
+                                                 ::benchmark::Counter::kIsIterationInvariantRate );
+}
+
+/**
+ * @brief Initialize the benchmark library and GEOSX, run the benchmarks selected on the command line and clean up.
+ * @param argc the number of command line arguments
+ * @param argv the command line arguments
+ * @return the exit code
+ */
+inline int runBenchmarks( int argc, char * * argv )
+{
+  // the benchmark library removes its own arguments before GEOSX sees them
+  ::benchmark::Initialize( &argc, argv );
+  if( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+  {
+    return 1;
+  }
+
+  commandLineOptions() = *basicSetup( argc, argv );
+  ::benchmark::RunSpecifiedBenchmarks();
+  basicCleanup();
+  return 0;
+}
+
+} // namespace benchmarking
+
+} // namespace geosx
+
+#endif //GEOSX_BENCHMARKS_BENCHMARKUTILS_HPP_
@@ -113,15 +113,34 @@ bool MpiWrapper::initialized()
 #endif
 }
 
-int MpiWrapper::init( int * argc, char * * * argv )
+int MpiWrapper::init( int * argc, char * * * argv, bool const requestThreadMultiple )
 {
 #ifdef GEOSX_USE_MPI
+  if( requestThreadMultiple )
+  {
+    // full thread support may disable some fast paths of the MPI library, so it is only requested on demand.
+    // The library may provide a lower level, which is checked before using several threads.
+    int provided = MPI_THREAD_SINGLE;
+    return MPI_Init_thread( argc, argv, MPI_THREAD_MULTIPLE, &provided );
+  }
   return MPI_Init( argc, argv );
 #else
+  GEOSX_UNUSED_VAR( requestThreadMultiple );
   return 0;
 #endif
 }
 
+bool MpiWrapper::supportsThreadMultiple()
+{
+#ifdef GEOSX_USE_MPI
+  int provided = MPI_THREAD_SINGLE;
+  MPI_CHECK_ERROR( MPI_Query_thread( &provided ) );
+  return provided == MPI_THREAD_MULTIPLE;
+#else
+  return true;
+#endif
+}
+
 void MpiWrapper::finalize()
 {
 #ifdef GEOSX_USE_MPI
@@ -157,7 +157,20 @@ public:
 
   static bool initialized();
 
-  static int init( int * argc, char * * * argv );
+  /**
+   * @brief Initialize MPI.
+   * @param argc the number of command line arguments
+   * @param argv the command line arguments
+   * @param requestThreadMultiple whether to request MPI_THREAD_MULTIPLE instead of the default thread support level
+   * @return the MPI error code
+   */
+  static int init( int * argc, char * * * argv, bool const requestThreadMultiple = false );
+
+  /**
+   * @brief Check whether concurrent MPI calls from several threads are allowed.
+   * @return true if the provided thread support level is MPI_THREAD_MULTIPLE (always true without MPI).
+   */
+  static bool supportsThreadMultiple();
 
   static void finalize();
 
@@ -332,6 +345,24 @@ public:
                          int * displacements,
                          MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Alltoall.
+   * @tparam T_SEND The pointer type for \p sendbuf
+   * @tparam T_RECV The pointer type for \p recvbuf
+   * @param[in] sendbuf The pointer to the sending buffer, holding \p sendcount values for each rank.
+   * @param[in] sendcount The number of values to send to each rank.
+   * @param[out] recvbuf The pointer to the receive buffer, receiving \p recvcount values from each rank.
+   * @param[in] recvcount The number of values to receive from each rank.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoall().
+   */
+  template< typename T_SEND, typename T_RECV >
+  static int alltoall( T_SEND const * sendbuf,
+                       int sendcount,
+                       T_RECV * recvbuf,
+                       int recvcount,
+                       MPI_Comm comm );
+
   /**
    * @brief Convenience function for MPI_Allgather.
    * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
@@ -640,6 +671,26 @@ int MpiWrapper::allgatherv( T_SEND const * const sendbuf,
 #endif
 }
 
+template< typename T_SEND, typename T_RECV >
+int MpiWrapper::alltoall( T_SEND const * const sendbuf,
+                          int sendcount,
+                          T_RECV * const recvbuf,
+                          int recvcount,
+                          MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Alltoall( sendbuf, sendcount, internal::getMpiType< T_SEND >(),
+                       recvbuf, recvcount, internal::getMpiType< T_RECV >(),
+                       comm );
+#else
+  static_assert( std::is_same< T_SEND, T_RECV >::value,
+                 "MpiWrapper::alltoall() for serial run requires send and receive buffers are of the same type" );
+  GEOSX_ERROR_IF_NE_MSG( sendcount, recvcount, "sendcount is not equal to recvcount." );
+  std::copy( sendbuf, sendbuf + sendcount, recvbuf );
+  return 0;
+#endif
+}
+
 
 template< typename T >
 void MpiWrapper::allGather( T const myValue, array1d< T > & allValues, MPI_Comm MPI_PARAM( comm ) )
@@ -0,0 +1,431 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file TimerTree.cpp
+ */
+
+#include "TimerTree.hpp"
+
+#include "common/DataTypes.hpp"
+#include "common/Format.hpp"
+#include "common/Logger.hpp"
+#include "common/MpiWrapper.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace geosx
+{
+namespace timing
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct TimerNode
+{
+  TimerNode( string nodeName, TimerNode * const nodeParent ):
+    name( std::move( nodeName ) ),
+    parent( nodeParent )
+  {}
+
+  /**
+   * @brief Get the child region with a given name, creating it on first use.
+   * @param childName the name of the child region
+   * @return the child node
+   */
+  TimerNode & child( char const * const childName )
+  {
+    for( std::unique_ptr< TimerNode > const & node : children )
+    {
+      if( node->name == childName )
+      {
+        return *node;
+      }
+    }
+    children.emplace_back( std::make_unique< TimerNode >( childName, this ) );
+    return *children.back();
+  }
+
+  /// Name of the region
+  string const name;
+
+  /// The calling region, nullptr for the root of a tree
+  TimerNode * const parent;
+
+  /// The regions called from this one, in order of first call
+  std::vector< std::unique_ptr< TimerNode > > children;
+
+  /// Number of completed calls
+  real64 count = 0;
+
+  /// Inclusive time of the completed calls
+  Clock::duration inclusive = Clock::duration::zero();
+
+  /// Start of the current call
+  Clock::time_point start;
+};
+
+namespace internal
+{
+
+bool enabled = false;
+
+}
+
+namespace
+{
+
+/// The timers of one thread
+struct ThreadTree
+{
+  /// Root of the tree, holding the top-level regions
+  TimerNode root{ "", nullptr };
+
+  /// Region currently timed
+  TimerNode * current = &root;
+};
+
+/// File name the report is exported to, if any
+string jsonFileName;
+
+/// Mutex protecting the registration of the thread trees
+std::mutex threadTreesMutex;
+
+/**
+ * @brief Get the trees of all the threads that have been timed.
+ * @return the list of trees, which outlive their threads so that they can be reported
+ */
+std::vector< std::unique_ptr< ThreadTree > > & threadTrees()
+{
+  static std::vector< std::unique_ptr< ThreadTree > > trees;
+  return trees;
+}
+
+/**
+ * @brief Get the tree of the calling thread, registering it on first use.
+ * @return the tree of the calling thread
+ */
+ThreadTree & localTree()
+{
+  thread_local ThreadTree * tree = nullptr;
+  if( tree == nullptr )
+  {
+    std::lock_guard< std::mutex > lock( threadTreesMutex );
+    threadTrees().emplace_back( std::make_unique< ThreadTree >() );
+    tree = threadTrees().back().get();
+  }
+  return *tree;
+}
+
+/**
+ * @brief Add the timings of a tree into another one, matching the regions by calling context.
+ * @param src the tree to add
+ * @param dst the tree to add into
+ */
+void merge( TimerNode const & src, TimerNode & dst )
+{
+  dst.count += src.count;
+  dst.inclusive += src.inclusive;
+  for( std::unique_ptr< TimerNode > const & child : src.children )
+  {
+    merge( *child, dst.child( child->name.c_str() ) );
+  }
+}
+
+/**
+ * @brief Write the calling contexts of the regions of a tree, one per line with tab-separated names.
+ * @param node the root of the tree
+ * @param prefix the calling context of @p node
+ * @param os the stream to write to
+ */
+void writePaths( TimerNode const & node, string const & prefix, std::ostream & os )
+{
+  for( std::unique_ptr< TimerNode > const & child : node.children )
+  {
+    string const path = prefix.empty() ? child->name : prefix + '\t' + child->name;
+    os << path << '\n';
+    writePaths( *child, path, os );
+  }
+}
+
+/**
+ * @brief Create the regions listed by writePaths() in a tree.
+ * @param paths the calling contexts of the regions
+ * @param root the root of the tree
+ */
+void insertPaths( string const & paths, TimerNode & root )
+{
+  std::istringstream is( paths );
+  string path;
+  while( std::getline( is, path ) )
+  {
+    TimerNode * node = &root;
+    std::istringstream pathStream( path );
+    string name;
+    while( std::getline( pathStream, name, '\t' ) )
+    {
+      node = &node->child( name.c_str() );
+    }
+  }
+}
+
+/**
+ * @brief List the regions of a tree in depth-first order.
+ * @param node the root of the tree
+ * @param depth the depth of the children of @p node
+ * @param nodes the list of regions and depths to append to
+ */
+void flatten( TimerNode const & node, int const depth, std::vector< std::pair< TimerNode const *, int > > & nodes )
+{
+  for( std::unique_ptr< TimerNode > const & child : node.children )
+  {
+    nodes.emplace_back( child.get(), depth );
+    flatten( *child, depth + 1, nodes );
+  }
+}
+
+/// Number of statistics reduced per region: calls, inclusive and exclusive times
+constexpr int numValues = 3;
+
+/// Reduced statistics of all the regions, numValues per region in depth-first order
+struct Statistics
+{
+  /// Minimum across the ranks
+  std::vector< real64 > min;
+
+  /// Average across the ranks
+  std::vector< real64 > avg;
+
+  /// Maximum across the ranks
+  std::vector< real64 > max;
+};
+
+/**
+ * @brief Write the statistics of a value in JSON.
+ * @param os the stream to write to
+ * @param stats the reduced statistics
+ * @param index the index of the value in @p stats
+ */
+void writeJsonValue( std::ostream & os, Statistics const & stats, std::size_t const index )
+{
+  os << GEOSX_FMT( "{{ \"min\": {:.6e}, \"avg\": {:.6e}, \"max\": {:.6e} }}",
+                   stats.min[index], stats.avg[index], stats.max[index] );
+}
+
+/**
+ * @brief Write the regions of a tree in JSON, with the regions they call nested in them.
+ * @param os the stream to write to
+ * @param node the root of the tree
+ * @param stats the reduced statistics
+ * @param index the depth-first index of the next region
+ * @param indent the indentation of the children of @p node
+ */
+void writeJsonChildren( std::ostream & os, TimerNode const & node, Statistics const & stats, std::size_t & index, string const & indent )
+{
+  os << "[";
+  for( std::size_t i = 0; i < node.children.size(); ++i )
+  {
+    TimerNode const & child = *node.children[i];
+    std::size_t const k = numValues * index++;
+
+    string escapedName;
+    for( char const c : child.name )
+    {
+      if( c == '"' || c == '\\' )
+      {
+        escapedName += '\\';
+      }
+      escapedName += c;
+    }
+
+    os << ( i > 0 ? "," : "" ) << "\n" << indent << "{ \"name\": \"" << escapedName << "\",\n";
+    os << indent << "  \"calls\": ";
+    writeJsonValue( os, stats, k );
+    os << ",\n" << indent << "  \"inclusive\": ";
+    writeJsonValue( os, stats, k + 1 );
+    os << ",\n" << indent << "  \"exclusive\": ";
+    writeJsonValue( os, stats, k + 2 );
+    os << ",\n" << indent << "  \"children\": ";
+    writeJsonChildren( os, child, stats, index, indent + "    " );
+    os << " }";
+  }
+  os << ( node.children.empty() ? "]" : "\n" + indent.substr( 2 ) + "]" );
+}
+
+} // namespace
+
+namespace internal
+{
+
+TimerNode * begin( char const * const name )
+{
+  ThreadTree & tree = localTree();
+  TimerNode & node = tree.current->child( name );
+  tree.current = &node;
+  node.start = Clock::now();
+  return &node;
+}
+
+TimerNode * begin( char const * const name, CallSite & site )
+{
+  ThreadTree & tree = localTree();
+  if( site.parent != tree.current )
+  {
+    site.parent = tree.current;
+    site.node = &tree.current->child( name );
+  }
+  TimerNode & node = *site.node;
+  tree.current = &node;
+  node.start = Clock::now();
+  return &node;
+}
+
+void end( TimerNode * const node )
+{
+  node->inclusive += Clock::now() - node->start;
+  node->count += 1;
+  localTree().current = node->parent;
+}
+
+void end( char const * const name )
+{
+  TimerNode * const node = localTree().current;
+  GEOSX_ERROR_IF( node->parent == nullptr || node->name != name,
+                  "Timer region " << name << " ended while " << ( node->parent == nullptr ? "no region" : node->name ) << " is open" );
+  end( node );
+}
+
+} // namespace internal
+
+void setup( string const & output )
+{
+  internal::enabled = !output.empty();
+  string const extension = ".json";
+  if( output.size() > extension.size() && output.compare( output.size() - extension.size(), extension.size(), extension ) == 0 )
+  {
+    jsonFileName = output;
+  }
+}
+
+void report()
+{
+  if( !internal::enabled )
+  {
+    return;
+  }
+
+  // Merge the trees of the threads of this rank.
+  // The regions that are still open only contribute their completed calls.
+  TimerNode local( "", nullptr );
+  for( std::unique_ptr< ThreadTree > const & tree : threadTrees() )
+  {
+    merge( tree->root, local );
+  }
+
+  // Build the union of the regions of all the ranks, so that they all reduce the same regions in the same order
+  std::ostringstream pathStream;
+  writePaths( local, "", pathStream );
+  string const paths = pathStream.str();
+
+  localIndex const maxSize = MpiWrapper::max( LvArray::integerConversion< localIndex >( paths.size() ) ) + 1;
+  array1d< char > sendBuffer( maxSize );
+  std::copy( paths.begin(), paths.end(), sendBuffer.begin() );
+  array1d< char > recvBuffer;
+  MpiWrapper::allGather( sendBuffer.toViewConst(), recvBuffer );
+
+  TimerNode all( "", nullptr );
+  for( localIndex rank = 0; rank < recvBuffer.size() / maxSize; ++rank )
+  {
+    insertPaths( string( recvBuffer.data() + rank * maxSize ), all );
+  }
+  merge( local, all );
+
+  std::vector< std::pair< TimerNode const *, int > > nodes;
+  flatten( all, 0, nodes );
+
+  std::size_t const size = numValues * nodes.size();
+  std::vector< real64 > values( size );
+  for( std::size_t i = 0; i < nodes.size(); ++i )
+  {
+    TimerNode const & node = *nodes[i].first;
+    Clock::duration exclusive = node.inclusive;
+    for( std::unique_ptr< TimerNode > const & child : node.children )
+    {
+      exclusive -= child->inclusive;
+    }
+    values[numValues * i] = node.count;
+    values[numValues * i + 1] = std::chrono::duration< real64 >( node.inclusive ).count();
+    values[numValues * i + 2] = std::chrono::duration< real64 >( exclusive ).count();
+  }
+
+  Statistics stats;
+  stats.min.resize( size );
+  stats.avg.resize( size );
+  stats.max.resize( size );
+  int const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( values.data(), stats.min.data(), LvArray::integerConversion< int >( size ), MPI_MIN, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( values.data(), stats.max.data(), LvArray::integerConversion< int >( size ), MPI_MAX, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( values.data(), stats.avg.data(), LvArray::integerConversion< int >( size ), MPI_SUM, MPI_COMM_GEOSX );
+  for( real64 & value : stats.avg )
+  {
+    value /= numRanks;
+  }
+
+  if( MpiWrapper::commRank( MPI_COMM_GEOSX ) != 0 )
+  {
+    return;
+  }
+
+  std::size_t nameWidth = 6;
+  for( std::pair< TimerNode const *, int > const & node : nodes )
+  {
+    nameWidth = std::max( nameWidth, 2 * node.second + node.first->name.size() );
+  }
+
+  GEOSX_LOG( GEOSX_FMT( "Timers on {} ranks (times in seconds, min / avg / max across ranks):", numRanks ) );
+  GEOSX_LOG( GEOSX_FMT( "{:<{}} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}",
+                        "Region", nameWidth, "calls(max)", "incl min", "incl avg", "incl max", "excl min", "excl avg", "excl max" ) );
+  for( std::size_t i = 0; i < nodes.size(); ++i )
+  {
+    std::size_t const k = numValues * i;
+    GEOSX_LOG( GEOSX_FMT( "{:<{}} {:>10} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f}",
+                          string( 2 * nodes[i].second, ' ' ) + nodes[i].first->name, nameWidth,
+                          static_cast< long long >( stats.max[k] ),
+                          stats.min[k + 1], stats.avg[k + 1], stats.max[k + 1],
+                          stats.min[k + 2], stats.avg[k + 2], stats.max[k + 2] ) );
+  }
+
+  if( !jsonFileName.empty() )
+  {
+    std::ofstream os( jsonFileName );
+    GEOSX_WARNING_IF( !os, "Could not open " << jsonFileName << " to export the timers" );
+    if( os )
+    {
+      std::size_t index = 0;
+      os << "{ \"numRanks\": " << numRanks << ",\n  \"timers\": ";
+      writeJsonChildren( os, all, stats, index, "    " );
+      os << " }\n";
+      GEOSX_LOG( "Timers exported to " << jsonFileName );
+    }
+  }
+}
+
+} // namespace timing
+} // namespace geosx
@@ -0,0 +1,164 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file TimerTree.hpp
+ *
+ * Lightweight hierarchical timers used by the timing macros when GEOSX is built without Caliper.
+ */
+
+#ifndef GEOSX_COMMON_TIMERTREE_HPP_
+#define GEOSX_COMMON_TIMERTREE_HPP_
+
+#include <string>
+
+namespace geosx
+{
+namespace timing
+{
+
+/// A node of the timer tree of a thread: one timed region in one calling context.
+struct TimerNode;
+
+/**
+ * @struct CallSite
+ * @brief Cache of the node of a timed call site, so that it is only looked up by name
+ *        when the call site is reached from a new calling context.
+ * @note Each thread has its own timer tree, hence the call sites must be thread-local.
+ */
+struct CallSite
+{
+  /// The region that was timed when the call site was last reached
+  TimerNode * parent = nullptr;
+
+  /// The node of the call site in that region
+  TimerNode * node = nullptr;
+};
+
+namespace internal
+{
+
+/// True iff the timers are recording. Only set at startup, before any thread is spawned.
+extern bool enabled;
+
+/**
+ * @brief Start timing a region, as a child of the region currently timed by the calling thread.
+ * @param name the name of the region
+ * @return the node of the region
+ */
+TimerNode * begin( char const * name );
+
+/**
+ * @brief Start timing the region of a call site, as a child of the region currently timed by the calling thread.
+ * @param name the name of the region
+ * @param site the cache of the call site
+ * @return the node of the region
+ */
+TimerNode * begin( char const * name, CallSite & site );
+
+/**
+ * @brief Stop timing a region.
+ * @param node the node returned by the matching call to begin()
+ */
+void end( TimerNode * const node );
+
+/**
+ * @brief Stop timing the region currently timed by the calling thread.
+ * @param name the name of the region, which must match the current region
+ */
+void end( char const * name );
+
+}
+
+/**
+ * @brief Enable the timers.
+ * @param output the timer output requested on the command line: any non-empty value enables
+ *               the timers, and a value ending with ".json" also names the file the report is exported to
+ */
+void setup( std::string const & output );
+
+/**
+ * @brief Reduce the timers across the ranks, log the report on rank 0 and export it if requested.
+ * @note This is a collective operation, which does nothing if the timers are not enabled.
+ */
+void report();
+
+/**
+ * @brief Start timing a region, to be closed by end() in the same scope.
+ * @param name the name of the region
+ */
+inline void begin( char const * name )
+{
+  if( internal::enabled )
+  {
+    internal::begin( name );
+  }
+}
+
+/**
+ * @brief Stop timing a region opened by begin().
+ * @param name the name of the region
+ */
+inline void end( char const * name )
+{
+  if( internal::enabled )
+  {
+    internal::end( name );
+  }
+}
+
+/**
+ * @class ScopedTimer
+ * @brief Times the enclosing scope. Costs a single branch when the timers are disabled.
+ */
+class ScopedTimer
+{
+public:
+
+  /**
+   * @brief Start timing the region of a call site.
+   * @param name the name of the region
+   * @param site the thread-local cache of the call site
+   */
+  ScopedTimer( char const * name, CallSite & site ):
+    m_node( internal::enabled ? internal::begin( name, site ) : nullptr )
+  {}
+
+  /**
+   * @brief Stop timing the region.
+   */
+  ~ScopedTimer()
+  {
+    if( m_node != nullptr )
+    {
+      internal::end( m_node );
+    }
+  }
+
+  /// Deleted copy constructor.
+  ScopedTimer( ScopedTimer const & ) = delete;
+
+  /// Deleted copy assignment.
+  ScopedTimer & operator=( ScopedTimer const & ) = delete;
+
+private:
+
+  /// The node of the timed region, or nullptr if the timers are disabled
+  TimerNode * const m_node;
+};
+
+} // namespace timing
+} // namespace geosx
+
+#endif // GEOSX_COMMON_TIMERTREE_HPP_
@@ -19,7 +19,8 @@
 /**
  * @file TimingMacros.hpp
  *
- * A collection of timing-related macros that wrap Caliper.
+ * A collection of timing-related macros that wrap Caliper, or the built-in timers of TimerTree.hpp
+ * when GEOSX is built without Caliper.
  */
 
 #ifndef GEOSX_COMMON_TIMINGMACROS_HPP_
@@ -28,11 +29,8 @@
 #include "common/GeosxConfig.hpp"
 #include "GeosxMacros.hpp"
 
-#ifdef GEOSX_USE_CALIPER
-#include <caliper/cali.h>
-#include <sys/time.h>
+#include <chrono>
 #include <string>
-#include <iostream>
 
 namespace timingHelpers
 {
@@ -45,6 +43,10 @@ namespace timingHelpers
   }
 }
 
+#ifdef GEOSX_USE_CALIPER
+#include <caliper/cali.h>
+#include <iostream>
+
 /// Mark a function or scope for timing with a given name
 #define GEOSX_MARK_SCOPE(name) cali::Function __cali_ann##__LINE__(STRINGIZE_NX(name))
 
@@ -65,30 +67,37 @@ namespace timingHelpers
 
 #else // GEOSX_USE_CALIPER
 
-/// @cond DO_NOT_DOCUMENT
-#define GEOSX_MARK_SCOPE(name)
-#define GEOSX_MARK_FUNCTION_SCOPED
-#define GEOSX_MARK_FUNCTION
+#include "common/TimerTree.hpp"
 
-#define GEOSX_MARK_BEGIN(name)
-#define GEOSX_MARK_END(name)
+/// Mark a function or scope for timing with a given name
+#define GEOSX_MARK_SCOPE(name) \
+  static thread_local geosx::timing::CallSite GEOSX_CONCAT(__geosx_timer_site, __LINE__); \
+  geosx::timing::ScopedTimer const GEOSX_CONCAT(__geosx_timer, __LINE__)(STRINGIZE_NX(name), GEOSX_CONCAT(__geosx_timer_site, __LINE__))
 
-#define GEOSX_MARK_FUNCTION_BEGIN
-#define GEOSX_MARK_FUNCTION_END
-/// @endcond
+/// Mark a function for timing using a compiler-provided name
+#define GEOSX_MARK_FUNCTION \
+  static std::string const __geosx_timer_name = timingHelpers::stripPF(__PRETTY_FUNCTION__); \
+  static thread_local geosx::timing::CallSite __geosx_timer_site; \
+  geosx::timing::ScopedTimer const __geosx_timer(__geosx_timer_name.c_str(), __geosx_timer_site)
+
+/// Mark the beginning of timed statement group
+#define GEOSX_MARK_BEGIN(name) geosx::timing::begin(STRINGIZE(name))
+
+/// Mark the end of timed statements group
+#define GEOSX_MARK_END(name) geosx::timing::end(STRINGIZE(name))
+
+/// Mark the beginning of function, only useful when you don't want to or can't mark the whole function.
+#define GEOSX_MARK_FUNCTION_BEGIN geosx::timing::begin(__func__)
+
+/// Mark the end of function, only useful when you don't want to or can't mark the whole function.
+#define GEOSX_MARK_FUNCTION_END geosx::timing::end(__func__)
 
 #endif // GEOSX_USE_CALIPER
 
-/// Get current time of day as a floating point number of seconds in a variable @p time.
+/// Get the current time of a monotonic clock as a floating point number of seconds in a variable @p time.
 #ifdef GEOSX_USE_TIMERS
 #define GEOSX_GET_TIME( time )                                                 \
-  real64 time;                                                                 \
-  do                                                                           \
-  {                                                                            \
-    timeval tim;                                                               \
-    gettimeofday(&tim, nullptr);                                               \
-    time = tim.tv_sec + (tim.tv_usec / 1000000.0);                             \
-  } while (false)
+  real64 time = std::chrono::duration< real64 >( std::chrono::steady_clock::now().time_since_epoch() ).count()
 #else
 #define GEOSX_GET_TIME( time )
 #endif
@@ -27,6 +27,8 @@
 #endif
 
 // System includes
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 
 #if defined( GEOSX_USE_MKL )
@@ -109,7 +111,12 @@ void setupMPI( int argc, char * argv[] )
 {
   if( !MpiWrapper::initialized() )
   {
-    MpiWrapper::init( &argc, &argv );
+    // MPI must be initialized before the command line is parsed, so the thread support option is looked up directly
+    bool const requestThreadMultiple = std::any_of( argv, argv + argc, []( char const * const arg )
+    {
+      return std::strcmp( arg, "--mpi-thread-multiple" ) == 0;
+    } );
+    MpiWrapper::init( &argc, &argv, requestThreadMultiple );
   }
 
   MPI_COMM_GEOSX = MpiWrapper::commDup( MPI_COMM_WORLD );
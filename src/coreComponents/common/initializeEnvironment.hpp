@@ -82,6 +82,12 @@ struct CommandLineOptions
 
   /// Suppress logging of host-device data migration.
   integer suppressMoveLogging = false;
+
+  /// The number of realizations of the problem run in sequence on the same mesh.
+  integer numRealizations = 1;
+
+  /// The CSV file receiving the per-neighbor communication profile, profiling is disabled if empty.
+  string communicationProfile;
 };
 
 /**
@@ -116,7 +122,7 @@ void setupMKL();
 void setupOpenMP();
 
 /**
- * @brief Setup MPI.
+ * @brief Setup MPI, with MPI_THREAD_MULTIPLE if the command line contains --mpi-thread-multiple.
  * @param [in] argc the number of command line arguments.
  * @param [in,out] argv the command line arguments.
  */
@@ -0,0 +1,145 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/TimerTree.hpp"
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/initializeEnvironment.hpp"
+
+#include <conduit.hpp>
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+using namespace geosx;
+
+/**
+ * @brief Check the statistics of a value exported by the timers.
+ * @param value the exported statistics
+ * @param min the expected minimum across the ranks
+ * @param avg the expected average across the ranks
+ * @param max the expected maximum across the ranks
+ */
+void checkStatistics( conduit::Node const & value, real64 const min, real64 const avg, real64 const max )
+{
+  real64 const relTol = 1e-6;
+  EXPECT_NEAR( value["min"].to_float64(), min, relTol * min );
+  EXPECT_NEAR( value["avg"].to_float64(), avg, relTol * avg );
+  EXPECT_NEAR( value["max"].to_float64(), max, relTol * max );
+}
+
+/**
+ * @brief Check that the min, avg and max of an exported time are ordered.
+ * @param value the exported statistics
+ */
+void checkTimeOrdering( conduit::Node const & value )
+{
+  EXPECT_LE( 0.0, value["min"].to_float64() );
+  EXPECT_LE( value["min"].to_float64(), value["avg"].to_float64() );
+  EXPECT_LE( value["avg"].to_float64(), value["max"].to_float64() );
+}
+
+TEST( TimerTree, nestingReductionAndJsonExport )
+{
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  int const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+
+  string const fileName = "testTimerTree.json";
+  timing::setup( fileName );
+
+  // the inner region is called a number of times that depends on the rank
+  for( int i = 0; i < 2; ++i )
+  {
+    timing::begin( "outer" );
+    for( int j = 0; j <= rank; ++j )
+    {
+      timing::begin( "inner" );
+      timing::end( "inner" );
+    }
+    timing::end( "outer" );
+  }
+
+  // the same name in another calling context is another region
+  {
+    static thread_local timing::CallSite site;
+    timing::ScopedTimer const timer( "inner", site );
+  }
+
+  // a region timed on a single rank is reduced with zero calls on the others
+  if( rank == 0 )
+  {
+    timing::begin( "rootOnly" );
+    timing::end( "rootOnly" );
+  }
+
+  timing::report();
+
+  if( rank != 0 )
+  {
+    return;
+  }
+
+  std::ifstream is( fileName );
+  ASSERT_TRUE( is.good() );
+  std::stringstream json;
+  json << is.rdbuf();
+
+  conduit::Node root;
+  conduit::Generator( json.str(), "json" ).walk( root );
+  EXPECT_EQ( root["numRanks"].to_int64(), numRanks );
+
+  conduit::Node const & timers = root["timers"];
+  ASSERT_EQ( timers.number_of_children(), 3 );
+
+  conduit::Node const & outer = timers.child( 0 );
+  EXPECT_EQ( outer["name"].as_string(), "outer" );
+  checkStatistics( outer["calls"], 2, 2, 2 );
+  checkTimeOrdering( outer["inclusive"] );
+  checkTimeOrdering( outer["exclusive"] );
+  EXPECT_LE( outer["exclusive"]["max"].to_float64(), outer["inclusive"]["max"].to_float64() );
+
+  ASSERT_EQ( outer["children"].number_of_children(), 1 );
+  conduit::Node const & nestedInner = outer["children"].child( 0 );
+  EXPECT_EQ( nestedInner["name"].as_string(), "inner" );
+  checkStatistics( nestedInner["calls"], 2, numRanks + 1, 2 * numRanks );
+  checkTimeOrdering( nestedInner["inclusive"] );
+  EXPECT_EQ( nestedInner["children"].number_of_children(), 0 );
+
+  if( numRanks == 1 )
+  {
+    // the exclusive time of a region is its inclusive time minus the inclusive times of its children
+    real64 const inclusive = outer["inclusive"]["max"].to_float64();
+    real64 const childInclusive = nestedInner["inclusive"]["max"].to_float64();
+    EXPECT_NEAR( outer["exclusive"]["max"].to_float64(), inclusive - childInclusive, 1e-5 * inclusive );
+  }
+
+  conduit::Node const & topInner = timers.child( 1 );
+  EXPECT_EQ( topInner["name"].as_string(), "inner" );
+  checkStatistics( topInner["calls"], 1, 1, 1 );
+  EXPECT_EQ( topInner["children"].number_of_children(), 0 );
+
+  conduit::Node const & rootOnly = timers.child( 2 );
+  EXPECT_EQ( rootOnly["name"].as_string(), "rootOnly" );
+  checkStatistics( rootOnly["calls"], numRanks > 1 ? 0.0 : 1.0, 1.0 / numRanks, 1 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  setupMPI( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  finalizeMPI();
+  return result;
+}
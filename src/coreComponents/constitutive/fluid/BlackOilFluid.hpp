@@ -127,14 +127,14 @@ private:
                    BlackOilFluidBase::WaterParams const waterParams,
                    arrayView1d< real64 const > componentMolarWeight,
                    bool const useMass,
-                   PhaseProp::ViewType phaseFraction,
-                   PhaseProp::ViewType phaseDensity,
-                   PhaseProp::ViewType phaseMassDensity,
-                   PhaseProp::ViewType phaseViscosity,
-                   PhaseProp::ViewType phaseEnthalpy,
-                   PhaseProp::ViewType phaseInternalEnergy,
-                   PhaseComp::ViewType phaseCompFraction,
-                   FluidProp::ViewType totalDensity );
+                   PhasePropStorage::ViewType phaseFraction,
+                   PhasePropStorage::ViewType phaseDensity,
+                   PhasePropStorage::ViewType phaseMassDensity,
+                   PhasePropStorage::ViewType phaseViscosity,
+                   PhasePropStorage::ViewType phaseEnthalpy,
+                   PhasePropStorage::ViewType phaseInternalEnergy,
+                   PhaseCompStorage::ViewType phaseCompFraction,
+                   FluidPropStorage::ViewType totalDensity );
 
     /**
      * @brief Utility function computing mass/molar densities and viscosity (no derivatives)
@@ -1106,17 +1106,13 @@ BlackOilFluid::KernelWrapper::
           real64 const temperature,
           arraySlice1d< geosx::real64 const, compflow::USD_COMP - 1 > const & composition ) const
 {
-  compute( pressure,
-           temperature,
-           composition,
-           m_phaseFraction( k, q ),
-           m_phaseDensity( k, q ),
-           m_phaseMassDensity( k, q ),
-           m_phaseViscosity( k, q ),
-           m_phaseEnthalpy( k, q ),
-           m_phaseInternalEnergy( k, q ),
-           m_phaseCompFraction( k, q ),
-           m_totalDensity( k, q ) );
+  computeInStorage< NC_BO, NP_BO >( k, q, [&]( auto const & ... props )
+  {
+    this->compute( pressure,
+                   temperature,
+                   composition,
+                   props ... );
+  } );
 }
 
 } // namespace constitutive
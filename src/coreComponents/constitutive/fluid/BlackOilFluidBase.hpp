@@ -94,14 +94,14 @@ protected:
                    WaterParams const waterParams,
                    arrayView1d< real64 const > componentMolarWeight,
                    bool const useMass,
-                   PhaseProp::ViewType phaseFraction,
-                   PhaseProp::ViewType phaseDensity,
-                   PhaseProp::ViewType phaseMassDensity,
-                   PhaseProp::ViewType phaseViscosity,
-                   PhaseProp::ViewType phaseEnthalpy,
-                   PhaseProp::ViewType phaseInternalEnergy,
-                   PhaseComp::ViewType phaseCompFraction,
-                   FluidProp::ViewType totalDensity );
+                   PhasePropStorage::ViewType phaseFraction,
+                   PhasePropStorage::ViewType phaseDensity,
+                   PhasePropStorage::ViewType phaseMassDensity,
+                   PhasePropStorage::ViewType phaseViscosity,
+                   PhasePropStorage::ViewType phaseEnthalpy,
+                   PhasePropStorage::ViewType phaseInternalEnergy,
+                   PhaseCompStorage::ViewType phaseCompFraction,
+                   FluidPropStorage::ViewType totalDensity );
 
     /// Phase ordering info
     arrayView1d< integer const > m_phaseTypes;
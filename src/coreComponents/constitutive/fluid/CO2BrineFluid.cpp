@@ -304,6 +304,23 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
   GEOSX_THROW_IF( m_flash == nullptr,
                   GEOSX_FMT( "{}: flash model {} not found in input files", getFullName(), FLASH::catalogName() ),
                   InputError );
+
+  // 3) Pack the tables of (P,T) of the flash and phase models sharing the same axes, to interpolate them together
+  std::vector< TableFunction const * > const ptTables = { m_flash->pressureTemperatureTable(),
+                                                          m_phase1->density.pressureTemperatureTable(),
+                                                          m_phase2->density.pressureTemperatureTable(),
+                                                          m_phase1->viscosity.pressureTemperatureTable(),
+                                                          m_phase2->viscosity.pressureTemperatureTable(),
+                                                          m_phase1->enthalpy.pressureTemperatureTable(),
+                                                          m_phase2->enthalpy.pressureTemperatureTable() };
+  m_ptTable = std::make_unique< PVTProps::MultiPropertyTable >( ptTables );
+  m_ptTableColumns.flash = m_ptTable->column( ptTables[0] );
+  for( integer ip = 0; ip < 2; ++ip )
+  {
+    m_ptTableColumns.phaseDensity[ip] = m_ptTable->column( ptTables[1+ip] );
+    m_ptTableColumns.phaseViscosity[ip] = m_ptTable->column( ptTables[3+ip] );
+    m_ptTableColumns.phaseEnthalpy[ip] = m_ptTable->column( ptTables[5+ip] );
+  }
 }
 
 template< typename PHASE1, typename PHASE2, typename FLASH >
@@ -315,6 +332,8 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::createKernelWrapper()
                         *m_phase1,
                         *m_phase2,
                         *m_flash,
+                        *m_ptTable,
+                        m_ptTableColumns,
                         m_componentMolarWeight.toViewConst(),
                         m_useMass,
                         m_phaseFraction.toView(),
@@ -334,16 +353,18 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
                  PHASE1 const & phase1,
                  PHASE2 const & phase2,
                  FLASH const & flash,
+                 PVTProps::MultiPropertyTable const & ptTable,
+                 PTTableColumns const & ptTableColumns,
                  arrayView1d< geosx::real64 const > componentMolarWeight,
                  bool const useMass,
-                 PhaseProp::ViewType phaseFraction,
-                 PhaseProp::ViewType phaseDensity,
-                 PhaseProp::ViewType phaseMassDensity,
-                 PhaseProp::ViewType phaseViscosity,
-                 PhaseProp::ViewType phaseEnthalpy,
-                 PhaseProp::ViewType phaseInternalEnergy,
-                 PhaseComp::ViewType phaseCompFraction,
-                 FluidProp::ViewType totalDensity )
+                 PhasePropStorage::ViewType phaseFraction,
+                 PhasePropStorage::ViewType phaseDensity,
+                 PhasePropStorage::ViewType phaseMassDensity,
+                 PhasePropStorage::ViewType phaseViscosity,
+                 PhasePropStorage::ViewType phaseEnthalpy,
+                 PhasePropStorage::ViewType phaseInternalEnergy,
+                 PhaseCompStorage::ViewType phaseCompFraction,
+                 FluidPropStorage::ViewType totalDensity )
   : MultiFluidBase::KernelWrapper( std::move( componentMolarWeight ),
                                    useMass,
                                    std::move( phaseFraction ),
@@ -358,7 +379,9 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
   m_p2Index( p2Index ),
   m_phase1( phase1.createKernelWrapper() ),
   m_phase2( phase2.createKernelWrapper() ),
-  m_flash( flash.createKernelWrapper() )
+  m_flash( flash.createKernelWrapper() ),
+  m_ptTable( ptTable.createKernelWrapper() ),
+  m_ptTableColumns( ptTableColumns )
 {}
 
 // explicit instantiation of the model template; unfortunately we can't use the aliases for this
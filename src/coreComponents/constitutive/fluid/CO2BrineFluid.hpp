@@ -31,6 +31,7 @@
 #include "constitutive/fluid/PVTFunctions/EzrokhiBrineDensity.hpp"
 #include "constitutive/fluid/PVTFunctions/EzrokhiBrineViscosity.hpp"
 #include "constitutive/fluid/PVTFunctions/FenghourCO2Viscosity.hpp"
+#include "constitutive/fluid/PVTFunctions/MultiPropertyTable.hpp"
 #include "constitutive/fluid/PVTFunctions/NoOpPVTFunction.hpp"
 #include "constitutive/fluid/PVTFunctions/PhillipsBrineDensity.hpp"
 #include "constitutive/fluid/PVTFunctions/PhillipsBrineViscosity.hpp"
@@ -65,6 +66,25 @@ public:
 
   virtual bool isThermal() const override;
 
+  /**
+   * @brief Columns of the tables of (P,T) of the submodels in the MultiPropertyTable, or -1 for the tables interpolated on their own.
+   *        The phase models are indexed by 0 for PHASE1 and 1 for PHASE2.
+   */
+  struct PTTableColumns
+  {
+    /// Column of the table of the flash model
+    integer flash;
+
+    /// Columns of the tables of the density models
+    integer phaseDensity[2];
+
+    /// Columns of the tables of the viscosity models
+    integer phaseViscosity[2];
+
+    /// Columns of the tables of the enthalpy models
+    integer phaseEnthalpy[2];
+  };
+
   /**
    * @brief Kernel wrapper class for CO2BrineFluid.
    */
@@ -114,16 +134,18 @@ private:
                    PHASE1 const & phase1,
                    PHASE2 const & phase2,
                    FLASH const & flash,
+                   PVTProps::MultiPropertyTable const & ptTable,
+                   PTTableColumns const & ptTableColumns,
                    arrayView1d< real64 const > componentMolarWeight,
                    bool const useMass,
-                   PhaseProp::ViewType phaseFraction,
-                   PhaseProp::ViewType phaseDensity,
-                   PhaseProp::ViewType phaseMassDensity,
-                   PhaseProp::ViewType phaseViscosity,
-                   PhaseProp::ViewType phaseEnthalpy,
-                   PhaseProp::ViewType phaseInternalEnergy,
-                   PhaseComp::ViewType phaseCompFraction,
-                   FluidProp::ViewType totalDensity );
+                   PhasePropStorage::ViewType phaseFraction,
+                   PhasePropStorage::ViewType phaseDensity,
+                   PhasePropStorage::ViewType phaseMassDensity,
+                   PhasePropStorage::ViewType phaseViscosity,
+                   PhasePropStorage::ViewType phaseEnthalpy,
+                   PhasePropStorage::ViewType phaseInternalEnergy,
+                   PhaseCompStorage::ViewType phaseCompFraction,
+                   FluidPropStorage::ViewType totalDensity );
 
     /// Index of the liquid phase
     integer m_p1Index;
@@ -140,6 +162,12 @@ private:
 
     // Flash kernel wrapper
     typename FLASH::KernelWrapper m_flash;
+
+    /// Kernel wrapper of the tables of (P,T) of the submodels, interpolated together
+    PVTProps::MultiPropertyTable::KernelWrapper m_ptTable;
+
+    /// Columns of the tables of (P,T) of the submodels
+    PTTableColumns m_ptTableColumns;
   };
 
   virtual integer getWaterPhaseIndex() const override final;
@@ -197,6 +225,12 @@ private:
   // Flash model
   std::unique_ptr< FLASH > m_flash;
 
+  /// Tables of (P,T) of the flash and phase models, interpolated together
+  std::unique_ptr< PVTProps::MultiPropertyTable > m_ptTable;
+
+  /// Columns of the tables of (P,T) of the flash and phase models
+  PTTableColumns m_ptTableColumns;
+
 };
 
 // these aliases are useful in constitutive dispatch
@@ -256,91 +290,104 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
     }
   }
 
-  // 2. Compute phase fractions and phase component fractions
+  // 2. Interpolate the tables of (P,T) of the submodels together, then compute phase fractions and phase component fractions
 
   real64 const temperatureInCelsius = temperature - 273.15;
-  m_flash.compute( pressure,
-                   temperatureInCelsius,
-                   compMoleFrac.toSliceConst(),
-                   phaseFraction,
-                   phaseCompFraction );
-
-  // 3. Compute phase densities and phase viscosities
-
-  m_phase1.density.compute( pressure,
-                            temperatureInCelsius,
-                            phaseCompFraction[ip1].toSliceConst(),
-                            phaseDensity[ip1],
-                            m_useMass );
-  m_phase1.viscosity.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction[ip1].toSliceConst(),
-                              phaseViscosity[ip1],
-                              m_useMass );
-
-  m_phase2.density.compute( pressure,
-                            temperatureInCelsius,
-                            phaseCompFraction[ip2].toSliceConst(),
-                            phaseDensity[ip2],
-                            m_useMass );
-  m_phase2.viscosity.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction[ip2].toSliceConst(),
-                              phaseViscosity[ip2],
-                              m_useMass );
+  PVTProps::PTTableValue ptTableValues[PVTProps::MultiPropertyTable::maxNumProperties];
+  m_ptTable.compute( pressure, temperatureInCelsius, ptTableValues );
+
+  PVTProps::PTTableDispatch< FLASH::KernelWrapper::hasPTTable >::call( m_ptTableColumns.flash, ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_flash.compute( tableValue ...,
+                     pressure,
+                     temperatureInCelsius,
+                     compMoleFrac.toSliceConst(),
+                     phaseFraction,
+                     phaseCompFraction );
+  } );
+
+  // 3. Compute phase molar and mass densities (in one table lookup) and phase viscosities
+
+  PVTProps::PTTableDispatch< PHASE1::Density::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseDensity[0], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase1.density.computeMolarAndMass( tableValue ...,
+                                          pressure,
+                                          temperatureInCelsius,
+                                          phaseCompFraction[ip1].toSliceConst(),
+                                          phaseDensity[ip1],
+                                          phaseMassDensity[ip1] );
+  } );
+  PVTProps::PTTableDispatch< PHASE1::Viscosity::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseViscosity[0], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase1.viscosity.compute( tableValue ...,
+                                pressure,
+                                temperatureInCelsius,
+                                phaseCompFraction[ip1].toSliceConst(),
+                                phaseViscosity[ip1],
+                                m_useMass );
+  } );
+
+  PVTProps::PTTableDispatch< PHASE2::Density::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseDensity[1], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase2.density.computeMolarAndMass( tableValue ...,
+                                          pressure,
+                                          temperatureInCelsius,
+                                          phaseCompFraction[ip2].toSliceConst(),
+                                          phaseDensity[ip2],
+                                          phaseMassDensity[ip2] );
+  } );
+  PVTProps::PTTableDispatch< PHASE2::Viscosity::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseViscosity[1], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase2.viscosity.compute( tableValue ...,
+                                pressure,
+                                temperatureInCelsius,
+                                phaseCompFraction[ip2].toSliceConst(),
+                                phaseViscosity[ip2],
+                                m_useMass );
+  } );
 
   // 4. Compute enthalpy and internal energy
 
-  m_phase1.enthalpy.compute( pressure,
-                             temperatureInCelsius,
-                             phaseCompFraction[ip1].toSliceConst(),
-                             phaseEnthalpy[ip1],
-                             m_useMass );
+  PVTProps::PTTableDispatch< PHASE1::Enthalpy::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseEnthalpy[0], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase1.enthalpy.compute( tableValue ...,
+                               pressure,
+                               temperatureInCelsius,
+                               phaseCompFraction[ip1].toSliceConst(),
+                               phaseEnthalpy[ip1],
+                               m_useMass );
+  } );
   m_phase1.internalEnergy.compute( pressure,
                                    temperatureInCelsius,
                                    phaseCompFraction[ip1].toSliceConst(),
                                    phaseInternalEnergy[ip1],
                                    m_useMass );
 
-  m_phase2.enthalpy.compute( pressure,
-                             temperatureInCelsius,
-                             phaseCompFraction[ip2].toSliceConst(),
-                             phaseEnthalpy[ip2],
-                             m_useMass );
+  PVTProps::PTTableDispatch< PHASE2::Enthalpy::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseEnthalpy[1], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase2.enthalpy.compute( tableValue ...,
+                               pressure,
+                               temperatureInCelsius,
+                               phaseCompFraction[ip2].toSliceConst(),
+                               phaseEnthalpy[ip2],
+                               m_useMass );
+  } );
   m_phase2.internalEnergy.compute( pressure,
                                    temperatureInCelsius,
                                    phaseCompFraction[ip2].toSliceConst(),
                                    phaseInternalEnergy[ip2],
                                    m_useMass );
 
-  // 5. Depending on the m_useMass flag, convert to mass variables or simply compute mass density
-
-  // TODO: for now the treatment of molar/mass density requires too many interpolations in the tables, it needs to be fixed
-  //       we should modify the PVT functions so that they can return phaseMassDens, phaseDens, and phaseMW in one call
+  // 5. If m_useMass is set, convert to mass variables
 
   if( m_useMass )
   {
-    // compute the phase molecular weights (ultimately, get that from the PVT function)
+    // compute the phase molecular weights from the molar and mass densities, and use the mass densities
     real64 phaseMolecularWeight[numPhase]{};
-    real64 phaseMolarDens{};
-    m_phase1.density.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction[ip1].toSliceConst(),
-                              phaseMolarDens,
-                              false );
-    phaseMolecularWeight[ip1] = phaseDensity[ip1] / phaseMolarDens;
-
-    m_phase2.density.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction[ip2].toSliceConst(),
-                              phaseMolarDens,
-                              false );
-    phaseMolecularWeight[ip2] = phaseDensity[ip2] / phaseMolarDens;
-
-    // copy the densities into the mass densities
     for( integer ip = 0; ip < numPhase; ++ip )
     {
-      phaseMassDensity[ip] = phaseDensity[ip];
+      phaseMolecularWeight[ip] = phaseMassDensity[ip] / phaseDensity[ip];
+      phaseDensity[ip] = phaseMassDensity[ip];
     }
 
     // convert mole fractions to mass fractions
@@ -348,20 +395,6 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
                                        phaseFraction,
                                        phaseCompFraction );
   }
-  else
-  {
-    // for now, we have to compute the phase mass density here
-    m_phase1.density.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction[ip1].toSliceConst(),
-                              phaseMassDensity[ip1],
-                              true );
-    m_phase2.density.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction[ip2].toSliceConst(),
-                              phaseMassDensity[ip2],
-                              true );
-  }
 
   // 6. Compute total fluid mass/molar density
 
@@ -410,99 +443,114 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
     }
   }
 
-  // 2. Compute phase fractions and phase component fractions
+  // 2. Interpolate the tables of (P,T) of the submodels together, then compute phase fractions and phase component fractions
 
   real64 const temperatureInCelsius = temperature - 273.15;
-  m_flash.compute( pressure,
-                   temperatureInCelsius,
-                   compMoleFrac.toSliceConst(),
-                   phaseFraction,
-                   phaseCompFraction );
-
-  // 3. Compute phase densities and phase viscosities
-
-  m_phase1.density.compute( pressure,
-                            temperatureInCelsius,
-                            phaseCompFraction.value[ip1].toSliceConst(), phaseCompFraction.derivs[ip1].toSliceConst(),
-                            phaseDensity.value[ip1], phaseDensity.derivs[ip1],
-                            m_useMass );
-  m_phase1.viscosity.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction.value[ip1].toSliceConst(), phaseCompFraction.derivs[ip1].toSliceConst(),
-                              phaseViscosity.value[ip1], phaseViscosity.derivs[ip1],
-                              m_useMass );
-  m_phase2.density.compute( pressure,
-                            temperatureInCelsius,
-                            phaseCompFraction.value[ip2].toSliceConst(), phaseCompFraction.derivs[ip2].toSliceConst(),
-                            phaseDensity.value[ip2], phaseDensity.derivs[ip2],
-                            m_useMass );
-  m_phase2.viscosity.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction.value[ip2].toSliceConst(), phaseCompFraction.derivs[ip2].toSliceConst(),
-                              phaseViscosity.value[ip2], phaseViscosity.derivs[ip2],
-                              m_useMass );
+  PVTProps::PTTableValue ptTableValues[PVTProps::MultiPropertyTable::maxNumProperties];
+  m_ptTable.compute( pressure, temperatureInCelsius, ptTableValues );
+
+  PVTProps::PTTableDispatch< FLASH::KernelWrapper::hasPTTable >::call( m_ptTableColumns.flash, ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_flash.compute( tableValue ...,
+                     pressure,
+                     temperatureInCelsius,
+                     compMoleFrac.toSliceConst(),
+                     phaseFraction,
+                     phaseCompFraction );
+  } );
+
+  // 3. Compute phase molar and mass densities (in one table lookup) and phase viscosities
+
+  PVTProps::PTTableDispatch< PHASE1::Density::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseDensity[0], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase1.density.computeMolarAndMass( tableValue ...,
+                                          pressure,
+                                          temperatureInCelsius,
+                                          phaseCompFraction.value[ip1].toSliceConst(), phaseCompFraction.derivs[ip1].toSliceConst(),
+                                          phaseDensity.value[ip1], phaseDensity.derivs[ip1],
+                                          phaseMassDensity.value[ip1], phaseMassDensity.derivs[ip1] );
+  } );
+  PVTProps::PTTableDispatch< PHASE1::Viscosity::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseViscosity[0], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase1.viscosity.compute( tableValue ...,
+                                pressure,
+                                temperatureInCelsius,
+                                phaseCompFraction.value[ip1].toSliceConst(), phaseCompFraction.derivs[ip1].toSliceConst(),
+                                phaseViscosity.value[ip1], phaseViscosity.derivs[ip1],
+                                m_useMass );
+  } );
+  PVTProps::PTTableDispatch< PHASE2::Density::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseDensity[1], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase2.density.computeMolarAndMass( tableValue ...,
+                                          pressure,
+                                          temperatureInCelsius,
+                                          phaseCompFraction.value[ip2].toSliceConst(), phaseCompFraction.derivs[ip2].toSliceConst(),
+                                          phaseDensity.value[ip2], phaseDensity.derivs[ip2],
+                                          phaseMassDensity.value[ip2], phaseMassDensity.derivs[ip2] );
+  } );
+  PVTProps::PTTableDispatch< PHASE2::Viscosity::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseViscosity[1], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase2.viscosity.compute( tableValue ...,
+                                pressure,
+                                temperatureInCelsius,
+                                phaseCompFraction.value[ip2].toSliceConst(), phaseCompFraction.derivs[ip2].toSliceConst(),
+                                phaseViscosity.value[ip2], phaseViscosity.derivs[ip2],
+                                m_useMass );
+  } );
 
 
   // 4. Compute enthalpy and internal energy
 
-  m_phase1.enthalpy.compute( pressure,
-                             temperatureInCelsius,
-                             phaseCompFraction.value[ip1].toSliceConst(), phaseCompFraction.derivs[ip1].toSliceConst(),
-                             phaseEnthalpy.value[ip1], phaseEnthalpy.derivs[ip1],
-                             m_useMass );
+  PVTProps::PTTableDispatch< PHASE1::Enthalpy::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseEnthalpy[0], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase1.enthalpy.compute( tableValue ...,
+                               pressure,
+                               temperatureInCelsius,
+                               phaseCompFraction.value[ip1].toSliceConst(), phaseCompFraction.derivs[ip1].toSliceConst(),
+                               phaseEnthalpy.value[ip1], phaseEnthalpy.derivs[ip1],
+                               m_useMass );
+  } );
   m_phase1.internalEnergy.compute( pressure,
                                    temperatureInCelsius,
                                    phaseCompFraction.value[ip1].toSliceConst(), phaseCompFraction.derivs[ip1].toSliceConst(),
                                    phaseInternalEnergy.value[ip1], phaseInternalEnergy.derivs[ip1],
                                    m_useMass );
 
-  m_phase2.enthalpy.compute( pressure,
-                             temperatureInCelsius,
-                             phaseCompFraction.value[ip2].toSliceConst(), phaseCompFraction.derivs[ip2].toSliceConst(),
-                             phaseEnthalpy.value[ip2], phaseEnthalpy.derivs[ip2],
-                             m_useMass );
+  PVTProps::PTTableDispatch< PHASE2::Enthalpy::KernelWrapper::hasPTTable >::call( m_ptTableColumns.phaseEnthalpy[1], ptTableValues, [&]( auto const & ... tableValue )
+  {
+    m_phase2.enthalpy.compute( tableValue ...,
+                               pressure,
+                               temperatureInCelsius,
+                               phaseCompFraction.value[ip2].toSliceConst(), phaseCompFraction.derivs[ip2].toSliceConst(),
+                               phaseEnthalpy.value[ip2], phaseEnthalpy.derivs[ip2],
+                               m_useMass );
+  } );
   m_phase2.internalEnergy.compute( pressure,
                                    temperatureInCelsius,
                                    phaseCompFraction.value[ip2].toSliceConst(), phaseCompFraction.derivs[ip2].toSliceConst(),
                                    phaseInternalEnergy.value[ip2], phaseInternalEnergy.derivs[ip2],
                                    m_useMass );
 
-  // 5. Depending on the m_useMass flag, convert to mass variables or simply compute mass density
-
-  // TODO: for now the treatment of molar/mass density requires too many interpolations in the tables, it needs to be fixed
-  //       we should modify the PVT functions so that they can return phaseMassDens, phaseDens, and phaseMW in one call
+  // 5. If m_useMass is set, convert to mass variables
 
   if( m_useMass )
   {
 
-    // 4.1 Compute the phase molecular weights (ultimately, get that from the PVT function)
+    // 4.1 Compute the phase molecular weights from the molar and mass densities, and use the mass densities
 
     real64 phaseMolecularWeight[numPhase]{};
     real64 dPhaseMolecularWeight[numPhase][numComp+2]{};
 
-    real64 phaseMolarDens{};
-    stackArray1d< real64, numComp+2 > dPhaseMolarDens( numComp+2 );
-
-    m_phase1.density.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction.value[ip1].toSliceConst(), phaseCompFraction.derivs[ip1].toSliceConst(),
-                              phaseMolarDens, dPhaseMolarDens.toSlice(),
-                              false );
-    phaseMolecularWeight[ip1] = phaseDensity.value[ip1] / phaseMolarDens;
-    for( integer idof = 0; idof < numComp+2; ++idof )
-    {
-      dPhaseMolecularWeight[ip1][idof] = phaseDensity.derivs[ip1][idof] / phaseMolarDens - phaseMolecularWeight[ip1] * dPhaseMolarDens[idof] / phaseMolarDens;
-    }
-
-    m_phase2.density.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction.value[ip2].toSliceConst(), phaseCompFraction.derivs[ip2].toSliceConst(),
-                              phaseMolarDens, dPhaseMolarDens.toSlice(),
-                              false );
-    phaseMolecularWeight[ip2] = phaseDensity.value[ip2] / phaseMolarDens;
-    for( integer idof = 0; idof < numComp+2; ++idof )
+    for( integer ip = 0; ip < numPhase; ++ip )
     {
-      dPhaseMolecularWeight[ip2][idof] = phaseDensity.derivs[ip2][idof] / phaseMolarDens - phaseMolecularWeight[ip2] * dPhaseMolarDens[idof] / phaseMolarDens;
+      real64 const phaseMolarDens = phaseDensity.value[ip];
+      phaseMolecularWeight[ip] = phaseMassDensity.value[ip] / phaseMolarDens;
+      for( integer idof = 0; idof < numComp+2; ++idof )
+      {
+        dPhaseMolecularWeight[ip][idof] = phaseMassDensity.derivs[ip][idof] / phaseMolarDens - phaseMolecularWeight[ip] * phaseDensity.derivs[ip][idof] / phaseMolarDens;
+        phaseDensity.derivs[ip][idof] = phaseMassDensity.derivs[ip][idof];
+      }
+      phaseDensity.value[ip] = phaseMassDensity.value[ip];
     }
 
     // 4.2 Convert the mole fractions to mass fractions
@@ -527,20 +575,6 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
       }
     }
   }
-  else
-  {
-    // for now, we have to compute the phase mass density here
-    m_phase1.density.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction.value[ip1].toSliceConst(), phaseCompFraction.derivs[ip1].toSliceConst(),
-                              phaseMassDensity.value[ip1], phaseMassDensity.derivs[ip1],
-                              true );
-    m_phase2.density.compute( pressure,
-                              temperatureInCelsius,
-                              phaseCompFraction.value[ip2].toSliceConst(), phaseCompFraction.derivs[ip2].toSliceConst(),
-                              phaseMassDensity.value[ip2], phaseMassDensity.derivs[ip2],
-                              true );
-  }
 
   // 5. Compute total fluid mass/molar density and derivatives
 
@@ -558,17 +592,13 @@ CO2BrineFluid< PHASE1, PHASE2, FLASH >::KernelWrapper::
           real64 const temperature,
           arraySlice1d< geosx::real64 const, compflow::USD_COMP - 1 > const & composition ) const
 {
-  compute( pressure,
-           temperature,
-           composition,
-           m_phaseFraction( k, q ),
-           m_phaseDensity( k, q ),
-           m_phaseMassDensity( k, q ),
-           m_phaseViscosity( k, q ),
-           m_phaseEnthalpy( k, q ),
-           m_phaseInternalEnergy( k, q ),
-           m_phaseCompFraction( k, q ),
-           m_totalDensity( k, q ) );
+  computeInStorage< 2, 2 >( k, q, [&]( auto const & ... props )
+  {
+    this->compute( pressure,
+                   temperature,
+                   composition,
+                   props ... );
+  } );
 }
 
 /// Declare strings associated with enumeration values
@@ -169,14 +169,14 @@ CompositionalMultiphaseFluid::KernelWrapper::
                  arrayView1d< pvt::PHASE_TYPE > const & phaseTypes,
                  arrayView1d< geosx::real64 const > const & componentMolarWeight,
                  bool useMass,
-                 PhaseProp::ViewType phaseFraction,
-                 PhaseProp::ViewType phaseDensity,
-                 PhaseProp::ViewType phaseMassDensity,
-                 PhaseProp::ViewType phaseViscosity,
-                 PhaseProp::ViewType phaseEnthalpy,
-                 PhaseProp::ViewType phaseInternalEnergy,
-                 PhaseComp::ViewType phaseCompFraction,
-                 FluidProp::ViewType totalDensity )
+                 PhasePropStorage::ViewType phaseFraction,
+                 PhasePropStorage::ViewType phaseDensity,
+                 PhasePropStorage::ViewType phaseMassDensity,
+                 PhasePropStorage::ViewType phaseViscosity,
+                 PhasePropStorage::ViewType phaseEnthalpy,
+                 PhasePropStorage::ViewType phaseInternalEnergy,
+                 PhaseCompStorage::ViewType phaseCompFraction,
+                 FluidPropStorage::ViewType totalDensity )
   : MultiFluidBase::KernelWrapper( componentMolarWeight,
                                    useMass,
                                    std::move( phaseFraction ),
@@ -105,14 +105,14 @@ private:
                    arrayView1d< pvt::PHASE_TYPE > const & phaseTypes,
                    arrayView1d< real64 const > const & componentMolarWeight,
                    bool const useMass,
-                   PhaseProp::ViewType phaseFraction,
-                   PhaseProp::ViewType phaseDensity,
-                   PhaseProp::ViewType phaseMassDensity,
-                   PhaseProp::ViewType phaseViscosity,
-                   PhaseProp::ViewType phaseEnthalpy,
-                   PhaseProp::ViewType phaseInternalEnergy,
-                   PhaseComp::ViewType phaseCompFraction,
-                   FluidProp::ViewType totalDensity );
+                   PhasePropStorage::ViewType phaseFraction,
+                   PhasePropStorage::ViewType phaseDensity,
+                   PhasePropStorage::ViewType phaseMassDensity,
+                   PhasePropStorage::ViewType phaseViscosity,
+                   PhasePropStorage::ViewType phaseEnthalpy,
+                   PhasePropStorage::ViewType phaseInternalEnergy,
+                   PhaseCompStorage::ViewType phaseCompFraction,
+                   FluidPropStorage::ViewType totalDensity );
 
     pvt::MultiphaseSystem & m_fluid;
 
@@ -403,17 +403,13 @@ CompositionalMultiphaseFluid::KernelWrapper::
           real64 const temperature,
           arraySlice1d< geosx::real64 const, compflow::USD_COMP - 1 > const & composition ) const
 {
-  compute( pressure,
-           temperature,
-           composition,
-           m_phaseFraction( k, q ),
-           m_phaseDensity( k, q ),
-           m_phaseMassDensity( k, q ),
-           m_phaseViscosity( k, q ),
-           m_phaseEnthalpy( k, q ),
-           m_phaseInternalEnergy( k, q ),
-           m_phaseCompFraction( k, q ),
-           m_totalDensity( k, q ) );
+  computeInStorage< MultiFluidBase::MAX_NUM_COMPONENTS, MultiFluidBase::MAX_NUM_PHASES >( k, q, [&]( auto const & ... props )
+  {
+    this->compute( pressure,
+                   temperature,
+                   composition,
+                   props ... );
+  } );
 }
 
 } /* namespace constitutive */
@@ -179,7 +179,7 @@ void MultiFluidBase::initializeState( arrayView2d< real64 const, compflow::USD_P
   localIndex const numGauss = m_initialTotalMassDensity.size( 1 );
   integer const numPhase = m_phaseMassDensity.value.size( 2 );
 
-  PhaseProp::ViewTypeConst const phaseMassDensity = m_phaseMassDensity.toViewConst();
+  PhasePropStorage::ViewTypeConst const phaseMassDensity = m_phaseMassDensity.toViewConst();
   arrayView2d< real64, multifluid::USD_FLUID > const totalMassDensity = m_initialTotalMassDensity.toView();
 
   forAll< parallelDevicePolicy<> >( numElem, [=] GEOSX_HOST_DEVICE ( localIndex const k )
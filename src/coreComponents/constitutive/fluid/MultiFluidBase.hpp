@@ -115,37 +115,37 @@ public:
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseFraction() const
   { return m_phaseFraction.value; }
 
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseFraction() const
+  arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > dPhaseFraction() const
   { return m_phaseFraction.derivs; }
 
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseDensity() const
   { return m_phaseDensity.value; }
 
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseDensity() const
+  arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > dPhaseDensity() const
   { return m_phaseDensity.derivs; }
 
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseMassDensity() const
   { return m_phaseMassDensity.value; }
 
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseMassDensity() const
+  arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > dPhaseMassDensity() const
   { return m_phaseMassDensity.derivs; }
 
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseViscosity() const
   { return m_phaseViscosity.value; }
 
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseViscosity() const
+  arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > dPhaseViscosity() const
   { return m_phaseViscosity.derivs; }
 
   arrayView4d< real64 const, multifluid::USD_PHASE_COMP > phaseCompFraction() const
   { return m_phaseCompFraction.value; }
 
-  arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > dPhaseCompFraction() const
+  arrayView5d< multifluid::DerivativeType const, multifluid::USD_PHASE_COMP_DC > dPhaseCompFraction() const
   { return m_phaseCompFraction.derivs; }
 
   arrayView2d< real64 const, multifluid::USD_FLUID > totalDensity() const
   { return m_totalDensity.value; }
 
-  arrayView3d< real64 const, multifluid::USD_FLUID_DC > dTotalDensity() const
+  arrayView3d< multifluid::DerivativeType const, multifluid::USD_FLUID_DC > dTotalDensity() const
   { return m_totalDensity.derivs; }
 
   arrayView2d< real64 const, multifluid::USD_FLUID > initialTotalMassDensity() const
@@ -154,13 +154,13 @@ public:
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseEnthalpy() const
   { return m_phaseEnthalpy.value; }
 
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseEnthalpy() const
+  arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > dPhaseEnthalpy() const
   { return m_phaseEnthalpy.derivs; }
 
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseInternalEnergy() const
   { return m_phaseInternalEnergy.value; }
 
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseInternalEnergy() const
+  arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > dPhaseInternalEnergy() const
   { return m_phaseInternalEnergy.derivs; }
 
   /**
@@ -183,6 +183,11 @@ protected:
   using PhaseComp = MultiFluidVar< real64, 4, multifluid::LAYOUT_PHASE_COMP, multifluid::LAYOUT_PHASE_COMP_DC >;
   using FluidProp = MultiFluidVar< real64, 2, multifluid::LAYOUT_FLUID, multifluid::LAYOUT_FLUID_DC >;
 
+  // storage counterparts of the types above, with derivatives held in multifluid::DerivativeType
+  using PhasePropStorage = MultiFluidVar< real64, 3, multifluid::LAYOUT_PHASE, multifluid::LAYOUT_PHASE_DC, multifluid::DerivativeType >;
+  using PhaseCompStorage = MultiFluidVar< real64, 4, multifluid::LAYOUT_PHASE_COMP, multifluid::LAYOUT_PHASE_COMP_DC, multifluid::DerivativeType >;
+  using FluidPropStorage = MultiFluidVar< real64, 2, multifluid::LAYOUT_FLUID, multifluid::LAYOUT_FLUID_DC, multifluid::DerivativeType >;
+
   class KernelWrapper
   {
 public:
@@ -240,14 +245,14 @@ protected:
      */
     KernelWrapper( arrayView1d< real64 const > componentMolarWeight,
                    bool const useMass,
-                   PhaseProp::ViewType phaseFraction,
-                   PhaseProp::ViewType phaseDensity,
-                   PhaseProp::ViewType phaseMassDensity,
-                   PhaseProp::ViewType phaseViscosity,
-                   PhaseProp::ViewType phaseEnthalpy,
-                   PhaseProp::ViewType phaseInternalEnergy,
-                   PhaseComp::ViewType phaseCompFraction,
-                   FluidProp::ViewType totalDensity )
+                   PhasePropStorage::ViewType phaseFraction,
+                   PhasePropStorage::ViewType phaseDensity,
+                   PhasePropStorage::ViewType phaseMassDensity,
+                   PhasePropStorage::ViewType phaseViscosity,
+                   PhasePropStorage::ViewType phaseEnthalpy,
+                   PhasePropStorage::ViewType phaseInternalEnergy,
+                   PhaseCompStorage::ViewType phaseCompFraction,
+                   FluidPropStorage::ViewType totalDensity )
       : m_componentMolarWeight( std::move( componentMolarWeight ) ),
       m_useMass( useMass ),
       m_phaseFraction( std::move( phaseFraction ) ),
@@ -358,6 +363,23 @@ protected:
                               PhaseProp::SliceType const phaseDens,
                               FluidProp::SliceType const totalDens ) const;
 
+    /**
+     * @brief Utility function calling a compute kernel on the properties stored at a given point
+     * @tparam maxNumComp the max number of components
+     * @tparam maxNumPhase the max number of phases
+     * @tparam FUNC the type of the compute kernel
+     * @param[in] k index of the cell
+     * @param[in] q index of the quadrature point
+     * @param[in] computeFunc the kernel, called with the phase fraction, phase density, phase mass density,
+     *            phase viscosity, phase enthalpy, phase internal energy, phase component fraction and total density slices
+     * @detail When derivatives are stored in reduced precision, the kernel computes them in double precision
+     *         on the stack and they are rounded once when written back to the storage arrays.
+     */
+    template< integer maxNumComp, integer maxNumPhase, typename FUNC >
+    GEOSX_HOST_DEVICE
+    void computeInStorage( localIndex const k,
+                           localIndex const q,
+                           FUNC && computeFunc ) const;
 
     /// View on the component molar weights
     arrayView1d< real64 const > m_componentMolarWeight;
@@ -366,14 +388,14 @@ protected:
     bool m_useMass;
 
     /// Views on the phase properties
-    PhaseProp::ViewType m_phaseFraction;
-    PhaseProp::ViewType m_phaseDensity;
-    PhaseProp::ViewType m_phaseMassDensity;
-    PhaseProp::ViewType m_phaseViscosity;
-    PhaseProp::ViewType m_phaseEnthalpy;
-    PhaseProp::ViewType m_phaseInternalEnergy;
-    PhaseComp::ViewType m_phaseCompFraction;
-    FluidProp::ViewType m_totalDensity;
+    PhasePropStorage::ViewType m_phaseFraction;
+    PhasePropStorage::ViewType m_phaseDensity;
+    PhasePropStorage::ViewType m_phaseMassDensity;
+    PhasePropStorage::ViewType m_phaseViscosity;
+    PhasePropStorage::ViewType m_phaseEnthalpy;
+    PhasePropStorage::ViewType m_phaseInternalEnergy;
+    PhaseCompStorage::ViewType m_phaseCompFraction;
+    FluidPropStorage::ViewType m_totalDensity;
 
 private:
 
@@ -528,14 +550,14 @@ protected:
 
   // constitutive data
 
-  PhaseProp m_phaseFraction;
-  PhaseProp m_phaseDensity;
-  PhaseProp m_phaseMassDensity;
-  PhaseProp m_phaseViscosity;
-  PhaseProp m_phaseEnthalpy;
-  PhaseProp m_phaseInternalEnergy;
-  PhaseComp m_phaseCompFraction;
-  FluidProp m_totalDensity;
+  PhasePropStorage m_phaseFraction;
+  PhasePropStorage m_phaseDensity;
+  PhasePropStorage m_phaseMassDensity;
+  PhasePropStorage m_phaseViscosity;
+  PhasePropStorage m_phaseEnthalpy;
+  PhasePropStorage m_phaseInternalEnergy;
+  PhaseCompStorage m_phaseCompFraction;
+  FluidPropStorage m_totalDensity;
 
   // initial data (used to compute the body force in the poromechanics solver)
 
@@ -872,6 +894,79 @@ MultiFluidBase::KernelWrapper::
 }
 
 
+template< integer maxNumComp, integer maxNumPhase, typename FUNC >
+GEOSX_HOST_DEVICE
+inline void
+MultiFluidBase::KernelWrapper::
+  computeInStorage( localIndex const k,
+                    localIndex const q,
+                    FUNC && computeFunc ) const
+{
+#if defined( GEOSX_USE_MIXED_PRECISION_FLUID )
+  using namespace multifluid;
+
+  integer constexpr maxNumDof = maxNumComp + 2;
+  integer const numPhase = numPhases();
+  integer const numComp = numComponents();
+  integer const numDof = numComp + 2;
+
+  // 1. Compute the derivatives in double precision on the stack
+
+  StackArray< real64, 4, maxNumDof *maxNumPhase, LAYOUT_PHASE_DC > dPhaseFrac( 1, 1, numPhase, numDof );
+  StackArray< real64, 4, maxNumDof *maxNumPhase, LAYOUT_PHASE_DC > dPhaseDens( 1, 1, numPhase, numDof );
+  StackArray< real64, 4, maxNumDof *maxNumPhase, LAYOUT_PHASE_DC > dPhaseMassDens( 1, 1, numPhase, numDof );
+  StackArray< real64, 4, maxNumDof *maxNumPhase, LAYOUT_PHASE_DC > dPhaseVisc( 1, 1, numPhase, numDof );
+  StackArray< real64, 4, maxNumDof *maxNumPhase, LAYOUT_PHASE_DC > dPhaseEnthalpy( 1, 1, numPhase, numDof );
+  StackArray< real64, 4, maxNumDof *maxNumPhase, LAYOUT_PHASE_DC > dPhaseInternalEnergy( 1, 1, numPhase, numDof );
+  StackArray< real64, 5, maxNumDof *maxNumComp *maxNumPhase, LAYOUT_PHASE_COMP_DC > dPhaseCompFrac( 1, 1, numPhase, numComp, numDof );
+  StackArray< real64, 3, maxNumDof, LAYOUT_FLUID_DC > dTotalDens( 1, 1, numDof );
+
+  computeFunc( PhaseProp::SliceType{ m_phaseFraction.value[k][q], dPhaseFrac[0][0] },
+               PhaseProp::SliceType{ m_phaseDensity.value[k][q], dPhaseDens[0][0] },
+               PhaseProp::SliceType{ m_phaseMassDensity.value[k][q], dPhaseMassDens[0][0] },
+               PhaseProp::SliceType{ m_phaseViscosity.value[k][q], dPhaseVisc[0][0] },
+               PhaseProp::SliceType{ m_phaseEnthalpy.value[k][q], dPhaseEnthalpy[0][0] },
+               PhaseProp::SliceType{ m_phaseInternalEnergy.value[k][q], dPhaseInternalEnergy[0][0] },
+               PhaseComp::SliceType{ m_phaseCompFraction.value[k][q], dPhaseCompFrac[0][0] },
+               FluidProp::SliceType{ m_totalDensity.value[k][q], dTotalDens[0][0] } );
+
+  // 2. Round the derivatives once when writing them back to storage
+
+  for( integer ip = 0; ip < numPhase; ++ip )
+  {
+    for( integer idof = 0; idof < numDof; ++idof )
+    {
+      m_phaseFraction.derivs[k][q][ip][idof] = static_cast< DerivativeType >( dPhaseFrac[0][0][ip][idof] );
+      m_phaseDensity.derivs[k][q][ip][idof] = static_cast< DerivativeType >( dPhaseDens[0][0][ip][idof] );
+      m_phaseMassDensity.derivs[k][q][ip][idof] = static_cast< DerivativeType >( dPhaseMassDens[0][0][ip][idof] );
+      m_phaseViscosity.derivs[k][q][ip][idof] = static_cast< DerivativeType >( dPhaseVisc[0][0][ip][idof] );
+      m_phaseEnthalpy.derivs[k][q][ip][idof] = static_cast< DerivativeType >( dPhaseEnthalpy[0][0][ip][idof] );
+      m_phaseInternalEnergy.derivs[k][q][ip][idof] = static_cast< DerivativeType >( dPhaseInternalEnergy[0][0][ip][idof] );
+    }
+    for( integer ic = 0; ic < numComp; ++ic )
+    {
+      for( integer idof = 0; idof < numDof; ++idof )
+      {
+        m_phaseCompFraction.derivs[k][q][ip][ic][idof] = static_cast< DerivativeType >( dPhaseCompFrac[0][0][ip][ic][idof] );
+      }
+    }
+  }
+  for( integer idof = 0; idof < numDof; ++idof )
+  {
+    m_totalDensity.derivs[k][q][idof] = static_cast< DerivativeType >( dTotalDens[0][0][idof] );
+  }
+#else
+  computeFunc( m_phaseFraction( k, q ),
+               m_phaseDensity( k, q ),
+               m_phaseMassDensity( k, q ),
+               m_phaseViscosity( k, q ),
+               m_phaseEnthalpy( k, q ),
+               m_phaseInternalEnergy( k, q ),
+               m_phaseCompFraction( k, q ),
+               m_totalDensity( k, q ) );
+#endif
+}
+
 } //namespace constitutive
 
 } //namespace geosx
@@ -32,11 +32,11 @@ namespace multifluid
 {
 
 using array2dLayoutFluid = array2d< real64, constitutive::multifluid::LAYOUT_FLUID >;
-using array3dLayoutFluid_dC = array3d< real64, constitutive::multifluid::LAYOUT_FLUID_DC >;
+using array3dLayoutFluid_dC = array3d< constitutive::multifluid::DerivativeType, constitutive::multifluid::LAYOUT_FLUID_DC >;
 using array3dLayoutPhase = array3d< real64, constitutive::multifluid::LAYOUT_PHASE >;
-using array4dLayoutPhase_dC = array4d< real64, constitutive::multifluid::LAYOUT_PHASE_DC >;
+using array4dLayoutPhase_dC = array4d< constitutive::multifluid::DerivativeType, constitutive::multifluid::LAYOUT_PHASE_DC >;
 using array4dLayoutPhaseComp = array4d< real64, constitutive::multifluid::LAYOUT_PHASE_COMP >;
-using array5dLayoutPhaseComp_dC = array5d< real64, constitutive::multifluid::LAYOUT_PHASE_COMP_DC >;
+using array5dLayoutPhaseComp_dC = array5d< constitutive::multifluid::DerivativeType, constitutive::multifluid::LAYOUT_PHASE_COMP_DC >;
 
 EXTRINSIC_MESH_DATA_TRAIT( phaseFraction,
                            "phaseFraction",
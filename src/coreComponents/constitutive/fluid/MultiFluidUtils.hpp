@@ -50,12 +50,13 @@ using ArraySliceOrRef = typename ArraySliceOrRefHelper< T, DIM, USD >::type;
 /**
  * @brief Helper struct used to represent a variable and its compositional derivatives
  * @tparam DIM number of dimensions
+ * @tparam T_DC type of the derivatives (defaults to the type of the value)
  */
-template< typename T, int DIM, int USD, int USD_DC >
+template< typename T, int DIM, int USD, int USD_DC, typename T_DC = T >
 struct MultiFluidVarSlice
 {
   internal::ArraySliceOrRef< T, DIM, USD > value;        /// variable value
-  internal::ArraySliceOrRef< T, DIM + 1, USD_DC > derivs; /// derivative w.r.t. pressure, temperature, compositions
+  internal::ArraySliceOrRef< T_DC, DIM + 1, USD_DC > derivs; /// derivative w.r.t. pressure, temperature, compositions
 };
 
 /**
@@ -63,14 +64,15 @@ struct MultiFluidVarSlice
  * @tparam NDIM number of dimensions
  * @tparam USD unit-stride-dim of primary property
  * @tparam USD_DC unit-stride-dim of derivatives
+ * @tparam T_DC type of the derivatives (defaults to the type of the values)
  */
-template< typename T, int NDIM, int USD, int USD_DC >
+template< typename T, int NDIM, int USD, int USD_DC, typename T_DC = T >
 struct MultiFluidVarView
 {
   ArrayView< T, NDIM, USD > value;        ///< View into property values
-  ArrayView< T, NDIM + 1, USD_DC > derivs; ///< View into property derivatives w.r.t. pressure, temperature, compositions
+  ArrayView< T_DC, NDIM + 1, USD_DC > derivs; ///< View into property derivatives w.r.t. pressure, temperature, compositions
 
-  using SliceType = MultiFluidVarSlice< T, NDIM - 2, USD - 2, USD_DC - 2 >;
+  using SliceType = MultiFluidVarSlice< T, NDIM - 2, USD - 2, USD_DC - 2, T_DC >;
 
   GEOSX_HOST_DEVICE
   SliceType operator()( localIndex const k, localIndex const q ) const
@@ -84,15 +86,16 @@ struct MultiFluidVarView
  * @tparam NDIM number of dimensions
  * @tparam PERM unit-stride-dim of primary property
  * @tparam PERM_DC unit-stride-dim of derivatives
+ * @tparam T_DC type of the stored derivatives (defaults to the type of the values)
  */
-template< typename T, int NDIM, typename PERM, typename PERM_DC >
+template< typename T, int NDIM, typename PERM, typename PERM_DC, typename T_DC = T >
 struct MultiFluidVar
 {
   Array< real64, NDIM, PERM > value;        ///< Property values
-  Array< real64, NDIM + 1, PERM_DC > derivs; ///< Property derivatives w.r.t. pressure, temperature, compositions
+  Array< T_DC, NDIM + 1, PERM_DC > derivs; ///< Property derivatives w.r.t. pressure, temperature, compositions
 
-  using ViewType = MultiFluidVarView< T, NDIM, getUSD< PERM >, getUSD< PERM_DC > >;
-  using ViewTypeConst = MultiFluidVarView< T const, NDIM, getUSD< PERM >, getUSD< PERM_DC > >;
+  using ViewType = MultiFluidVarView< T, NDIM, getUSD< PERM >, getUSD< PERM_DC >, T_DC >;
+  using ViewTypeConst = MultiFluidVarView< T const, NDIM, getUSD< PERM >, getUSD< PERM_DC >, T_DC const >;
 
   using SliceType = typename ViewType::SliceType;
   using SliceTypeConst = typename ViewTypeConst::SliceType;
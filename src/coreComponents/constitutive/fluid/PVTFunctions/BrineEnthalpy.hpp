@@ -22,6 +22,7 @@
 #include "PVTFunctionBase.hpp"
 
 #include "constitutive/fluid/layouts.hpp"
+#include "constitutive/fluid/PVTFunctions/MultiPropertyTable.hpp"
 #include "constitutive/fluid/PVTFunctions/PVTFunctionHelpers.hpp"
 #include "functions/TableFunction.hpp"
 
@@ -68,6 +69,31 @@ public:
                 arraySlice1d< real64, USD3 > const & dValue,
                 bool useMass ) const;
 
+  /// Compute the brine enthalpy from the CO2 enthalpy interpolated in a MultiPropertyTable
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void compute( PTTableValue const & tableValue,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                real64 & value,
+                bool useMass ) const;
+
+  /// Compute the brine enthalpy and its derivatives from the CO2 enthalpy interpolated in a MultiPropertyTable
+  template< int USD1, int USD2, int USD3 >
+  GEOSX_HOST_DEVICE
+  void compute( PTTableValue const & tableValue,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                real64 & value,
+                arraySlice1d< real64, USD3 > const & dValue,
+                bool useMass ) const;
+
+  /// The CO2 enthalpy table can be interpolated in a MultiPropertyTable
+  static constexpr bool hasPTTable = true;
+
   virtual void move( LvArray::MemorySpace const space, bool const touch ) override
   {
     PVTFunctionBaseUpdate::move( space, touch );
@@ -118,6 +144,7 @@ public:
    */
   KernelWrapper createKernelWrapper() const;
 
+  virtual TableFunction const * pressureTemperatureTable() const override { return m_CO2EnthalpyTable; }
 
 private:
 
@@ -143,10 +170,23 @@ void BrineEnthalpyUpdate::compute( real64 const & pressure,
                                    real64 & value,
                                    bool useMass ) const
 {
-  real64 const input[2] = { pressure, temperature };
-  real64 const brineEnthalpy = m_brineEnthalpyTable.compute( &temperature );
-  real64 const CO2Enthalpy = m_CO2EnthalpyTable.compute( input );
+  compute( PTTableValue::interpolate( m_CO2EnthalpyTable, pressure, temperature ),
+           pressure, temperature, phaseComposition, value, useMass );
+}
+
+template< int USD1 >
+GEOSX_HOST_DEVICE
+void BrineEnthalpyUpdate::compute( PTTableValue const & tableValue,
+                                   real64 const & pressure,
+                                   real64 const & temperature,
+                                   arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                   real64 & value,
+                                   bool useMass ) const
+{
+  GEOSX_UNUSED_VAR( pressure );
 
+  real64 const brineEnthalpy = m_brineEnthalpyTable.compute( &temperature );
+  real64 const CO2Enthalpy = tableValue.value;
 
   //assume there are only CO2 and brine here.
 
@@ -175,15 +215,31 @@ void BrineEnthalpyUpdate::compute( real64 const & pressure,
                                    arraySlice1d< real64, USD3 > const & dValue,
                                    bool useMass ) const
 {
+  compute( PTTableValue::interpolateWithDerivatives( m_CO2EnthalpyTable, pressure, temperature ),
+           pressure, temperature, phaseComposition, dPhaseComposition, value, dValue, useMass );
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+void BrineEnthalpyUpdate::compute( PTTableValue const & tableValue,
+                                   real64 const & pressure,
+                                   real64 const & temperature,
+                                   arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                   arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                   real64 & value,
+                                   arraySlice1d< real64, USD3 > const & dValue,
+                                   bool useMass ) const
+{
+  GEOSX_UNUSED_VAR( pressure );
+
   using Deriv = multifluid::DerivativeOffset;
 
-  real64 const input[2] = { pressure, temperature };
   real64 brineEnthalpy_dTemperature = 0.0;
   real64 dvalue_dC = 0.0;
-  real64 CO2EnthalpyDeriv[2]{};
+  real64 const ( &CO2EnthalpyDeriv )[2] = tableValue.dValue;
 
   real64 const brineEnthalpy = m_brineEnthalpyTable.compute( &temperature, &brineEnthalpy_dTemperature );
-  real64 const CO2Enthalpy = m_CO2EnthalpyTable.compute( input, CO2EnthalpyDeriv );
+  real64 const CO2Enthalpy = tableValue.value;
 
   //assume there are only CO2 and brine here.
 
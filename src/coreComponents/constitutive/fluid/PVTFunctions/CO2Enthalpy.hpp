@@ -22,6 +22,7 @@
 #include "PVTFunctionBase.hpp"
 
 #include "constitutive/fluid/layouts.hpp"
+#include "constitutive/fluid/PVTFunctions/MultiPropertyTable.hpp"
 #include "constitutive/fluid/PVTFunctions/PVTFunctionHelpers.hpp"
 #include "functions/TableFunction.hpp"
 
@@ -64,6 +65,31 @@ public:
                 arraySlice1d< real64, USD3 > const & dValue,
                 bool useMass ) const;
 
+  /// Compute the CO2 enthalpy from the enthalpy interpolated in a MultiPropertyTable
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void compute( PTTableValue const & tableValue,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                real64 & value,
+                bool useMass ) const;
+
+  /// Compute the CO2 enthalpy and its derivatives from the enthalpy interpolated in a MultiPropertyTable
+  template< int USD1, int USD2, int USD3 >
+  GEOSX_HOST_DEVICE
+  void compute( PTTableValue const & tableValue,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                real64 & value,
+                arraySlice1d< real64, USD3 > const & dValue,
+                bool useMass ) const;
+
+  /// The enthalpy table can be interpolated in a MultiPropertyTable
+  static constexpr bool hasPTTable = true;
+
   virtual void move( LvArray::MemorySpace const space, bool const touch ) override
   {
     PVTFunctionBaseUpdate::move( space, touch );
@@ -110,6 +136,7 @@ public:
                                     array1d< real64 > const & densities,
                                     array1d< real64 > const & enthalpies );
 
+  virtual TableFunction const * pressureTemperatureTable() const override { return m_CO2EnthalpyTable; }
 
 private:
 
@@ -128,11 +155,36 @@ void CO2EnthalpyUpdate::compute( real64 const & pressure,
                                  real64 & value,
                                  bool useMass ) const
 {
-  GEOSX_UNUSED_VAR( phaseComposition );
-  real64 const input[2] = { pressure, temperature };
+  compute( PTTableValue::interpolate( m_CO2EnthalpyTable, pressure, temperature ),
+           pressure, temperature, phaseComposition, value, useMass );
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+void CO2EnthalpyUpdate::compute( real64 const & pressure,
+                                 real64 const & temperature,
+                                 arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                 arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                 real64 & value,
+                                 arraySlice1d< real64, USD3 > const & dValue,
+                                 bool useMass ) const
+{
+  compute( PTTableValue::interpolateWithDerivatives( m_CO2EnthalpyTable, pressure, temperature ),
+           pressure, temperature, phaseComposition, dPhaseComposition, value, dValue, useMass );
+}
 
+template< int USD1 >
+GEOSX_HOST_DEVICE
+void CO2EnthalpyUpdate::compute( PTTableValue const & tableValue,
+                                 real64 const & pressure,
+                                 real64 const & temperature,
+                                 arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                 real64 & value,
+                                 bool useMass ) const
+{
+  GEOSX_UNUSED_VAR( pressure, temperature, phaseComposition );
 
-  value = m_CO2EnthalpyTable.compute( input );
+  value = tableValue.value;
 
   if( !useMass )
   {
@@ -142,7 +194,8 @@ void CO2EnthalpyUpdate::compute( real64 const & pressure,
 
 template< int USD1, int USD2, int USD3 >
 GEOSX_HOST_DEVICE
-void CO2EnthalpyUpdate::compute( real64 const & pressure,
+void CO2EnthalpyUpdate::compute( PTTableValue const & tableValue,
+                                 real64 const & pressure,
                                  real64 const & temperature,
                                  arraySlice1d< real64 const, USD1 > const & phaseComposition,
                                  arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
@@ -150,18 +203,15 @@ void CO2EnthalpyUpdate::compute( real64 const & pressure,
                                  arraySlice1d< real64, USD3 > const & dValue,
                                  bool useMass ) const
 {
-  GEOSX_UNUSED_VAR( phaseComposition, dPhaseComposition );
+  GEOSX_UNUSED_VAR( pressure, temperature, phaseComposition, dPhaseComposition );
 
   using Deriv = multifluid::DerivativeOffset;
 
-  real64 const input[2] = { pressure, temperature };
-  real64 CO2EnthalpyDeriv[2]{};
-
-  value = m_CO2EnthalpyTable.compute( input, CO2EnthalpyDeriv );
+  value = tableValue.value;
 
   LvArray::forValuesInSlice( dValue, []( real64 & val ){ val = 0.0; } );
-  dValue[Deriv::dP] = CO2EnthalpyDeriv[0];
-  dValue[Deriv::dT] = CO2EnthalpyDeriv[1];
+  dValue[Deriv::dP] = tableValue.dValue[0];
+  dValue[Deriv::dT] = tableValue.dValue[1];
 
   if( !useMass )
   {
@@ -173,37 +173,36 @@ void calculateCO2Solubility( string const & functionName,
   constexpr real64 lambda[] = { -0.411370585, 6.07632013e-4, 97.5347708, 0, 0, 0, 0, -0.0237622469, 0.0170656236, 0, 1.41335834e-5 };
   constexpr real64 zeta[] = { 3.36389723e-4, -1.98298980e-5, 0, 0, 0, 0, 0, 2.12220830e-3, -5.24873303e-3, 0, 0 };
 
-  localIndex const nPressures = tableCoords.nPressures();
-  localIndex const nTemperatures = tableCoords.nTemperatures();
-
-  for( localIndex i = 0; i < nPressures; ++i )
+  PVTFunctionHelpers::computePropertyTable( tableCoords, [&]( localIndex const i, localIndex const j )
   {
     real64 const P = tableCoords.getPressure( i ) / P_Pa_f;
+    real64 const T = tableCoords.getTemperature( j );
 
-    for( localIndex j = 0; j < nTemperatures; ++j )
-    {
-      real64 const T = tableCoords.getTemperature( j );
-
-      // compute reduced volume by solving the CO2 equation of state
-      real64 const V_r = CO2SolubilityFunction( functionName, tolerance, T, P, &co2EOS );
+    // compute reduced volume by solving the CO2 equation of state
+    real64 const V_r = CO2SolubilityFunction( functionName, tolerance, T, P, &co2EOS );
 
-      // compute equation (6) of Duan and Sun (2003)
-      real64 const logK = Par( T+T_K_f, P, mu )
-                          - logF( T, P, V_r )
-                          + 2*Par( T+T_K_f, P, lambda ) * salinity
-                          + Par( T+T_K_f, P, zeta ) * salinity * salinity;
+    // compute equation (6) of Duan and Sun (2003)
+    real64 const logK = Par( T+T_K_f, P, mu )
+                        - logF( T, P, V_r )
+                        + 2*Par( T+T_K_f, P, lambda ) * salinity
+                        + Par( T+T_K_f, P, zeta ) * salinity * salinity;
 
-      // mole fraction of CO2 in vapor phase, equation (4) of Duan and Sun (2003)
-      real64 const y_CO2 = (P - PWater( T ))/P;
-      values[j*nPressures+i] = y_CO2 * P / exp( logK );
-    }
-  }
+    // mole fraction of CO2 in vapor phase, equation (4) of Duan and Sun (2003)
+    real64 const y_CO2 = (P - PWater( T ))/P;
+    return y_CO2 * P / exp( logK );
+  }, values.toView() );
 }
 
 TableFunction const * makeSolubilityTable( string_array const & inputParams,
                                            string const & functionName,
                                            FunctionManager & functionManager )
 {
+  string const tableName = functionName + "_table";
+  if( functionManager.hasGroup< TableFunction >( tableName ) )
+  {
+    return functionManager.getGroupPointer< TableFunction >( tableName );
+  }
+
   // initialize the (p,T) coordinates
   PTTableCoordinates tableCoords;
   PVTFunctionHelpers::initializePropertyTable( inputParams, tableCoords );
@@ -231,19 +230,11 @@ TableFunction const * makeSolubilityTable( string_array const & inputParams,
   array1d< real64 > values( tableCoords.nPressures() * tableCoords.nTemperatures() );
   calculateCO2Solubility( functionName, tolerance, tableCoords, salinity, values );
 
-  string const tableName = functionName + "_table";
-  if( functionManager.hasGroup< TableFunction >( tableName ) )
-  {
-    return functionManager.getGroupPointer< TableFunction >( tableName );
-  }
-  else
-  {
-    TableFunction * const solubilityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
-    solubilityTable->setTableCoordinates( tableCoords.getCoords() );
-    solubilityTable->setTableValues( values );
-    solubilityTable->setInterpolationMethod( TableFunction::InterpolationType::Linear );
-    return solubilityTable;
-  }
+  TableFunction * const solubilityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
+  solubilityTable->setTableCoordinates( tableCoords.getCoords() );
+  solubilityTable->setTableValues( values );
+  solubilityTable->setInterpolationMethod( TableFunction::InterpolationType::Linear );
+  return solubilityTable;
 }
 
 } // namespace
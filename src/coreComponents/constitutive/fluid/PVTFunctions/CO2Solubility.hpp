@@ -21,6 +21,7 @@
 
 #include "FlashModelBase.hpp"
 
+#include "constitutive/fluid/PVTFunctions/MultiPropertyTable.hpp"
 #include "constitutive/fluid/PVTFunctions/PVTFunctionHelpers.hpp"
 #include "constitutive/fluid/layouts.hpp"
 #include "constitutive/fluid/MultiFluidUtils.hpp"
@@ -74,6 +75,29 @@ public:
                 PhaseProp::SliceType const phaseFraction,
                 PhaseComp::SliceType const phaseCompFraction ) const;
 
+  /// Compute the phase fractions and compositions from the solubility interpolated in a MultiPropertyTable
+  template< int USD1, int USD2, int USD3 >
+  GEOSX_HOST_DEVICE
+  void compute( PTTableValue const & tableValue,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & compFraction,
+                arraySlice1d< real64, USD2 > const & phaseFraction,
+                arraySlice2d< real64, USD3 > const & phaseCompFraction ) const;
+
+  /// Compute the phase fractions and compositions and their derivatives from the solubility interpolated in a MultiPropertyTable
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void compute( PTTableValue const & tableValue,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & compFraction,
+                PhaseProp::SliceType const phaseFraction,
+                PhaseComp::SliceType const phaseCompFraction ) const;
+
+  /// The solubility table can be interpolated in a MultiPropertyTable
+  static constexpr bool hasPTTable = true;
+
   virtual void move( LvArray::MemorySpace const space, bool const touch ) override
   {
     FlashModelBaseUpdate::move( space, touch );
@@ -122,6 +146,8 @@ public:
    */
   KernelWrapper createKernelWrapper() const;
 
+  virtual TableFunction const * pressureTemperatureTable() const override { return m_CO2SolubilityTable; }
+
 private:
 
   /// Table to compute solubility as a function of pressure and temperature
@@ -149,9 +175,37 @@ CO2SolubilityUpdate::compute( real64 const & pressure,
                               arraySlice1d< real64, USD2 > const & phaseFraction,
                               arraySlice2d< real64, USD3 > const & phaseCompFraction ) const
 {
+  compute( PTTableValue::interpolate( m_CO2SolubilityTable, pressure, temperature ),
+           pressure, temperature, compFraction, phaseFraction, phaseCompFraction );
+}
+
+template< int USD1 >
+GEOSX_HOST_DEVICE
+inline void
+CO2SolubilityUpdate::compute( real64 const & pressure,
+                              real64 const & temperature,
+                              arraySlice1d< real64 const, USD1 > const & compFraction,
+                              PhaseProp::SliceType const phaseFraction,
+                              PhaseComp::SliceType const phaseCompFraction ) const
+{
+  compute( PTTableValue::interpolateWithDerivatives( m_CO2SolubilityTable, pressure, temperature ),
+           pressure, temperature, compFraction, phaseFraction, phaseCompFraction );
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+inline void
+CO2SolubilityUpdate::compute( PTTableValue const & tableValue,
+                              real64 const & pressure,
+                              real64 const & temperature,
+                              arraySlice1d< real64 const, USD1 > const & compFraction,
+                              arraySlice1d< real64, USD2 > const & phaseFraction,
+                              arraySlice2d< real64, USD3 > const & phaseCompFraction ) const
+{
+  GEOSX_UNUSED_VAR( pressure, temperature );
+
   // solubility mol/kg(water)  X = Csat/W
-  real64 const input[2] = { pressure, temperature };
-  real64 solubility = m_CO2SolubilityTable.compute( input );
+  real64 solubility = tableValue.value;
   solubility *= m_componentMolarWeight[m_waterIndex];
 
   // Y = C/W = z/(1-z)
@@ -214,18 +268,20 @@ CO2SolubilityUpdate::compute( real64 const & pressure,
 template< int USD1 >
 GEOSX_HOST_DEVICE
 inline void
-CO2SolubilityUpdate::compute( real64 const & pressure,
+CO2SolubilityUpdate::compute( PTTableValue const & tableValue,
+                              real64 const & pressure,
                               real64 const & temperature,
                               arraySlice1d< real64 const, USD1 > const & compFraction,
                               PhaseProp::SliceType const phaseFraction,
                               PhaseComp::SliceType const phaseCompFraction ) const
 {
+  GEOSX_UNUSED_VAR( pressure, temperature );
+
   using Deriv = multifluid::DerivativeOffset;
 
   // solubility mol/kg(water)  X = Csat/W
-  real64 const input[2] = { pressure, temperature };
-  real64 solubilityDeriv[2]{};
-  real64 solubility = m_CO2SolubilityTable.compute( input, solubilityDeriv );
+  real64 solubilityDeriv[2] = { tableValue.dValue[0], tableValue.dValue[1] };
+  real64 solubility = tableValue.value;
 
   solubility *= m_componentMolarWeight[m_waterIndex];
   for( integer ic = 0; ic < 2; ++ic )
@@ -75,6 +75,44 @@ public:
                 arraySlice1d< real64, USD3 > const & dValue,
                 bool useMass ) const;
 
+  /**
+   * @brief Compute the molar and the mass densities with a single evaluation of the tables.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] massValue the mass density
+   */
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            real64 & molarValue,
+                            real64 & massValue ) const;
+
+  /**
+   * @brief Compute the molar and the mass densities and their derivatives with a single evaluation of the tables.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[in] dPhaseComposition the derivatives of the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] dMolarValue the derivatives of the molar density
+   * @param[out] massValue the mass density
+   * @param[out] dMassValue the derivatives of the mass density
+   */
+  template< int USD1, int USD2, int USD3 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                            real64 & molarValue,
+                            arraySlice1d< real64, USD3 > const & dMolarValue,
+                            real64 & massValue,
+                            arraySlice1d< real64, USD3 > const & dMassValue ) const;
+
   virtual void move( LvArray::MemorySpace const space, bool const touch ) override
   {
     PVTFunctionBaseUpdate::move( space, touch );
@@ -245,6 +283,42 @@ void EzrokhiBrineDensityUpdate::compute( real64 const & pressure,
 
 }
 
+template< int USD1 >
+GEOSX_HOST_DEVICE
+void EzrokhiBrineDensityUpdate::computeMolarAndMass( real64 const & pressure,
+                                                     real64 const & temperature,
+                                                     arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                     real64 & molarValue,
+                                                     real64 & massValue ) const
+{
+  compute( pressure, temperature, phaseComposition, massValue, true );
+  molarValue = massValue / m_componentMolarWeight[m_waterIndex];
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+void EzrokhiBrineDensityUpdate::computeMolarAndMass( real64 const & pressure,
+                                                     real64 const & temperature,
+                                                     arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                     arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                                     real64 & molarValue,
+                                                     arraySlice1d< real64, USD3 > const & dMolarValue,
+                                                     real64 & massValue,
+                                                     arraySlice1d< real64, USD3 > const & dMassValue ) const
+{
+  using Deriv = multifluid::DerivativeOffset;
+
+  compute( pressure, temperature, phaseComposition, dPhaseComposition, massValue, dMassValue, true );
+
+  // the molar density only differs from the mass density by the constant water molar weight
+  real64 const waterMWInv = 1.0 / m_componentMolarWeight[m_waterIndex];
+  molarValue = massValue * waterMWInv;
+  dMolarValue[Deriv::dP] = dMassValue[Deriv::dP] * waterMWInv;
+  dMolarValue[Deriv::dT] = dMassValue[Deriv::dT] * waterMWInv;
+  dMolarValue[Deriv::dC+m_CO2Index] = dMassValue[Deriv::dC+m_CO2Index] * waterMWInv;
+  dMolarValue[Deriv::dC+m_waterIndex] = dMassValue[Deriv::dC+m_waterIndex] * waterMWInv;
+}
+
 } // end namespace PVTProps
 
 } // end namespace constitutive
@@ -22,6 +22,7 @@
 #include "PVTFunctionBase.hpp"
 
 #include "constitutive/fluid/layouts.hpp"
+#include "constitutive/fluid/PVTFunctions/MultiPropertyTable.hpp"
 #include "constitutive/fluid/PVTFunctions/PVTFunctionHelpers.hpp"
 #include "functions/TableFunction.hpp"
 
@@ -62,6 +63,31 @@ public:
                 arraySlice1d< real64, USD3 > const & dValue,
                 bool useMass ) const;
 
+  /// Compute the viscosity from the viscosity interpolated in a MultiPropertyTable
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void compute( PTTableValue const & tableValue,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                real64 & value,
+                bool useMass ) const;
+
+  /// Compute the viscosity and its derivatives from the viscosity interpolated in a MultiPropertyTable
+  template< int USD1, int USD2, int USD3 >
+  GEOSX_HOST_DEVICE
+  void compute( PTTableValue const & tableValue,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                real64 & value,
+                arraySlice1d< real64, USD3 > const & dValue,
+                bool useMass ) const;
+
+  /// The viscosity table can be interpolated in a MultiPropertyTable
+  static constexpr bool hasPTTable = true;
+
   virtual void move( LvArray::MemorySpace const space, bool const touch ) override
   {
     PVTFunctionBaseUpdate::move( space, touch );
@@ -104,6 +130,8 @@ public:
    */
   KernelWrapper createKernelWrapper() const;
 
+  virtual TableFunction const * pressureTemperatureTable() const override { return m_CO2ViscosityTable; }
+
 private:
 
   /// Table with CO2 viscosity tabulated as a function of (P,T)
@@ -119,10 +147,8 @@ void FenghourCO2ViscosityUpdate::compute( real64 const & pressure,
                                           real64 & value,
                                           bool useMass ) const
 {
-  GEOSX_UNUSED_VAR( phaseComposition, useMass );
-
-  real64 const input[2] = { pressure, temperature };
-  value = m_CO2ViscosityTable.compute( input );
+  compute( PTTableValue::interpolate( m_CO2ViscosityTable, pressure, temperature ),
+           pressure, temperature, phaseComposition, value, useMass );
 }
 
 template< int USD1, int USD2, int USD3 >
@@ -135,20 +161,48 @@ void FenghourCO2ViscosityUpdate::compute( real64 const & pressure,
                                           arraySlice1d< real64, USD3 > const & dValue,
                                           bool useMass ) const
 {
-  GEOSX_UNUSED_VAR( phaseComposition,
+  compute( PTTableValue::interpolateWithDerivatives( m_CO2ViscosityTable, pressure, temperature ),
+           pressure, temperature, phaseComposition, dPhaseComposition, value, dValue, useMass );
+}
+
+template< int USD1 >
+GEOSX_HOST_DEVICE
+void FenghourCO2ViscosityUpdate::compute( PTTableValue const & tableValue,
+                                          real64 const & pressure,
+                                          real64 const & temperature,
+                                          arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                          real64 & value,
+                                          bool useMass ) const
+{
+  GEOSX_UNUSED_VAR( pressure, temperature, phaseComposition, useMass );
+
+  value = tableValue.value;
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+void FenghourCO2ViscosityUpdate::compute( PTTableValue const & tableValue,
+                                          real64 const & pressure,
+                                          real64 const & temperature,
+                                          arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                          arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                          real64 & value,
+                                          arraySlice1d< real64, USD3 > const & dValue,
+                                          bool useMass ) const
+{
+  GEOSX_UNUSED_VAR( pressure,
+                    temperature,
+                    phaseComposition,
                     dPhaseComposition,
                     useMass );
 
   using Deriv = multifluid::DerivativeOffset;
 
-  real64 const input[2] = { pressure, temperature };
-  real64 densityDeriv[2]{};
-  value = m_CO2ViscosityTable.compute( input, densityDeriv );
+  value = tableValue.value;
 
   LvArray::forValuesInSlice( dValue, []( real64 & val ){ val = 0.0; } );
-  dValue[Deriv::dP] = densityDeriv[0];
-  dValue[Deriv::dT] = densityDeriv[1];
-
+  dValue[Deriv::dP] = tableValue.dValue[0];
+  dValue[Deriv::dT] = tableValue.dValue[1];
 }
 
 } // end namespace PVTProps
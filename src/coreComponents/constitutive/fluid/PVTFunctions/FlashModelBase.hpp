@@ -24,6 +24,8 @@
 namespace geosx
 {
 
+class TableFunction;
+
 namespace constitutive
 {
 
@@ -55,6 +57,9 @@ public:
     m_componentMolarWeight.move( space, touch );
   }
 
+  /// True if the wrapper can take the value of its table of (P,T) interpolated in a MultiPropertyTable
+  static constexpr bool hasPTTable = false;
+
 protected:
 
   /// Array storing the component molar weights
@@ -93,6 +98,12 @@ public:
 
   string const & flashModelName() const { return m_modelName; }
 
+  /**
+   * @brief Get the table of (P,T) which can be interpolated in a MultiPropertyTable.
+   * @return the table, or nullptr if the kernel wrapper does not take the value of a table of (P,T)
+   */
+  virtual TableFunction const * pressureTemperatureTable() const { return nullptr; }
+
 protected:
 
   /// Name the solubility model
@@ -0,0 +1,139 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MultiPropertyTable.cpp
+ */
+
+#include "constitutive/fluid/PVTFunctions/MultiPropertyTable.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+namespace constitutive
+{
+
+namespace PVTProps
+{
+
+namespace
+{
+
+/**
+ * @brief Check whether a table can be packed in a MultiPropertyTable.
+ * @param[in] table the table
+ * @return true if the table is a table of (P,T) with linear interpolation
+ */
+bool isPackable( TableFunction const * const table )
+{
+  return table != nullptr &&
+         table->numDimensions() == 2 &&
+         table->getInterpolationMethod() == TableFunction::InterpolationType::Linear;
+}
+
+/**
+ * @brief Check whether two tables have the same axes.
+ * @param[in] table1 the first table
+ * @param[in] table2 the second table
+ * @return true if the coordinates of the two tables are identical
+ */
+bool haveSameAxes( TableFunction const & table1, TableFunction const & table2 )
+{
+  ArrayOfArraysView< real64 const > const coords1 = table1.getCoordinates();
+  ArrayOfArraysView< real64 const > const coords2 = table2.getCoordinates();
+  for( localIndex dim = 0; dim < 2; ++dim )
+  {
+    if( !std::equal( coords1[dim].begin(), coords1[dim].end(), coords2[dim].begin(), coords2[dim].end() ) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+}
+
+MultiPropertyTable::MultiPropertyTable( std::vector< TableFunction const * > const & tables )
+{
+  // distinct candidate tables
+  std::vector< TableFunction const * > candidates;
+  for( TableFunction const * const table : tables )
+  {
+    if( isPackable( table ) && std::find( candidates.begin(), candidates.end(), table ) == candidates.end() )
+    {
+      candidates.push_back( table );
+    }
+  }
+
+  // keep the largest set of tables sharing the same axes
+  for( TableFunction const * const reference : candidates )
+  {
+    std::vector< TableFunction const * > sameAxes;
+    for( TableFunction const * const table : candidates )
+    {
+      if( LvArray::integerConversion< integer >( sameAxes.size() ) < maxNumProperties && haveSameAxes( *reference, *table ) )
+      {
+        sameAxes.push_back( table );
+      }
+    }
+    if( sameAxes.size() > m_tables.size() )
+    {
+      m_tables = sameAxes;
+    }
+  }
+
+  if( m_tables.empty() )
+  {
+    return;
+  }
+
+  ArrayOfArraysView< real64 const > const coords = m_tables[0]->getCoordinates();
+  m_pressures.resize( coords.sizeOfArray( 0 ) );
+  std::copy( coords[0].begin(), coords[0].end(), m_pressures.begin() );
+  m_temperatures.resize( coords.sizeOfArray( 1 ) );
+  std::copy( coords[1].begin(), coords[1].end(), m_temperatures.begin() );
+
+  // the values of all the tables at a point are stored next to each other
+  localIndex const numPoints = m_pressures.size() * m_temperatures.size();
+  m_values.resize( numPoints, numProperties() );
+  for( integer ip = 0; ip < numProperties(); ++ip )
+  {
+    arrayView1d< real64 const > const tableValues = m_tables[ip]->getValues();
+    for( localIndex i = 0; i < numPoints; ++i )
+    {
+      m_values[i][ip] = tableValues[i];
+    }
+  }
+}
+
+integer MultiPropertyTable::column( TableFunction const * const table ) const
+{
+  auto const it = std::find( m_tables.begin(), m_tables.end(), table );
+  return ( table == nullptr || it == m_tables.end() ) ? -1 : LvArray::integerConversion< integer >( it - m_tables.begin() );
+}
+
+MultiPropertyTable::KernelWrapper MultiPropertyTable::createKernelWrapper() const
+{
+  return KernelWrapper( m_pressures.toViewConst(),
+                        m_temperatures.toViewConst(),
+                        m_values.toViewConst() );
+}
+
+} // end namespace PVTProps
+
+} // end namespace constitutive
+
+} // end namespace geosx
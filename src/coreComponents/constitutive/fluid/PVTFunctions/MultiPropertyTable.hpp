@@ -0,0 +1,354 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MultiPropertyTable.hpp
+ */
+
+#ifndef GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_MULTIPROPERTYTABLE_HPP_
+#define GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_MULTIPROPERTYTABLE_HPP_
+
+#include "functions/TableFunction.hpp"
+
+namespace geosx
+{
+
+namespace constitutive
+{
+
+namespace PVTProps
+{
+
+/**
+ * @brief Value of a table of (P,T) and its derivatives, interpolated before the call to the PVT function using the table.
+ */
+struct PTTableValue
+{
+  /// The interpolated value
+  real64 value;
+
+  /// The derivatives of the interpolated value with respect to pressure and temperature
+  real64 dValue[2];
+
+  /**
+   * @brief Interpolate the value of a table of (P,T), without its derivatives.
+   * @param[in] table the table
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @return the interpolated value
+   */
+  GEOSX_HOST_DEVICE
+  static PTTableValue interpolate( TableFunction::KernelWrapper const & table,
+                                   real64 const & pressure,
+                                   real64 const & temperature )
+  {
+    real64 const input[2] = { pressure, temperature };
+    PTTableValue tableValue{};
+    tableValue.value = table.compute( input );
+    return tableValue;
+  }
+
+  /**
+   * @brief Interpolate the value of a table of (P,T) and its derivatives.
+   * @param[in] table the table
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @return the interpolated value and its derivatives
+   */
+  GEOSX_HOST_DEVICE
+  static PTTableValue interpolateWithDerivatives( TableFunction::KernelWrapper const & table,
+                                                  real64 const & pressure,
+                                                  real64 const & temperature )
+  {
+    real64 const input[2] = { pressure, temperature };
+    PTTableValue tableValue{};
+    tableValue.value = table.compute( input, tableValue.dValue );
+    return tableValue;
+  }
+};
+
+/**
+ * @brief Kernel wrapper of a MultiPropertyTable.
+ */
+class MultiPropertyTableUpdate
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param[in] pressures the pressure axis
+   * @param[in] temperatures the temperature axis
+   * @param[in] values the values of the properties at each point, with the pressure index running fastest
+   */
+  MultiPropertyTableUpdate( arrayView1d< real64 const > const & pressures,
+                            arrayView1d< real64 const > const & temperatures,
+                            arrayView2d< real64 const > const & values )
+    : m_pressures( pressures ),
+    m_temperatures( temperatures ),
+    m_values( values )
+  {}
+
+  /**
+   * @brief Interpolate all the properties and their derivatives with a single bracket search.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[out] tableValues the values of the properties, in the order of the columns of the table
+   * @details The interpolation is the linear interpolation of TableFunction, with the same floating-point operations,
+   *   so that the result of each property is exactly the one of its own table.
+   */
+  GEOSX_HOST_DEVICE
+  void compute( real64 const & pressure,
+                real64 const & temperature,
+                PTTableValue * const tableValues ) const;
+
+  /**
+   * @brief Move the KernelWrapper to the given execution space, optionally touching it.
+   * @param space the space to move the KernelWrapper to
+   * @param touch whether the KernelWrapper should be touched in the new space or not
+   */
+  void move( LvArray::MemorySpace const space, bool const touch )
+  {
+    m_pressures.move( space, touch );
+    m_temperatures.move( space, touch );
+    m_values.move( space, touch );
+  }
+
+private:
+
+  /**
+   * @brief Find the interval of an axis containing a coordinate, and the interpolation weights of its bounds.
+   * @param[in] coords the axis
+   * @param[in] x the coordinate
+   * @param[out] bounds the indices of the bounds of the interval
+   * @param[out] weights the weights of the bounds
+   * @param[out] dWeights the derivatives of the weights with respect to the coordinate
+   */
+  GEOSX_HOST_DEVICE
+  static void bracket( arrayView1d< real64 const > const & coords,
+                       real64 const & x,
+                       localIndex ( &bounds )[2],
+                       real64 ( &weights )[2],
+                       real64 ( &dWeights )[2] );
+
+  /// Pressure axis
+  arrayView1d< real64 const > m_pressures;
+
+  /// Temperature axis
+  arrayView1d< real64 const > m_temperatures;
+
+  /// Values of the properties, interleaved: one row per point and one column per property
+  arrayView2d< real64 const > m_values;
+};
+
+/**
+ * @brief Tables of (P,T) sharing the same axes, packed into a single table with all the property values of a point
+ *        stored next to each other.
+ * @details The interpolation of all the properties needs a single bracket search and a single set of weights.
+ *   The tables which cannot be packed (other axes, other interpolation methods) keep being interpolated on their own.
+ */
+class MultiPropertyTable
+{
+public:
+
+  /// Maximum number of properties in the table
+  static constexpr integer maxNumProperties = 8;
+
+  /**
+   * @brief Constructor, packing the largest set of tables with identical axes.
+   * @param[in] tables the candidate tables, possibly nullptr or repeated
+   */
+  explicit MultiPropertyTable( std::vector< TableFunction const * > const & tables );
+
+  /**
+   * @brief Get the column of a table.
+   * @param[in] table the table
+   * @return the column of the table, or -1 if the table has not been packed
+   */
+  integer column( TableFunction const * const table ) const;
+
+  /**
+   * @brief @return the number of packed tables
+   */
+  integer numProperties() const { return LvArray::integerConversion< integer >( m_tables.size() ); }
+
+  /// Type of kernel wrapper for in-kernel update
+  using KernelWrapper = MultiPropertyTableUpdate;
+
+  /**
+   * @brief Create an update kernel wrapper.
+   * @return the wrapper
+   */
+  KernelWrapper createKernelWrapper() const;
+
+private:
+
+  /// The packed tables, in the order of the columns
+  std::vector< TableFunction const * > m_tables;
+
+  /// Pressure axis
+  array1d< real64 > m_pressures;
+
+  /// Temperature axis
+  array1d< real64 > m_temperatures;
+
+  /// Values of the properties, interleaved: one row per point and one column per property
+  array2d< real64 > m_values;
+};
+
+/**
+ * @brief Call a function computing a PVT property, with the value of its table of (P,T) if it has been interpolated.
+ * @tparam HAS_PT_TABLE true if the PVT function can take the value of its table of (P,T) as argument
+ */
+template< bool HAS_PT_TABLE >
+struct PTTableDispatch
+{
+  /**
+   * @brief Call the function without table value.
+   * @tparam LAMBDA the type of the function
+   * @param[in] column the column of the table in the MultiPropertyTable (unused)
+   * @param[in] tableValues the values interpolated in the MultiPropertyTable (unused)
+   * @param[in] lambda the function, taking the table value as optional argument
+   */
+  template< typename LAMBDA >
+  GEOSX_HOST_DEVICE
+  static void call( integer const column, PTTableValue const * const tableValues, LAMBDA && lambda )
+  {
+    GEOSX_UNUSED_VAR( column, tableValues );
+    lambda();
+  }
+};
+
+/**
+ * @brief Call a function computing a PVT property, with the value of its table of (P,T) if it has been interpolated.
+ */
+template<>
+struct PTTableDispatch< true >
+{
+  /**
+   * @brief Call the function with the value of its table, or without if the table has not been packed.
+   * @tparam LAMBDA the type of the function
+   * @param[in] column the column of the table in the MultiPropertyTable, or -1
+   * @param[in] tableValues the values interpolated in the MultiPropertyTable
+   * @param[in] lambda the function, taking the table value as optional argument
+   */
+  template< typename LAMBDA >
+  GEOSX_HOST_DEVICE
+  static void call( integer const column, PTTableValue const * const tableValues, LAMBDA && lambda )
+  {
+    if( column < 0 )
+    {
+      lambda();
+    }
+    else
+    {
+      lambda( tableValues[column] );
+    }
+  }
+};
+
+GEOSX_HOST_DEVICE
+inline void
+MultiPropertyTableUpdate::bracket( arrayView1d< real64 const > const & coords,
+                                   real64 const & x,
+                                   localIndex ( & bounds )[2],
+                                   real64 ( & weights )[2],
+                                   real64 ( & dWeights )[2] )
+{
+  // same as in TableFunction::KernelWrapper::interpolateLinear
+  if( x <= coords[0] )
+  {
+    bounds[0] = 0;
+    bounds[1] = 0;
+    weights[0] = 0;
+    weights[1] = 1;
+    dWeights[0] = 0;
+    dWeights[1] = 0;
+  }
+  else if( x >= coords[coords.size() - 1] )
+  {
+    bounds[0] = coords.size() - 1;
+    bounds[1] = bounds[0];
+    weights[0] = 1;
+    weights[1] = 0;
+    dWeights[0] = 0;
+    dWeights[1] = 0;
+  }
+  else
+  {
+    auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), x );
+    bounds[1] = LvArray::integerConversion< localIndex >( lower );
+    bounds[0] = bounds[1] - 1;
+
+    real64 const dx = coords[bounds[1]] - coords[bounds[0]];
+    weights[0] = 1.0 - ( x - coords[bounds[0]] ) / dx;
+    weights[1] = 1.0 - weights[0];
+    dWeights[0] = -1.0 / dx;
+    dWeights[1] = -dWeights[0];
+  }
+}
+
+GEOSX_HOST_DEVICE
+inline void
+MultiPropertyTableUpdate::compute( real64 const & pressure,
+                                   real64 const & temperature,
+                                   PTTableValue * const tableValues ) const
+{
+  integer const numProperties = LvArray::integerConversion< integer >( m_values.size( 1 ) );
+  if( numProperties == 0 )
+  {
+    return;
+  }
+
+  localIndex presBounds[2]{};
+  real64 presWeights[2]{};
+  real64 dPresWeights[2]{};
+  bracket( m_pressures, pressure, presBounds, presWeights, dPresWeights );
+
+  localIndex tempBounds[2]{};
+  real64 tempWeights[2]{};
+  real64 dTempWeights[2]{};
+  bracket( m_temperatures, temperature, tempBounds, tempWeights, dTempWeights );
+
+  for( integer ip = 0; ip < numProperties; ++ip )
+  {
+    tableValues[ip].value = 0.0;
+    tableValues[ip].dValue[0] = 0.0;
+    tableValues[ip].dValue[1] = 0.0;
+  }
+
+  // the corners are visited, and the products are evaluated, in the order of TableFunction
+  for( integer point = 0; point < 4; ++point )
+  {
+    integer const presCorner = point & 1;
+    integer const tempCorner = ( point >> 1 ) & 1;
+    localIndex const tableIndex = presBounds[presCorner] + tempBounds[tempCorner] * m_pressures.size();
+
+    arraySlice1d< real64 const > const cornerValues = m_values[tableIndex];
+    for( integer ip = 0; ip < numProperties; ++ip )
+    {
+      real64 const cornerValue = cornerValues[ip];
+      tableValues[ip].value += cornerValue * presWeights[presCorner] * tempWeights[tempCorner];
+      tableValues[ip].dValue[0] += cornerValue * dPresWeights[presCorner] * tempWeights[tempCorner];
+      tableValues[ip].dValue[1] += cornerValue * presWeights[presCorner] * dTempWeights[tempCorner];
+    }
+  }
+}
+
+} // end namespace PVTProps
+
+} // end namespace constitutive
+
+} // end namespace geosx
+
+#endif //GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_MULTIPROPERTYTABLE_HPP_
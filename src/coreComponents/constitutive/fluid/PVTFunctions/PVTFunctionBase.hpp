@@ -24,6 +24,8 @@
 namespace geosx
 {
 
+class TableFunction;
+
 namespace constitutive
 {
 
@@ -52,6 +54,9 @@ public:
     m_componentMolarWeight.move( space, touch );
   }
 
+  /// True if the wrapper can take the value of its table of (P,T) interpolated in a MultiPropertyTable
+  static constexpr bool hasPTTable = false;
+
 protected:
 
   /// Array storing the component molar weights
@@ -92,6 +97,12 @@ public:
 
   virtual PVTFunctionType functionType() const = 0;
 
+  /**
+   * @brief Get the table of (P,T) which can be interpolated in a MultiPropertyTable.
+   * @return the table, or nullptr if the kernel wrapper does not take the value of a table of (P,T)
+   */
+  virtual TableFunction const * pressureTemperatureTable() const { return nullptr; }
+
 protected:
 
   /// Name of the PVT function
@@ -17,6 +17,8 @@
  */
 
 #include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/MpiWrapper.hpp"
 
 #ifndef GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_PVTFUNCTIONHELPERS_HPP
 #define GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_PVTFUNCTIONHELPERS_HPP
@@ -223,6 +225,61 @@ initializePropertyTable( string_array const & inputParameters,
   }
 }
 
+/**
+ * @brief Compute the values of a property table, distributing the (p,T) points among the MPI ranks and threads
+ * @tparam FUNC the type of the function computing the property
+ * @param[in] tableCoords the (p,T) coordinates of the table
+ * @param[in] func the function computing the property for a pressure index and a temperature index
+ * @param[out] values the values of the property, with the pressure index running fastest
+ * @note This function must be called on all the ranks with the same coordinates.
+ *       If the computation fails on a (p,T) point, an exception is thrown on all the ranks.
+ */
+template< typename FUNC >
+void
+computePropertyTable( PTTableCoordinates const & tableCoords,
+                      FUNC && func,
+                      arrayView1d< real64 > const & values )
+{
+  localIndex const nPressures = tableCoords.nPressures();
+  localIndex const numValues = nPressures * tableCoords.nTemperatures();
+  GEOSX_ERROR_IF_NE( values.size(), numValues );
+
+  // each rank computes a contiguous range of points, the other values are zero and filled by the sum below
+  int const rank = MpiWrapper::commRank();
+  int const numRanks = MpiWrapper::commSize();
+  localIndex const begin = numValues * rank / numRanks;
+  localIndex const end = numValues * ( rank + 1 ) / numRanks;
+  values.setValues< serialPolicy >( 0.0 );
+
+  // the exceptions cannot leave the threads, so we only record the first point that failed
+  RAJA::ReduceMin< parallelHostReduce, localIndex > firstFailure( numValues );
+  forAll< parallelHostPolicy >( end - begin, [=] ( localIndex const k )
+  {
+    localIndex const index = begin + k;
+    try
+    {
+      values[index] = func( index % nPressures, index / nPressures );
+    }
+    catch( std::exception const & )
+    {
+      firstFailure.min( index );
+    }
+  } );
+
+  // if a point failed, it is computed again on its rank to throw the original exception there
+  localIndex const globalFirstFailure = MpiWrapper::min( static_cast< localIndex >( firstFailure.get() ) );
+  if( globalFirstFailure < numValues )
+  {
+    if( globalFirstFailure >= begin && globalFirstFailure < end )
+    {
+      func( globalFirstFailure % nPressures, globalFirstFailure / nPressures );
+    }
+    GEOSX_THROW( "The computation of a property table failed on another rank", InputError );
+  }
+
+  MpiWrapper::allReduce( values.data(), values.data(), LvArray::integerConversion< int >( numValues ), MPI_SUM, MPI_COMM_GEOSX );
+}
+
 } // namespace PVTFunctionHelpers
 
 } // namespace PVTProps
@@ -22,6 +22,7 @@
 #include "PVTFunctionBase.hpp"
 
 #include "constitutive/fluid/layouts.hpp"
+#include "constitutive/fluid/PVTFunctions/MultiPropertyTable.hpp"
 #include "constitutive/fluid/PVTFunctions/PVTFunctionHelpers.hpp"
 #include "functions/TableFunction.hpp"
 
@@ -66,6 +67,89 @@ public:
                 arraySlice1d< real64, USD3 > const & dValue,
                 bool useMass ) const;
 
+  /**
+   * @brief Compute the molar and the mass densities with a single evaluation of the tables.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] massValue the mass density
+   */
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            real64 & molarValue,
+                            real64 & massValue ) const;
+
+  /**
+   * @brief Compute the molar and the mass densities and their derivatives with a single evaluation of the tables.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[in] dPhaseComposition the derivatives of the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] dMolarValue the derivatives of the molar density
+   * @param[out] massValue the mass density
+   * @param[out] dMassValue the derivatives of the mass density
+   */
+  template< int USD1, int USD2, int USD3 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                            real64 & molarValue,
+                            arraySlice1d< real64, USD3 > const & dMolarValue,
+                            real64 & massValue,
+                            arraySlice1d< real64, USD3 > const & dMassValue ) const;
+
+  /**
+   * @brief Compute the molar and the mass densities from the brine density interpolated in a MultiPropertyTable.
+   * @param[in] tableValue the value of the brine density table
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] massValue the mass density
+   */
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( PTTableValue const & tableValue,
+                            real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            real64 & molarValue,
+                            real64 & massValue ) const;
+
+  /**
+   * @brief Compute the molar and the mass densities and their derivatives from the brine density interpolated in a MultiPropertyTable.
+   * @param[in] tableValue the value and derivatives of the brine density table
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[in] dPhaseComposition the derivatives of the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] dMolarValue the derivatives of the molar density
+   * @param[out] massValue the mass density
+   * @param[out] dMassValue the derivatives of the mass density
+   */
+  template< int USD1, int USD2, int USD3 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( PTTableValue const & tableValue,
+                            real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                            real64 & molarValue,
+                            arraySlice1d< real64, USD3 > const & dMolarValue,
+                            real64 & massValue,
+                            arraySlice1d< real64, USD3 > const & dMassValue ) const;
+
+  /// The brine density table can be interpolated in a MultiPropertyTable
+  static constexpr bool hasPTTable = true;
+
   virtual void move( LvArray::MemorySpace const space, bool const touch ) override
   {
     PVTFunctionBaseUpdate::move( space, touch );
@@ -74,6 +158,53 @@ public:
 
 protected:
 
+  /// Number of derivatives of the densities (pressure, temperature, and the CO2 and water compositions)
+  static constexpr integer numDerivs = multifluid::DerivativeOffset::dC + 2;
+
+  /**
+   * @brief Compute the terms of equation (1) from Garcia (2001), shared by the molar and the mass densities.
+   * @param[in] tableValue the value of the brine density table
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[out] density the density of the brine without CO2
+   * @param[out] conc the CO2 concentration
+   * @param[out] concDensVol the CO2 concentration times the brine density times the CO2 apparent molar volume
+   */
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void computeGarciaTerms( PTTableValue const & tableValue,
+                           real64 const & temperature,
+                           arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                           real64 & density,
+                           real64 & conc,
+                           real64 & concDensVol ) const;
+
+  /**
+   * @brief Compute the terms of equation (1) from Garcia (2001) and their derivatives, ordered as in multifluid::DerivativeOffset.
+   * @param[in] tableValue the value and derivatives of the brine density table
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[in] dPhaseComposition the derivatives of the phase composition
+   * @param[out] density the density of the brine without CO2
+   * @param[out] dDensity the derivatives of the density of the brine without CO2
+   * @param[out] conc the CO2 concentration
+   * @param[out] dConc the derivatives of the CO2 concentration
+   * @param[out] concDensVol the CO2 concentration times the brine density times the CO2 apparent molar volume
+   * @param[out] dConcDensVol the derivatives of concDensVol
+   */
+  template< int USD1, int USD2 >
+  GEOSX_HOST_DEVICE
+  void computeGarciaTerms( PTTableValue const & tableValue,
+                           real64 const & temperature,
+                           arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                           arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                           real64 & density,
+                           real64 ( &dDensity )[numDerivs],
+                           real64 & conc,
+                           real64 ( &dConc )[numDerivs],
+                           real64 & concDensVol,
+                           real64 ( &dConcDensVol )[numDerivs] ) const;
+
   /// Table with brine density tabulated as a function (P,T,sal)
   TableFunction::KernelWrapper m_brineDensityTable;
 
@@ -112,6 +243,7 @@ public:
    */
   KernelWrapper createKernelWrapper() const;
 
+  virtual TableFunction const * pressureTemperatureTable() const override { return m_brineDensityTable; }
 
 private:
 
@@ -128,11 +260,12 @@ private:
 
 template< int USD1 >
 GEOSX_HOST_DEVICE
-void PhillipsBrineDensityUpdate::compute( real64 const & pressure,
-                                          real64 const & temperature,
-                                          arraySlice1d< real64 const, USD1 > const & phaseComposition,
-                                          real64 & value,
-                                          bool useMass ) const
+void PhillipsBrineDensityUpdate::computeGarciaTerms( PTTableValue const & tableValue,
+                                                     real64 const & temperature,
+                                                     arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                     real64 & density,
+                                                     real64 & conc,
+                                                     real64 & concDensVol ) const
 {
   // this method implements the method proposed by E. Garcia (2001)
 
@@ -142,8 +275,7 @@ void PhillipsBrineDensityUpdate::compute( real64 const & pressure,
   constexpr real64 c = 8.740e-4;
   constexpr real64 d = -5.044e-7;
 
-  real64 const input[2] = { pressure, temperature };
-  real64 const density = m_brineDensityTable.compute( input );
+  density = tableValue.value;
 
   // equation (2) from Garcia (2001)
   real64 const squaredTemp = temperature * temperature;
@@ -156,32 +288,24 @@ void PhillipsBrineDensityUpdate::compute( real64 const & pressure,
   real64 const wMwInv = 1.0 / m_componentMolarWeight[m_waterIndex];
   real64 const oneMinusCO2PhaseCompInv = 1.0 / ( 1.0 - phaseComposition[m_CO2Index] );
   real64 const coef = wMwInv * phaseComposition[m_CO2Index] * oneMinusCO2PhaseCompInv;
-  real64 const conc = coef * density;
+  conc = coef * density;
 
   // CO2 concentration times density times vol
-  real64 const concDensVol = conc * density * V;
-
-  // Brine density
-  // equation (1) from Garcia (2001)
-  if( useMass )
-  {
-    value = density + m_componentMolarWeight[m_CO2Index] * conc - concDensVol;
-  }
-  else
-  {
-    value = density / m_componentMolarWeight[m_waterIndex] + conc - concDensVol / m_componentMolarWeight[m_waterIndex];
-  }
+  concDensVol = conc * density * V;
 }
 
-template< int USD1, int USD2, int USD3 >
+template< int USD1, int USD2 >
 GEOSX_HOST_DEVICE
-void PhillipsBrineDensityUpdate::compute( real64 const & pressure,
-                                          real64 const & temperature,
-                                          arraySlice1d< real64 const, USD1 > const & phaseComposition,
-                                          arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
-                                          real64 & value,
-                                          arraySlice1d< real64, USD3 > const & dValue,
-                                          bool useMass ) const
+void PhillipsBrineDensityUpdate::computeGarciaTerms( PTTableValue const & tableValue,
+                                                     real64 const & temperature,
+                                                     arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                     arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                                     real64 & density,
+                                                     real64 ( & dDensity )[numDerivs],
+                                                     real64 & conc,
+                                                     real64 ( & dConc )[numDerivs],
+                                                     real64 & concDensVol,
+                                                     real64 ( & dConcDensVol )[numDerivs] ) const
 {
   using Deriv = multifluid::DerivativeOffset;
 
@@ -193,9 +317,12 @@ void PhillipsBrineDensityUpdate::compute( real64 const & pressure,
   constexpr real64 c = 8.740e-4;
   constexpr real64 d = -5.044e-7;
 
-  real64 const input[2] = { pressure, temperature };
-  real64 densityDeriv[2]{};
-  real64 const density = m_brineDensityTable.compute( input, densityDeriv );
+  real64 const ( &densityDeriv )[2] = tableValue.dValue;
+  density = tableValue.value;
+  dDensity[Deriv::dP] = densityDeriv[0];
+  dDensity[Deriv::dT] = densityDeriv[1];
+  dDensity[Deriv::dC+m_CO2Index] = 0.0;
+  dDensity[Deriv::dC+m_waterIndex] = 0.0;
 
   // equation (2) from Garcia (2001)
   real64 const squaredTemp = temperature * temperature;
@@ -218,55 +345,168 @@ void PhillipsBrineDensityUpdate::compute( real64 const & pressure,
   dCoef_dComp[m_CO2Index] = wMwInv * dPhaseComposition[m_CO2Index][Deriv::dC+m_CO2Index] * oneMinusCO2PhaseCompInvSquared;
   dCoef_dComp[m_waterIndex] = wMwInv * dPhaseComposition[m_CO2Index][Deriv::dC+m_waterIndex] * oneMinusCO2PhaseCompInvSquared;
 
-  real64 const conc = coef * density;
-  real64 const dConc_dPres = dCoef_dPres * density + coef * densityDeriv[0];
-  real64 const dConc_dTemp = dCoef_dTemp * density + coef * densityDeriv[1];
-  real64 dConc_dComp[2]{};
-  dConc_dComp[m_CO2Index] = dCoef_dComp[m_CO2Index] * density;
-  dConc_dComp[m_waterIndex] = dCoef_dComp[m_waterIndex] * density;
+  conc = coef * density;
+  dConc[Deriv::dP] = dCoef_dPres * density + coef * densityDeriv[0];
+  dConc[Deriv::dT] = dCoef_dTemp * density + coef * densityDeriv[1];
+  dConc[Deriv::dC+m_CO2Index] = dCoef_dComp[m_CO2Index] * density;
+  dConc[Deriv::dC+m_waterIndex] = dCoef_dComp[m_waterIndex] * density;
 
   // CO2 concentration times density times vol
-  real64 const concDensVol = conc * density * V;
-  real64 const dConcDensVol_dPres = ( dConc_dPres * density + conc * densityDeriv[0] ) * V;
-  real64 const dConcDensVol_dTemp = ( dConc_dTemp * density + conc * densityDeriv[1] ) * V
-                                    + conc * density * dV_dTemp;
-  real64 dConcDensVol_dComp[2]{};
-  dConcDensVol_dComp[m_CO2Index] = dConc_dComp[m_CO2Index] * density * V;
-  dConcDensVol_dComp[m_waterIndex] = dConc_dComp[m_waterIndex] * density * V;
+  concDensVol = conc * density * V;
+  dConcDensVol[Deriv::dP] = ( dConc[Deriv::dP] * density + conc * densityDeriv[0] ) * V;
+  dConcDensVol[Deriv::dT] = ( dConc[Deriv::dT] * density + conc * densityDeriv[1] ) * V
+                            + conc * density * dV_dTemp;
+  dConcDensVol[Deriv::dC+m_CO2Index] = dConc[Deriv::dC+m_CO2Index] * density * V;
+  dConcDensVol[Deriv::dC+m_waterIndex] = dConc[Deriv::dC+m_waterIndex] * density * V;
+}
+
+template< int USD1 >
+GEOSX_HOST_DEVICE
+void PhillipsBrineDensityUpdate::compute( real64 const & pressure,
+                                          real64 const & temperature,
+                                          arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                          real64 & value,
+                                          bool useMass ) const
+{
+  real64 density = 0.0;
+  real64 conc = 0.0;
+  real64 concDensVol = 0.0;
+  computeGarciaTerms( PTTableValue::interpolate( m_brineDensityTable, pressure, temperature ),
+                      temperature, phaseComposition, density, conc, concDensVol );
+
+  // Brine density
+  // equation (1) from Garcia (2001)
+  if( useMass )
+  {
+    value = density + m_componentMolarWeight[m_CO2Index] * conc - concDensVol;
+  }
+  else
+  {
+    value = density / m_componentMolarWeight[m_waterIndex] + conc - concDensVol / m_componentMolarWeight[m_waterIndex];
+  }
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+void PhillipsBrineDensityUpdate::compute( real64 const & pressure,
+                                          real64 const & temperature,
+                                          arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                          arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                          real64 & value,
+                                          arraySlice1d< real64, USD3 > const & dValue,
+                                          bool useMass ) const
+{
+  real64 density = 0.0;
+  real64 conc = 0.0;
+  real64 concDensVol = 0.0;
+  real64 dDensity[numDerivs]{};
+  real64 dConc[numDerivs]{};
+  real64 dConcDensVol[numDerivs]{};
+  computeGarciaTerms( PTTableValue::interpolateWithDerivatives( m_brineDensityTable, pressure, temperature ),
+                      temperature, phaseComposition, dPhaseComposition,
+                      density, dDensity, conc, dConc, concDensVol, dConcDensVol );
 
   // Brine density
   // equation (1) from Garcia (2001)
   if( useMass )
   {
-    value = density
-            + m_componentMolarWeight[m_CO2Index] * conc
-            - concDensVol;
-    dValue[Deriv::dP] = densityDeriv[0]
-                        + m_componentMolarWeight[m_CO2Index] * dConc_dPres
-                        - dConcDensVol_dPres;
-    dValue[Deriv::dT] = densityDeriv[1]
-                        + m_componentMolarWeight[m_CO2Index] * dConc_dTemp
-                        - dConcDensVol_dTemp;
-    dValue[Deriv::dC+m_CO2Index] = m_componentMolarWeight[m_CO2Index] * dConc_dComp[m_CO2Index]
-                                   - dConcDensVol_dComp[m_CO2Index];
-    dValue[Deriv::dC+m_waterIndex] = m_componentMolarWeight[m_CO2Index] * dConc_dComp[m_waterIndex]
-                                     - dConcDensVol_dComp[m_waterIndex];
+    value = density + m_componentMolarWeight[m_CO2Index] * conc - concDensVol;
+    for( integer i = 0; i < numDerivs; ++i )
+    {
+      dValue[i] = dDensity[i] + m_componentMolarWeight[m_CO2Index] * dConc[i] - dConcDensVol[i];
+    }
   }
   else
   {
-    value = density / m_componentMolarWeight[m_waterIndex]
-            + conc
-            - concDensVol / m_componentMolarWeight[m_waterIndex];
-    dValue[Deriv::dP] = densityDeriv[0]  / m_componentMolarWeight[m_waterIndex]
-                        + dConc_dPres
-                        - dConcDensVol_dPres / m_componentMolarWeight[m_waterIndex];
-    dValue[Deriv::dT] = densityDeriv[1]  / m_componentMolarWeight[m_waterIndex]
-                        + dConc_dTemp
-                        - dConcDensVol_dTemp  / m_componentMolarWeight[m_waterIndex];
-    dValue[Deriv::dC+m_CO2Index] = dConc_dComp[m_CO2Index]
-                                   - dConcDensVol_dComp[m_CO2Index] / m_componentMolarWeight[m_waterIndex];
-    dValue[Deriv::dC+m_waterIndex] = dConc_dComp[m_waterIndex]
-                                     - dConcDensVol_dComp[m_waterIndex] / m_componentMolarWeight[m_waterIndex];
+    value = density / m_componentMolarWeight[m_waterIndex] + conc - concDensVol / m_componentMolarWeight[m_waterIndex];
+    for( integer i = 0; i < numDerivs; ++i )
+    {
+      dValue[i] = dDensity[i] / m_componentMolarWeight[m_waterIndex] + dConc[i] - dConcDensVol[i] / m_componentMolarWeight[m_waterIndex];
+    }
+  }
+}
+
+template< int USD1 >
+GEOSX_HOST_DEVICE
+void PhillipsBrineDensityUpdate::computeMolarAndMass( real64 const & pressure,
+                                                      real64 const & temperature,
+                                                      arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                      real64 & molarValue,
+                                                      real64 & massValue ) const
+{
+  computeMolarAndMass( PTTableValue::interpolate( m_brineDensityTable, pressure, temperature ),
+                       pressure, temperature, phaseComposition, molarValue, massValue );
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+void PhillipsBrineDensityUpdate::computeMolarAndMass( real64 const & pressure,
+                                                      real64 const & temperature,
+                                                      arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                      arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                                      real64 & molarValue,
+                                                      arraySlice1d< real64, USD3 > const & dMolarValue,
+                                                      real64 & massValue,
+                                                      arraySlice1d< real64, USD3 > const & dMassValue ) const
+{
+  computeMolarAndMass( PTTableValue::interpolateWithDerivatives( m_brineDensityTable, pressure, temperature ),
+                       pressure, temperature, phaseComposition, dPhaseComposition,
+                       molarValue, dMolarValue, massValue, dMassValue );
+}
+
+template< int USD1 >
+GEOSX_HOST_DEVICE
+void PhillipsBrineDensityUpdate::computeMolarAndMass( PTTableValue const & tableValue,
+                                                      real64 const & pressure,
+                                                      real64 const & temperature,
+                                                      arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                      real64 & molarValue,
+                                                      real64 & massValue ) const
+{
+  GEOSX_UNUSED_VAR( pressure );
+
+  real64 density = 0.0;
+  real64 conc = 0.0;
+  real64 concDensVol = 0.0;
+  computeGarciaTerms( tableValue, temperature, phaseComposition, density, conc, concDensVol );
+
+  // Brine density
+  // equation (1) from Garcia (2001)
+  massValue = density + m_componentMolarWeight[m_CO2Index] * conc - concDensVol;
+  molarValue = density / m_componentMolarWeight[m_waterIndex] + conc - concDensVol / m_componentMolarWeight[m_waterIndex];
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+void PhillipsBrineDensityUpdate::computeMolarAndMass( PTTableValue const & tableValue,
+                                                      real64 const & pressure,
+                                                      real64 const & temperature,
+                                                      arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                      arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                                      real64 & molarValue,
+                                                      arraySlice1d< real64, USD3 > const & dMolarValue,
+                                                      real64 & massValue,
+                                                      arraySlice1d< real64, USD3 > const & dMassValue ) const
+{
+  GEOSX_UNUSED_VAR( pressure );
+
+  real64 density = 0.0;
+  real64 conc = 0.0;
+  real64 concDensVol = 0.0;
+  real64 dDensity[numDerivs]{};
+  real64 dConc[numDerivs]{};
+  real64 dConcDensVol[numDerivs]{};
+  computeGarciaTerms( tableValue, temperature, phaseComposition, dPhaseComposition,
+                      density, dDensity, conc, dConc, concDensVol, dConcDensVol );
+
+  // Brine density
+  // equation (1) from Garcia (2001)
+  massValue = density + m_componentMolarWeight[m_CO2Index] * conc - concDensVol;
+  molarValue = density / m_componentMolarWeight[m_waterIndex] + conc - concDensVol / m_componentMolarWeight[m_waterIndex];
+  for( integer i = 0; i < numDerivs; ++i )
+  {
+    dMassValue[i] = dDensity[i] + m_componentMolarWeight[m_CO2Index] * dConc[i] - dConcDensVol[i];
+    dMolarValue[i] = dDensity[i] / m_componentMolarWeight[m_waterIndex] + dConc[i] - dConcDensVol[i] / m_componentMolarWeight[m_waterIndex];
   }
 }
 
@@ -21,6 +21,9 @@
 #include "constitutive/fluid/PVTFunctions/CO2EOSSolver.hpp"
 #include "functions/FunctionManager.hpp"
 
+#include <algorithm>
+#include <cstdint>
+
 namespace geosx
 {
 
@@ -210,32 +213,32 @@ TableFunction const * makeDensityTable( string_array const & inputParams,
                                         string const & functionName,
                                         FunctionManager & functionManager )
 {
-  PTTableCoordinates tableCoords;
-  PVTFunctionHelpers::initializePropertyTable( inputParams, tableCoords );
-
-  real64 tolerance = 1e-10;
-  try
-  {
-    if( inputParams.size() >= 9 )
-    {
-      tolerance = stod( inputParams[8] );
-    }
-  }
-  catch( const std::invalid_argument & e )
-  {
-    GEOSX_THROW( GEOSX_FMT( "{}: invalid model parameter value: {}", functionName, e.what() ), InputError );
-  }
-
-  array1d< real64 > densities( tableCoords.nPressures() * tableCoords.nTemperatures() );
-  SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
-
-  string const & tableName = functionName + "_table";
+  string const tableName = functionName + "_table";
   if( functionManager.hasGroup< TableFunction >( tableName ) )
   {
     return functionManager.getGroupPointer< TableFunction >( tableName );
   }
   else
   {
+    PTTableCoordinates tableCoords;
+    PVTFunctionHelpers::initializePropertyTable( inputParams, tableCoords );
+
+    real64 tolerance = 1e-10;
+    try
+    {
+      if( inputParams.size() >= 9 )
+      {
+        tolerance = stod( inputParams[8] );
+      }
+    }
+    catch( const std::invalid_argument & e )
+    {
+      GEOSX_THROW( GEOSX_FMT( "{}: invalid model parameter value: {}", functionName, e.what() ), InputError );
+    }
+
+    array1d< real64 > densities( tableCoords.nPressures() * tableCoords.nTemperatures() );
+    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
+
     TableFunction * const densityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
     densityTable->setTableCoordinates( tableCoords.getCoords() );
     densityTable->setTableValues( densities );
@@ -244,6 +247,33 @@ TableFunction const * makeDensityTable( string_array const & inputParams,
   }
 }
 
+/**
+ * @brief Name of the table storing the Span-Wagner densities computed on a set of (p,T) points with a given tolerance
+ * @param[in] tableCoords the (p,T) coordinates of the table
+ * @param[in] tolerance the tolerance of the density solver
+ * @return the name, built from a hash of the coordinates and of the tolerance
+ */
+string sharedDensityTableName( PTTableCoordinates const & tableCoords,
+                               real64 const tolerance )
+{
+  // FNV-1a hash
+  std::uint64_t hash = 14695981039346656037ULL;
+  auto const hashValues = [&]( real64 const * const data, localIndex const size )
+  {
+    unsigned char const * const bytes = reinterpret_cast< unsigned char const * >( data );
+    for( std::size_t k = 0; k < static_cast< std::size_t >( size ) * sizeof( real64 ); ++k )
+    {
+      hash = ( hash ^ bytes[k] ) * 1099511628211ULL;
+    }
+  };
+  hashValues( tableCoords.getPressures().data(), tableCoords.nPressures() );
+  hashValues( tableCoords.getTemperatures().data(), tableCoords.nTemperatures() );
+  hashValues( &tolerance, 1 );
+
+  return GEOSX_FMT( "{}_{}x{}_{:016x}_table",
+                    SpanWagnerCO2Density::catalogName(), tableCoords.nPressures(), tableCoords.nTemperatures(), hash );
+}
+
 } // namespace
 
 void SpanWagnerCO2Density::calculateCO2Density( string const & functionName,
@@ -251,20 +281,37 @@ void SpanWagnerCO2Density::calculateCO2Density( string const & functionName,
                                                 PTTableCoordinates const & tableCoords,
                                                 array1d< real64 > const & densities )
 {
+  // the densities are computed once for each set of (p,T) points, and then shared by all the models needing them
+  // (density, viscosity, and enthalpy models), which usually use the same coordinates
+  FunctionManager & functionManager = FunctionManager::getInstance();
+  string const sharedTableName = sharedDensityTableName( tableCoords, tolerance );
+  if( functionManager.hasGroup< TableFunction >( sharedTableName ) )
+  {
+    TableFunction const & sharedTable = functionManager.getGroup< TableFunction >( sharedTableName );
+    ArrayOfArraysView< real64 const > const sharedCoords = sharedTable.getCoordinates();
+    if( std::equal( sharedCoords[0].begin(), sharedCoords[0].end(), tableCoords.getPressures().begin(), tableCoords.getPressures().end() ) &&
+        std::equal( sharedCoords[1].begin(), sharedCoords[1].end(), tableCoords.getTemperatures().begin(), tableCoords.getTemperatures().end() ) )
+    {
+      densities.setValues< serialPolicy >( sharedTable.getValues() );
+      return;
+    }
+  }
 
   constexpr real64 TK_f = 273.15;
 
-  localIndex const nPressures = tableCoords.nPressures();
-  localIndex const nTemperatures = tableCoords.nTemperatures();
-
-  for( localIndex i = 0; i < nPressures; ++i )
+  PVTFunctionHelpers::computePropertyTable( tableCoords, [&]( localIndex const i, localIndex const j )
   {
     real64 const PPa = tableCoords.getPressure( i );
-    for( localIndex j = 0; j < nTemperatures; ++j )
-    {
-      real64 const TK = tableCoords.getTemperature( j ) + TK_f;
-      densities[j*nPressures+i] = spanWagnerCO2DensityFunction( functionName, tolerance, TK, PPa, &co2HelmholtzEnergy );
-    }
+    real64 const TK = tableCoords.getTemperature( j ) + TK_f;
+    return spanWagnerCO2DensityFunction( functionName, tolerance, TK, PPa, &co2HelmholtzEnergy );
+  }, densities.toView() );
+
+  if( !functionManager.hasGroup< TableFunction >( sharedTableName ) )
+  {
+    TableFunction * const sharedTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", sharedTableName ) );
+    sharedTable->setTableCoordinates( tableCoords.getCoords() );
+    sharedTable->setTableValues( densities );
+    sharedTable->setInterpolationMethod( TableFunction::InterpolationType::Linear );
   }
 }
 
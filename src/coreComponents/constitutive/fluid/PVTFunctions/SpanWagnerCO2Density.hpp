@@ -22,6 +22,7 @@
 #include "PVTFunctionBase.hpp"
 
 #include "constitutive/fluid/layouts.hpp"
+#include "constitutive/fluid/PVTFunctions/MultiPropertyTable.hpp"
 #include "constitutive/fluid/PVTFunctions/PVTFunctionHelpers.hpp"
 #include "functions/TableFunction.hpp"
 
@@ -64,6 +65,89 @@ public:
                 arraySlice1d< real64, USD3 > const & dValue,
                 bool useMass ) const;
 
+  /**
+   * @brief Compute the molar and the mass densities with a single evaluation of the tables.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] massValue the mass density
+   */
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            real64 & molarValue,
+                            real64 & massValue ) const;
+
+  /**
+   * @brief Compute the molar and the mass densities and their derivatives with a single evaluation of the tables.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[in] dPhaseComposition the derivatives of the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] dMolarValue the derivatives of the molar density
+   * @param[out] massValue the mass density
+   * @param[out] dMassValue the derivatives of the mass density
+   */
+  template< int USD1, int USD2, int USD3 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                            real64 & molarValue,
+                            arraySlice1d< real64, USD3 > const & dMolarValue,
+                            real64 & massValue,
+                            arraySlice1d< real64, USD3 > const & dMassValue ) const;
+
+  /**
+   * @brief Compute the molar and the mass densities from the CO2 density interpolated in a MultiPropertyTable.
+   * @param[in] tableValue the value of the CO2 density table
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] massValue the mass density
+   */
+  template< int USD1 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( PTTableValue const & tableValue,
+                            real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            real64 & molarValue,
+                            real64 & massValue ) const;
+
+  /**
+   * @brief Compute the molar and the mass densities and their derivatives from the CO2 density interpolated in a MultiPropertyTable.
+   * @param[in] tableValue the value and derivatives of the CO2 density table
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] phaseComposition the phase composition
+   * @param[in] dPhaseComposition the derivatives of the phase composition
+   * @param[out] molarValue the molar density
+   * @param[out] dMolarValue the derivatives of the molar density
+   * @param[out] massValue the mass density
+   * @param[out] dMassValue the derivatives of the mass density
+   */
+  template< int USD1, int USD2, int USD3 >
+  GEOSX_HOST_DEVICE
+  void computeMolarAndMass( PTTableValue const & tableValue,
+                            real64 const & pressure,
+                            real64 const & temperature,
+                            arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                            arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                            real64 & molarValue,
+                            arraySlice1d< real64, USD3 > const & dMolarValue,
+                            real64 & massValue,
+                            arraySlice1d< real64, USD3 > const & dMassValue ) const;
+
+  /// The CO2 density table can be interpolated in a MultiPropertyTable
+  static constexpr bool hasPTTable = true;
+
   virtual void move( LvArray::MemorySpace const space, bool const touch ) override
   {
     PVTFunctionBaseUpdate::move( space, touch );
@@ -107,6 +191,17 @@ public:
    */
   KernelWrapper createKernelWrapper() const;
 
+  virtual TableFunction const * pressureTemperatureTable() const override { return m_CO2DensityTable; }
+
+  /**
+   * @brief Compute the CO2 density on the (p,T) points of a table.
+   * @param[in] functionName the name of the function, used in the error messages
+   * @param[in] tolerance the tolerance of the Newton solver of the Span-Wagner equation of state
+   * @param[in] tableCoords the (p,T) coordinates of the table
+   * @param[out] densities the densities, with the pressure index running fastest
+   * @note The points are distributed among the MPI ranks, so this function must be called on all the ranks.
+   *       The densities are computed once for a given set of points and tolerance, and reused in the subsequent calls.
+   */
   static
   void calculateCO2Density( string const & functionName,
                             real64 const & tolerance,
@@ -173,6 +268,78 @@ void SpanWagnerCO2DensityUpdate::compute( real64 const & pressure,
 
 }
 
+template< int USD1 >
+GEOSX_HOST_DEVICE
+void SpanWagnerCO2DensityUpdate::computeMolarAndMass( real64 const & pressure,
+                                                      real64 const & temperature,
+                                                      arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                      real64 & molarValue,
+                                                      real64 & massValue ) const
+{
+  computeMolarAndMass( PTTableValue::interpolate( m_CO2DensityTable, pressure, temperature ),
+                       pressure, temperature, phaseComposition, molarValue, massValue );
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+void SpanWagnerCO2DensityUpdate::computeMolarAndMass( real64 const & pressure,
+                                                      real64 const & temperature,
+                                                      arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                      arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                                      real64 & molarValue,
+                                                      arraySlice1d< real64, USD3 > const & dMolarValue,
+                                                      real64 & massValue,
+                                                      arraySlice1d< real64, USD3 > const & dMassValue ) const
+{
+  computeMolarAndMass( PTTableValue::interpolateWithDerivatives( m_CO2DensityTable, pressure, temperature ),
+                       pressure, temperature, phaseComposition, dPhaseComposition,
+                       molarValue, dMolarValue, massValue, dMassValue );
+}
+
+template< int USD1 >
+GEOSX_HOST_DEVICE
+void SpanWagnerCO2DensityUpdate::computeMolarAndMass( PTTableValue const & tableValue,
+                                                      real64 const & pressure,
+                                                      real64 const & temperature,
+                                                      arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                      real64 & molarValue,
+                                                      real64 & massValue ) const
+{
+  GEOSX_UNUSED_VAR( pressure, temperature, phaseComposition );
+
+  massValue = tableValue.value;
+  molarValue = massValue / m_componentMolarWeight[m_CO2Index];
+}
+
+template< int USD1, int USD2, int USD3 >
+GEOSX_HOST_DEVICE
+void SpanWagnerCO2DensityUpdate::computeMolarAndMass( PTTableValue const & tableValue,
+                                                      real64 const & pressure,
+                                                      real64 const & temperature,
+                                                      arraySlice1d< real64 const, USD1 > const & phaseComposition,
+                                                      arraySlice2d< real64 const, USD2 > const & dPhaseComposition,
+                                                      real64 & molarValue,
+                                                      arraySlice1d< real64, USD3 > const & dMolarValue,
+                                                      real64 & massValue,
+                                                      arraySlice1d< real64, USD3 > const & dMassValue ) const
+{
+  GEOSX_UNUSED_VAR( pressure, temperature, phaseComposition, dPhaseComposition );
+
+  using Deriv = multifluid::DerivativeOffset;
+
+  massValue = tableValue.value;
+
+  LvArray::forValuesInSlice( dMassValue, []( real64 & val ){ val = 0.0; } );
+  LvArray::forValuesInSlice( dMolarValue, []( real64 & val ){ val = 0.0; } );
+  dMassValue[Deriv::dP] = tableValue.dValue[0];
+  dMassValue[Deriv::dT] = tableValue.dValue[1];
+
+  real64 const mwInv = 1.0 / m_componentMolarWeight[m_CO2Index];
+  molarValue = massValue * mwInv;
+  dMolarValue[Deriv::dP] = tableValue.dValue[0] * mwInv;
+  dMolarValue[Deriv::dT] = tableValue.dValue[1] * mwInv;
+}
+
 } // end namespace PVTProps
 
 } // end namespace constitutive
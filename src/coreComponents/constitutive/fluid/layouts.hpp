@@ -43,6 +43,14 @@ struct DerivativeOffset
   static integer constexpr dC = 2;
 };
 
+#if defined( GEOSX_USE_MIXED_PRECISION_FLUID )
+/// Storage type of the fluid property derivatives (single precision, values and Jacobian remain in double precision)
+using DerivativeType = real32;
+#else
+/// Storage type of the fluid property derivatives
+using DerivativeType = real64;
+#endif
+
 #if defined( GEOSX_USE_CUDA )
 
 /// Constitutive model phase property array layout
@@ -146,6 +146,14 @@ public:
     }
   }
 
+  /**
+   * @brief Reset the state of the porosity model to the beginning of the time step, after a cut of the time step.
+   */
+  void resetStateToBeginningOfStep() const
+  {
+    getBasePorosityModel().resetStateToBeginningOfStep();
+  }
+
   /**
    * @brief get a constant reference to the solid internal energy model
    * return a constant SolidInternalEnergy reference to the solid internal energy model
@@ -149,12 +149,12 @@ public:
                                     real64 const & initialFluidTotalMassDensity,
                                     arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & fluidPhaseDensity,
                                     arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & fluidPhaseDensityOld,
-                                    arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > const & dFluidPhaseDensity,
+                                    arraySlice2d< constitutive::multifluid::DerivativeType const, constitutive::multifluid::USD_PHASE_DC - 2 > const & dFluidPhaseDensity,
                                     arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 2 > const & fluidPhaseCompFrac,
                                     arraySlice2d< real64 const, compflow::USD_PHASE_COMP - 1 > const & fluidPhaseCompFracOld,
-                                    arraySlice3d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC -2 > const & dFluidPhaseCompFrac,
+                                    arraySlice3d< constitutive::multifluid::DerivativeType const, constitutive::multifluid::USD_PHASE_COMP_DC -2 > const & dFluidPhaseCompFrac,
                                     arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & fluidPhaseMassDensity,
-                                    arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > const & dFluidPhaseMassDensity,
+                                    arraySlice2d< constitutive::multifluid::DerivativeType const, constitutive::multifluid::USD_PHASE_DC - 2 > const & dFluidPhaseMassDensity,
                                     arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & fluidPhaseSaturation,
                                     arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & fluidPhaseSaturationOld,
                                     arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & dFluidPhaseSaturation_dPressure,
@@ -344,6 +344,25 @@ public:
 //                                           volStrain );
   }
 
+  /**
+   * @brief Update the porosity in the flow step of the fixed-stress split.
+   * @param[in] k the element index
+   * @param[in] q the quadrature point index
+   * @param[in] pressure the pressure at the beginning of the time step
+   * @param[in] deltaPressure the pressure increment since the beginning of the time step
+   *
+   * The mean total stress increment of the last mechanics solve is held fixed.
+   */
+  GEOSX_HOST_DEVICE
+  void updateStateFromPressureFixedStress( localIndex const k,
+                                           localIndex const q,
+                                           real64 const & pressure,
+                                           real64 const & deltaPressure ) const
+  {
+    GEOSX_UNUSED_VAR( pressure );
+    m_porosityUpdate.updateFromPressureFixedStress( k, q, deltaPressure, m_solidUpdate.getBulkModulus( k ) );
+  }
+
   /**
    * @brief Return the stiffness at a given element (small-strain interface)
    *
@@ -461,6 +480,11 @@ private:
     porosity = m_porosityUpdate.getPorosity( k, q );
     porosityOld = m_porosityUpdate.getOldPorosity( k, q );
     porosityInit = m_porosityUpdate.getInitialPorosity( k, q );
+
+    // Save the mean total stress increment, estimated with the drained bulk modulus, for the flow step of the fixed-stress split
+    real64 const meanTotalStressIncrement = m_solidUpdate.getBulkModulus( k ) * LvArray::tensorOps::symTrace< 3 >( strainIncrement )
+                                            - m_porosityUpdate.getBiotCoefficient( k ) * deltaFluidPressure;
+    m_porosityUpdate.saveMeanTotalStressIncrement( k, q, meanTotalStressIncrement );
   }
 
   GEOSX_HOST_DEVICE
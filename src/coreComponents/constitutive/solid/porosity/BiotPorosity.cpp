@@ -36,11 +36,17 @@ BiotPorosity::BiotPorosity( string const & name, Group * const parent ):
 
   registerWrapper( viewKeyStruct::biotCoefficientString(), &m_biotCoefficient ).
     setDescription( "Biot coefficient." );
+
+  registerWrapper( viewKeyStruct::meanTotalStressIncrementString(), &m_meanTotalStressIncrement ).
+    setApplyDefaultValue( 0.0 ).
+    setDescription( "Mean total stress increment of the last mechanics solve, used by the fixed-stress split" );
 }
 
 void BiotPorosity::allocateConstitutiveData( dataRepository::Group & parent,
                                              localIndex const numConstitutivePointsPerParentIndex )
 {
+  m_meanTotalStressIncrement.resize( 0, numConstitutivePointsPerParentIndex );
+
   PorosityBase::allocateConstitutiveData( parent, numConstitutivePointsPerParentIndex );
 }
 
@@ -71,6 +77,22 @@ void BiotPorosity::initializeState() const
   } );
 }
 
+void BiotPorosity::saveConvergedState() const
+{
+  PorosityBase::saveConvergedState();
+
+  // the stress increments are measured from the beginning of the time step
+  arrayView2d< real64 > const meanTotalStressIncrement = m_meanTotalStressIncrement;
+  meanTotalStressIncrement.zero();
+}
+
+void BiotPorosity::resetStateToBeginningOfStep() const
+{
+  // the stress increments computed with the abandoned time step are discarded
+  arrayView2d< real64 > const meanTotalStressIncrement = m_meanTotalStressIncrement;
+  meanTotalStressIncrement.zero();
+}
+
 
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, BiotPorosity, string const &, Group * const )
 } /* namespace constitutive */
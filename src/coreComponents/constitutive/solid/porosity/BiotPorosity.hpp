@@ -50,12 +50,14 @@ public:
                        arrayView2d< real64 > const & initialPorosity,
                        arrayView1d< real64 > const & referencePorosity,
                        arrayView1d< real64 > const & biotCoefficient,
+                       arrayView2d< real64 > const & meanTotalStressIncrement,
                        real64 const & grainBulkModulus ): PorosityBaseUpdates( newPorosity,
                                                                                oldPorosity,
                                                                                dPorosity_dPressure,
                                                                                initialPorosity,
                                                                                referencePorosity ),
     m_biotCoefficient( biotCoefficient ),
+    m_meanTotalStressIncrement( meanTotalStressIncrement ),
     m_grainBulkModulus( grainBulkModulus )
   {}
 
@@ -88,6 +90,47 @@ public:
     savePorosity( k, q, porosity, biotSkeletonModulusInverse );
   }
 
+  /**
+   * @brief Save the mean total stress increment computed by the mechanics.
+   * @param[in] k Element index.
+   * @param[in] q Quadrature point index.
+   * @param[in] meanTotalStressIncrement the increment of the mean total stress since the beginning of the time step
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void saveMeanTotalStressIncrement( localIndex const k,
+                                     localIndex const q,
+                                     real64 const & meanTotalStressIncrement ) const
+  {
+    m_meanTotalStressIncrement[k][q] = meanTotalStressIncrement;
+  }
+
+  /**
+   * @brief Update the porosity from the pressure, with the mean total stress increment of the last mechanics solve held fixed.
+   * @param[in] k Element index.
+   * @param[in] q Quadrature point index.
+   * @param[in] deltaPressure the pressure increment since the beginning of the time step
+   * @param[in] bulkModulus the drained bulk modulus
+   *
+   * This is the porosity used by the flow step of the fixed-stress split: the term b^2 / K_dr
+   * added to the pore compressibility accounts for the volumetric strain induced by the pressure change.
+   */
+  GEOSX_HOST_DEVICE
+  void updateFromPressureFixedStress( localIndex const k,
+                                      localIndex const q,
+                                      real64 const & deltaPressure,
+                                      real64 const & bulkModulus ) const
+  {
+    real64 const biotSkeletonModulusInverse = (m_biotCoefficient[k] - m_referencePorosity[k]) / m_grainBulkModulus;
+    real64 const fixedStressModulusInverse = m_biotCoefficient[k] * m_biotCoefficient[k] / bulkModulus;
+
+    real64 const porosity = m_oldPorosity[k][q]
+                            + m_biotCoefficient[k] * m_meanTotalStressIncrement[k][q] / bulkModulus
+                            + ( biotSkeletonModulusInverse + fixedStressModulusInverse ) * deltaPressure;
+
+    savePorosity( k, q, porosity, biotSkeletonModulusInverse + fixedStressModulusInverse );
+  }
+
   GEOSX_HOST_DEVICE
   void updateBiotCoefficient( localIndex const k,
                               real64 const bulkModulus ) const
@@ -98,6 +141,8 @@ public:
 protected:
   arrayView1d< real64 > m_biotCoefficient;
 
+  arrayView2d< real64 > m_meanTotalStressIncrement;
+
   real64 m_grainBulkModulus;
 };
 
@@ -117,10 +162,15 @@ public:
   {
     static constexpr char const *biotCoefficientString() { return "biotCoefficient"; }
     static constexpr char const *grainBulkModulusString() { return "grainBulkModulus"; }
+    static constexpr char const *meanTotalStressIncrementString() { return "meanTotalStressIncrement"; }
   } viewKeys;
 
   virtual void initializeState() const override final;
 
+  virtual void saveConvergedState() const override final;
+
+  virtual void resetStateToBeginningOfStep() const override final;
+
   using KernelWrapper = BiotPorosityUpdates;
 
   /**
@@ -135,6 +185,7 @@ public:
                           m_initialPorosity,
                           m_referencePorosity,
                           m_biotCoefficient,
+                          m_meanTotalStressIncrement,
                           m_grainBulkModulus );
   }
 
@@ -143,6 +194,9 @@ protected:
 
   array1d< real64 > m_biotCoefficient;
 
+  /// Mean total stress increment of the last mechanics solve, used by the fixed-stress split
+  array2d< real64 > m_meanTotalStressIncrement;
+
   real64 m_grainBulkModulus;
 };
 
@@ -201,6 +201,10 @@ public:
   /// Save state data in preparation for next timestep
   virtual void saveConvergedState() const override;
 
+  /// Reset the state data to the beginning of the time step, after a cut of the time step
+  virtual void resetStateToBeginningOfStep() const
+  {}
+
   /**
    * @brief Initialize newPorosity and oldPorosity.
    */
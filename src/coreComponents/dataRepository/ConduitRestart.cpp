@@ -18,6 +18,7 @@
 
 // Source includes
 #include "ConduitRestart.hpp"
+#include "ExecutableGroup.hpp"
 #include "common/MpiWrapper.hpp"
 #include "common/TimingMacros.hpp"
 #include "common/Path.hpp"
@@ -25,6 +26,9 @@
 // TPL includes
 #include <conduit_relay.hpp>
 
+// System includes
+#include <memory>
+
 namespace geosx
 {
 namespace dataRepository
@@ -35,6 +39,9 @@ string writeRootFile( conduit::Node & root, string const & rootPath )
   string const completeRootPath = rootPath;
   string const rootFileName = splitPath( completeRootPath ).second;
 
+  // HDF5 is not called concurrently with the background outputs
+  ExecutableGroup::waitForAllPendingExecutions();
+
   if( MpiWrapper::commRank() == 0 )
   {
     makeDirsForPath( completeRootPath );
@@ -58,6 +65,8 @@ string writeRootFile( conduit::Node & root, string const & rootPath )
 
 string readRootNode( string const & rootPath )
 {
+  ExecutableGroup::waitForAllPendingExecutions();
+
   string rankFilePattern;
   if( MpiWrapper::commRank() == 0 )
   {
@@ -91,6 +100,23 @@ void writeTree( string const & path, conduit::Node & root )
   conduit::relay::io::save( root, filePathForRank, "hdf5" );
 }
 
+std::function< void() > snapshotTree( string const & path, conduit::Node & root )
+{
+  GEOSX_MARK_FUNCTION;
+
+  conduit::Node rootFileNode;
+  string const filePathForRank = writeRootFile( rootFileNode, path );
+  GEOSX_LOG_RANK( "Writing out restart file at " << filePathForRank );
+
+  // the copy owns its data, so the tree can change while the copy is written (without any MPI call)
+  std::shared_ptr< conduit::Node > const snapshot = std::make_shared< conduit::Node >();
+  root.compact_to( *snapshot );
+  return [snapshot, filePathForRank]()
+  {
+    conduit::relay::io::save( *snapshot, filePathForRank, "hdf5" );
+  };
+}
+
 void loadTree( string const & path, conduit::Node & root )
 {
   GEOSX_MARK_FUNCTION;
@@ -99,5 +125,14 @@ void loadTree( string const & path, conduit::Node & root )
   conduit::relay::io::load( filePathForRank, "hdf5", root );
 }
 
+void mergeTree( string const & path, conduit::Node & root )
+{
+  GEOSX_MARK_FUNCTION;
+  string const filePathForRank = readRootNode( path );
+  GEOSX_LOG_RANK( "Reading in restart file at " << filePathForRank );
+  // merge into the existing nodes instead of resetting them, since the groups of the tree hold references to them
+  conduit::relay::io::load_merged( filePathForRank, "hdf5", root );
+}
+
 } /* end namespace dataRepository */
 } /* end namespace geosx */
@@ -27,7 +27,7 @@
 #include <conduit.hpp>
 
 // System includes
-
+#include <functional>
 
 /// @cond DO_NOT_DOCUMENT
 
@@ -91,8 +91,12 @@ string writeRootFile( conduit::Node & root, string const & rootPath );
 
 void writeTree( string const & path, conduit::Node & root );
 
+std::function< void() > snapshotTree( string const & path, conduit::Node & root );
+
 void loadTree( string const & path, conduit::Node & root );
 
+void mergeTree( string const & path, conduit::Node & root );
+
 } // namespace dataRepository
 } // namespace geosx
 
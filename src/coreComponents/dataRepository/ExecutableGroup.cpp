@@ -18,9 +18,100 @@
 
 #include "ExecutableGroup.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 namespace geosx
 {
 
+namespace
+{
+
+/**
+ * @class BackgroundExecutor
+ * @brief A single thread running the asynchronous executions of all the targets, in launch order.
+ */
+class BackgroundExecutor
+{
+public:
+
+  ~BackgroundExecutor()
+  {
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      m_done = true;
+    }
+    m_condition.notify_one();
+    if( m_thread.joinable() )
+    {
+      m_thread.join();
+    }
+  }
+
+  std::future< void > launch( std::function< void() > work )
+  {
+    std::packaged_task< void() > task( std::move( work ) );
+    std::future< void > result = task.get_future();
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      if( !m_thread.joinable() )
+      {
+        m_thread = std::thread( [this]() { run(); } );
+      }
+      m_tasks.emplace_back( std::move( task ) );
+    }
+    m_condition.notify_one();
+    return result;
+  }
+
+  void waitForAll()
+  {
+    if( !m_thread.joinable() || std::this_thread::get_id() == m_thread.get_id() )
+    {
+      return;
+    }
+    // the tasks run in launch order, all of them have completed once an empty one has
+    launch( [](){} ).get();
+  }
+
+private:
+
+  void run()
+  {
+    while( true )
+    {
+      std::packaged_task< void() > task;
+      {
+        std::unique_lock< std::mutex > lock( m_mutex );
+        m_condition.wait( lock, [this]() { return m_done || !m_tasks.empty(); } );
+        if( m_tasks.empty() )
+        {
+          return;
+        }
+        task = std::move( m_tasks.front() );
+        m_tasks.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque< std::packaged_task< void() > > m_tasks;
+  std::thread m_thread;
+  bool m_done = false;
+};
+
+BackgroundExecutor & getBackgroundExecutor()
+{
+  static BackgroundExecutor executor;
+  return executor;
+}
+
+}
+
 void ExecutableGroup::signalToPrepareForExecution( real64 const GEOSX_UNUSED_PARAM( time_n ),
                                                    real64 const GEOSX_UNUSED_PARAM( dt ),
                                                    integer const GEOSX_UNUSED_PARAM( cycle ),
@@ -35,4 +126,46 @@ void ExecutableGroup::cleanup( real64 const GEOSX_UNUSED_PARAM( time_n ),
                                DomainPartition & GEOSX_UNUSED_PARAM( domain ) )
 {}
 
+std::function< void() > ExecutableGroup::snapshotForAsyncExecution( real64 const GEOSX_UNUSED_PARAM( time_n ),
+                                                                    real64 const GEOSX_UNUSED_PARAM( dt ),
+                                                                    integer const GEOSX_UNUSED_PARAM( cycleNumber ),
+                                                                    integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                                                                    real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                                                                    DomainPartition & GEOSX_UNUSED_PARAM( domain ) )
+{
+  return {};
+}
+
+bool ExecutableGroup::executeAsync( real64 const time_n,
+                                    real64 const dt,
+                                    integer const cycleNumber,
+                                    integer const eventCounter,
+                                    real64 const eventProgress,
+                                    DomainPartition & domain )
+{
+  // the previous execution must complete before the target takes a new snapshot
+  waitForPendingExecution();
+
+  std::function< void() > work = snapshotForAsyncExecution( time_n, dt, cycleNumber, eventCounter, eventProgress, domain );
+  if( !work )
+  {
+    return false;
+  }
+  m_pendingExecution = getBackgroundExecutor().launch( std::move( work ) );
+  return true;
+}
+
+void ExecutableGroup::waitForPendingExecution()
+{
+  if( m_pendingExecution.valid() )
+  {
+    m_pendingExecution.get();
+  }
+}
+
+void ExecutableGroup::waitForAllPendingExecutions()
+{
+  getBackgroundExecutor().waitForAll();
+}
+
 }
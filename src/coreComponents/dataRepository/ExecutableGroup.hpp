@@ -22,6 +22,9 @@
 #include "common/DataTypes.hpp"
 #include "Group.hpp"
 
+#include <functional>
+#include <future>
+
 
 namespace geosx
 {
@@ -85,6 +88,62 @@ public:
                         real64 const eventProgress,
                         DomainPartition & domain );
 
+  /**
+   * @brief Take a snapshot of the data used by the target and return the work to perform on it asynchronously.
+   * @param[in] time_n        current time level
+   * @param[in] dt            time step to be taken
+   * @param[in] cycleNumber   global cycle number
+   * @param[in] eventCounter  index of event that triggered execution
+   * @param[in] eventProgress fractional progress in current cycle
+   * @param[in,out] domain    the physical domain
+   * @return The work to be executed in the background, or an empty function if the target must be executed synchronously.
+   *
+   * @details This is the extension point for targets that do not modify the simulation state (outputs).
+   * It is called by executeAsync(), instead of execute(), for events flagged as asynchronous. The returned
+   * work must neither access the domain nor call MPI on a communicator used concurrently by the main thread.
+   * It is run after the work previously launched by any target.
+   */
+  virtual std::function< void() > snapshotForAsyncExecution( real64 const time_n,
+                                                             real64 const dt,
+                                                             integer const cycleNumber,
+                                                             integer const eventCounter,
+                                                             real64 const eventProgress,
+                                                             DomainPartition & domain );
+
+  /**
+   * @brief Launch the work returned by snapshotForAsyncExecution() in the background.
+   * @param[in] time_n        current time level
+   * @param[in] dt            time step to be taken
+   * @param[in] cycleNumber   global cycle number
+   * @param[in] eventCounter  index of event that triggered execution
+   * @param[in] eventProgress fractional progress in current cycle
+   * @param[in,out] domain    the physical domain
+   * @return true if the work has been launched, false if the target must be executed synchronously
+   *
+   * @details The previous asynchronous execution of the target is completed first.
+   */
+  bool executeAsync( real64 const time_n,
+                     real64 const dt,
+                     integer const cycleNumber,
+                     integer const eventCounter,
+                     real64 const eventProgress,
+                     DomainPartition & domain );
+
+  /**
+   * @brief Wait for the completion of the asynchronous execution of the target, if any.
+   */
+  virtual void waitForPendingExecution();
+
+  /**
+   * @brief Wait for the completion of the asynchronous executions of all the targets.
+   *
+   * @details The asynchronous executions of all the targets run on a single background thread, in launch
+   * order. Their calls to libraries that are not thread-safe (HDF5) are therefore never concurrent, and their
+   * collective calls are issued in the same order on every rank. The main thread calls this function before
+   * it calls such a library itself. Called from the background thread, it returns immediately.
+   */
+  static void waitForAllPendingExecutions();
+
   /**
    * @brief Supplies the timestep request for this target to the event manager.
    * @param[in] time current time level
@@ -112,6 +171,9 @@ public:
 
 private:
   integer m_timestepType = 0;
+
+  /// The asynchronous execution launched by the last call to executeAsync()
+  std::future< void > m_pendingExecution;
 };
 
 
@@ -235,7 +235,8 @@ void Group::printDataHierarchy( integer const indent )
 {
   for( auto & view : wrappers() )
   {
-    GEOSX_LOG( string( indent, '\t' ) << view.second->getName() << ", " << LvArray::system::demangleType( view.second ) );
+    GEOSX_LOG( string( indent, '\t' ) << view.second->getName() << ", " << LvArray::system::demangleType( view.second ) <<
+               ", " << LvArray::system::calculateSize( view.second->bytesAllocated() ) );
   }
 
   for( auto & group : m_subGroups )
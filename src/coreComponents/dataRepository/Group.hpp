@@ -155,7 +155,7 @@ public:
   ///@{
 
   /**
-   * @brief Prints the data hierarchy recursively.
+   * @brief Prints the data hierarchy recursively, with the memory allocated by each wrapper.
    * @param[in] indent The level of indentation to add to this level of output.
    */
   void printDataHierarchy( integer indent = 0 );
@@ -391,6 +391,14 @@ public:
     return wrapperHelpers::capacity( *m_data );
   }
 
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  virtual std::size_t bytesAllocated() const override
+  { return wrapperHelpers::bytesAllocated( *m_data ); }
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  virtual LvArray::MemorySpace getPreviousSpace() const override
+  { return wrapperHelpers::getPreviousSpace( *m_data ); }
+
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void resize( localIndex const newSize ) override
   {
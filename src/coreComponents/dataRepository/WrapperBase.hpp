@@ -125,6 +125,18 @@ public:
    */
   virtual localIndex capacity() const = 0;
 
+  /**
+   * @brief @return the number of bytes allocated by the wrapped object, including its unused capacity.
+   * @note The memory held outside of the buffers of the LvArray containers (e.g. by std containers of objects)
+   *       is only approximated.
+   */
+  virtual std::size_t bytesAllocated() const = 0;
+
+  /**
+   * @brief @return the memory space in which the data was last moved, host if the wrapped type cannot be moved.
+   */
+  virtual LvArray::MemorySpace getPreviousSpace() const = 0;
+
   /**
    * @brief Calls T::resize(newsize) if it exists.
    * @param[in] newsize parameter to pass to T::resize(newsize)
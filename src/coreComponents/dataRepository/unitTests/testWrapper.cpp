@@ -149,3 +149,41 @@ TYPED_TEST( WrapperSetGet, Description )
   this->testDescription( "First description." );
   this->testDescription( "Second description." );
 }
+
+TEST( WrapperBytesAllocated, Scalar )
+{
+  conduit::Node node;
+  Group group( "root", node );
+  Wrapper< int > wrapper( "wrapper", group );
+  WrapperBase const & wrapperBase = wrapper;
+
+  EXPECT_EQ( wrapperBase.bytesAllocated(), sizeof( int ) );
+  EXPECT_EQ( wrapperBase.getPreviousSpace(), LvArray::MemorySpace::host );
+}
+
+TEST( WrapperBytesAllocated, Array )
+{
+  conduit::Node node;
+  Group group( "root", node );
+  Wrapper< array2d< real64 > > wrapper( "wrapper", group );
+  WrapperBase const & wrapperBase = wrapper;
+
+  wrapper.reference().resize( 10, 3 );
+  EXPECT_GE( wrapperBase.bytesAllocated(), 30 * sizeof( real64 ) );
+  EXPECT_EQ( wrapperBase.bytesAllocated(), LvArray::integerConversion< std::size_t >( wrapper.reference().capacity() ) * sizeof( real64 ) );
+}
+
+TEST( WrapperBytesAllocated, ArrayOfArrays )
+{
+  conduit::Node node;
+  Group group( "root", node );
+  Wrapper< ArrayOfArrays< localIndex > > wrapper( "wrapper", group );
+  WrapperBase const & wrapperBase = wrapper;
+
+  ArrayOfArrays< localIndex > & arrays = wrapper.reference();
+  localIndex const values[] = { 0, 1, 2, 3, 4 };
+  arrays.appendArray( values, values + 3 );
+  arrays.appendArray( values + 3, values + 5 );
+  std::size_t const numValues = LvArray::integerConversion< std::size_t >( arrays.valueCapacity() + 2 * arrays.size() + 1 );
+  EXPECT_EQ( wrapperBase.bytesAllocated(), numValues * sizeof( localIndex ) );
+}
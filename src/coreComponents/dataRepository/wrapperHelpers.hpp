@@ -262,6 +262,61 @@ capacity( T const & value )
 { return size( value ); }
 
 
+template< typename T >
+inline std::size_t
+bytesAllocated( T const & value )
+{ return LvArray::integerConversion< std::size_t >( capacity( value ) * byteSizeOfElement< T >() ); }
+
+template< typename T, typename INDEX_TYPE >
+inline std::size_t
+bytesAllocated( ArrayOfArrays< T, INDEX_TYPE > const & value )
+{
+  // The values, the offsets and the sizes of the arrays
+  return LvArray::integerConversion< std::size_t >( value.valueCapacity() ) * sizeof( T ) +
+         LvArray::integerConversion< std::size_t >( 2 * value.size() + 1 ) * sizeof( INDEX_TYPE );
+}
+
+template< typename T >
+inline std::size_t
+bytesAllocated( ArrayOfSets< T > const & value )
+{
+  return LvArray::integerConversion< std::size_t >( value.valueCapacity() ) * sizeof( T ) +
+         LvArray::integerConversion< std::size_t >( 2 * value.size() + 1 ) * sizeof( localIndex );
+}
+
+template< typename COL_INDEX, typename INDEX_TYPE >
+inline std::size_t
+bytesAllocated( SparsityPattern< COL_INDEX, INDEX_TYPE > const & value )
+{
+  return LvArray::integerConversion< std::size_t >( value.nonZeroCapacity() ) * sizeof( COL_INDEX ) +
+         LvArray::integerConversion< std::size_t >( 2 * value.numRows() + 1 ) * sizeof( INDEX_TYPE );
+}
+
+template< typename T, typename COL_INDEX >
+inline std::size_t
+bytesAllocated( CRSMatrix< T, COL_INDEX > const & value )
+{
+  return LvArray::integerConversion< std::size_t >( value.nonZeroCapacity() ) * ( sizeof( T ) + sizeof( COL_INDEX ) ) +
+         LvArray::integerConversion< std::size_t >( 2 * value.numRows() + 1 ) * sizeof( localIndex );
+}
+
+template< typename T >
+inline std::size_t
+bytesAllocated( InterObjectRelation< T > const & value )
+{ return bytesAllocated( value.base() ); }
+
+
+template< typename T, int NDIM, typename PERMUTATION >
+inline LvArray::MemorySpace
+getPreviousSpace( Array< T, NDIM, PERMUTATION > const & value )
+{ return value.getPreviousSpace(); }
+
+template< typename T >
+inline LvArray::MemorySpace
+getPreviousSpace( T const & GEOSX_UNUSED_PARAM( value ) )
+{ return LvArray::MemorySpace::host; }
+
+
 
 template< typename T >
 std::enable_if_t< traits::HasMemberFunction_setName< T > >
@@ -48,7 +48,10 @@ EventBase::EventBase( const string & name,
   m_timeStepEventCount( 0 ),
   m_eventProgress( 0 ),
   m_currentEventDtRequest( 0.0 ),
-  m_target( nullptr )
+  m_asynchronous( 0 ),
+  m_waitForNames(),
+  m_target( nullptr ),
+  m_waitForEvents()
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -89,6 +92,16 @@ EventBase::EventBase( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "If this option is set, the event will reduce its timestep requests to match any specified beginTime/endTimes exactly." );
 
+  registerWrapper( viewKeyStruct::asynchronousString(), &m_asynchronous ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "If this option is set, the target works on a snapshot of its data in the background, overlapping with the following events. "
+                    "Only targets that do not modify the simulation state support it, the others are executed synchronously." );
+
+  registerWrapper( viewKeyStruct::waitForString(), &m_waitForNames ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Paths of the asynchronous events whose pending executions must complete before this event executes." );
+
   registerWrapper( viewKeyStruct::lastTimeString(), &m_lastTime ).
     setApplyDefaultValue( -1.0e100 ).
     setDescription( "Last event occurrence (time)" );
@@ -147,6 +160,12 @@ void EventBase::getTargetReferences()
     m_target = &this->getGroupByPath< ExecutableGroup >( m_eventTarget );
   }
 
+  m_waitForEvents.clear();
+  for( string const & eventPath : m_waitForNames )
+  {
+    m_waitForEvents.emplace_back( &this->getGroupByPath< EventBase >( eventPath ) );
+  }
+
   this->forSubGroups< EventBase >( []( EventBase & subEvent )
   {
     subEvent.getTargetReferences();
@@ -154,6 +173,20 @@ void EventBase::getTargetReferences()
 }
 
 
+void EventBase::waitForPendingExecution()
+{
+  if( m_target != nullptr )
+  {
+    m_target->waitForPendingExecution();
+  }
+
+  this->forSubGroups< EventBase >( []( EventBase & subEvent )
+  {
+    subEvent.waitForPendingExecution();
+  } );
+}
+
+
 void EventBase::checkEvents( real64 const time,
                              real64 const dt,
                              integer const cycle,
@@ -217,13 +250,24 @@ bool EventBase::execute( real64 const time_n,
 {
   bool earlyReturn = false;
 
+  for( EventBase * const event : m_waitForEvents )
+  {
+    event->waitForPendingExecution();
+  }
+
   // If m_targetExecFlag is set, then the code has resumed at a point
   // after the target has executed.
   if((m_target != nullptr) && (m_targetExecFlag == 0))
   {
     m_targetExecFlag = 1;
-    earlyReturn = earlyReturn ||
-                  m_target->execute( time_n, dt, cycleNumber, m_eventCount, m_eventProgress, domain );
+
+    // targets that cannot take a snapshot of their data are executed synchronously
+    if( m_asynchronous == 0 ||
+        !m_target->executeAsync( time_n, dt, cycleNumber, m_eventCount, m_eventProgress, domain ) )
+    {
+      earlyReturn = earlyReturn ||
+                    m_target->execute( time_n, dt, cycleNumber, m_eventCount, m_eventProgress, domain );
+    }
   }
 
   // Iterate through the sub-event list using the managed integer m_currentSubEvent
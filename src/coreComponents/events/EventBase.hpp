@@ -115,6 +115,11 @@ public:
    */
   void getTargetReferences();
 
+  /**
+   * @brief Wait for the completion of the asynchronous executions of the targets of this event and its sub-events, if any.
+   */
+  virtual void waitForPendingExecution() override;
+
   /**
    * @brief Events are triggered based upon their forecast values, which are defined
    *        as the expected number of code cycles before they are executed.  This method
@@ -192,6 +197,8 @@ public:
     static constexpr char const * currentSubEventString() { return "currentSubEvent"; }
     static constexpr char const * isTargetExecutingString() { return "isTargetExecuting"; }
     static constexpr char const * finalDtStretchString() { return "finalDtStretch"; }
+    static constexpr char const * asynchronousString() { return "asynchronous"; }
+    static constexpr char const * waitForString() { return "waitFor"; }
 
     dataRepository::ViewKey eventTarget = { eventTargetString() };
     dataRepository::ViewKey beginTime = { beginTimeString() };
@@ -338,9 +345,14 @@ private:
   integer m_timeStepEventCount;
   real64 m_eventProgress;
   real64 m_currentEventDtRequest;
+  integer m_asynchronous;
+  string_array m_waitForNames;
 
   /// A pointer to the optional event target
   ExecutableGroup * m_target;
+
+  /// The events whose asynchronous executions must complete before this event executes
+  std::vector< EventBase * > m_waitForEvents;
 };
 
 } /* namespace geosx */
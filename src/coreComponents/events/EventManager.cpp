@@ -171,6 +171,7 @@ bool EventManager::run( DomainPartition & domain )
       else if( subEvent->isReadyForExec() )
       {
         earlyReturn = subEvent->execute( m_time, m_dt, m_cycle, 0, 0, domain );
+        CommunicationTools::getInstance().logEventProfile( subEvent->getName() );
       }
 
       // Check the exit flag
@@ -194,6 +195,11 @@ bool EventManager::run( DomainPartition & domain )
   // Cleanup
   GEOSX_LOG_RANK_0( "Cleaning up events" );
 
+  this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
+  {
+    subEvent.waitForPendingExecution();
+  } );
+
   this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
   {
     subEvent.cleanup( m_time, m_cycle, 0, 0, domain );
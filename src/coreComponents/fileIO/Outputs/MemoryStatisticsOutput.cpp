@@ -0,0 +1,296 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MemoryStatisticsOutput.cpp
+ */
+
+#include "MemoryStatisticsOutput.hpp"
+
+#include "common/Format.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/Path.hpp"
+#include "common/TimingMacros.hpp"
+
+#include <umpire/ResourceManager.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <vector>
+#include <sstream>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// Memory allocated on one rank by a group (and its sub-groups) or a wrapper
+struct Footprint
+{
+  /// Number of bytes allocated
+  std::size_t bytes = 0;
+  /// Number of bytes allocated by the data last moved to the device
+  std::size_t deviceBytes = 0;
+};
+
+/**
+ * @brief Compute the memory allocated by the wrappers of a group and of its sub-groups.
+ * @param group the group
+ * @param path the path of @p group, made of tab-separated names
+ * @param footprints the memory allocated by each group and wrapper, by path
+ * @return the memory allocated by @p group
+ * @note The names of the groups end with '/', so that sorting the paths lists each group before its content.
+ */
+Footprint addFootprints( Group const & group, string const & path, std::map< string, Footprint > & footprints )
+{
+  Footprint total;
+  group.forWrappers( [&]( WrapperBase const & wrapper )
+  {
+    Footprint footprint;
+    footprint.bytes = wrapper.bytesAllocated();
+    footprint.deviceBytes = wrapper.getPreviousSpace() == LvArray::MemorySpace::host ? 0 : footprint.bytes;
+    footprints[ path + '\t' + wrapper.getName() ] = footprint;
+
+    total.bytes += footprint.bytes;
+    total.deviceBytes += footprint.deviceBytes;
+  } );
+
+  group.forSubGroups( [&]( Group const & subGroup )
+  {
+    Footprint const footprint = addFootprints( subGroup, path + '\t' + subGroup.getName() + '/', footprints );
+    total.bytes += footprint.bytes;
+    total.deviceBytes += footprint.deviceBytes;
+  } );
+
+  footprints[ path ] = total;
+  return total;
+}
+
+/**
+ * @brief Broadcast the lines of a string from rank 0.
+ * @param lines the newline-separated lines of this rank, only used on rank 0
+ * @return the lines of rank 0, in order
+ * @note Unlike gathering the lines of every rank, the memory and communication cost does not grow with the number of ranks.
+ */
+std::vector< string > broadcastLines( string const & lines )
+{
+  string rootLines = lines;
+  MpiWrapper::broadcast( rootLines, 0 );
+
+  std::vector< string > result;
+  std::istringstream is( rootLines );
+  string line;
+  while( std::getline( is, line ) )
+  {
+    result.emplace_back( line );
+  }
+  return result;
+}
+
+/**
+ * @brief Reduce values across the ranks.
+ * @param values the values of this rank
+ * @param op the reduction operation
+ * @return the reduced values
+ */
+std::vector< real64 > reduce( std::vector< real64 > const & values, MPI_Op const op )
+{
+  std::vector< real64 > result( values.size() );
+  MpiWrapper::allReduce( values.data(), result.data(), LvArray::integerConversion< int >( values.size() ), op, MPI_COMM_GEOSX );
+  return result;
+}
+
+/**
+ * @brief Format a number of bytes.
+ * @param bytes the number of bytes, as a reduced floating-point value
+ * @return the number of bytes with the appropriate unit
+ */
+string formatBytes( real64 const bytes )
+{
+  return LvArray::system::calculateSize( static_cast< std::size_t >( bytes ) );
+}
+
+/**
+ * @brief Log the current and high-water marks of the Umpire allocators, reduced across the ranks.
+ */
+void logUmpireAllocators()
+{
+  umpire::ResourceManager & rm = umpire::ResourceManager::getInstance();
+
+  std::ostringstream nameStream;
+  std::vector< string > allocatorNames;
+  for( string const & allocatorName : rm.getAllocatorNames() )
+  {
+    // Skip umpire internal allocators.
+    if( allocatorName.rfind( "__umpire_internal", 0 ) != 0 )
+    {
+      allocatorNames.emplace_back( allocatorName );
+      nameStream << allocatorName << '\n';
+    }
+  }
+
+  // Allocators that do not exist on every rank cannot be reduced
+  std::vector< string > const allNames = broadcastLines( nameStream.str() );
+  bool const sameAllocators = allNames.size() == allocatorNames.size() &&
+                              std::all_of( allNames.begin(), allNames.end(), [&]( string const & name ) { return rm.isAllocator( name ); } );
+  if( MpiWrapper::min( sameAllocators ? 1 : 0 ) == 0 )
+  {
+    GEOSX_WARNING( "Not all ranks have created the same umpire allocators, cannot reduce their statistics." );
+    return;
+  }
+
+  std::vector< real64 > values;
+  for( string const & allocatorName : allNames )
+  {
+    umpire::Allocator allocator = rm.getAllocator( allocatorName );
+    values.emplace_back( allocator.getCurrentSize() );
+    values.emplace_back( allocator.getHighWatermark() );
+  }
+  std::vector< real64 > const sum = reduce( values, MPI_SUM );
+  std::vector< real64 > const max = reduce( values, MPI_MAX );
+
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "{:<20} {:>12} {:>12} {:>12} {:>12}",
+                               "Umpire allocator", "current sum", "current max", "peak sum", "peak max" ) );
+  std::size_t i = 0;
+  for( string const & allocatorName : allNames )
+  {
+    GEOSX_LOG_RANK_0( GEOSX_FMT( "{:<20} {:>12} {:>12} {:>12} {:>12}",
+                                 allocatorName,
+                                 formatBytes( sum[i] ),
+                                 formatBytes( max[i] ),
+                                 formatBytes( sum[i + 1] ),
+                                 formatBytes( max[i + 1] ) ) );
+    i += 2;
+  }
+}
+
+}
+
+MemoryStatisticsOutput::MemoryStatisticsOutput( string const & name,
+                                                Group * const parent ):
+  OutputBase( name, parent ),
+  m_threshold( 0.01 ),
+  m_writeCSV( 1 )
+{
+  registerWrapper( viewKeysStruct::thresholdString(), &m_threshold ).
+    setApplyDefaultValue( 0.01 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Fraction of the memory allocated on all the ranks below which a group or a wrapper is not logged" );
+
+  registerWrapper( viewKeysStruct::writeCSVString(), &m_writeCSV ).
+    setApplyDefaultValue( 1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to write the statistics of every group and wrapper to a CSV file in the output directory" );
+}
+
+MemoryStatisticsOutput::~MemoryStatisticsOutput()
+{}
+
+bool MemoryStatisticsOutput::execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
+                                      real64 const GEOSX_UNUSED_PARAM( dt ),
+                                      integer const cycleNumber,
+                                      integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                                      real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                                      DomainPartition & GEOSX_UNUSED_PARAM( domain ) )
+{
+  GEOSX_MARK_FUNCTION;
+
+  Group const & rootGroup = this->getGroupByPath( "/Problem" );
+
+  std::map< string, Footprint > footprints;
+  addFootprints( rootGroup, rootGroup.getName() + '/', footprints );
+
+  // Reduce the groups and wrappers of rank 0, in the same order on every rank. The groups and wrappers
+  // that only exist on other ranks are not listed, but are accounted for in the totals of their parent groups.
+  std::ostringstream pathStream;
+  for( auto const & entry : footprints )
+  {
+    pathStream << entry.first << '\n';
+  }
+  std::vector< string > const paths = broadcastLines( pathStream.str() );
+
+  std::vector< real64 > bytes;
+  std::vector< real64 > deviceBytes;
+  bytes.reserve( paths.size() );
+  deviceBytes.reserve( paths.size() );
+  for( string const & path : paths )
+  {
+    auto const it = footprints.find( path );
+    bytes.emplace_back( it == footprints.end() ? 0.0 : it->second.bytes );
+    deviceBytes.emplace_back( it == footprints.end() ? 0.0 : it->second.deviceBytes );
+  }
+
+  std::vector< real64 > const minBytes = reduce( bytes, MPI_MIN );
+  std::vector< real64 > const maxBytes = reduce( bytes, MPI_MAX );
+  std::vector< real64 > const sumBytes = reduce( bytes, MPI_SUM );
+  std::vector< real64 > const sumDeviceBytes = reduce( deviceBytes, MPI_SUM );
+
+  int const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  real64 const minLoggedBytes = m_threshold * sumBytes.front();
+
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "Memory allocated by the data repository on {} ranks at cycle {} (imbalance = max / avg):",
+                               numRanks, cycleNumber ) );
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "{:<60} {:>12} {:>12} {:>12} {:>12} {:>9} {:>12}",
+                               "Group / wrapper", "sum", "rank min", "rank avg", "rank max", "imbalance", "device sum" ) );
+  std::size_t i = 0;
+  for( string const & path : paths )
+  {
+    if( sumBytes[i] >= minLoggedBytes && sumBytes[i] > 0 )
+    {
+      std::size_t const depth = std::count( path.begin(), path.end(), '\t' );
+      string const name = string( 2 * depth, ' ' ) + path.substr( path.rfind( '\t' ) + 1 );
+      real64 const avgBytes = sumBytes[i] / numRanks;
+      GEOSX_LOG_RANK_0( GEOSX_FMT( "{:<60} {:>12} {:>12} {:>12} {:>12} {:>9.2f} {:>12}",
+                                   name,
+                                   formatBytes( sumBytes[i] ),
+                                   formatBytes( minBytes[i] ),
+                                   formatBytes( avgBytes ),
+                                   formatBytes( maxBytes[i] ),
+                                   maxBytes[i] / avgBytes,
+                                   formatBytes( sumDeviceBytes[i] ) ) );
+    }
+    ++i;
+  }
+
+  logUmpireAllocators();
+
+  if( m_writeCSV && MpiWrapper::commRank( MPI_COMM_GEOSX ) == 0 )
+  {
+    string const fileName = joinPath( getOutputDirectory(), GEOSX_FMT( "{}_memory_{:09}.csv", getFileNameRoot(), cycleNumber ) );
+    std::ofstream os( fileName );
+    GEOSX_WARNING_IF( !os, "Could not open " << fileName << " to write the memory statistics" );
+    os << "path,kind,bytesMin,bytesAvg,bytesMax,bytesSum,deviceBytesSum\n";
+    i = 0;
+    for( string const & path : paths )
+    {
+      string fullPath = path;
+      fullPath.erase( std::remove( fullPath.begin(), fullPath.end(), '\t' ), fullPath.end() );
+      os << fullPath << ',' << ( path.back() == '/' ? "group" : "wrapper" ) << ','
+         << static_cast< long long >( minBytes[i] ) << ',' << static_cast< long long >( sumBytes[i] / numRanks ) << ','
+         << static_cast< long long >( maxBytes[i] ) << ',' << static_cast< long long >( sumBytes[i] ) << ','
+         << static_cast< long long >( sumDeviceBytes[i] ) << '\n';
+      ++i;
+    }
+  }
+
+  return false;
+}
+
+
+REGISTER_CATALOG_ENTRY( OutputBase, MemoryStatisticsOutput, string const &, Group * const )
+} /* namespace geosx */
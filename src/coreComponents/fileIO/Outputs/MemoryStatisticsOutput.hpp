@@ -0,0 +1,94 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MemoryStatisticsOutput.hpp
+ */
+
+#ifndef GEOSX_FILEIO_OUTPUTS_MEMORYSTATISTICSOUTPUT_HPP_
+#define GEOSX_FILEIO_OUTPUTS_MEMORYSTATISTICSOUTPUT_HPP_
+
+#include "OutputBase.hpp"
+
+
+namespace geosx
+{
+
+/**
+ * @class MemoryStatisticsOutput
+ *
+ * An output reporting the memory allocated by the groups and wrappers of the data repository,
+ * reduced across the ranks, and the current and high-water marks of the Umpire allocators.
+ */
+class MemoryStatisticsOutput : public OutputBase
+{
+public:
+  /// @copydoc geosx::dataRepository::Group::Group(string const & name, Group * const parent)
+  MemoryStatisticsOutput( string const & name,
+                          Group * const parent );
+
+  /// Destructor
+  virtual ~MemoryStatisticsOutput() override;
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string catalogName() { return "MemoryStatistics"; }
+
+  /**
+   * @brief Logs the memory statistics and writes those of every group and wrapper to a CSV file.
+   * @copydoc EventBase::execute()
+   */
+  virtual bool execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override;
+
+  /**
+   * @brief Report the memory statistics one last time as the code exits
+   * @copydetails ExecutableGroup::cleanup()
+   */
+  virtual void cleanup( real64 const time_n,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override
+  {
+    execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+  }
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct
+  {
+    static constexpr char const * thresholdString() { return "threshold"; }
+    static constexpr char const * writeCSVString() { return "writeCSV"; }
+  };
+  /// @endcond
+
+private:
+
+  /// Fraction of the total memory below which a group or a wrapper is not logged
+  real64 m_threshold;
+
+  /// Flag to write the statistics of every group and wrapper to a CSV file
+  integer m_writeCSV;
+};
+
+
+} /* namespace geosx */
+
+#endif /* GEOSX_FILEIO_OUTPUTS_MEMORYSTATISTICSOUTPUT_HPP_ */
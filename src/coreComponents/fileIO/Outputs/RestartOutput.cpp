@@ -54,6 +54,25 @@ bool RestartOutput::execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
   return false;
 }
 
+std::function< void() > RestartOutput::snapshotForAsyncExecution( real64 const GEOSX_UNUSED_PARAM( time_n ),
+                                                                  real64 const GEOSX_UNUSED_PARAM( dt ),
+                                                                  integer const cycleNumber,
+                                                                  integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                                                                  real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                                                                  DomainPartition & GEOSX_UNUSED_PARAM( domain ) )
+{
+  GEOSX_MARK_FUNCTION;
+
+  Group & rootGroup = this->getGroupByPath( "/Problem" );
+  string const fileName = GEOSX_FMT( "{}_restart_{:09}", getFileNameRoot(), cycleNumber );
+
+  rootGroup.prepareToWrite();
+  std::function< void() > write = snapshotTree( joinPath( OutputBase::getOutputDirectory(), fileName ), *(rootGroup.getConduitNode().parent()) );
+  rootGroup.finishWriting();
+
+  return write;
+}
+
 
 REGISTER_CATALOG_ENTRY( OutputBase, RestartOutput, string const &, Group * const )
 } /* namespace geosx */
@@ -58,6 +58,18 @@ public:
                         real64 const eventProgress,
                         DomainPartition & domain ) override;
 
+  /**
+   * @brief Copies the restart tree, and returns the write of the copy.
+   * @copydoc ExecutableGroup::snapshotForAsyncExecution()
+   * @note The copy doubles the memory used by the restart data until the write completes.
+   */
+  virtual std::function< void() > snapshotForAsyncExecution( real64 const time_n,
+                                                             real64 const dt,
+                                                             integer const cycleNumber,
+                                                             integer const eventCounter,
+                                                             real64 const eventProgress,
+                                                             DomainPartition & domain ) override;
+
   /**
    * @brief Write one final restart file as the code exits
    * @copydetails ExecutableGroup::cleanup()
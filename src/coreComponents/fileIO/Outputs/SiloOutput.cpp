@@ -83,6 +83,9 @@ bool SiloOutput::execute( real64 const time_n,
 {
   GEOSX_MARK_FUNCTION;
 
+  // silo writes through HDF5, which is not called concurrently with the background outputs
+  waitForAllPendingExecutions();
+
   SiloFile silo;
 
   int const size = MpiWrapper::commSize( MPI_COMM_GEOSX );
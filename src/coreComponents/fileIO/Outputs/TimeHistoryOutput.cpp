@@ -27,7 +27,10 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
   m_format( ),
   m_filename( ),
   m_recordCount( 0 ),
-  m_io( )
+  m_io( ),
+  m_asyncWrite( 0 ),
+  m_ioComm( MPI_COMM_GEOSX ),
+  m_pendingRecordCount( 0 )
 {
   registerWrapper( viewKeys::timeHistoryOutputTargetString(), &m_collectorPaths ).
     setInputFlag( InputFlags::REQUIRED ).
@@ -49,6 +52,28 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
     setRestartFlags( RestartFlags::WRITE_AND_READ ).
     setDescription( "The current history record to be written, on restart from an earlier time allows use to remove invalid future history." );
 
+  registerWrapper( viewKeys::asyncWriteString(), &m_asyncWrite ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to write the buffered time history to file in a background thread, overlapping the output with the next time steps "
+                    "(requires running with --mpi-thread-multiple)." );
+}
+
+TimeHistoryOutput::~TimeHistoryOutput()
+{
+  waitForPendingExecution();
+  if( m_ioComm != MPI_COMM_GEOSX )
+  {
+    MpiWrapper::commFree( m_ioComm );
+  }
+}
+
+void TimeHistoryOutput::waitForPendingExecution()
+{
+  OutputBase::waitForPendingExecution();
+  // the records are only counted once on disk, so that a restart never refers to records still being written
+  m_recordCount += m_pendingRecordCount;
+  m_pendingRecordCount = 0;
 }
 
 void TimeHistoryOutput::initCollectorParallel( DomainPartition & domain, HistoryCollection & collector )
@@ -62,7 +87,7 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition & domain, History
   for( localIndex ii = 0; ii < collector.getCollectionCount( ); ++ii )
   {
     HistoryMetadata metadata = collector.getMetadata( domain, ii );
-    m_io.emplace_back( std::make_unique< HDFHistIO >( outputFile, metadata, m_recordCount ) );
+    m_io.emplace_back( std::make_unique< HDFHistIO >( outputFile, metadata, m_recordCount, 1, 2, m_ioComm ) );
     collector.registerBufferCall( ii, [this, ii, ioCount, &domain, &collector]()
     {
       collector.updateSetsIndices( domain );
@@ -82,7 +107,7 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition & domain, History
     {
       HistoryMetadata metaMetadata = metaCollector.getMetadata( domain, ii );
       metaMetadata.setName( collector.getTargetName() + " " + metaMetadata.getName( ) );
-      m_io.emplace_back( std::make_unique< HDFHistIO >( outputFile, metaMetadata, m_recordCount ) );
+      m_io.emplace_back( std::make_unique< HDFHistIO >( outputFile, metaMetadata, m_recordCount, 1, 2, m_ioComm ) );
       metaCollector.registerBufferCall( ii, [this, ii, ioCount, &domain, &metaCollector] ()
       {
         metaCollector.updateSetsIndices( domain );
@@ -113,6 +138,8 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition & domain, History
 
 void TimeHistoryOutput::initializePostInitialConditionsPostSubGroups()
 {
+  // HDF5 is only called by one thread at a time, the library does not need to be thread-safe
+  waitForAllPendingExecutions();
   {
     // check whether to truncate or append to the file up front so we don't have to bother during later accesses
     string const outputDirectory = getOutputDirectory();
@@ -125,6 +152,20 @@ void TimeHistoryOutput::initializePostInitialConditionsPostSubGroups()
     HDFFile( outputFile, (m_recordCount == 0), true, MPI_COMM_GEOSX );
   }
 
+  if( m_asyncWrite != 0 && m_ioComm == MPI_COMM_GEOSX )
+  {
+    if( MpiWrapper::supportsThreadMultiple() )
+    {
+      // the background writes use their own communicator so they never interleave with the main thread communications
+      m_ioComm = MpiWrapper::commDup( MPI_COMM_GEOSX );
+    }
+    else
+    {
+      GEOSX_WARNING( getName() << ": MPI does not provide MPI_THREAD_MULTIPLE (see --mpi-thread-multiple), time history will be written synchronously" );
+      m_asyncWrite = 0;
+    }
+  }
+
   DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
   for( auto collectorPath : m_collectorPaths )
   {
@@ -141,25 +182,64 @@ void TimeHistoryOutput::setFileName( string const & root )
 
 void TimeHistoryOutput::reinit()
 {
+  waitForPendingExecution();
   m_recordCount = 0;
   m_io.clear();
   initializePostInitialConditionsPostSubGroups();
 }
 
-bool TimeHistoryOutput::execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
-                                 real64 const GEOSX_UNUSED_PARAM( dt ),
-                                 integer const GEOSX_UNUSED_PARAM( cycleNumber ),
-                                 integer const GEOSX_UNUSED_PARAM( eventCounter ),
-                                 real64 const GEOSX_UNUSED_PARAM( eventProgress ),
-                                 DomainPartition & GEOSX_UNUSED_PARAM( domain ) )
+std::function< void() > TimeHistoryOutput::snapshotForAsyncExecution( real64 const GEOSX_UNUSED_PARAM( time_n ),
+                                                                       real64 const GEOSX_UNUSED_PARAM( dt ),
+                                                                       integer const GEOSX_UNUSED_PARAM( cycleNumber ),
+                                                                       integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                                                                       real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                                                                       DomainPartition & GEOSX_UNUSED_PARAM( domain ) )
 {
-  GEOSX_MARK_FUNCTION;
+  if( m_asyncWrite == 0 )
+  {
+    return {};
+  }
+
+  // the previous write has completed (see executeAsync), its side of the double buffers can be reused
   localIndex newBuffered = m_io.front()->getBufferedCount( );
   for( auto & th_io : m_io )
   {
-    th_io->write( );
+    th_io->swapBuffers( );
+  }
+  m_pendingRecordCount = newBuffered;
+
+  // the writes are collective, every rank launches them in the same order on the same communicator
+  return [this]()
+  {
+    for( auto & th_io : m_io )
+    {
+      th_io->writeSwapped( );
+    }
+  };
+}
+
+bool TimeHistoryOutput::execute( real64 const time_n,
+                                 real64 const dt,
+                                 integer const cycleNumber,
+                                 integer const eventCounter,
+                                 real64 const eventProgress,
+                                 DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+  if( m_asyncWrite != 0 )
+  {
+    executeAsync( time_n, dt, cycleNumber, eventCounter, eventProgress, domain );
+  }
+  else
+  {
+    waitForAllPendingExecutions();
+    localIndex newBuffered = m_io.front()->getBufferedCount( );
+    for( auto & th_io : m_io )
+    {
+      th_io->write( );
+    }
+    m_recordCount += newBuffered;
   }
-  m_recordCount += newBuffered;
   return false;
 }
 
@@ -170,6 +250,8 @@ void TimeHistoryOutput::cleanup( real64 const time_n,
                                  DomainPartition & domain )
 {
   execute( time_n, 0.0, cycleNumber, eventCounter, eventProgress, domain );
+  waitForPendingExecution();
+  waitForAllPendingExecutions();
   // remove any unused trailing space reserved to write additional histories
   for( auto & th_io : m_io )
   {
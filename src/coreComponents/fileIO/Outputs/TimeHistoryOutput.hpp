@@ -42,8 +42,7 @@ public:
                      Group * const parent );
 
   /// Destructor
-  virtual ~TimeHistoryOutput() override
-  { }
+  virtual ~TimeHistoryOutput() override;
 
   /**
    * @brief Catalog name interface
@@ -80,6 +79,24 @@ public:
                         integer const eventCounter,
                         real64 const eventProgress,
                         DomainPartition & domain ) override;
+  /**
+   * @brief Hands the buffered time history over to the write side of the double buffers and returns the write.
+   * @copydoc ExecutableGroup::snapshotForAsyncExecution()
+   * @note Background writes require the asyncWrite flag, which provides them with their own communicator.
+   */
+  virtual std::function< void() > snapshotForAsyncExecution( real64 const time_n,
+                                                             real64 const dt,
+                                                             integer const cycleNumber,
+                                                             integer const eventCounter,
+                                                             real64 const eventProgress,
+                                                             DomainPartition & domain ) override;
+
+  /**
+   * @brief Wait for the completion of the background write launched by the last execution, if any,
+   *        and account for its records.
+   */
+  virtual void waitForPendingExecution() override;
+
   /**
    * @brief Writes out a time history file at the end of the simulation.
    * @copydoc ExecutableGroup::cleanup()
@@ -97,11 +114,13 @@ public:
     static constexpr char const * timeHistoryOutputFilenameString() { return "filename"; }
     static constexpr char const * timeHistoryOutputFormatString() { return "format"; }
     static constexpr char const * timeHistoryRestartString() { return "restart"; }
+    static constexpr char const * asyncWriteString() { return "asyncWrite"; }
 
     dataRepository::ViewKey timeHistoryOutputTarget = { "sources" };
     dataRepository::ViewKey timeHistoryOutputFilename = { "filename" };
     dataRepository::ViewKey timeHistoryOutputFormat = { "format" };
     dataRepository::ViewKey timeHistoryRestart = { "restart" };
+    dataRepository::ViewKey asyncWrite = { "asyncWrite" };
   } timeHistoryOutputViewKeys;
   /// @endcond
 
@@ -132,6 +151,12 @@ private:
   integer m_recordCount;
   /// The buffered time history output objects for each collector to collect data into and to use to configure/write to file.
   std::vector< std::unique_ptr< BufferedHistoryIO > > m_io;
+  /// Whether to write the buffered history in a background thread
+  integer m_asyncWrite;
+  /// The communicator used for file output, duplicated from MPI_COMM_GEOSX when writing in the background
+  MPI_Comm m_ioComm;
+  /// The number of records written by the pending write, added to the record count once it completes
+  integer m_pendingRecordCount;
 };
 }
 
@@ -64,6 +64,12 @@ void VTKOutput::postProcessInput()
   m_writer.setOutputLocation( getOutputDirectory(), m_plotFileRoot );
 }
 
+void VTKOutput::reinit()
+{
+  m_writer.clearData();
+  m_writer.setOutputLocation( getOutputDirectory(), m_plotFileRoot );
+}
+
 bool VTKOutput::execute( real64 const time_n,
                          real64 const GEOSX_UNUSED_PARAM( dt ),
                          integer const cycleNumber,
@@ -47,6 +47,11 @@ public:
 
   virtual void postProcessInput() override;
 
+  /**
+   * @brief Start a new series of vtk files in the current output directory
+   */
+  virtual void reinit() override;
+
   /**
    * @brief Writes out a set of vtk files.
    * @copydoc EventBase::execute()
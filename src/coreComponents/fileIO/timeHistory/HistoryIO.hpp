@@ -68,7 +68,25 @@ public:
   /**
    * @brief Write the buffered history data to the output target.
    */
-  virtual void write( ) = 0;
+  void write( )
+  {
+    swapBuffers( );
+    writeSwapped( );
+  }
+
+  /**
+   * @brief Hand the buffered history data over to the write side of the double buffer and empty the collection buffer.
+   * @note Collection into the buffer can then proceed while writeSwapped() is executed concurrently. The previous
+   *       call to writeSwapped() must have completed before calling this.
+   */
+  virtual void swapBuffers( ) = 0;
+
+  /**
+   * @brief Write the history data handed over by the last call to swapBuffers() to the output target.
+   * @note This only accesses the write side of the double buffer, so it can be executed in a background thread
+   *       while collection proceeds, provided any communicator it uses is not used concurrently by other threads.
+   */
+  virtual void writeSwapped( ) = 0;
 
   /**
    * @brief Ensure the repressentation of the data in the output target is dense and terse.
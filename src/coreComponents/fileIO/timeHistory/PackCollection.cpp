@@ -1,7 +1,36 @@
 #include "PackCollection.hpp"
 
+#include "common/TypeDispatch.hpp"
+
+#include <algorithm>
+
 namespace geosx
 {
+
+namespace
+{
+
+/// Field types that can be reduced: 1-2D real arrays, the second dimension being reduced component-wise
+using ReducibleTypes = types::ArrayTypes< types::RealTypes, types::DimsUpTo< 2 > >;
+
+template< typename T, int USD >
+inline real64 componentValue( ArrayView< T const, 1, USD > const & values,
+                              localIndex const i,
+                              localIndex const GEOSX_UNUSED_PARAM( c ) )
+{
+  return values[ i ];
+}
+
+template< typename T, int USD >
+inline real64 componentValue( ArrayView< T const, 2, USD > const & values,
+                              localIndex const i,
+                              localIndex const c )
+{
+  return values( i, c );
+}
+
+}
+
 PackCollection::PackCollection ( string const & name, Group * parent )
   : HistoryCollection( name, parent )
   , m_setsIndices( )
@@ -10,6 +39,8 @@ PackCollection::PackCollection ( string const & name, Group * parent )
   , m_setNames( )
   , m_setChanged( true )
   , m_onlyOnSetChange( 0 )
+  , m_reduction( ReductionType::none )
+  , m_percentile( 50.0 )
   , m_disableCoordCollection( false )
   , m_initialized( false )
 {
@@ -29,6 +60,24 @@ PackCollection::PackCollection ( string const & name, Group * parent )
     setInputFlag( InputFlags::OPTIONAL ).
     setDefaultValue( 0 ).
     setDescription( "Whether or not to only collect when the collected sets of indices change in any way." );
+
+  registerWrapper( PackCollection::viewKeysStruct::reductionString(), &m_reduction ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_reduction ).
+    setDescription( "Reduction applied over all ranks to the values of each set, so that only the reduced value(s) are output. "
+                    "The reductions of an empty set are NaN, except the sum which is 0. Valid options:\n* " + EnumStrings< ReductionType >::concat( "\n* " ) );
+
+  registerWrapper( PackCollection::viewKeysStruct::percentileString(), &m_percentile ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_percentile ).
+    setDescription( "The percentile (between 0 and 100) computed by the percentile reduction, with the nearest-rank method." );
+}
+
+void PackCollection::postProcessInput()
+{
+  GEOSX_THROW_IF( m_percentile < 0.0 || m_percentile > 100.0,
+                  getName() << ": " << viewKeysStruct::percentileString() << " must be between 0 and 100",
+                  InputError );
 }
 
 void PackCollection::initializePostSubGroups( )
@@ -42,6 +91,15 @@ void PackCollection::initializePostSubGroups( )
     Group const * const targetObject = this->getTargetObject( domain, m_objectPath );
     ObjectManagerBase const * const objectManagerTarget = dynamic_cast< ObjectManagerBase const * >( targetObject );
     m_targetIsMeshObject = objectManagerTarget != nullptr;
+    GEOSX_THROW_IF( m_reduction == ReductionType::volumeWeightedMean &&
+                    !targetObject->hasWrapper( ElementSubRegionBase::viewKeyStruct::elementVolumeString() ),
+                    getName() << ": the volume-weighted mean reduction requires an element sub-region target",
+                    InputError );
+    GEOSX_THROW_IF( m_reduction != ReductionType::none &&
+                    !types::dispatch( ReducibleTypes{}, targetObject->getWrapperBase( m_fieldName ).getTypeId(), false, []( auto ){} ),
+                    getName() << ": the " << EnumStrings< ReductionType >::toString( m_reduction ) << " reduction requires a "
+                              << "one- or two-dimensional array of reals, " << m_fieldName << " is not one",
+                    InputError );
     // update sets after we know whether to filter ghost indices ( m_targetIsMeshObject )
     updateSetsIndices( domain );
     HistoryCollection::initializePostSubGroups( );
@@ -61,7 +119,18 @@ HistoryMetadata PackCollection::getMetadata( DomainPartition const & domain, loc
 {
   Group const * targetObject = this->getTargetObject( domain, m_objectPath );
   WrapperBase const & target = targetObject->getWrapperBase( m_fieldName );
-  if( m_setNames.size() != 0 )
+  if( m_reduction != ReductionType::none )
+  {
+    // the reduced values are only serialized (and written) by rank 0
+    localIndex dims[2] = { MpiWrapper::commRank() == 0 ? 1 : 0, target.numArrayComp() };
+    string name = m_fieldName + " " + EnumStrings< ReductionType >::toString( m_reduction );
+    if( m_setNames.size() != 0 )
+    {
+      name += " " + m_setNames[ collectionIdx ];
+    }
+    return HistoryMetadata( name, dims[1] > 1 ? 2 : 1, dims, std::type_index( typeid( real64 ) ) );
+  }
+  else if( m_setNames.size() != 0 )
   {
     GEOSX_ERROR_IF( collectionIdx < 0 || collectionIdx >= m_setNames.size(), "Invalid collection index specified." );
     localIndex collectionSize = m_setsIndices[ collectionIdx ].size( );
@@ -176,12 +245,13 @@ void PackCollection::updateSetsIndices( DomainPartition & domain )
 
 localIndex PackCollection::getNumMetaCollectors( ) const
 {
-  return m_targetIsMeshObject && !m_disableCoordCollection ? 1 : 0;
+  return m_targetIsMeshObject && !m_disableCoordCollection && m_reduction == ReductionType::none ? 1 : 0;
 }
 
 void PackCollection::buildMetaCollectors( )
 {
-  if( !m_disableCoordCollection )
+  // reduced values are not associated with coordinates
+  if( !m_disableCoordCollection && m_reduction == ReductionType::none )
   {
     char const * coordField = nullptr;
     if( m_objectPath.find( "nodeManager" ) != string::npos )
@@ -227,6 +297,12 @@ void PackCollection::collect( DomainPartition & domain,
   GEOSX_ERROR_IF( collectionIdx < 0 || collectionIdx >= getCollectionCount( ), "Attempting to collection from an invalid collection index!" );
   Group const * targetObject = this->getTargetObject( domain, m_objectPath );
   WrapperBase const & target = targetObject->getWrapperBase( m_fieldName );
+  if( m_reduction != ReductionType::none )
+  {
+    collectReduced( *targetObject, target, collectionIdx, buffer );
+    m_setChanged = false;
+    return;
+  }
   // if we have any indices to collect, and we're either collecting every time or we're only collecting when the set changes and the set has
   // changed
   parallelDeviceEvents events;
@@ -250,5 +326,166 @@ void PackCollection::collect( DomainPartition & domain,
   GEOSX_ASYNC_WAIT( 6000000000, 10, testAllDeviceEvents( events ) );
 }
 
+void PackCollection::collectReduced( Group const & targetObject,
+                                     WrapperBase const & target,
+                                     localIndex const collectionIdx,
+                                     buffer_unit_type * & buffer ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  arrayView1d< localIndex const > const indices = m_setsIndices[ collectionIdx ].toViewConst();
+  localIndex const numIndices = indices.size();
+  localIndex const numComps = target.numArrayComp();
+  ReductionType const reduction = m_reduction;
+
+  arrayView1d< real64 const > volume;
+  if( reduction == ReductionType::volumeWeightedMean )
+  {
+    volume = targetObject.getReference< array1d< real64 > >( ElementSubRegionBase::viewKeyStruct::elementVolumeString() ).toViewConst();
+    volume.move( LvArray::MemorySpace::host, false );
+  }
+
+  // the reductions of an empty set, except the sum, are written as NaN
+  real64 const emptySetValue = std::numeric_limits< real64 >::quiet_NaN();
+  array1d< real64 > result( numComps );
+
+  types::dispatch( ReducibleTypes{}, target.getTypeId(), true, [&]( auto array )
+  {
+    using ArrayType = decltype( array );
+    Wrapper< ArrayType > const & wrapperT = Wrapper< ArrayType >::cast( target );
+    auto const values = wrapperT.reference().toViewConst();
+    values.move( LvArray::MemorySpace::host, false );
+
+    if( reduction == ReductionType::min || reduction == ReductionType::max )
+    {
+      // Compute the local extrema, stored as { -min, max } to combine them with a single MPI_MAX reduction
+
+      array1d< real64 > extrema( 2 * numComps );
+      for( localIndex c = 0; c < numComps; ++c )
+      {
+        RAJA::ReduceMin< parallelHostReduce, real64 > localMin( LvArray::NumericLimits< real64 >::max );
+        RAJA::ReduceMax< parallelHostReduce, real64 > localMax( -LvArray::NumericLimits< real64 >::max );
+        forAll< parallelHostPolicy >( numIndices, [=]( localIndex const i )
+        {
+          real64 const value = componentValue( values, indices[i], c );
+          localMin.min( value );
+          localMax.max( value );
+        } );
+        extrema[c] = -localMin.get();
+        extrema[numComps + c] = localMax.get();
+      }
+      MpiWrapper::allReduce( extrema.data(), extrema.data(), LvArray::integerConversion< int >( extrema.size() ), MPI_MAX, MPI_COMM_GEOSX );
+
+      for( localIndex c = 0; c < numComps; ++c )
+      {
+        // the extrema of an empty set are left at their initial values, with min > max
+        bool const isEmpty = -extrema[c] > extrema[numComps + c];
+        result[c] = isEmpty ? emptySetValue : ( reduction == ReductionType::min ? -extrema[c] : extrema[numComps + c] );
+      }
+    }
+    else if( reduction == ReductionType::percentile )
+    {
+      // Gather the values of the set on rank 0, stored component by component on each rank, and select the percentile there
+
+      int const numLocalValues = LvArray::integerConversion< int >( numIndices * numComps );
+      array1d< real64 > localValues( numLocalValues );
+      for( localIndex c = 0; c < numComps; ++c )
+      {
+        for( localIndex i = 0; i < numIndices; ++i )
+        {
+          localValues[c * numIndices + i] = componentValue( values, indices[i], c );
+        }
+      }
+
+      int const rank = MpiWrapper::commRank();
+      int const numRanks = MpiWrapper::commSize();
+      array1d< int > counts( rank == 0 ? numRanks : 0 );
+      MpiWrapper::gather( &numLocalValues, 1, counts.data(), 1, 0, MPI_COMM_GEOSX );
+
+      array1d< int > offsets( rank == 0 ? numRanks + 1 : 0 );
+      if( rank == 0 )
+      {
+        for( int r = 0; r < numRanks; ++r )
+        {
+          offsets[r + 1] = offsets[r] + counts[r];
+        }
+      }
+      array1d< real64 > gatheredValues( rank == 0 ? offsets[numRanks] : 0 );
+      MpiWrapper::gatherv( localValues.data(), numLocalValues, gatheredValues.data(), counts.data(), offsets.data(), 0, MPI_COMM_GEOSX );
+
+      if( rank == 0 )
+      {
+        localIndex const numGlobalIndices = gatheredValues.size() / numComps;
+        std::vector< real64 > componentValues( numGlobalIndices );
+        for( localIndex c = 0; c < numComps; ++c )
+        {
+          if( numGlobalIndices == 0 )
+          {
+            result[c] = emptySetValue;
+            continue;
+          }
+
+          localIndex pos = 0;
+          for( int r = 0; r < numRanks; ++r )
+          {
+            localIndex const numRankIndices = counts[r] / numComps;
+            real64 const * const rankValues = gatheredValues.data() + offsets[r] + c * numRankIndices;
+            std::copy( rankValues, rankValues + numRankIndices, componentValues.begin() + pos );
+            pos += numRankIndices;
+          }
+
+          // nearest-rank percentile: the smallest value with at least percentile % of the values below or equal to it
+          localIndex const k = LvArray::math::max( static_cast< localIndex >( std::ceil( m_percentile / 100.0 * numGlobalIndices ) ), localIndex( 1 ) ) - 1;
+          std::nth_element( componentValues.begin(), componentValues.begin() + k, componentValues.end() );
+          result[c] = componentValues[k];
+        }
+      }
+    }
+    else
+    {
+      // Compute the local (weighted) sums, followed by the sum of the weights, and combine them with a single MPI_SUM reduction
+
+      array1d< real64 > sums( numComps + 1 );
+      for( localIndex c = 0; c < numComps; ++c )
+      {
+        RAJA::ReduceSum< parallelHostReduce, real64 > localSum( 0.0 );
+        forAll< parallelHostPolicy >( numIndices, [=]( localIndex const i )
+        {
+          real64 const weight = volume.empty() ? 1.0 : volume[ indices[i] ];
+          localSum += weight * componentValue( values, indices[i], c );
+        } );
+        sums[c] = localSum.get();
+      }
+      RAJA::ReduceSum< parallelHostReduce, real64 > localWeight( 0.0 );
+      forAll< parallelHostPolicy >( numIndices, [=]( localIndex const i )
+      {
+        localWeight += volume.empty() ? 1.0 : volume[ indices[i] ];
+      } );
+      sums[numComps] = localWeight.get();
+      MpiWrapper::allReduce( sums.data(), sums.data(), LvArray::integerConversion< int >( sums.size() ), MPI_SUM, MPI_COMM_GEOSX );
+
+      real64 const totalWeight = sums[numComps];
+      for( localIndex c = 0; c < numComps; ++c )
+      {
+        if( reduction == ReductionType::sum )
+        {
+          result[c] = sums[c];
+        }
+        else
+        {
+          result[c] = totalWeight > 0.0 ? sums[c] / totalWeight : emptySetValue;
+        }
+      }
+    }
+  } );
+
+  if( MpiWrapper::commRank() == 0 )
+  {
+    size_t const numBytes = numComps * sizeof( real64 );
+    memcpy( buffer, result.data(), numBytes );
+    buffer += numBytes;
+  }
+}
+
 REGISTER_CATALOG_ENTRY( TaskBase, PackCollection, string const &, Group * const )
 }
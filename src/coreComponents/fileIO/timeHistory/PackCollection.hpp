@@ -20,6 +20,7 @@
 #define GEOSX_FILEIO_TIMEHISTORY_PACKCOLLECTION_HPP_
 
 #include "TimeHistoryCollection.hpp"
+#include "codingUtilities/EnumStrings.hpp"
 
 namespace geosx
 {
@@ -46,6 +47,21 @@ public:
    */
   static string catalogName() { return "PackCollection"; }
 
+  /**
+   * @enum ReductionType
+   * @brief Reduction operators that can be applied to the collected values of each set.
+   */
+  enum class ReductionType : integer
+  {
+    none,               ///< collect the values of every index in the set
+    sum,                ///< sum of the values
+    mean,               ///< arithmetic mean of the values
+    volumeWeightedMean, ///< mean of the values weighted by the element volumes
+    min,                ///< minimum value
+    max,                ///< maximum value
+    percentile          ///< value at the requested percentile
+  };
+
   virtual void initializePostSubGroups() override;
 
   /// @copydoc geosx::HistoryCollection::getMetadata
@@ -78,15 +94,22 @@ public:
     static constexpr char const * fieldNameString() { return "fieldName"; }
     static constexpr char const * setNamesString() { return "setNames"; }
     static constexpr char const * onlyOnSetChangeString() { return "onlyOnSetChange"; }
+    static constexpr char const * reductionString() { return "reduction"; }
+    static constexpr char const * percentileString() { return "percentile"; }
 
     dataRepository::ViewKey objectPath = { "objectPath" };
     dataRepository::ViewKey fieldName = { "fieldName" };
     dataRepository::ViewKey setNames = { "setNames" };
     dataRepository::ViewKey onlyOnSetChange = { "onlyOnSetChange" };
+    dataRepository::ViewKey reduction = { "reduction" };
+    dataRepository::ViewKey percentile = { "percentile" };
   } viewKeys;
   /// @endcond
 
 protected:
+  /// @copydoc geosx::dataRepository::Group::postProcessInput( )
+  virtual void postProcessInput() override;
+
   /// Construct the metadata collectors for this collector.
   void buildMetaCollectors( );
 
@@ -105,6 +128,19 @@ protected:
                         buffer_unit_type * & buffer ) override;
 
 private:
+  /**
+   * @brief Reduce the collected values of a set over all ranks and serialize the result on rank 0.
+   * @param targetObject The object from which the field values are collected.
+   * @param target The wrapper of the collected field.
+   * @param collectionIdx The index of the set being collected.
+   * @param buffer The buffer to serialize the reduced values into, advanced past them on rank 0.
+   * @note This is collective over MPI_COMM_GEOSX, ranks without indices in the set still take part.
+   */
+  void collectReduced( Group const & targetObject,
+                       WrapperBase const & target,
+                       localIndex const collectionIdx,
+                       buffer_unit_type * & buffer ) const;
+
   // todo : replace this with a vector of references to the actual set sortedarrays (after packing rework to allow sorted arrays to be used
   // for indexing)
   /// The indices for the specified sets to pack
@@ -119,6 +155,10 @@ private:
   bool m_setChanged;
   /// Whether to only pack when the collected set(s) change size (mostly used for collecting metadata)
   localIndex m_onlyOnSetChange;
+  /// The reduction applied to the collected values of each set
+  ReductionType m_reduction;
+  /// The percentile (in [0,100]) returned by the percentile reduction
+  real64 m_percentile;
   /// Whether to create coordinate meta-collectors if collected objects are mesh objects (set to true for coordinate meta-collectors to
   /// avoid init recursion)
   bool m_disableCoordCollection;
@@ -128,5 +168,15 @@ private:
   bool m_initialized;
 };
 
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( PackCollection::ReductionType,
+              "none",
+              "sum",
+              "mean",
+              "volumeWeightedMean",
+              "min",
+              "max",
+              "percentile" );
+
 }
 #endif
@@ -168,7 +168,11 @@ HDFHistIO::HDFHistIO( string const & filename,
   m_name( name ),
   m_comm( comm ),
   m_subcomm( MPI_COMM_NULL ),
-  m_sizeChanged( true )
+  m_sizeChanged( true ),
+  m_writeBuffer( ),
+  m_writeCount( 0 ),
+  m_localIdxCounts_write( ),
+  m_writeSizeChanged( false )
 {
   for( hsize_t dd = 0; dd < m_rank; ++dd )
   {
@@ -286,30 +290,46 @@ void HDFHistIO::init( bool existsOkay )
   }
 }
 
-void HDFHistIO::write( )
+void HDFHistIO::swapBuffers( )
+{
+  // the buffers keep their allocations, so after the first swaps no reallocation happens during collection
+  std::swap( m_dataBuffer, m_writeBuffer );
+  if( m_dataBuffer.size() < m_writeBuffer.size() )
+  {
+    m_dataBuffer.resize( m_writeBuffer.size() );
+  }
+  m_writeCount = m_bufferedCount;
+  m_localIdxCounts_write.swap( m_localIdxCounts_buffered );
+  m_localIdxCounts_buffered.clear( );
+  m_writeSizeChanged = m_sizeChanged;
+  m_sizeChanged = false;
+  emptyBuffer( );
+}
+
+void HDFHistIO::writeSwapped( )
 {
   // check if the size has changed on any process in the primary comm
   bool anyChanged = false;
-  MpiWrapper::allReduce( &m_sizeChanged, &anyChanged, 1, MPI_LOR, m_comm );
-  m_sizeChanged = anyChanged;
+  MpiWrapper::allReduce( &m_writeSizeChanged, &anyChanged, 1, MPI_LOR, m_comm );
+  m_writeSizeChanged = anyChanged;
 
   // this will set the first dim large enough to hold all the rows we're about to write
-  resizeFileIfNeeded( m_bufferedCount );
-  if( m_bufferedCount > 0 )
+  resizeFileIfNeeded( m_writeCount );
+  if( m_writeCount > 0 )
   {
     buffer_unit_type * dataBuffer = nullptr;
-    if( m_dataBuffer.size() > 0 )
+    if( m_writeBuffer.size() > 0 )
     {
-      dataBuffer = &m_dataBuffer[0];
+      dataBuffer = &m_writeBuffer[0];
     }
-    for( localIndex row = 0; row < m_bufferedCount; ++row )
+    for( localIndex row = 0; row < m_writeCount; ++row )
     {
       // if the size changed at all, update the partitioning and dataset extent before each row is to be written
       //  to ensure the correct mpi ranks participate and that there is enough room to write the largest row during execution
-      if( m_sizeChanged )
+      if( m_writeSizeChanged )
       {
         // since the highwater might change (the max # of indices / 2nd dimension) when updating the partitioning
-        setupPartition( m_localIdxCounts_buffered[ row ] );
+        setupPartition( m_localIdxCounts_write[ row ] );
         // keep the write limit the same (will only change in resizeFileIfNeeded call above)
         updateDatasetExtent( m_writeLimit );
       }
@@ -328,7 +348,7 @@ void HDFHistIO::write( )
 
         std::vector< hsize_t > bufferedCounts( m_rank+1 );
         bufferedCounts[0] = LvArray::integerConversion< hsize_t >( 1 );
-        bufferedCounts[1] = LvArray::integerConversion< hsize_t >( m_localIdxCounts_buffered[ row ] );
+        bufferedCounts[1] = LvArray::integerConversion< hsize_t >( m_localIdxCounts_write[ row ] );
         for( hsize_t dd = 2; dd < m_rank+1; ++dd )
         {
           bufferedCounts[dd] = m_dims[dd-1];
@@ -343,7 +363,7 @@ void HDFHistIO::write( )
         // forward the data buffer pointer to the start of the next row
         if( dataBuffer )
         {
-          dataBuffer += m_localIdxCounts_buffered[ row ] * m_typeSize;
+          dataBuffer += m_localIdxCounts_write[ row ] * m_typeSize;
         }
 
         // unfortunately have to close/open the file for each row since the accessing mpi ranks and extents can change over time
@@ -355,9 +375,9 @@ void HDFHistIO::write( )
       m_writeHead++;
     }
   }
-  m_sizeChanged = false;
-  m_localIdxCounts_buffered.clear( );
-  emptyBuffer( );
+  m_writeSizeChanged = false;
+  m_writeCount = 0;
+  m_localIdxCounts_write.clear( );
 }
 
 void HDFHistIO::compressInFile( )
@@ -161,8 +161,11 @@ public:
   /// @copydoc geosx::BufferedHistoryIO::init
   virtual void init( bool existsOkay ) override;
 
-  /// @copydoc geosx::BufferedHistoryIO::write
-  virtual void write( ) override;
+  /// @copydoc geosx::BufferedHistoryIO::swapBuffers
+  virtual void swapBuffers( ) override;
+
+  /// @copydoc geosx::BufferedHistoryIO::writeSwapped
+  virtual void writeSwapped( ) override;
 
   /// @copydoc geosx::BufferedHistoryIO::compressInFile
   virtual void compressInFile( ) override;
@@ -240,6 +243,16 @@ private:
   MPI_Comm m_subcomm;
   /// Whether the size of the collected data has changed between writes to file
   bool m_sizeChanged;
+
+  // write side of the double buffer, filled by swapBuffers( ) and consumed by writeSwapped( )
+  /// The history data to be written
+  buffer_type m_writeBuffer;
+  /// The number of history states to be written
+  localIndex m_writeCount;
+  /// The local index count of each history state to be written
+  std::vector< globalIndex > m_localIdxCounts_write;
+  /// Whether the size of the data to be written changed since the last write
+  bool m_writeSizeChanged;
 };
 
 }
@@ -56,5 +56,14 @@ void VTKPVDWriter::addData( real64 time, string const & filePath ) const
   dataSetNode.append_attribute( "timestep" ) = time;
   dataSetNode.append_attribute( "file" ) = filePath.c_str();
 }
+
+void VTKPVDWriter::clearData()
+{
+  auto collectionNode = m_pvdFile.child( "VTKFile" ).child( "Collection" );
+  while( collectionNode.first_child() )
+  {
+    collectionNode.remove_child( collectionNode.first_child() );
+  }
+}
 }
 }
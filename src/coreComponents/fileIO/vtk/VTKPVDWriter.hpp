@@ -55,6 +55,11 @@ public:
    */
   void addData( real64 time, string const & filePath ) const;
 
+  /*!
+   * @brief Remove all the datasets added so far
+   */
+  void clearData();
+
 private:
 
   /// PVD XML file
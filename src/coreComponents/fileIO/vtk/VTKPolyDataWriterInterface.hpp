@@ -117,6 +117,15 @@ public:
     m_pvd.setFileName( joinPath( m_outputDir, m_outputName ) + ".pvd" );
   }
 
+  /**
+   * @brief Forget the time steps written so far, so that the next write starts a new .pvd file
+   */
+  void clearData()
+  {
+    m_pvd.clearData();
+    m_previousCycle = -1;
+  }
+
   /**
    * @brief Main method of this class. Write all the files for one time step.
    * @details This method writes a .pvd file (if a previous one was created from a precedent time step,
@@ -17,6 +17,7 @@
  */
 
 #include "FunctionManager.hpp"
+#include "TableFunction.hpp"
 
 namespace geosx
 {
@@ -67,4 +68,12 @@ void FunctionManager::expandObjectCatalogs()
   }
 }
 
+void FunctionManager::setRealization( integer const realization )
+{
+  forSubGroups< TableFunction >( [&]( TableFunction & table )
+  {
+    table.setRealization( realization );
+  } );
+}
+
 } // end of namespace geosx
@@ -67,6 +67,12 @@ public:
    */
   virtual void expandObjectCatalogs() override;
 
+  /**
+   * @brief Select the realization of an ensemble run in all the table functions
+   * @param realization the index of the realization
+   */
+  void setRealization( integer const realization );
+
 private:
   static FunctionManager * m_instance;
 };
@@ -29,6 +29,7 @@ TableFunction::TableFunction( const string & name,
                               Group * const parent ):
   FunctionBase( name, parent ),
   m_interpolationMethod( InterpolationType::Linear ),
+  m_realization( 0 ),
   m_kernelWrapper( createKernelWrapper() )
 {
   registerWrapper( viewKeyStruct::coordinatesString(), &m_tableCoordinates1D ).
@@ -42,12 +43,12 @@ TableFunction::TableFunction( const string & name,
   registerWrapper( viewKeyStruct::coordinateFilesString(), &m_coordinateFiles ).
     setInputFlag( InputFlags::OPTIONAL ).
     setRestartFlags( RestartFlags::NO_WRITE ).
-    setDescription( "List of coordinate file names for ND Table" );
+    setDescription( "List of coordinate file names for ND Table (%r is replaced by the realization index)" );
 
   registerWrapper( viewKeyStruct::voxelFileString(), &m_voxelFile ).
     setInputFlag( InputFlags::OPTIONAL ).
     setRestartFlags( RestartFlags::NO_WRITE ).
-    setDescription( "Voxel file name for ND Table" );
+    setDescription( "Voxel file name for ND Table (%r is replaced by the realization index)" );
 
   registerWrapper( viewKeyStruct::interpolationString(), &m_interpolationMethod ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -85,6 +86,37 @@ void TableFunction::parseFile( string const & filename, array1d< T > & target )
   inputStream.close();
 }
 
+string TableFunction::realizationFileName( string const & filename ) const
+{
+  string result = filename;
+  string const token = "%r";
+  string const index = std::to_string( m_realization );
+  for( size_t pos = result.find( token ); pos != string::npos; pos = result.find( token, pos + index.size() ) )
+  {
+    result.replace( pos, token.size(), index );
+  }
+  return result;
+}
+
+bool TableFunction::dependsOnRealization() const
+{
+  auto const hasToken = []( string const & filename ) { return filename.find( "%r" ) != string::npos; };
+  return hasToken( m_voxelFile ) || std::any_of( m_coordinateFiles.begin(), m_coordinateFiles.end(), hasToken );
+}
+
+void TableFunction::setRealization( integer const realization )
+{
+  m_realization = realization;
+  if( m_coordinateFiles.empty() || !dependsOnRealization() )
+  {
+    return;
+  }
+
+  m_coordinates.resize( 0 );
+  m_values.clear();
+  initializeFunction();
+}
+
 void TableFunction::setInterpolationMethod( InterpolationType const method )
 {
   m_interpolationMethod = method;
@@ -132,12 +164,12 @@ void TableFunction::initializeFunction()
   else
   {
     // ND Table
-    parseFile( m_voxelFile, m_values );
+    parseFile( realizationFileName( m_voxelFile ), m_values );
     array1d< real64 > tmp;
     for( localIndex ii = 0; ii < m_coordinateFiles.size(); ++ii )
     {
       tmp.clear();
-      parseFile( m_coordinateFiles[ii], tmp );
+      parseFile( realizationFileName( m_coordinateFiles[ii] ), tmp );
       m_coordinates.appendArray( tmp.begin(), tmp.end() );
     }
   }
@@ -279,6 +279,14 @@ private:
    */
   void setTableValues( real64_array values );
 
+  /**
+   * @brief Select the realization of an ensemble run
+   * @param realization the index of the realization
+   * @details The tables read from files whose name contains the token %r are reloaded from
+   *          the files of the new realization; the other tables are left untouched.
+   */
+  void setRealization( integer const realization );
+
   /**
    * @brief Create an instance of the kernel wrapper
    * @return the kernel wrapper
@@ -312,6 +320,19 @@ private:
   template< typename T >
   void parseFile( string const & filename, array1d< T > & target );
 
+  /**
+   * @brief Substitute the index of the current realization in a file name.
+   * @param[in] filename The file name, possibly containing the token %r.
+   * @return The file name of the current realization.
+   */
+  string realizationFileName( string const & filename ) const;
+
+  /**
+   * @brief Check whether the table is read from realization-dependent files.
+   * @return true if one of the file names contains the token %r
+   */
+  bool dependsOnRealization() const;
+
   /// Coordinates for 1D table
   array1d< real64 > m_tableCoordinates1D;
 
@@ -330,6 +351,9 @@ private:
   /// Table values (in fortran order)
   array1d< real64 > m_values;
 
+  /// Index of the realization whose files are read
+  integer m_realization;
+
   /// Kernel wrapper object used in evaluate() interface
   KernelWrapper m_kernelWrapper;
 
@@ -973,8 +973,19 @@ void DofManager::countRowLengthsOneBlock( arrayView1d< localIndex > const & rowL
 
 // Create the sparsity pattern (location-location). Low level interface
 void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern ) const
+{
+  setSparsityPattern( pattern, arrayView1d< localIndex const >() );
+
+  // Compress to remove unused space between rows
+  pattern.compress();
+}
+
+void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern,
+                                     arrayView1d< localIndex const > const & additionalRowLengths ) const
 {
   GEOSX_ERROR_IF( !m_reordered, "Cannot set monolithic sparsity pattern before reorderByRank() has been called." );
+  GEOSX_ERROR_IF( !additionalRowLengths.empty() && additionalRowLengths.size() != numLocalDofs(),
+                  "The number of additional row lengths does not match the number of local rows." );
 
   localIndex const numLocalRows = numLocalDofs();
   localIndex const numFields = LvArray::integerConversion< localIndex >( m_fields.size() );
@@ -989,6 +1000,14 @@ void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern )
     }
   }
 
+  if( !additionalRowLengths.empty() )
+  {
+    forAll< parallelHostPolicy >( numLocalRows, [&]( localIndex const localRow )
+    {
+      rowSizes[localRow] += additionalRowLengths[localRow];
+    } );
+  }
+
   // Step 2. Allocate enough capacity for all nonzero entries in each row
   pattern.resizeFromRowCapacities< parallelHostPolicy >( numLocalRows, numGlobalDofs(), rowSizes.data() );
 
@@ -1000,9 +1019,6 @@ void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern )
       setSparsityPatternOneBlock( pattern.toView(), blockRow, blockCol );
     }
   }
-
-  // Step 4. Compress to remove unused space between rows
-  pattern.compress();
 }
 
 namespace
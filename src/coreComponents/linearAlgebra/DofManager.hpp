@@ -341,6 +341,17 @@ public:
    */
   void setSparsityPattern( SparsityPattern< globalIndex > & pattern ) const;
 
+  /**
+   * @brief Populate sparsity pattern of the entire system matrix, leaving room for additional entries.
+   * @param [out] pattern the target sparsity pattern
+   * @param [in] additionalRowLengths the number of additional entries to reserve in each local row
+   *
+   * The pattern is not compressed, so that the entries of couplings that are not known to the
+   * DofManager can be inserted by the caller in place, without copying the pattern.
+   */
+  void setSparsityPattern( SparsityPattern< globalIndex > & pattern,
+                           arrayView1d< localIndex const > const & additionalRowLengths ) const;
+
   /**
    * @brief Copy values from LA vectors to simulation data arrays.
    *
@@ -50,6 +50,8 @@
 
 #include <umfpack.h>
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -120,26 +122,33 @@ void factorize( SuiteSparseData & data, LinearSolverParameters const & params )
   data.colIndices.move( LvArray::MemorySpace::host, false );
   data.values.move( LvArray::MemorySpace::host, false );
 
-  // symbolic factorization
-  status = umfpack_dl_symbolic( numRows,
-                                numRows,
-                                data.rowPtr.data(),
-                                data.colIndices.data(),
-                                data.values.data(),
-                                &data.symbolic,
-                                data.control,
-                                data.info );
-  if( status < 0 )
+  // symbolic factorization (skipped when the one of a matrix with the same pattern is reused)
+  if( !data.symbolic )
   {
-    umfpack_dl_report_info( data.control, data.info );
-    umfpack_dl_report_status( data.control, status );
-    GEOSX_ERROR( "SuiteSparse: umfpack_dl_symbolic failed." );
-  }
+    status = umfpack_dl_symbolic( numRows,
+                                  numRows,
+                                  data.rowPtr.data(),
+                                  data.colIndices.data(),
+                                  data.values.data(),
+                                  &data.symbolic,
+                                  data.control,
+                                  data.info );
+    if( status < 0 )
+    {
+      umfpack_dl_report_info( data.control, data.info );
+      umfpack_dl_report_status( data.control, status );
+      GEOSX_ERROR( "SuiteSparse: umfpack_dl_symbolic failed." );
+    }
 
-  // print the symbolic factorization
-  if( params.logLevel > 1 )
+    // print the symbolic factorization
+    if( params.logLevel > 1 )
+    {
+      umfpack_dl_report_symbolic( data.symbolic, data.control );
+    }
+  }
+  else if( params.logLevel > 1 )
   {
-    umfpack_dl_report_symbolic( data.symbolic, data.control );
+    GEOSX_LOG_RANK( "SuiteSparse: reusing the symbolic factorization of the previous matrix" );
   }
 
   // numeric factorization
@@ -165,6 +174,22 @@ void factorize( SuiteSparseData & data, LinearSolverParameters const & params )
   }
 }
 
+bool hasSamePattern( SuiteSparseData const & data, SuiteSparseData const & newData )
+{
+  if( data.rowPtr.size() != newData.rowPtr.size() || data.colIndices.size() != newData.colIndices.size() )
+  {
+    return false;
+  }
+
+  data.rowPtr.move( LvArray::MemorySpace::host, false );
+  data.colIndices.move( LvArray::MemorySpace::host, false );
+  newData.rowPtr.move( LvArray::MemorySpace::host, false );
+  newData.colIndices.move( LvArray::MemorySpace::host, false );
+
+  return std::equal( data.rowPtr.begin(), data.rowPtr.end(), newData.rowPtr.begin() )
+         && std::equal( data.colIndices.begin(), data.colIndices.end(), newData.colIndices.begin() );
+}
+
 void setOptions( SuiteSparseData & data, LinearSolverParameters const & params )
 {
   // Get the default control parameters
@@ -178,8 +203,8 @@ void setOptions( SuiteSparseData & data, LinearSolverParameters const & params )
 template< typename LAI >
 void SuiteSparse< LAI >::setup( Matrix const & mat )
 {
-  clear();
   PreconditionerBase< LAI >::setup( mat );
+  m_condEst = -1.0;
 
   // Choose working rank that will carry out the solve
   int const rank = MpiWrapper::commRank( mat.comm() );
@@ -189,24 +214,37 @@ void SuiteSparse< LAI >::setup( Matrix const & mat )
   SSlong const numNZ = LvArray::integerConversion< SSlong >( mat.numGlobalNonzeros() );
 
   // Allocate memory and control structures on working rank only
-  m_data = std::make_unique< SuiteSparseData >( rank == m_workingRank ? numGR : 0,
-                                                rank == m_workingRank ? numNZ : 0 );
-  setOptions( *m_data, m_params );
+  std::unique_ptr< SuiteSparseData > data = std::make_unique< SuiteSparseData >( rank == m_workingRank ? numGR : 0,
+                                                                                 rank == m_workingRank ? numNZ : 0 );
+  setOptions( *data, m_params );
 
   // Export needs to be carried collectively on all ranks
   m_export = std::make_unique< typename Matrix::Export >( mat, m_workingRank );
 
   m_export->exportCRS( mat,
-                       m_data->rowPtr,
-                       m_data->colIndices,
-                       m_data->values );
+                       data->rowPtr,
+                       data->colIndices,
+                       data->values );
 
   // Perform matrix factorization on working rank
   if( rank == m_workingRank )
   {
     Stopwatch timer( m_result.setupTime );
+
+    // The symbolic factorization only depends on the sparsity pattern:
+    // it is taken over from the previous setup if the pattern has not changed
+    if( m_data && m_data->symbolic && hasSamePattern( *m_data, *data ) )
+    {
+      std::swap( data->symbolic, m_data->symbolic );
+    }
+    m_data = std::move( data );
+
     factorize( *m_data, m_params );
   }
+  else
+  {
+    m_data = std::move( data );
+  }
 
   // Sync timer to all ranks
   MpiWrapper::bcast( &m_result.setupTime, 1, m_workingRank, mat.comm() );
@@ -68,6 +68,8 @@ public:
   /**
    * @brief Compute the preconditioner from a matrix.
    * @param mat the matrix to precondition.
+   * @note If @p mat has the same sparsity pattern as the matrix of the previous setup,
+   *       its symbolic factorization is reused and only the numeric factorization is recomputed.
    */
   virtual void setup( Matrix const & mat ) override;
 
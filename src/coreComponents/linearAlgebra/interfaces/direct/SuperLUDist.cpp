@@ -29,6 +29,8 @@
 
 #include <superlu_ddefs.h>
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -172,28 +174,69 @@ SuperLUDist< LAI >::~SuperLUDist() = default;
 template< typename LAI >
 void SuperLUDist< LAI >::setup( Matrix const & mat )
 {
-  clear();
   Base::setup( mat );
+  m_condEst = -1.0;
 
   int_t const numGR = LvArray::integerConversion< int_t >( mat.numGlobalRows() );
   int_t const numLR = LvArray::integerConversion< int_t >( mat.numLocalRows() );
   int_t const numNZ = LvArray::integerConversion< int_t >( mat.numLocalNonzeros() );
+  int_t const firstRow = LvArray::integerConversion< int_t >( mat.ilower() );
 
-  m_data = std::make_unique< SuperLUDistData >( numGR, numLR, numNZ, mat.comm() );
-  setOptions();
+  array1d< int_t > rowPtr( numLR + 1 );
+  array1d< int_t > colIndices( numNZ );
+  array1d< double > values( numNZ );
 
   typename Matrix::Export matExport;
-  matExport.exportCRS( mat, m_data->rowPtr, m_data->colIndices, m_data->values );
-  m_data->rowPtr.move( LvArray::MemorySpace::host, false );
-  m_data->colIndices.move( LvArray::MemorySpace::host, false );
-  m_data->values.move( LvArray::MemorySpace::host, false );
+  matExport.exportCRS( mat, rowPtr, colIndices, values );
+  rowPtr.move( LvArray::MemorySpace::host, false );
+  colIndices.move( LvArray::MemorySpace::host, false );
+  values.move( LvArray::MemorySpace::host, false );
+
+  // The column permutation and the symbolic factorization only depend on the sparsity pattern:
+  // they are reused if the pattern of the previous matrix is the same on all the ranks.
+  // This is not done with the parallel symbolic factorization, which is always redone by SuperLU_Dist.
+  bool samePattern = false;
+  if( m_data && m_data->options.ParSymbFact == NO )
+  {
+    NRformat_loc const * const store = static_cast< NRformat_loc const * >( m_data->mat.Store );
+    bool const sameLocalPattern = m_data->mat.nrow == numGR
+                                  && store->fst_row == firstRow
+                                  && m_data->rowPtr.size() == rowPtr.size()
+                                  && m_data->colIndices.size() == colIndices.size()
+                                  && std::equal( rowPtr.begin(), rowPtr.end(), m_data->rowPtr.begin() )
+                                  && std::equal( colIndices.begin(), colIndices.end(), m_data->colIndices.begin() );
+    samePattern = MpiWrapper::min( sameLocalPattern ? 1 : 0, mat.comm() ) == 1;
+  }
+
+  if( samePattern )
+  {
+    // Only release the LU factors, the scaling and permutation data structure is kept
+    dDestroy_LU( numGR, &m_data->grid, &m_data->lu );
+    if( m_data->options.SolveInitialized )
+    {
+      dSolveFinalize( &m_data->options, &m_data->solve );
+    }
+    SUPERLU_FREE( (NRformat_loc *)m_data->mat.Store );
+    PStatFree( &m_data->stat );
+    PStatInit( &m_data->stat );
+  }
+  else
+  {
+    m_data.reset();
+    m_data = std::make_unique< SuperLUDistData >( numGR, numLR, numNZ, mat.comm() );
+    setOptions();
+  }
+
+  m_data->rowPtr = std::move( rowPtr );
+  m_data->colIndices = std::move( colIndices );
+  m_data->values = std::move( values );
 
   dCreate_CompRowLoc_Matrix_dist( &m_data->mat,
                                   numGR,
                                   numGR,
                                   numNZ,
                                   numLR,
-                                  LvArray::integerConversion< int_t >( mat.ilower() ),
+                                  firstRow,
                                   m_data->values.data(),
                                   m_data->colIndices.data(),
                                   m_data->rowPtr.data(),
@@ -203,7 +246,7 @@ void SuperLUDist< LAI >::setup( Matrix const & mat )
 
   {
     Stopwatch timer( m_result.setupTime );
-    factorize();
+    factorize( samePattern );
   }
 }
 
@@ -335,14 +378,14 @@ void SuperLUDist< LAI >::setOptions()
 }
 
 template< typename LAI >
-void SuperLUDist< LAI >::factorize()
+void SuperLUDist< LAI >::factorize( bool const samePattern )
 {
   // To be able to use SuperLU_Dist solver we need to disable floating point exceptions
   LvArray::system::FloatingPointExceptionGuard guard;
 
   // Call the linear equation solver to factorize the matrix.
   int info = 0;
-  m_data->options.Fact = DOFACT;
+  m_data->options.Fact = samePattern ? SamePattern : DOFACT;
   pdgssvx( &m_data->options,
            &m_data->mat,
            &m_data->scalePerm,
@@ -68,6 +68,8 @@ public:
   /**
    * @brief Compute the preconditioner from a matrix.
    * @param mat the matrix to precondition.
+   * @note If @p mat has the same sparsity pattern as the matrix of the previous setup,
+   *       only the row permutation and the numeric factorization are recomputed.
    */
   virtual void setup( Matrix const & mat ) override;
 
@@ -104,8 +106,10 @@ private:
 
   /**
    * @brief Perform symbolic/numeric factorization of the matrix.
+   * @param samePattern whether the matrix has the same sparsity pattern as the previously factorized one,
+   *                    in which case the column permutation and the symbolic factorization are reused
    */
-  void factorize();
+  void factorize( bool const samePattern );
 
   /**
    * @brief Estimates the condition number of the matrix using LU factors.
@@ -104,6 +104,22 @@ protected:
   real64 cond_est = 1.0;
 
   void test( LinearSolverParameters const & params )
+  {
+    auto solver = LAI::createSolver( params );
+    solveAndCheck( *solver, params );
+  }
+
+  void testSamePattern( LinearSolverParameters const & params )
+  {
+    // Set the solver up with a first matrix, then solve with a matrix with the same pattern and other values
+    auto solver = LAI::createSolver( params );
+    solver->setup( matrix );
+    matrix.scale( 2.0 );
+    solveAndCheck( *solver, params );
+  }
+
+  void solveAndCheck( LinearSolverBase< LAI > & solver,
+                      LinearSolverParameters const & params )
   {
     // Create a random "true" solution vector
     Vector sol_true;
@@ -120,11 +136,10 @@ protected:
     sol_comp.create( sol_true.localSize(), sol_true.comm() );
     sol_comp.zero();
 
-    // Create the solver and solve the system
-    auto solver = LAI::createSolver( params );
-    solver->setup( matrix );
-    solver->solve( rhs, sol_comp );
-    EXPECT_TRUE( solver->result().success() );
+    // Set the solver up and solve the system
+    solver.setup( matrix );
+    solver.solve( rhs, sol_comp );
+    EXPECT_TRUE( solver.result().success() );
 
     // Check that solution is within epsilon of true
     Vector sol_diff( sol_comp );
@@ -171,6 +186,18 @@ TYPED_TEST_P( SolverTestLaplace2D, DirectParallel )
   this->test( params_DirectParallel() );
 }
 
+TYPED_TEST_P( SolverTestLaplace2D, DirectSerialSamePattern )
+{
+  LinearSolverParameters params = params_DirectSerial();
+  params.isSymmetric = true;
+  this->testSamePattern( params );
+}
+
+TYPED_TEST_P( SolverTestLaplace2D, DirectParallelSamePattern )
+{
+  this->testSamePattern( params_DirectParallel() );
+}
+
 TYPED_TEST_P( SolverTestLaplace2D, GMRES_ILU )
 {
   this->test( params_GMRES_ILU() );
@@ -189,6 +216,8 @@ TYPED_TEST_P( SolverTestLaplace2D, CG_AMG )
 REGISTER_TYPED_TEST_SUITE_P( SolverTestLaplace2D,
                              DirectSerial,
                              DirectParallel,
+                             DirectSerialSamePattern,
+                             DirectParallelSamePattern,
                              GMRES_ILU,
                              CG_SGS,
                              CG_AMG );
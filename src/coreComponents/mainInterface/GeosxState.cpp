@@ -14,6 +14,7 @@
 
 // Source includes
 #include "GeosxState.hpp"
+#include "common/TimerTree.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "mainInterface/initialization.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
@@ -120,8 +121,15 @@ GeosxState::GeosxState( std::unique_ptr< CommandLineOptions > && commandLineOpti
 
 #if defined( GEOSX_USE_CALIPER )
   setupCaliper( *m_caliperManager, getCommandLineOptions() );
+#else
+  timing::setup( getCommandLineOptions().timerOutput );
 #endif
 
+  if( !getCommandLineOptions().communicationProfile.empty() )
+  {
+    m_commTools->enableProfiling( getCommandLineOptions().communicationProfile );
+  }
+
   string restartFileName;
   if( ProblemManager::parseRestart( restartFileName, getCommandLineOptions() ) )
   {
@@ -138,10 +146,6 @@ GeosxState::GeosxState( std::unique_ptr< CommandLineOptions > && commandLineOpti
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 GeosxState::~GeosxState()
 {
-#if defined( GEOSX_USE_CALIPER )
-  m_caliperManager->flush();
-#endif
-
   GEOSX_ERROR_IF( currentGlobalState != this, "This shouldn't be possible." );
   currentGlobalState = nullptr;
 }
@@ -204,6 +208,18 @@ void GeosxState::run()
   }
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void GeosxState::report()
+{
+  m_commTools->reportProfile();
+
+#if defined( GEOSX_USE_CALIPER )
+  m_caliperManager->flush();
+#else
+  timing::report();
+#endif
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 dataRepository::Group & GeosxState::getProblemManagerAsGroup()
 { return getProblemManager(); }
@@ -137,6 +137,13 @@ public:
    */
   void run();
 
+  /**
+   * @brief Report the timers and the communication profile of the run.
+   * @note This is a collective operation, to be called on the normal exit path only: a failing rank
+   *   would otherwise leave the others waiting in the reductions instead of aborting.
+   */
+  void report();
+
   /**
    * @brief Return the current State.
    * @return The current state.
@@ -43,6 +43,8 @@
 #include "mesh/mpiCommunications/SpatialPartition.hpp"
 #include "physicsSolvers/PhysicsSolverManager.hpp"
 #include "physicsSolvers/SolverBase.hpp"
+#include "physicsSolvers/surfaceGeneration/EmbeddedSurfaceGenerator.hpp"
+#include "physicsSolvers/surfaceGeneration/SurfaceGenerator.hpp"
 #include "schema/schemaUtilities.hpp"
 
 // System includes
@@ -55,12 +57,40 @@ namespace geosx
 using namespace dataRepository;
 using namespace constitutive;
 
+namespace
+{
+
+/**
+ * @brief Get the directory in which the outputs of a realization of an ensemble run are written.
+ * @param outputDirectory the output directory of the run
+ * @param realization the index of the realization
+ * @return the output directory of the realization
+ */
+string realizationOutputDirectory( string const & outputDirectory, integer const realization )
+{
+  return joinPath( outputDirectory, GEOSX_FMT( "realization{}", realization ) );
+}
+
+/**
+ * @brief Get the path of the restart file holding the initial state of an ensemble run.
+ * @param outputDirectory the output directory of the run
+ * @return the path of the restart file
+ */
+string ensembleInitialStatePath( string const & outputDirectory )
+{
+  return joinPath( outputDirectory, "ensembleInitialState" );
+}
+
+}
+
 ProblemManager::ProblemManager( conduit::Node & root ):
   dataRepository::Group( dataRepository::keys::ProblemManager, root ),
   m_physicsSolverManager( nullptr ),
   m_eventManager( nullptr ),
   m_functionManager( nullptr ),
-  m_fieldSpecificationManager( nullptr )
+  m_fieldSpecificationManager( nullptr ),
+  m_realization( 0 ),
+  m_batchedEnsemble( false )
 {
   // Groups that do not read from the xml
   registerGroup< DomainPartition >( groupKeys.domain );
@@ -135,6 +165,11 @@ ProblemManager::ProblemManager( conduit::Node & root ):
     setRestartFlags( RestartFlags::WRITE ).
     setDescription( "Whether to disallow using pinned memory allocations for MPI communication buffers." );
 
+  commandLine.registerWrapper< integer >( viewKeys.numRealizations.key() ).
+    setApplyDefaultValue( 1 ).
+    setRestartFlags( RestartFlags::WRITE ).
+    setDescription( "Number of realizations of the problem run on the same mesh and discretization." );
+
 }
 
 ProblemManager::~ProblemManager()
@@ -156,6 +191,8 @@ void ProblemManager::problemSetup()
 
   applyNumericalMethods();
 
+  setupBatchedEnsemble();
+
   registerDataOnMeshRecursive( getDomainPartition().getMeshBodies() );
 
   initialize();
@@ -178,10 +215,11 @@ void ProblemManager::parseCommandLineInput()
   commandLine.getReference< integer >( viewKeys.overridePartitionNumbers ) = opts.overridePartitionNumbers;
   commandLine.getReference< integer >( viewKeys.useNonblockingMPI ) = opts.useNonblockingMPI;
   commandLine.getReference< integer >( viewKeys.suppressPinned ) = opts.suppressPinned;
+  commandLine.getReference< integer >( viewKeys.numRealizations ) = opts.numRealizations;
 
   string & outputDirectory = commandLine.getReference< string >( viewKeys.outputDirectory );
   outputDirectory = opts.outputDirectory;
-  OutputBase::setOutputDirectory( outputDirectory );
+  OutputBase::setOutputDirectory( opts.numRealizations > 1 ? realizationOutputDirectory( outputDirectory, 0 ) : outputDirectory );
 
   string & inputFileName = commandLine.getReference< string >( viewKeys.inputFileName );
   inputFileName = xmlWrapper::buildMultipleInputXML( opts.inputFileNames, outputDirectory );
@@ -415,6 +453,25 @@ void ProblemManager::parseXMLDocument( xmlWrapper::xmlDocument const & xmlDocume
     MeshManager & meshManager = this->getGroup< MeshManager >( groupKeys.meshManager );
     meshManager.generateMeshLevels( domain );
 
+    // The mesh cache entries are identified by the inputs the generated meshes depend on
+    {
+      std::ostringstream signature;
+      for( char const * const nodeName : { meshManager.getName().c_str(),
+                                           MeshLevel::groupStructKeys::elemManagerString,
+                                           groupKeys.geometricObjectManager.key().c_str() } )
+      {
+        xmlProblemNode.child( nodeName ).print( signature, "", pugi::format_raw );
+      }
+      Group const & commandLine = this->getGroup< Group >( groupKeys.commandLine );
+      signature << commandLine.getReference< integer >( viewKeys.xPartitionsOverride ) << " "
+                << commandLine.getReference< integer >( viewKeys.yPartitionsOverride ) << " "
+                << commandLine.getReference< integer >( viewKeys.zPartitionsOverride );
+
+      // Another build may write (or read) the cached data differently
+      signature << "\n" << getVersion();
+      meshManager.setCacheSignature( signature.str() );
+    }
+
 
 
     //   domain.getMeshBodies().forSubGroups< MeshBody >( [&]( MeshBody & meshBody )
@@ -552,6 +609,11 @@ void ProblemManager::generateMesh()
   DomainPartition & domain = getDomainPartition();
 
   MeshManager & meshManager = this->getGroup< MeshManager >( groupKeys.meshManager );
+  if( meshManager.loadMeshCache( domain ) )
+  {
+    return;
+  }
+
   meshManager.generateMeshes( domain );
 
   Group & meshBodies = domain.getMeshBodies();
@@ -639,6 +701,7 @@ void ProblemManager::generateMesh()
     edgeManager.setIsExternal( faceManager );
   } );
 
+  meshManager.writeMeshCache( domain );
 }
 
 
@@ -648,6 +711,12 @@ void ProblemManager::importFields()
   DomainPartition & domain = getDomainPartition();
   MeshManager & meshManager = this->getGroup< MeshManager >( groupKeys.meshManager );
 
+  // The meshes loaded from the cache have no fields to import, and the generators hold no data
+  if( meshManager.isLoadedFromCache() )
+  {
+    return;
+  }
+
   meshManager.forSubGroups< MeshGeneratorBase >( [&]( MeshGeneratorBase & generator )
   {
     generator.importFields( domain );
@@ -804,7 +873,16 @@ void ProblemManager::setRegionQuadrature( Group & meshBodies,
 
 bool ProblemManager::runSimulation()
 {
-  return m_eventManager->run( getDomainPartition() );
+  integer const numRealizations = getGroup< Group >( groupKeys.commandLine ).getReference< integer >( viewKeys.numRealizations );
+  while( !m_eventManager->run( getDomainPartition() ) )
+  {
+    if( m_batchedEnsemble || m_realization + 1 >= numRealizations )
+    {
+      return false;
+    }
+    startRealization( m_realization + 1 );
+  }
+  return true;
 }
 
 DomainPartition & ProblemManager::getDomainPartition()
@@ -821,6 +899,114 @@ void ProblemManager::applyInitialConditions()
 {
   m_fieldSpecificationManager->applyInitialConditions( getDomainPartition() );
   initializePostInitialConditions();
+
+  integer const numRealizations = getGroup< Group >( groupKeys.commandLine ).getReference< integer >( viewKeys.numRealizations );
+  if( numRealizations > 1 )
+  {
+    // The fracture solvers modify the mesh, which is shared by all the realizations
+    m_physicsSolverManager->forSubGroups< SurfaceGenerator, EmbeddedSurfaceGenerator >( []( auto const & solver )
+    {
+      GEOSX_THROW( GEOSX_FMT( "{}: an ensemble of realizations cannot be run with a surface generator", solver.getName() ),
+                   InputError );
+    } );
+
+    // Write the initial state to a restart file, read back by each realization instead of rebuilding the problem
+    string const & outputDirectory = getGroup< Group >( groupKeys.commandLine ).getReference< string >( viewKeys.outputDirectory );
+    prepareToWrite();
+    writeTree( ensembleInitialStatePath( outputDirectory ), *getConduitNode().parent() );
+    finishWriting();
+
+    if( m_batchedEnsemble )
+    {
+      GEOSX_LOG_RANK_0( GEOSX_FMT( "Running an ensemble of {} realizations advanced together by the solvers", numRealizations ) );
+      storeRealizations( numRealizations );
+    }
+    else
+    {
+      GEOSX_LOG_RANK_0( GEOSX_FMT( "Running an ensemble of {} realizations, starting with realization 0", numRealizations ) );
+    }
+  }
+}
+
+void ProblemManager::setupBatchedEnsemble()
+{
+  integer const numRealizations = getGroup< Group >( groupKeys.commandLine ).getReference< integer >( viewKeys.numRealizations );
+
+  m_batchedEnsemble = numRealizations > 1 && m_physicsSolverManager->numSubGroups() > 0;
+  m_physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase const & solver )
+  {
+    m_batchedEnsemble = m_batchedEnsemble && solver.supportsEnsemble();
+  } );
+
+  if( m_batchedEnsemble )
+  {
+    m_physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase & solver )
+    {
+      solver.setNumRealizations( numRealizations );
+    } );
+  }
+}
+
+void ProblemManager::resetToInitialState( integer const realization )
+{
+  // Rewind the events, the solvers and the fields to the initial state; the mesh, the ghosts,
+  // the stencils and the degrees of freedom are left untouched
+  string const & outputDirectory = getGroup< Group >( groupKeys.commandLine ).getReference< string >( viewKeys.outputDirectory );
+  mergeTree( ensembleInitialStatePath( outputDirectory ), *getConduitNode().parent() );
+  readRestartOverwrite();
+
+  // Load the properties of the realization and update the solver states accordingly
+  m_functionManager->setRealization( realization );
+  m_fieldSpecificationManager->applyInitialConditions( getDomainPartition() );
+  m_physicsSolverManager->initializePostInitialConditions();
+}
+
+void ProblemManager::storeRealizations( integer const numRealizations )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // Each realization is set up in the regular fields, as in a sequential ensemble run, and copied into the ensemble fields.
+  // The ensemble fields are not written to restart files, so rewinding to the initial state leaves them untouched.
+  DomainPartition & domain = getDomainPartition();
+  for( integer realization = 0; realization < numRealizations; ++realization )
+  {
+    if( realization > 0 )
+    {
+      resetToInitialState( realization );
+    }
+    m_physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase & solver )
+    {
+      solver.storeRealizationState( domain, realization );
+    } );
+  }
+
+  // The regular fields and the tables are left with the first realization
+  resetToInitialState( 0 );
+
+  // All the realizations are written by the same outputs
+  string const & outputDirectory = getGroup< Group >( groupKeys.commandLine ).getReference< string >( viewKeys.outputDirectory );
+  OutputBase::setOutputDirectory( outputDirectory );
+  getGroup< OutputManager >( groupKeys.outputManager ).forSubGroups< OutputBase >( []( OutputBase & output )
+  {
+    output.reinit();
+  } );
+}
+
+void ProblemManager::startRealization( integer const realization )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "Starting realization {}", realization ) );
+  m_realization = realization;
+
+  string const & outputDirectory = getGroup< Group >( groupKeys.commandLine ).getReference< string >( viewKeys.outputDirectory );
+  OutputBase::setOutputDirectory( realizationOutputDirectory( outputDirectory, realization ) );
+
+  resetToInitialState( realization );
+
+  getGroup< OutputManager >( groupKeys.outputManager ).forSubGroups< OutputBase >( []( OutputBase & output )
+  {
+    output.reinit();
+  } );
 }
 
 void ProblemManager::readRestartOverwrite()
@@ -151,6 +151,9 @@ public:
   /**
    * @brief Run the events in the scheduler.
    * @return True iff the simulation exited early, and needs to be run again to completion.
+   * @details In an ensemble run, the realizations are either advanced together by the solvers, when they
+   *          all support it, or run one after the other, each one restarting from the initial state of the
+   *          problem with the tables and initial conditions of the realization.
    */
   bool runSimulation();
 
@@ -161,6 +164,9 @@ public:
 
   /**
    * @brief Applies initial conditions indicated within the input file FieldSpecifications block
+   * @details In an ensemble run, the resulting initial state is written to a restart file to start the next realizations.
+   *          When the solvers advance the realizations together, the initial state of each realization is set up
+   *          from this file and stored in the ensemble fields of the solvers.
    */
   void applyInitialConditions();
 
@@ -224,6 +230,7 @@ public:
     dataRepository::ViewKey useNonblockingMPI        = {"useNonblockingMPI"};        ///< Flag to use non-block MPI key
     dataRepository::ViewKey suppressPinned           = {"suppressPinned"};           ///< Flag to suppress use of pinned
                                                                                      ///< memory key
+    dataRepository::ViewKey numRealizations          = {"numRealizations"};          ///< Number of realizations key
   } viewKeys; ///< Command line input viewKeys
 
   /// Child group viewKeys
@@ -343,6 +350,30 @@ private:
                             constitutive::ConstitutiveManager const & constitutiveManager,
                             map< std::tuple< string, string, string >, localIndex > const & regionQuadrature );
 
+  /**
+   * @brief Check whether the realizations of an ensemble run can be advanced together by the solvers,
+   *        and set the number of realizations of the solvers accordingly.
+   */
+  void setupBatchedEnsemble();
+
+  /**
+   * @brief Rewind the fields to the initial state of the problem and set up the initial state of a realization.
+   * @param realization the index of the realization
+   */
+  void resetToInitialState( integer const realization );
+
+  /**
+   * @brief Set up the initial state of each realization and store it in the ensemble fields of the solvers.
+   * @param numRealizations the number of realizations
+   */
+  void storeRealizations( integer const numRealizations );
+
+  /**
+   * @brief Rewind the problem to its initial state and set it up for a new realization of an ensemble run.
+   * @param realization the index of the realization
+   */
+  void startRealization( integer const realization );
+
   /// The PhysicsSolverManager
   PhysicsSolverManager * m_physicsSolverManager;
 
@@ -354,6 +385,12 @@ private:
 
   /// The FieldSpecificationManager
   FieldSpecificationManager * m_fieldSpecificationManager;
+
+  /// The index of the realization being run
+  integer m_realization;
+
+  /// Whether the realizations of the ensemble run are advanced together by the solvers
+  bool m_batchedEnsemble;
 };
 
 } /* namespace geosx */
@@ -100,6 +100,9 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     TIMERS,
     SUPPRESS_MOVE_LOGGING,
     PAUSE_FOR,
+    REALIZATIONS,
+    COMM_PROFILE,
+    MPI_THREAD_MULTIPLE_SUPPORT,
   };
 
   const option::Descriptor usage[] =
@@ -116,9 +119,12 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     { PROBLEMNAME, 0, "n", "name", Arg::nonEmpty, "\t-n, --name, \t Name of the problem, used for output" },
     { SUPPRESS_PINNED, 0, "s", "suppress-pinned", Arg::None, "\t-s, --suppress-pinned \t Suppress usage of pinned memory for MPI communication buffers" },
     { OUTPUTDIR, 0, "o", "output", Arg::nonEmpty, "\t-o, --output, \t Directory to put the output files" },
-    { TIMERS, 0, "t", "timers", Arg::nonEmpty, "\t-t, --timers, \t String specifying the type of timer output." },
+    { TIMERS, 0, "t", "timers", Arg::nonEmpty, "\t-t, --timers, \t String specifying the type of timer output. Without Caliper, any value enables the built-in timers, and a .json file name also exports them" },
     { SUPPRESS_MOVE_LOGGING, 0, "", "suppress-move-logging", Arg::None, "\t--suppress-move-logging \t Suppress logging of host-device data migration" },
     { PAUSE_FOR, 0, "", "pause-for", Arg::numeric, "\t--pause-for, \t Pause geosx for a given number of seconds before starting execution" },
+    { REALIZATIONS, 0, "", "realizations", Arg::numeric, "\t--realizations, \t Number of realizations of the problem run on the same mesh and discretization" },
+    { COMM_PROFILE, 0, "", "comm-profile", Arg::nonEmpty, "\t--comm-profile, \t Profile the field synchronizations and write the statistics of each neighbor to the given CSV file" },
+    { MPI_THREAD_MULTIPLE_SUPPORT, 0, "", "mpi-thread-multiple", Arg::None, "\t--mpi-thread-multiple \t Initialize MPI with MPI_THREAD_MULTIPLE, required by the background writes of the TimeHistory output" },
     { 0, 0, nullptr, nullptr, nullptr, nullptr }
   };
 
@@ -228,9 +234,29 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
         std::this_thread::sleep_for( std::chrono::seconds( duration ) );
       }
       break;
+      case REALIZATIONS:
+      {
+        commandLineOptions->numRealizations = std::stoi( opt.arg );
+        GEOSX_THROW_IF_LE_MSG( commandLineOptions->numRealizations, 0,
+                               "The number of realizations must be positive", InputError );
+      }
+      break;
+      case COMM_PROFILE:
+      {
+        commandLineOptions->communicationProfile = opt.arg;
+      }
+      break;
+      case MPI_THREAD_MULTIPLE_SUPPORT:
+      {
+        // handled by setupMPI, before the command line is parsed
+      }
+      break;
     }
   }
 
+  GEOSX_THROW_IF( commandLineOptions->numRealizations > 1 && commandLineOptions->beginFromRestart,
+                  "An ensemble of realizations cannot be started from a restart file", InputError );
+
   if( commandLineOptions->problemName.empty() && options[INPUT].count() > 0 )
   {
     string & inputFileName = commandLineOptions->inputFileNames[0];
@@ -41,6 +41,16 @@ ElementRegionManager::~ElementRegionManager()
   // TODO Auto-generated destructor stub
 }
 
+void ElementRegionManager::computeAccessorSignature( std::vector< localIndex > & signature ) const
+{
+  signature.clear();
+  signature.push_back( numRegions() );
+  for( localIndex er = 0; er < numRegions(); ++er )
+  {
+    signature.push_back( getRegion( er ).numSubRegions() );
+  }
+}
+
 void ElementRegionManager::resize( integer_array const & numElements,
                                    string_array const & regionNames,
                                    string_array const & GEOSX_UNUSED_PARAM( elementTypes ) )
@@ -863,6 +863,30 @@ public:
   ElementViewAccessor< traits::ViewTypeConst< typename TRAIT::type > >
   constructMaterialExtrinsicAccessor( bool const allowMissingViews = false ) const;
 
+  /**
+   * @brief Construct an accessor from the wrappers found in the accessor cache of the manager.
+   * @tparam VIEWTYPE the type of the viewed wrappers
+   * @tparam LHS the type of the views stored in the accessor
+   * @tparam FIND_WRAPPER the type of the function returning the wrapper viewed in a subregion
+   * @param key the unique key of the accessor in the cache
+   * @param findWrapper the function returning a pointer to the wrapper viewed by the accessor in a given subregion
+   *   (or nullptr if the subregion has none), only called when the wrappers are missing from the cache or out of date
+   * @return a new accessor viewing the current data of the wrappers
+   * @details Only the lookup of the wrappers is cached, and it is done again when the subregions of the manager
+   *   have changed. The accessor itself is constructed on each call: a nested accessor reused across calls would
+   *   not move its inner views again, and would keep stale data in the other memory spaces.
+   *   Removing a subregion or a viewed wrapper requires a call to clearAccessorCache.
+   */
+  template< typename VIEWTYPE, typename LHS, typename FIND_WRAPPER >
+  ElementViewAccessor< LHS >
+  getCachedAccessor( string const & key, FIND_WRAPPER && findWrapper ) const;
+
+  /**
+   * @brief Remove all the accessors from the accessor cache of the manager.
+   */
+  void clearAccessorCache() const
+  { m_accessorCache.clear(); }
+
 
   /**
    * @brief This is a const function to construct a MaterialViewAccessor to access the material data for specified
@@ -1172,6 +1196,25 @@ private:
                                 ElementViewAccessor< arrayView1d< localIndex > > const & packList,
                                 string const fractureRegionName ) const;
 
+  /**
+   * @brief Compute the numbers of subregions, used to detect the out-of-date entries of the accessor cache.
+   * @param signature the number of regions followed by the number of subregions of each region
+   */
+  void computeAccessorSignature( std::vector< localIndex > & signature ) const;
+
+  /// Entry of the accessor cache
+  struct CachedAccessor
+  {
+    /// The numbers of subregions when the wrappers were found
+    std::vector< localIndex > signature;
+
+    /// The wrapper viewed in each subregion of each region, or nullptr
+    std::vector< std::vector< dataRepository::WrapperBase const * > > wrappers;
+  };
+
+  /// Cache of the accessors, mutable since it does not change the observable state of the manager
+  mutable unordered_map< string, CachedAccessor > m_accessorCache;
+
   /**
    * @brief Copy constructor.
    */
@@ -1259,6 +1302,48 @@ ElementRegionManager::
 }
 
 
+template< typename VIEWTYPE, typename LHS, typename FIND_WRAPPER >
+ElementRegionManager::ElementViewAccessor< LHS >
+ElementRegionManager::getCachedAccessor( string const & key, FIND_WRAPPER && findWrapper ) const
+{
+  std::vector< localIndex > signature;
+  computeAccessorSignature( signature );
+
+  CachedAccessor & cached = m_accessorCache[key];
+  if( cached.signature != signature )
+  {
+    cached.signature = std::move( signature );
+    cached.wrappers.resize( numRegions() );
+    for( localIndex er = 0; er < numRegions(); ++er )
+    {
+      ElementRegionBase const & region = getRegion( er );
+      cached.wrappers[er].resize( region.numSubRegions() );
+      for( localIndex esr = 0; esr < region.numSubRegions(); ++esr )
+      {
+        dataRepository::WrapperBase const * const wrapper = findWrapper( region.getSubRegion( esr ) );
+        cached.wrappers[er][esr] = wrapper == nullptr ? nullptr : &dynamicCast< dataRepository::Wrapper< VIEWTYPE > const & >( *wrapper );
+      }
+    }
+  }
+
+  // same construction as in constructViewAccessor, without the lookups by name
+  ElementViewAccessor< LHS > viewAccessor;
+  viewAccessor.resize( numRegions() );
+  for( localIndex er = 0; er < numRegions(); ++er )
+  {
+    viewAccessor[er].resize( cached.wrappers[er].size() );
+    for( localIndex esr = 0; esr < viewAccessor[er].size(); ++esr )
+    {
+      if( cached.wrappers[er][esr] != nullptr )
+      {
+        viewAccessor[er][esr] = static_cast< dataRepository::Wrapper< VIEWTYPE > const * >( cached.wrappers[er][esr] )->reference();
+      }
+    }
+  }
+  viewAccessor.setName( key );
+  return viewAccessor;
+}
+
 template< typename T, int NDIM, typename PERM >
 ElementRegionManager::ElementViewAccessor< ArrayView< T const, NDIM, getUSD< PERM > > >
 ElementRegionManager::
@@ -178,6 +178,14 @@ public:
   ElementType getElementType() const
   { return m_elementType; }
 
+  /**
+   * @brief Set the type of element in this subregion.
+   * @param[in] elementType the type of element in this subregion
+   * @note Only meant to be used when the subregion is not built from a cell block (e.g. when loaded from the mesh cache).
+   */
+  void setElementType( ElementType const elementType )
+  { m_elementType = elementType; }
+
   ///@}
 
   /**
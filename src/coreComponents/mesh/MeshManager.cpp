@@ -15,20 +15,68 @@
 
 #include "MeshManager.hpp"
 
+#include "mesh/CellElementRegion.hpp"
 #include "mesh/mpiCommunications/SpatialPartition.hpp"
+#include "generators/ExternalMeshGeneratorBase.hpp"
 #include "generators/MeshGeneratorBase.hpp"
+#include "common/Path.hpp"
 #include "common/TimingMacros.hpp"
+#include "dataRepository/ConduitRestart.hpp"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
 
 namespace geosx
 {
 
 using namespace dataRepository;
 
+namespace
+{
+
+/// Name of the tree holding the cached data in a cache entry directory
+constexpr char const * cacheTreeName = "mesh";
+
+/// Version of the layout of the cached data, to be incremented whenever the written groups or arrays change
+constexpr int cacheFormatVersion = 1;
+
+/**
+ * @brief Remove a cache entry directory written by writeTree.
+ * @param[in] entryPath the path of the entry directory
+ */
+void removeCacheEntry( string const & entryPath )
+{
+  string const treePath = joinPath( entryPath, cacheTreeName );
+  for( string const & fileName : readDirectory( treePath ) )
+  {
+    if( fileName != "." && fileName != ".." )
+    {
+      std::remove( joinPath( treePath, fileName ).c_str() );
+    }
+  }
+  std::remove( treePath.c_str() );
+  std::remove( ( treePath + ".root" ).c_str() );
+  std::remove( entryPath.c_str() );
+}
+
+}
+
 MeshManager::MeshManager( string const & name,
                           Group * const parent ):
-  Group( name, parent )
+  Group( name, parent ),
+  m_loadedFromCache( false )
 {
   setInputFlags( InputFlags::REQUIRED );
+
+  registerWrapper( viewKeyStruct::cacheDirectoryString(), &m_cacheDirectory ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( "" ).
+    setDescription( "Directory holding the mesh cache. If specified, the meshes built (and ghosted) by a run are written "
+                    "in this directory, and the following runs with the same mesh inputs and number of ranks load them "
+                    "instead of generating them again. Not available with wells, fractures or fields imported from the mesh file" );
 }
 
 MeshManager::~MeshManager()
@@ -83,5 +131,289 @@ void MeshManager::importFields( DomainPartition & domain )
   } );
 }
 
+bool MeshManager::isCacheable( DomainPartition const & domain ) const
+{
+  bool cacheable = true;
+
+  // Surface (fractures) and well regions are not built from cell blocks and are not restored by the cache
+  domain.forMeshBodies( [&]( MeshBody const & meshBody )
+  {
+    cacheable = cacheable && meshBody.getMeshLevels().numSubGroups() == 1;
+    meshBody.getMeshLevel( 0 ).getElemManager().forElementRegions( [&]( ElementRegionBase const & region )
+    {
+      cacheable = cacheable && dynamicCast< CellElementRegion const * >( &region ) != nullptr;
+    } );
+  } );
+
+  // The imported fields require the mesh file to be read anyway
+  forSubGroups< ExternalMeshGeneratorBase >( [&]( ExternalMeshGeneratorBase const & meshGen )
+  {
+    cacheable = cacheable && meshGen.getFieldsToImport().empty();
+  } );
+
+  return cacheable;
+}
+
+string MeshManager::getCachePath() const
+{
+  string key;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::ostringstream os;
+    os << m_cacheSignature << "\nranks=" << MpiWrapper::commSize() << "\n";
+
+    // The cached arrays are only readable by a build with the same data layout
+    os << "format=" << cacheFormatVersion
+       << " localIndex=" << sizeof( localIndex )
+       << " globalIndex=" << sizeof( globalIndex )
+       << " real64=" << sizeof( real64 )
+       << " integer=" << sizeof( integer ) << "\n";
+
+    // A modified mesh file invalidates the cache entries built from it
+    forSubGroups< ExternalMeshGeneratorBase >( [&]( ExternalMeshGeneratorBase const & meshGen )
+    {
+      struct stat fileStat;
+      if( stat( meshGen.getFilePath().c_str(), &fileStat ) == 0 )
+      {
+        os << meshGen.getFilePath() << " " << fileStat.st_size << " " << fileStat.st_mtime << "\n";
+      }
+    } );
+
+    // 64-bit FNV-1a hash, so that the keys do not depend on the standard library implementation
+    std::uint64_t hash = 14695981039346656037ULL;
+    for( char const c : os.str() )
+    {
+      hash ^= static_cast< unsigned char >( c );
+      hash *= 1099511628211ULL;
+    }
+    key = GEOSX_FMT( "mesh_{:016x}", hash );
+  }
+  MpiWrapper::broadcast( key, 0 );
+
+  return joinPath( m_cacheDirectory, key );
+}
+
+bool MeshManager::loadMeshCache( DomainPartition & domain )
+{
+  m_loadedFromCache = false;
+  if( m_cacheDirectory.empty() )
+  {
+    return false;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  if( !isCacheable( domain ) )
+  {
+    GEOSX_LOG_RANK_0( "Mesh cache: the meshes contain wells, fractures or imported fields and will not be cached" );
+    return false;
+  }
+
+  string const cachePath = getCachePath();
+
+  // The entries are renamed into place once all the ranks have written their files, so an existing entry is complete
+  integer entryExists = 0;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    entryExists = std::ifstream( joinPath( cachePath, cacheTreeName ) + ".root" ).good();
+  }
+  MpiWrapper::broadcast( entryExists, 0 );
+
+  if( !entryExists )
+  {
+    GEOSX_LOG_RANK_0( "Mesh cache: no entry found, the meshes will be generated and cached in " << cachePath );
+    return false;
+  }
+
+  GEOSX_LOG_RANK_0( "Mesh cache: loading the meshes from " << cachePath );
+
+  conduit::Node cache;
+  loadTree( joinPath( cachePath, cacheTreeName ), cache );
+
+  domain.forMeshBodies( [&]( MeshBody & meshBody )
+  {
+    conduit::Node & bodyNode = cache[ DomainPartition::groupKeysStruct::meshBodiesString() ][ meshBody.getName() ];
+    MeshLevel & meshLevel = meshBody.getMeshLevel( 0 );
+    ElementRegionManager & elemManager = meshLevel.getElemManager();
+
+    // The sub-regions are usually created (and typed) from the cell blocks
+    conduit::Node & elementTypes = bodyNode[ "elementTypes" ];
+    elemManager.forElementRegions< CellElementRegion >( [&]( CellElementRegion & region )
+    {
+      if( !elementTypes.has_child( region.getName() ) )
+      {
+        return;
+      }
+      conduit::Node & regionNode = elementTypes[ region.getName() ];
+      Group & elementSubRegions = region.getGroup( ElementRegionBase::viewKeyStruct::elementSubRegions() );
+      for( conduit::index_t i = 0; i < regionNode.number_of_children(); ++i )
+      {
+        conduit::Node & typeNode = regionNode.child( i );
+        CellElementSubRegion & subRegion = elementSubRegions.registerGroup< CellElementSubRegion >( typeNode.name() );
+        subRegion.setElementType( static_cast< ElementType >( typeNode.to_int() ) );
+      }
+    } );
+
+    meshBody.setGlobalLengthScale( bodyNode[ "globalLengthScale" ].to_double() );
+  } );
+
+  // Neighbors, as in DomainPartition::setupCommunications (only the first mesh body is ghosted)
+  if( cache.has_child( "neighbors" ) )
+  {
+    conduit::Node & neighborsNode = cache[ "neighbors" ];
+    int const * const neighborRanks = neighborsNode.as_int_ptr();
+    for( conduit::index_t i = 0; i < neighborsNode.dtype().number_of_elements(); ++i )
+    {
+      domain.getNeighbors().emplace_back( neighborRanks[i] );
+    }
+  }
+  for( NeighborCommunicator const & neighbor : domain.getNeighbors() )
+  {
+    neighbor.addNeighborGroupToMesh( domain.getMeshBody( 0 ).getMeshLevel( 0 ) );
+  }
+
+  domain.forMeshBodies( [&]( MeshBody & meshBody )
+  {
+    conduit::Node & dataNode = cache[ DomainPartition::groupKeysStruct::meshBodiesString() ][ meshBody.getName() ][ "data" ];
+    MeshLevel & meshLevel = meshBody.getMeshLevel( 0 );
+    NodeManager & nodeManager = meshLevel.getNodeManager();
+    EdgeManager & edgeManager = meshLevel.getEdgeManager();
+    FaceManager & faceManager = meshLevel.getFaceManager();
+    ElementRegionManager & elemManager = meshLevel.getElemManager();
+
+    // The sets are dynamic wrappers that must exist before being loaded
+    auto const createSets = [&]( ObjectManagerBase & manager )
+    {
+      string const managerPath = manager.getPath().substr( meshBody.getPath().size() + 1 );
+      conduit::Node & setsNode = dataNode[ managerPath ][ ObjectManagerBase::groupKeyStruct::setsString() ];
+      for( conduit::index_t i = 0; i < setsNode.number_of_children(); ++i )
+      {
+        string const setName = setsNode.child( i ).name();
+        if( !manager.sets().hasWrapper( setName ) )
+        {
+          manager.createSet( setName );
+        }
+      }
+    };
+    createSets( nodeManager );
+    createSets( edgeManager );
+    createSets( faceManager );
+    elemManager.forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+    {
+      createSets( subRegion );
+    } );
+
+    meshBody.getConduitNode().update( dataNode );
+    meshBody.loadFromConduit();
+
+    nodeManager.constructGlobalToLocalMap();
+    edgeManager.constructGlobalToLocalMap();
+    faceManager.constructGlobalToLocalMap();
+
+    nodeManager.setupRelatedObjectsInRelations( edgeManager, faceManager, elemManager );
+    edgeManager.setupRelatedObjectsInRelations( nodeManager, faceManager );
+    faceManager.setupRelatedObjectsInRelations( nodeManager, edgeManager, elemManager );
+
+    elemManager.forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+    {
+      subRegion.constructGlobalToLocalMap();
+      subRegion.setupRelatedObjectsInRelations( meshLevel );
+      subRegion.setMaxGlobalIndex();
+    } );
+
+    elemManager.setMaxGlobalIndex();
+    nodeManager.setMaxGlobalIndex();
+    edgeManager.setMaxGlobalIndex();
+    faceManager.setMaxGlobalIndex();
+  } );
+
+  SpatialPartition & partition = dynamicCast< SpatialPartition & >( domain.getReference< PartitionBase >( keys::partitionManager ) );
+  auto const loadPartitionArray = [&]( string const & key, array1d< int > & values )
+  {
+    conduit::Node & valuesNode = cache[ "partition" ][ key ];
+    values.resize( valuesNode.dtype().number_of_elements() );
+    std::copy_n( valuesNode.as_int_ptr(), values.size(), values.data() );
+  };
+  loadPartitionArray( "partitions", partition.m_Partitions );
+  loadPartitionArray( "periodic", partition.m_Periodic );
+  loadPartitionArray( "coords", partition.m_coords );
+
+  m_loadedFromCache = true;
+  return true;
+}
+
+void MeshManager::writeMeshCache( DomainPartition & domain )
+{
+  if( m_cacheDirectory.empty() || !isCacheable( domain ) )
+  {
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  string const cachePath = getCachePath();
+  GEOSX_LOG_RANK_0( "Mesh cache: writing the meshes to " << cachePath );
+
+  conduit::Node cache;
+  domain.forMeshBodies( [&]( MeshBody & meshBody )
+  {
+    meshBody.prepareToWrite();
+
+    conduit::Node & bodyNode = cache[ DomainPartition::groupKeysStruct::meshBodiesString() ][ meshBody.getName() ];
+    bodyNode[ "data" ].set_external( meshBody.getConduitNode() );
+    bodyNode[ "globalLengthScale" ].set( meshBody.getGlobalLengthScale() );
+
+    meshBody.getMeshLevel( 0 ).getElemManager().
+      forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const,
+                                                                  localIndex const,
+                                                                  ElementRegionBase const & region,
+                                                                  CellElementSubRegion const & subRegion )
+    {
+      bodyNode[ "elementTypes" ][ region.getName() ][ subRegion.getName() ].set( static_cast< int >( subRegion.getElementType() ) );
+    } );
+  } );
+
+  std::vector< int > neighborRanks;
+  for( NeighborCommunicator const & neighbor : domain.getNeighbors() )
+  {
+    neighborRanks.emplace_back( neighbor.neighborRank() );
+  }
+  if( !neighborRanks.empty() )
+  {
+    cache[ "neighbors" ].set( neighborRanks.data(), neighborRanks.size() );
+  }
+
+  SpatialPartition const & partition = dynamicCast< SpatialPartition const & >( domain.getReference< PartitionBase >( keys::partitionManager ) );
+  cache[ "partition/partitions" ].set( partition.m_Partitions.data(), partition.m_Partitions.size() );
+  cache[ "partition/periodic" ].set( partition.m_Periodic.data(), partition.m_Periodic.size() );
+  cache[ "partition/coords" ].set( partition.m_coords.data(), partition.m_coords.size() );
+
+  // Each run writes into its own temporary directory, renamed into place once all the ranks have written their files.
+  // The renaming is atomic: concurrent runs sharing the cache never load a partially written entry.
+  string tmpPath;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    char hostName[ 256 ] = { 0 };
+    gethostname( hostName, sizeof( hostName ) - 1 );
+    tmpPath = GEOSX_FMT( "{}.tmp_{}_{}", cachePath, hostName, getpid() );
+  }
+  MpiWrapper::broadcast( tmpPath, 0 );
+
+  writeTree( joinPath( tmpPath, cacheTreeName ), cache );
+
+  domain.forMeshBodies( [&]( MeshBody & meshBody )
+  {
+    meshBody.finishWriting();
+  } );
+
+  MpiWrapper::barrier();
+  if( MpiWrapper::commRank() == 0 && std::rename( tmpPath.c_str(), cachePath.c_str() ) != 0 )
+  {
+    // Another run has written the same entry in the meantime
+    GEOSX_LOG_RANK_0( "Mesh cache: the entry " << cachePath << " already exists, the written meshes are discarded" );
+    removeCacheEntry( tmpPath );
+  }
+  MpiWrapper::barrier();
+}
 
 } /* namespace geosx */
@@ -74,13 +74,74 @@ public:
    */
   void importFields( DomainPartition & domain );
 
+  /**
+   * @brief Set the description of the inputs the generated meshes depend on.
+   * @param[in] signature a string that changes whenever the generated meshes may change (e.g. the printed mesh,
+   *                      element regions and geometry inputs)
+   * @details The signature is used, along with the number of ranks, the layout of the cached data
+   *          and the mesh files time stamps, to identify the entries of the mesh cache.
+   */
+  void setCacheSignature( string const & signature )
+  { m_cacheSignature = signature; }
+
+  /**
+   * @brief Load the meshes, with their neighbors and ghosting information, from the mesh cache.
+   * @param[in] domain a reference to the physical domain
+   * @return true if an entry matching the inputs was found in the cache and loaded, false otherwise
+   * @details When it succeeds, this replaces the generation of the meshes, the construction of the
+   *          maps and the setup of the communications. It does nothing if no cache directory is set.
+   */
+  bool loadMeshCache( DomainPartition & domain );
+
+  /**
+   * @brief Write the fully built (and ghosted) meshes into the mesh cache.
+   * @param[in] domain a reference to the physical domain
+   */
+  void writeMeshCache( DomainPartition & domain );
+
+  /**
+   * @brief Check whether the meshes have been loaded from the mesh cache instead of being generated.
+   * @return true if the meshes have been loaded from the cache
+   */
+  bool isLoadedFromCache() const
+  { return m_loadedFromCache; }
+
+  ///@cond DO_NOT_DOCUMENT
+  struct viewKeyStruct
+  {
+    constexpr static char const * cacheDirectoryString() { return "cacheDirectory"; }
+  };
+  /// @endcond
+
 private:
 
+  /**
+   * @brief Check that the meshes only contain objects the mesh cache is able to restore.
+   * @param[in] domain a reference to the physical domain
+   * @return true if the meshes can be cached
+   */
+  bool isCacheable( DomainPartition const & domain ) const;
+
+  /**
+   * @brief Compute the path of the cache entry matching the current inputs.
+   * @return the path of the cache entry directory, identical on all ranks
+   */
+  string getCachePath() const;
+
   /**
    * @brief Deleted default constructor of the MeshManager
    */
   MeshManager() = delete;
 
+  /// Directory holding the mesh cache (no caching if empty)
+  Path m_cacheDirectory;
+
+  /// Description of the inputs the generated meshes depend on
+  string m_cacheSignature;
+
+  /// Whether the meshes have been loaded from the mesh cache
+  bool m_loadedFromCache;
+
 };
 
 } /* namespace geosx */
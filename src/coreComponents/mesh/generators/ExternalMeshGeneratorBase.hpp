@@ -39,6 +39,20 @@ public:
   ExternalMeshGeneratorBase( const string & name,
                              Group * const parent );
 
+  /**
+   * @brief Get the path to the mesh file.
+   * @return the path to the mesh file
+   */
+  Path const & getFilePath() const
+  { return m_filePath; }
+
+  /**
+   * @brief Get the names of the fields to be imported from the mesh file.
+   * @return the names of the fields to import
+   */
+  arrayView1d< string const > getFieldsToImport() const
+  { return m_fieldsToImport.toViewConst(); }
+
 protected:
 
   ///@cond DO_NOT_DOCUMENT
@@ -26,8 +26,10 @@
 
 #include "common/DataTypes.hpp"
 #include "common/TimingMacros.hpp"
+#include "codingUtilities/StringUtilities.hpp"
 
 #include <cmath>
+#include <numeric>
 
 namespace geosx
 {
@@ -97,6 +99,13 @@ InternalMeshGenerator::InternalMeshGenerator( string const & name, Group * const
     setSizedFromParent( 0 ).
     setDescription( "Names of each mesh block" );
 
+  registerWrapper( viewKeyStruct::cellBlockWeightsString(), &m_blockWeights ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setSizedFromParent( 0 ).
+    setDescription( "Relative computational cost of an element of each mesh block. If specified, the partition boundaries "
+                    "are placed so that the estimated work (instead of the number of elements) is balanced among the ranks "
+                    "along each direction" );
+
   registerWrapper( viewKeyStruct::elementTypesString(), &m_elementType ).
     setInputFlag( InputFlags::REQUIRED ).
     setSizedFromParent( 0 ).
@@ -202,6 +211,23 @@ void InternalMeshGenerator::postProcessInput()
     }
   }
 
+  {
+    localIndex const numBlocks = m_regionNames.size();
+    if( m_blockWeights.size() == 1 )
+    {
+      real64 const blockWeight = m_blockWeights[0];
+      m_blockWeights.resizeDefault( numBlocks, blockWeight );
+    }
+    GEOSX_THROW_IF( !m_blockWeights.empty() && m_blockWeights.size() != numBlocks,
+                    GEOSX_FMT( "InternalMesh '{}': the number of values of '{}' must be the number of mesh blocks ({})",
+                               getName(), viewKeyStruct::cellBlockWeightsString(), numBlocks ),
+                    InputError );
+    GEOSX_THROW_IF( std::any_of( m_blockWeights.begin(), m_blockWeights.end(), []( real64 const w ){ return w <= 0.0; } ),
+                    GEOSX_FMT( "InternalMesh '{}': the values of '{}' must be positive",
+                               getName(), viewKeyStruct::cellBlockWeightsString() ),
+                    InputError );
+  }
+
   for( int i=0; i<3; ++i )
   {
     m_min[i] = m_vertices[i].front();
@@ -536,6 +562,82 @@ static void getElemToNodesRelationInBox( ElementType const elementType,
   }
 }
 
+void InternalMeshGenerator::setCostWeightedPartitionLocations( SpatialPartition & partition ) const
+{
+  for( int dir = 0; dir < 3; ++dir )
+  {
+    integer const numPartitions = partition.m_Partitions( dir );
+    if( numPartitions == 1 )
+    {
+      continue;
+    }
+
+    integer numLayers = 0;
+    for( int block = 0; block < m_nElems[dir].size(); ++block )
+    {
+      numLayers += m_nElems[dir][block];
+    }
+    GEOSX_THROW_IF_LT_MSG( numLayers, numPartitions,
+                           GEOSX_FMT( "InternalMesh '{}': more partitions than elements along direction {}", getName(), dir ),
+                           InputError );
+
+    // Cost of each layer of elements orthogonal to the direction (same block ordering as m_regionNames)
+    array1d< real64 > layerCost( numLayers );
+    localIndex blockOffset = 0;
+    for( int iblock = 0; iblock < m_nElems[0].size(); ++iblock )
+    {
+      for( int jblock = 0; jblock < m_nElems[1].size(); ++jblock )
+      {
+        for( int kblock = 0; kblock < m_nElems[2].size(); ++kblock, ++blockOffset )
+        {
+          int const blockIndex[3] = { iblock, jblock, kblock };
+          real64 cost = m_blockWeights[blockOffset] * m_numElePerBox[blockOffset];
+          for( int i = 0; i < m_dim; ++i )
+          {
+            if( i != dir )
+            {
+              cost *= m_nElems[i][blockIndex[i]];
+            }
+          }
+          for( integer k = m_firstElemIndexForBlock[dir][blockIndex[dir]]; k <= m_lastElemIndexForBlock[dir][blockIndex[dir]]; ++k )
+          {
+            layerCost[k] += cost;
+          }
+        }
+      }
+    }
+
+    // cumulatedCost[k] is the cost of the layers before layer k
+    array1d< real64 > cumulatedCost( numLayers + 1 );
+    std::partial_sum( layerCost.begin(), layerCost.end(), cumulatedCost.begin() + 1 );
+    real64 const totalCost = cumulatedCost.back();
+
+    // The boundaries are expressed in the uniform index space used to assign the elements to the partitions
+    array1d< real64 > locations( numPartitions - 1 );
+    integer previousLayer = 0;
+    for( integer p = 1; p < numPartitions; ++p )
+    {
+      real64 const targetCost = totalCost * p / numPartitions;
+      integer layer = LvArray::integerConversion< integer >( std::lower_bound( cumulatedCost.begin(), cumulatedCost.end(), targetCost ) -
+                                                            cumulatedCost.begin() );
+      if( layer > 0 && targetCost - cumulatedCost[layer - 1] < cumulatedCost[layer] - targetCost )
+      {
+        --layer;
+      }
+      // Every partition keeps at least one layer of elements
+      layer = std::min( std::max( layer, previousLayer + 1 ), numLayers - ( numPartitions - p ) );
+      locations[p - 1] = m_min[dir] + ( m_max[dir] - m_min[dir] ) * layer / numLayers;
+      previousLayer = layer;
+    }
+
+    GEOSX_LOG_RANK_0_IF( getLogLevel() > 0,
+                         GEOSX_FMT( "InternalMesh '{}': cost-weighted partition boundaries along direction {}: {}",
+                                    getName(), dir, stringutilities::join( locations, ", " ) ) );
+
+    partition.setPartitionLocations( dir, locations.toViewConst() );
+  }
+}
+
 /**
  * @param partition
  * @param domain
@@ -580,6 +682,10 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
     m_max[1] = m_vertices[1].back();
     m_max[2] = m_vertices[2].back();
 
+    if( !m_blockWeights.empty() )
+    {
+      setCostWeightedPartitionLocations( partition );
+    }
     partition.setSizes( m_min, m_max );
 
     real64 size[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_max );
@@ -142,6 +142,7 @@ protected:
     constexpr static char const * yBiasString() { return "yBias"; }
     constexpr static char const * zBiasString() { return "zBias"; }
     constexpr static char const * cellBlockNamesString() { return "cellBlockNames"; }
+    constexpr static char const * cellBlockWeightsString() { return "cellBlockWeights"; }
     constexpr static char const * elementTypesString() { return "elementTypes"; }
     constexpr static char const * trianglePatternString() { return "trianglePattern"; }
     constexpr static char const * meshTypeString() { return "meshType"; }
@@ -182,6 +183,9 @@ private:
   /// String array of region names
   array1d< string > m_regionNames;
 
+  /// Relative computational cost of an element of each block, used to place the partition boundaries
+  array1d< real64 > m_blockWeights;
+
   /// Ndim x nBlock spatialized array of first element index in the cellBlock
   array1d< integer > m_firstElemIndexForBlock[3];
 
@@ -217,6 +221,16 @@ private:
 
 
 
+  /**
+   * @brief Place the partition boundaries so that the cost of the elements is balanced along each direction.
+   * @param[in,out] partition the Cartesian partition whose boundaries are set
+   * @details The cost of each layer of elements orthogonal to a direction is the sum of the weights of its
+   * elements, and the boundaries are placed between the layers that split the cumulated cost evenly.
+   * Since the partition is a tensor product of the splits along each direction, the cost is balanced
+   * between the slabs of ranks along each direction, not necessarily between all the ranks.
+   */
+  void setCostWeightedPartitionLocations( SpatialPartition & partition ) const;
+
   /**
    * @brief Convert ndim node spatialized index to node global index.
    * @param[in] node ndim spatialized array index
@@ -0,0 +1,157 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ParMETISInterface.cpp
+ */
+
+#include "ParMETISInterface.hpp"
+
+#include <parmetis.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#define GEOSX_PARMETIS_CHECK( call ) \
+  do { \
+    auto const ierr = call; \
+    GEOSX_ERROR_IF_NE_MSG( ierr, METIS_OK, "Error in call to:\n" << #call ); \
+  } while( false )
+
+namespace geosx
+{
+namespace parmetis
+{
+
+namespace
+{
+
+/**
+ * @brief Convert indices to the index type ParMETIS is built with.
+ * @param values the indices
+ * @param size the number of indices
+ * @return the converted indices
+ * @details ParMETIS may be built with 32-bit indices, in which case every index is checked to fit.
+ */
+std::vector< idx_t > toParmetisIndices( pmet_idx_t const * const values, pmet_idx_t const size )
+{
+  std::vector< idx_t > converted( size );
+  std::transform( values, values + size, converted.begin(), []( pmet_idx_t const value )
+  {
+    return LvArray::integerConversion< idx_t >( value );
+  } );
+  return converted;
+}
+
+} // namespace
+
+ArrayOfArrays< pmet_idx_t, pmet_idx_t >
+meshToDual( ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & elemToNodes,
+            arrayView1d< pmet_idx_t const > const & elemDist,
+            MPI_Comm comm,
+            int const minCommonNodes )
+{
+  pmet_idx_t const numElems = elemToNodes.size();
+
+  std::vector< idx_t > elemDistIdx = toParmetisIndices( elemDist.data(), elemDist.size() );
+  std::vector< idx_t > offsetsIdx = toParmetisIndices( elemToNodes.getOffsets(), numElems + 1 );
+  std::vector< idx_t > valuesIdx = toParmetisIndices( elemToNodes.getValues(), elemToNodes.getOffsets()[numElems] );
+
+  idx_t numFlag = 0;
+  idx_t ncommonnodes = minCommonNodes;
+  idx_t * xadj;
+  idx_t * adjncy;
+
+  GEOSX_PARMETIS_CHECK( ParMETIS_V3_Mesh2Dual( elemDistIdx.data(), offsetsIdx.data(), valuesIdx.data(),
+                                               &numFlag, &ncommonnodes, &xadj, &adjncy, &comm ) );
+
+  std::vector< pmet_idx_t > const graphOffsets( xadj, xadj + numElems + 1 );
+  ArrayOfArrays< pmet_idx_t, pmet_idx_t > graph;
+  graph.resizeFromOffsets( numElems, graphOffsets.data() );
+  for( pmet_idx_t k = 0; k < numElems; ++k )
+  {
+    graph.appendToArray( k, adjncy + xadj[k], adjncy + xadj[k+1] );
+  }
+
+  METIS_Free( xadj );
+  METIS_Free( adjncy );
+
+  return graph;
+}
+
+array1d< pmet_idx_t >
+partition( ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & graph,
+           arrayView1d< pmet_idx_t const > const & vertexWeights,
+           ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & edgeWeights,
+           arrayView1d< pmet_idx_t const > const & vertDist,
+           pmet_idx_t const numParts,
+           MPI_Comm comm )
+{
+  GEOSX_ERROR_IF( !vertexWeights.empty() && vertexWeights.size() != graph.size(),
+                  "The number of vertex weights does not match the number of vertices" );
+  GEOSX_ERROR_IF( !edgeWeights.empty() && edgeWeights.size() != graph.size(),
+                  "The edge weights do not match the graph" );
+
+  array1d< pmet_idx_t > part( graph.size() );
+  if( numParts == 1 )
+  {
+    return part;
+  }
+
+  pmet_idx_t const numEdges = graph.getOffsets()[graph.size()];
+  std::vector< idx_t > vertDistIdx = toParmetisIndices( vertDist.data(), vertDist.size() );
+  std::vector< idx_t > offsetsIdx = toParmetisIndices( graph.getOffsets(), graph.size() + 1 );
+  std::vector< idx_t > adjacencyIdx = toParmetisIndices( graph.getValues(), numEdges );
+  std::vector< idx_t > vertexWeightsIdx = toParmetisIndices( vertexWeights.data(), vertexWeights.size() );
+  std::vector< idx_t > edgeWeightsIdx = toParmetisIndices( edgeWeights.getValues(), edgeWeights.empty() ? 0 : numEdges );
+
+  // 0: no weights, 1: edge weights only, 2: vertex weights only, 3: both
+  idx_t weightFlag = ( vertexWeights.empty() ? 0 : 2 ) + ( edgeWeights.empty() ? 0 : 1 );
+
+  // Every part receives the same share of the total weight, with a 5% tolerance
+  idx_t numConstraints = 1;
+  array1d< real_t > targetWeights( numParts );
+  targetWeights.setValues< serialPolicy >( 1.0 / numParts );
+  real_t imbalanceTolerance = 1.05;
+
+  // Default options
+  idx_t options[4] = { 0, 0, 0, 0 };
+  idx_t numFlag = 0;
+  idx_t nparts = LvArray::integerConversion< idx_t >( numParts );
+  idx_t edgeCut = 0;
+  std::vector< idx_t > partIdx( graph.size() );
+
+  GEOSX_PARMETIS_CHECK( ParMETIS_V3_PartKway( vertDistIdx.data(),
+                                              offsetsIdx.data(),
+                                              adjacencyIdx.data(),
+                                              vertexWeights.empty() ? nullptr : vertexWeightsIdx.data(),
+                                              edgeWeights.empty() ? nullptr : edgeWeightsIdx.data(),
+                                              &weightFlag,
+                                              &numFlag,
+                                              &numConstraints,
+                                              &nparts,
+                                              targetWeights.data(),
+                                              &imbalanceTolerance,
+                                              options,
+                                              &edgeCut,
+                                              partIdx.data(),
+                                              &comm ) );
+
+  std::copy( partIdx.begin(), partIdx.end(), part.begin() );
+  return part;
+}
+
+} // namespace parmetis
+} // namespace geosx
@@ -0,0 +1,71 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ParMETISInterface.hpp
+ */
+
+#ifndef GEOSX_MESH_GENERATORS_PARMETISINTERFACE_HPP_
+#define GEOSX_MESH_GENERATORS_PARMETISINTERFACE_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+
+namespace geosx
+{
+namespace parmetis
+{
+
+/// Index type of the ParMETIS interface, converted to the index type of the library (32 or 64-bit) at each call
+using pmet_idx_t = int64_t;
+
+/**
+ * @brief Convert a distributed mesh to its dual graph.
+ * @param elemToNodes the map from the local elements to the global indices of their nodes
+ * @param elemDist the distribution of the elements: the elements of rank r are numbered
+ *                 from elemDist[r] to elemDist[r+1]-1 (size is the number of ranks + 1)
+ * @param comm the MPI communicator of the ranks holding the elements
+ * @param minCommonNodes the minimum number of nodes shared by two elements for them to be connected
+ *                       (3 connects the volume elements through their faces)
+ * @return the adjacency of the local elements, in terms of global element indices
+ */
+ArrayOfArrays< pmet_idx_t, pmet_idx_t >
+meshToDual( ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & elemToNodes,
+            arrayView1d< pmet_idx_t const > const & elemDist,
+            MPI_Comm comm,
+            int const minCommonNodes );
+
+/**
+ * @brief Partition a distributed graph with a multilevel k-way algorithm.
+ * @param graph the adjacency of the local vertices, in terms of global vertex indices
+ * @param vertexWeights the weights of the local vertices, or an empty array for unit weights
+ * @param edgeWeights the weights of the edges, with the same layout as @p graph, or an empty array for unit weights
+ * @param vertDist the distribution of the vertices (see @p elemDist in meshToDual)
+ * @param numParts the number of parts
+ * @param comm the MPI communicator of the ranks holding the vertices
+ * @return the part assigned to each local vertex
+ * @note Every rank must hold at least one vertex.
+ */
+array1d< pmet_idx_t >
+partition( ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & graph,
+           arrayView1d< pmet_idx_t const > const & vertexWeights,
+           ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & edgeWeights,
+           arrayView1d< pmet_idx_t const > const & vertDist,
+           pmet_idx_t const numParts,
+           MPI_Comm comm );
+
+} // namespace parmetis
+} // namespace geosx
+
+#endif //GEOSX_MESH_GENERATORS_PARMETISINTERFACE_HPP_
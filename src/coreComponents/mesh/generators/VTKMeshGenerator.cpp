@@ -20,6 +20,7 @@
 
 #include "mesh/DomainPartition.hpp"
 #include "mesh/generators/CellBlockManager.hpp"
+#include "mesh/generators/InternalWellGenerator.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "mesh/MeshBody.hpp"
 #include "constitutive/solid/CoupledSolidBase.hpp"
@@ -30,14 +31,27 @@
 #include "common/DataTypes.hpp"
 #include "common/DataLayouts.hpp"
 
+#ifdef GEOSX_USE_PARMETIS
+#include "mesh/generators/ParMETISInterface.hpp"
+#endif
+
+#include <vtkAppendFilter.h>
 #include <vtkArrayDispatch.h>
 #include <vtkBoundingBox.h>
 #include <vtkCellData.h>
+#include <vtkCharArray.h>
+#include <vtkCleanUnstructuredGrid.h>
+#include <vtkCommunicator.h>
 #include <vtkDIYExplicitAssigner.h>
+#include <vtkExtractCells.h>
 #include <vtkGenerateGlobalIds.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
 #include <vtkPointData.h>
+#include <vtkPoints.h>
 #include <vtkRedistributeDataSetFilter.h>
 #include <vtkSmartPointer.h>
+#include <vtkStaticCellLocator.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkUnstructuredGridReader.h>
 #include <vtkXMLPUnstructuredGridReader.h>
@@ -51,6 +65,8 @@
 #endif
 
 #include <numeric>
+#include <set>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace geosx
@@ -66,6 +82,64 @@ VTKMeshGenerator::VTKMeshGenerator( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( "attribute" ).
     setDescription( "Translate the coordinates of the vertices by a given vector" );
+
+  registerWrapper( viewKeyStruct::partitionMethodString(), &m_partitionMethod ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( PartitionMethod::kdtree ).
+    setDescription( "Method used to distribute the cells among the MPI ranks. Valid options:\n* " +
+                    EnumStrings< PartitionMethod >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::partitionWeightFieldString(), &m_partitionWeightField ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Name of the cell attribute holding the computational cost of each cell "
+                    "(only used by the parmetis partition method)" );
+
+  registerWrapper( viewKeyStruct::partitionRegionAttributesString(), &m_partitionRegionAttributes ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( GEOSX_FMT( "Values of the region attribute whose cells have their cost multiplied by the factors given in '{}' "
+                               "(only used by the parmetis partition method)",
+                               viewKeyStruct::partitionRegionWeightsString() ) );
+
+  registerWrapper( viewKeyStruct::partitionRegionWeightsString(), &m_partitionRegionWeights ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( GEOSX_FMT( "Cost factors of the cells of the regions listed in '{}'",
+                               viewKeyStruct::partitionRegionAttributesString() ) );
+
+  registerWrapper( viewKeyStruct::partitionWellWeightString(), &m_partitionWellWeight ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1.0 ).
+    setDescription( "Weight of the connections between two cells crossed by the same well (defined in the same Mesh block), "
+                    "relative to the other cell connections. Large values keep the cells of each well on as few ranks as possible "
+                    "(only used by the parmetis partition method)" );
+}
+
+void VTKMeshGenerator::postProcessInput()
+{
+  ExternalMeshGeneratorBase::postProcessInput();
+
+  GEOSX_THROW_IF_NE_MSG( m_partitionRegionAttributes.size(), m_partitionRegionWeights.size(),
+                         GEOSX_FMT( "{} '{}': attributes '{}' and '{}' must contain the same number of values",
+                                    catalogName(), getName(),
+                                    viewKeyStruct::partitionRegionAttributesString(),
+                                    viewKeyStruct::partitionRegionWeightsString() ),
+                         InputError );
+
+  GEOSX_THROW_IF( std::any_of( m_partitionRegionWeights.begin(), m_partitionRegionWeights.end(), []( real64 const w ){ return w <= 0.0; } ),
+                  GEOSX_FMT( "{} '{}': the values of '{}' must be positive",
+                             catalogName(), getName(), viewKeyStruct::partitionRegionWeightsString() ),
+                  InputError );
+
+  GEOSX_THROW_IF_LT_MSG( m_partitionWellWeight, 1.0,
+                         GEOSX_FMT( "{} '{}': '{}' must be greater than or equal to 1",
+                                    catalogName(), getName(), viewKeyStruct::partitionWellWeightString() ),
+                         InputError );
+
+#ifndef GEOSX_USE_PARMETIS
+  GEOSX_THROW_IF( m_partitionMethod == PartitionMethod::parmetis,
+                  GEOSX_FMT( "{} '{}': the parmetis partition method requires GEOSX to be built with ParMETIS",
+                             catalogName(), getName() ),
+                  InputError );
+#endif
 }
 
 namespace
@@ -88,9 +162,138 @@ vtkSmartPointer< vtkMultiProcessController > getVTKController()
   return controller;
 }
 
+/**
+ * @brief Merge the points of a mesh that have the same global id.
+ * @param[in] mesh the mesh, with global point ids
+ * @return the mesh in which each global point id is held by a single point
+ * @details The first point holding each global id is kept, with its data, and the cells are renumbered accordingly.
+ * Unlike a geometric merge, this keeps the points that are intentionally duplicated (e.g. on pre-split fractures).
+ */
+vtkSmartPointer< vtkUnstructuredGrid >
+mergePointsWithSameGlobalId( vtkUnstructuredGrid & mesh )
+{
+  vtkDataArray * const globalPointId = mesh.GetPointData()->GetGlobalIds();
+  vtkIdType const numPoints = mesh.GetNumberOfPoints();
+
+  std::unordered_map< vtkIdType, vtkIdType > globalToMerged;
+  std::vector< vtkIdType > mergedPointId( numPoints );
+  vtkNew< vtkIdList > keptPoints;
+  for( vtkIdType i = 0; i < numPoints; ++i )
+  {
+    auto const inserted = globalToMerged.emplace( static_cast< vtkIdType >( globalPointId->GetTuple1( i ) ), keptPoints->GetNumberOfIds() );
+    if( inserted.second )
+    {
+      keptPoints->InsertNextId( i );
+    }
+    mergedPointId[i] = inserted.first->second;
+  }
+
+  vtkSmartPointer< vtkUnstructuredGrid > merged = vtkSmartPointer< vtkUnstructuredGrid >::New();
+  merged->DeepCopy( &mesh );
+  if( keptPoints->GetNumberOfIds() == numPoints )
+  {
+    return merged;
+  }
+
+  vtkNew< vtkPoints > points;
+  points->SetDataType( mesh.GetPoints()->GetDataType() );
+  mesh.GetPoints()->GetPoints( keptPoints, points );
+  merged->SetPoints( points );
+
+  vtkNew< vtkPointData > pointData;
+  pointData->CopyGlobalIdsOn();
+  pointData->CopyAllocate( mesh.GetPointData(), keptPoints->GetNumberOfIds() );
+  for( vtkIdType i = 0; i < keptPoints->GetNumberOfIds(); ++i )
+  {
+    pointData->CopyData( mesh.GetPointData(), keptPoints->GetId( i ), i );
+  }
+  merged->GetPointData()->ShallowCopy( pointData );
+
+  vtkDataArray * const connectivity = merged->GetCells()->GetConnectivityArray();
+  for( vtkIdType i = 0; i < connectivity->GetNumberOfTuples(); ++i )
+  {
+    connectivity->SetTuple1( i, mergedPointId[ static_cast< vtkIdType >( connectivity->GetTuple1( i ) ) ] );
+  }
+
+  // the face streams of the polyhedra are made of: number of faces, then for each face its number of points and its points
+  vtkIdTypeArray * const faces = merged->GetFaces();
+  if( faces != nullptr )
+  {
+    vtkIdType i = 0;
+    while( i < faces->GetNumberOfValues() )
+    {
+      vtkIdType const numFaces = faces->GetValue( i++ );
+      for( vtkIdType f = 0; f < numFaces; ++f )
+      {
+        vtkIdType const numFacePoints = faces->GetValue( i++ );
+        for( vtkIdType p = 0; p < numFacePoints; ++p, ++i )
+        {
+          faces->SetValue( i, mergedPointId[ faces->GetValue( i ) ] );
+        }
+      }
+    }
+  }
+
+  return merged;
+}
+
+/**
+ * @brief Read the pieces of a VTK XML file that are assigned to this rank.
+ * @tparam READER the type of VTK XML reader
+ * @param[in] filePath the Path of the file to load
+ * @return the part of the mesh read by this rank
+ * @details The pieces stored in the file are split by the reader into contiguous ranges,
+ * one per rank. Only the pieces of the range of this rank are read from the disk, and their
+ * data is directly seeked in the (raw) appended section of the files.
+ * If the file holds fewer pieces than there are ranks, some ranks do not read anything;
+ * in particular, a single-piece file is entirely read by one rank.
+ * The points duplicated at the seams between the pieces read by this rank are merged.
+ */
+template< typename READER >
+vtkSmartPointer< vtkUnstructuredGrid >
+readPieces( Path const & filePath )
+{
+  int const rank = MpiWrapper::commRank();
+  int const numRanks = MpiWrapper::commSize();
+
+  vtkSmartPointer< READER > vtkUgReader = vtkSmartPointer< READER >::New();
+  vtkUgReader->SetFileName( filePath.c_str() );
+  vtkUgReader->UpdatePiece( rank, numRanks, 0 );
+  vtkSmartPointer< vtkUnstructuredGrid > mesh = vtkUgReader->GetOutput();
+
+  // same split of the pieces as the reader
+  int const numPieces = vtkUgReader->GetNumberOfPieces();
+  int const numPiecesRead = ( ( rank + 1 ) * numPieces ) / numRanks - ( rank * numPieces ) / numRanks;
+  if( numPiecesRead <= 1 )
+  {
+    return mesh;
+  }
+
+  // The pieces are appended to each other, so the points they share are duplicated.
+  // Only these duplicates are merged, which requires the global point ids of the pieces.
+  if( mesh->GetPointData()->GetGlobalIds() != nullptr )
+  {
+    return mergePointsWithSameGlobalId( *mesh );
+  }
+
+  GEOSX_WARNING( GEOSX_FMT( "Rank {} reads {} pieces of {} without global point ids, all their coincident points are merged. "
+                            "Write the file with global point ids, or with at least as many pieces as ranks, "
+                            "to keep the points that are intentionally duplicated.",
+                            rank, numPiecesRead, filePath ) );
+
+  // The input data is set directly (instead of connecting the pipeline)
+  // for the cleaner not to request the whole dataset from the reader again.
+  vtkNew< vtkCleanUnstructuredGrid > cleaner;
+  cleaner->SetInputData( mesh );
+  cleaner->Update();
+  return vtkUnstructuredGrid::SafeDownCast( cleaner->GetOutputDataObject( 0 ) );
+}
+
 /**
  * @brief Load the VTK file into the VTK data structure
  * @param[in] filePath the Path of the file to load
+ * @details The .vtu and .pvtu files are read in parallel, piece by piece (see readPieces).
+ * The legacy .vtk files cannot be read in parallel and are loaded on the root MPI process.
  */
 vtkSmartPointer< vtkUnstructuredGrid >
 loadVTKMesh( Path const & filePath )
@@ -101,49 +304,30 @@ loadVTKMesh( Path const & filePath )
 
   if( extension == "pvtu" )
   {
-    vtkSmartPointer< vtkXMLPUnstructuredGridReader > vtkUgReader = vtkSmartPointer< vtkXMLPUnstructuredGridReader >::New();
-    vtkUgReader->SetFileName( filePath.c_str() );
-    vtkUgReader->UpdateInformation();
-    int const numberOfPieces = vtkUgReader->GetNumberOfPieces();
-    if( MpiWrapper::commSize() == 1 )
-    {
-      vtkUgReader->Update();
-    }
-    else if( MpiWrapper::commRank() < numberOfPieces )
-    {
-      vtkUgReader->UpdatePiece( MpiWrapper::commRank(), 2, 0 ); // TODO What's that numPieces = 2?
-    }
-    loadedMesh = vtkUgReader->GetOutput();
+    loadedMesh = readPieces< vtkXMLPUnstructuredGridReader >( filePath );
   }
-  else
+  else if( extension == "vtu" )
+  {
+    loadedMesh = readPieces< vtkXMLUnstructuredGridReader >( filePath );
+  }
+  else if( extension == "vtk" )
   {
     if( MpiWrapper::commRank() == 0 )
     {
-      auto read = [&]( auto vtkUgReader ) // auto can be multiple types in the same function
-      {
-        vtkUgReader->SetFileName( filePath.c_str() );
-        vtkUgReader->Update();
-        return vtkUgReader->GetOutput();
-      };
-
-      if( extension == "vtk" )
-      {
-        loadedMesh = read( vtkSmartPointer< vtkUnstructuredGridReader >::New() );
-      }
-      else if( extension == "vtu" )
-      {
-        loadedMesh = read( vtkSmartPointer< vtkXMLUnstructuredGridReader >::New() );
-      }
-      else
-      {
-        GEOSX_ERROR( extension << " is not a recognized extension for using the VTK reader with GEOSX. Please use .vtk or .vtu" );
-      }
+      vtkSmartPointer< vtkUnstructuredGridReader > vtkUgReader = vtkSmartPointer< vtkUnstructuredGridReader >::New();
+      vtkUgReader->SetFileName( filePath.c_str() );
+      vtkUgReader->Update();
+      loadedMesh = vtkUgReader->GetOutput();
     }
     else
     {
       loadedMesh = vtkSmartPointer< vtkUnstructuredGrid >::New();
     }
   }
+  else
+  {
+    GEOSX_ERROR( extension << " is not a recognized extension for using the VTK reader with GEOSX. Please use .vtk, .vtu or .pvtu" );
+  }
 
   return loadedMesh;
 }
@@ -180,6 +364,20 @@ std::vector< int > computePartitionAssignments( int const numParts, int const nu
 }
 
 
+/**
+ * @brief Generate global ids for the points and cells of a mesh loaded on one or several MPI ranks
+ * @param[in] loadedMesh the mesh that was loaded on one or several MPI ranks
+ * @return the mesh holding the global ids
+ */
+vtkSmartPointer< vtkUnstructuredGrid >
+generateGlobalIds( vtkUnstructuredGrid & loadedMesh )
+{
+  vtkNew< vtkGenerateGlobalIds > generator;
+  generator->SetInputDataObject( &loadedMesh );
+  generator->Update();
+  return vtkUnstructuredGrid::SafeDownCast( generator->GetOutputDataObject( 0 ) );
+}
+
 /**
  * @brief Redistribute the mesh among the available MPI ranks
  * @details this method will also generate global ids for points and cells in the VTK Mesh
@@ -191,13 +389,11 @@ redistributeMesh( vtkUnstructuredGrid & loadedMesh,
                   std::vector< vtkBoundingBox > & cuts )
 {
   // Generate global IDs for vertices and cells
-  vtkNew< vtkGenerateGlobalIds > generator;
-  generator->SetInputDataObject( &loadedMesh );
-  generator->Update();
+  vtkSmartPointer< vtkUnstructuredGrid > meshWithIds = generateGlobalIds( loadedMesh );
 
   // Redistribute data all over the available ranks
   vtkNew< vtkRedistributeDataSetFilter > rdsf;
-  rdsf->SetInputDataObject( generator->GetOutputDataObject( 0 ) );
+  rdsf->SetInputDataObject( meshWithIds );
   rdsf->SetNumberOfPartitions( MpiWrapper::commSize() );
   rdsf->Update();
 
@@ -293,6 +489,119 @@ real64 writeMeshNodes( vtkUnstructuredGrid & mesh,
   return LvArray::tensorOps::l2Norm< 3 >( xMax );
 }
 
+/**
+ * @brief Exchange variable-sized buffers between all pairs of ranks.
+ * @tparam T type of the exchanged values
+ * @param sendBuffers the values to send to each rank
+ * @return the values received from each rank
+ */
+template< typename T >
+std::vector< std::vector< T > > exchangeBuffers( std::vector< std::vector< T > > const & sendBuffers )
+{
+  int const numRanks = MpiWrapper::commSize();
+
+  std::vector< int > sendSizes( numRanks );
+  std::vector< int > recvSizes( numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    sendSizes[r] = LvArray::integerConversion< int >( sendBuffers[r].size() );
+  }
+  MpiWrapper::alltoall( sendSizes.data(), 1, recvSizes.data(), 1, MPI_COMM_GEOSX );
+
+  std::vector< std::vector< T > > recvBuffers( numRanks );
+  std::vector< MPI_Request > requests;
+  requests.reserve( 2 * numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    if( recvSizes[r] > 0 )
+    {
+      recvBuffers[r].resize( recvSizes[r] );
+      requests.emplace_back();
+      MpiWrapper::iRecv( recvBuffers[r].data(), recvSizes[r], r, 0, MPI_COMM_GEOSX, &requests.back() );
+    }
+  }
+  for( int r = 0; r < numRanks; ++r )
+  {
+    if( sendSizes[r] > 0 )
+    {
+      requests.emplace_back();
+      MpiWrapper::iSend( sendBuffers[r].data(), sendSizes[r], r, 0, MPI_COMM_GEOSX, &requests.back() );
+    }
+  }
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( requests.size() ), requests.data(), MPI_STATUSES_IGNORE );
+
+  return recvBuffers;
+}
+
+} // namespace
+
+namespace vtk
+{
+
+vtkSmartPointer< vtkUnstructuredGrid >
+migrateCells( vtkUnstructuredGrid & mesh,
+              arrayView1d< int const > const & ranks )
+{
+  int const numRanks = MpiWrapper::commSize();
+
+  std::vector< vtkSmartPointer< vtkIdList > > cellsOfRank( numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    cellsOfRank[r] = vtkSmartPointer< vtkIdList >::New();
+  }
+  for( vtkIdType c = 0; c < mesh.GetNumberOfCells(); ++c )
+  {
+    cellsOfRank[ranks[c]]->InsertNextId( c );
+  }
+
+  std::vector< std::vector< char > > sendBuffers( numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    if( cellsOfRank[r]->GetNumberOfIds() > 0 )
+    {
+      vtkNew< vtkExtractCells > extractor;
+      extractor->SetInputDataObject( &mesh );
+      extractor->SetCellList( cellsOfRank[r] );
+      extractor->Update();
+
+      vtkNew< vtkCharArray > buffer;
+      vtkCommunicator::MarshalDataObject( extractor->GetOutputDataObject( 0 ), buffer );
+      sendBuffers[r].assign( buffer->GetPointer( 0 ), buffer->GetPointer( 0 ) + buffer->GetNumberOfValues() );
+    }
+  }
+
+  std::vector< std::vector< char > > recvBuffers = exchangeBuffers( sendBuffers );
+
+  vtkNew< vtkAppendFilter > appender;
+  bool receivedCells = false;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    if( !recvBuffers[r].empty() )
+    {
+      vtkNew< vtkCharArray > buffer;
+      buffer->SetArray( recvBuffers[r].data(), LvArray::integerConversion< vtkIdType >( recvBuffers[r].size() ), 1 );
+      vtkNew< vtkUnstructuredGrid > piece;
+      vtkCommunicator::UnMarshalDataObject( buffer, piece );
+      appender->AddInputData( piece );
+      receivedCells = true;
+    }
+  }
+
+  if( !receivedCells )
+  {
+    return vtkSmartPointer< vtkUnstructuredGrid >::New();
+  }
+  appender->Update();
+  vtkUnstructuredGrid * const appended = vtkUnstructuredGrid::SafeDownCast( appender->GetOutputDataObject( 0 ) );
+  GEOSX_ERROR_IF( appended->GetPointData()->GetGlobalIds() == nullptr, "Global point IDs have not been generated" );
+  return mergePointsWithSameGlobalId( *appended );
+}
+
+} // namespace vtk
+
+namespace
+{
+
 /**
  * @brief Gathers all the data from all ranks, merge them, sort them, and remove duplicates.
  * @tparam T Type of the exchanged data.
@@ -326,6 +635,338 @@ std::vector< T > collectUniqueValues( std::vector< T > const & data )
   return allData;
 }
 
+#ifdef GEOSX_USE_PARMETIS
+
+/**
+ * @brief Collect the segments of the wells defined in the same Mesh block as a mesh.
+ * @param meshManager the group holding the mesh generators
+ * @param meshName the name of the mesh crossed by the wells
+ * @param scale the scaling applied to the coordinates of the mesh
+ * @param translate the translation applied to the coordinates of the mesh
+ * @return for each well, the end points of its polyline segments (six values per segment),
+ *         expressed in the coordinate system of the VTK mesh
+ */
+std::vector< array2d< real64 > > collectWellSegments( Group const & meshManager,
+                                                      string const & meshName,
+                                                      R1Tensor const & scale,
+                                                      R1Tensor const & translate )
+{
+  std::vector< array2d< real64 > > wellSegments;
+  meshManager.forSubGroups< InternalWellGenerator >( [&]( InternalWellGenerator const & well )
+  {
+    if( well.getReference< string >( InternalWellGenerator::viewKeyStruct::meshNameString() ) != meshName )
+    {
+      return;
+    }
+
+    arrayView2d< real64 const > const polyNodeCoords =
+      well.getReference< array2d< real64 > >( InternalWellGenerator::viewKeyStruct::polylineNodeCoordsString() );
+    arrayView2d< globalIndex const > const segmentToPolyNodes =
+      well.getReference< array2d< globalIndex > >( InternalWellGenerator::viewKeyStruct::polylineSegmentConnString() );
+
+    array2d< real64 > segments( segmentToPolyNodes.size( 0 ), 6 );
+    for( localIndex iseg = 0; iseg < segmentToPolyNodes.size( 0 ); ++iseg )
+    {
+      for( integer inode = 0; inode < 2; ++inode )
+      {
+        for( integer i = 0; i < 3; ++i )
+        {
+          // Inverse of the transformation applied in writeMeshNodes
+          segments( iseg, 3 * inode + i ) = polyNodeCoords( segmentToPolyNodes( iseg, inode ), i ) / scale[i] - translate[i];
+        }
+      }
+    }
+    wellSegments.emplace_back( std::move( segments ) );
+  } );
+  return wellSegments;
+}
+
+using parmetis::pmet_idx_t;
+
+/// Resolution of the cell weights passed to ParMETIS (which only accepts integers), relative to the average cell cost
+constexpr pmet_idx_t CELL_WEIGHT_RESOLUTION = 100;
+
+
+/**
+ * @brief Build the map from the cells to the global ids of their points.
+ * @param[in] mesh the local part of the mesh, holding global point ids
+ * @return the cell to global points map
+ */
+ArrayOfArrays< pmet_idx_t, pmet_idx_t > buildCellToGlobalPoints( vtkUnstructuredGrid & mesh )
+{
+  vtkIdType const numCells = mesh.GetNumberOfCells();
+  vtkIdTypeArray const * const globalPointId = vtkIdTypeArray::FastDownCast( mesh.GetPointData()->GetGlobalIds() );
+  GEOSX_ERROR_IF( numCells > 0 && globalPointId == nullptr, "Global point IDs have not been generated" );
+
+  array1d< pmet_idx_t > offsets( numCells + 1 );
+  for( vtkIdType c = 0; c < numCells; ++c )
+  {
+    offsets[c + 1] = offsets[c] + mesh.GetCellSize( c );
+  }
+
+  ArrayOfArrays< pmet_idx_t, pmet_idx_t > cellToPoints;
+  cellToPoints.resizeFromOffsets( numCells, offsets.data() );
+
+  vtkNew< vtkIdList > pointIds;
+  for( vtkIdType c = 0; c < numCells; ++c )
+  {
+    mesh.GetCellPoints( c, pointIds );
+    for( vtkIdType i = 0; i < pointIds->GetNumberOfIds(); ++i )
+    {
+      cellToPoints.emplaceBack( c, globalPointId->GetValue( pointIds->GetId( i ) ) );
+    }
+  }
+  return cellToPoints;
+}
+
+/**
+ * @brief Compute the ParMETIS weights of the cells from their computational cost.
+ * @param[in] mesh the local part of the mesh
+ * @param[in] weightFieldName the name of the cell attribute holding the cost of each cell (unit costs if empty)
+ * @param[in] attributeName the name of the cell attribute holding the region of each cell
+ * @param[in] regionAttributes the regions whose cells have their cost scaled
+ * @param[in] regionWeights the cost factors of the regions
+ * @return the weights of the local cells
+ * @details The costs are normalized by their global average and rounded to integers, with a resolution of 1%.
+ */
+array1d< pmet_idx_t > computeCellWeights( vtkUnstructuredGrid & mesh,
+                                          string const & weightFieldName,
+                                          string const & attributeName,
+                                          arrayView1d< integer const > const & regionAttributes,
+                                          arrayView1d< real64 const > const & regionWeights )
+{
+  vtkIdType const numCells = mesh.GetNumberOfCells();
+  array1d< real64 > cost( numCells );
+  cost.setValues< serialPolicy >( 1.0 );
+
+  if( !weightFieldName.empty() )
+  {
+    vtkDataArray * const weightArray = mesh.GetCellData()->GetArray( weightFieldName.c_str() );
+    GEOSX_THROW_IF( numCells > 0 && weightArray == nullptr,
+                    "Cell attribute '" << weightFieldName << "' not found in the mesh",
+                    InputError );
+    for( vtkIdType c = 0; c < numCells; ++c )
+    {
+      cost[c] = weightArray->GetComponent( c, 0 );
+    }
+  }
+
+  if( !regionAttributes.empty() )
+  {
+    vtkDataArray * const attributeArray = mesh.GetCellData()->GetArray( attributeName.c_str() );
+    GEOSX_THROW_IF( numCells > 0 && attributeArray == nullptr,
+                    "Region attribute '" << attributeName << "' not found in the mesh",
+                    InputError );
+
+    std::unordered_map< integer, real64 > regionToWeight;
+    for( localIndex i = 0; i < regionAttributes.size(); ++i )
+    {
+      regionToWeight[regionAttributes[i]] = regionWeights[i];
+    }
+    for( vtkIdType c = 0; c < numCells; ++c )
+    {
+      auto const it = regionToWeight.find( static_cast< integer >( attributeArray->GetComponent( c, 0 ) ) );
+      if( it != regionToWeight.end() )
+      {
+        cost[c] *= it->second;
+      }
+    }
+  }
+
+  real64 const totalCost = MpiWrapper::sum( std::accumulate( cost.begin(), cost.end(), 0.0 ) );
+  real64 const averageCost = totalCost / MpiWrapper::sum( numCells );
+
+  array1d< pmet_idx_t > weights( numCells );
+  for( vtkIdType c = 0; c < numCells; ++c )
+  {
+    pmet_idx_t const weight = averageCost > 0.0 ? std::lround( CELL_WEIGHT_RESOLUTION * cost[c] / averageCost ) : 1;
+    weights[c] = std::max( pmet_idx_t{ 1 }, weight );
+  }
+  return weights;
+}
+
+/**
+ * @brief Compute the weights of the dual graph edges, giving a higher weight to the connections of the cells crossed by the same well.
+ * @param[in] mesh the local part of the mesh
+ * @param[in] graph the dual graph of the cells (in terms of global cell indices)
+ * @param[in] firstCellIndex the global index of the first local cell
+ * @param[in] wellSegments the segments of each well (see collectWellSegments)
+ * @param[in] wellWeight the weight of the connections between two cells crossed by the same well
+ * @return the weights of the edges, with the layout of @p graph
+ */
+ArrayOfArrays< pmet_idx_t, pmet_idx_t >
+computeWellEdgeWeights( vtkUnstructuredGrid & mesh,
+                        ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & graph,
+                        pmet_idx_t const firstCellIndex,
+                        std::vector< array2d< real64 > > const & wellSegments,
+                        pmet_idx_t const wellWeight )
+{
+  pmet_idx_t const numWells = LvArray::integerConversion< pmet_idx_t >( wellSegments.size() );
+
+  // Find the local cells crossed by the wells, encoding each (cell, well) pair as cell * numWells + well
+  std::vector< pmet_idx_t > localWellCells;
+  if( mesh.GetNumberOfCells() > 0 )
+  {
+    vtkNew< vtkStaticCellLocator > locator;
+    locator->SetDataSet( &mesh );
+    locator->BuildLocator();
+
+    vtkNew< vtkIdList > cellIds;
+    for( pmet_idx_t w = 0; w < numWells; ++w )
+    {
+      array2d< real64 > const & segments = wellSegments[w];
+      for( localIndex iseg = 0; iseg < segments.size( 0 ); ++iseg )
+      {
+        locator->FindCellsAlongLine( &segments( iseg, 0 ), &segments( iseg, 3 ), 0.0, cellIds );
+        for( vtkIdType i = 0; i < cellIds->GetNumberOfIds(); ++i )
+        {
+          localWellCells.push_back( ( firstCellIndex + cellIds->GetId( i ) ) * numWells + w );
+        }
+      }
+    }
+  }
+
+  // The remote neighbors of the local cells must be known too, and the well cells are few: gather them all
+  std::vector< pmet_idx_t > const wellCells = collectUniqueValues( localWellCells );
+  auto const wellsOfCell = [&]( pmet_idx_t const cell )
+  {
+    return std::make_pair( std::lower_bound( wellCells.begin(), wellCells.end(), cell * numWells ),
+                           std::lower_bound( wellCells.begin(), wellCells.end(), ( cell + 1 ) * numWells ) );
+  };
+
+  ArrayOfArrays< pmet_idx_t, pmet_idx_t > edgeWeights;
+  edgeWeights.resizeFromOffsets( graph.size(), graph.getOffsets() );
+  for( pmet_idx_t i = 0; i < graph.size(); ++i )
+  {
+    auto const wellsOfI = wellsOfCell( firstCellIndex + i );
+    for( pmet_idx_t const j : graph[i] )
+    {
+      auto const wellsOfJ = wellsOfCell( j );
+      bool sameWell = false;
+      for( auto wi = wellsOfI.first; wi != wellsOfI.second && !sameWell; ++wi )
+      {
+        sameWell = std::any_of( wellsOfJ.first, wellsOfJ.second,
+                                [&]( pmet_idx_t const wj ){ return wj % numWells == *wi % numWells; } );
+      }
+      edgeWeights.emplaceBack( i, sameWell ? wellWeight : 1 );
+    }
+  }
+  return edgeWeights;
+}
+
+
+/**
+ * @brief Redistribute the mesh among the available MPI ranks with ParMETIS
+ * @param[in] mesh the mesh distributed over all the ranks, holding global point ids
+ * @param[in] cellWeights the weights of the local cells
+ * @param[in] wellSegments the segments of the wells crossing the mesh (see collectWellSegments)
+ * @param[in] wellWeight the weight of the connections between two cells crossed by the same well
+ * @return the cells assigned to this rank
+ * @details The cells are partitioned by ParMETIS through the dual graph connecting the cells sharing a face.
+ */
+vtkSmartPointer< vtkUnstructuredGrid >
+partitionMesh( vtkUnstructuredGrid & mesh,
+               arrayView1d< pmet_idx_t const > const & cellWeights,
+               std::vector< array2d< real64 > > const & wellSegments,
+               pmet_idx_t const wellWeight )
+{
+  int const numRanks = MpiWrapper::commSize();
+
+  // The cells of each rank are numbered contiguously
+  array1d< pmet_idx_t > cellCounts;
+  MpiWrapper::allGather( LvArray::integerConversion< pmet_idx_t >( mesh.GetNumberOfCells() ), cellCounts );
+  array1d< pmet_idx_t > cellDist( numRanks + 1 );
+  std::partial_sum( cellCounts.begin(), cellCounts.end(), cellDist.begin() + 1 );
+
+  ArrayOfArrays< pmet_idx_t, pmet_idx_t > const cellToPoints = buildCellToGlobalPoints( mesh );
+  ArrayOfArrays< pmet_idx_t, pmet_idx_t > const graph =
+    parmetis::meshToDual( cellToPoints.toViewConst(), cellDist.toViewConst(), MPI_COMM_GEOSX, 3 );
+
+  ArrayOfArrays< pmet_idx_t, pmet_idx_t > edgeWeights;
+  if( !wellSegments.empty() && wellWeight > 1 )
+  {
+    edgeWeights = computeWellEdgeWeights( mesh,
+                                          graph.toViewConst(),
+                                          cellDist[MpiWrapper::commRank()],
+                                          wellSegments,
+                                          wellWeight );
+  }
+
+  array1d< pmet_idx_t > const parts = parmetis::partition( graph.toViewConst(),
+                                                           cellWeights,
+                                                           edgeWeights.toViewConst(),
+                                                           cellDist.toViewConst(),
+                                                           numRanks,
+                                                           MPI_COMM_GEOSX );
+
+  array1d< int > ranks( parts.size() );
+  std::copy( parts.begin(), parts.end(), ranks.begin() );
+  return vtk::migrateCells( mesh, ranks.toViewConst() );
+}
+
+/**
+ * @brief Compute the ranks sharing points with this rank
+ * @param[in] mesh the cells assigned to this rank, holding global point ids
+ * @details Each global point id is sent to the rank in charge of it (round-robin). This rank identifies
+ * the points held by several ranks and sends back to each of them the list of ranks it shares points with.
+ */
+std::unordered_set< int > computeMPINeighborRanksFromSharedPoints( vtkUnstructuredGrid & mesh )
+{
+  int const numRanks = MpiWrapper::commSize();
+
+  vtkIdType const numPts = mesh.GetNumberOfPoints();
+  vtkIdTypeArray const * const globalPointId = vtkIdTypeArray::FastDownCast( mesh.GetPointData()->GetGlobalIds() );
+  GEOSX_ERROR_IF( numPts > 0 && globalPointId == nullptr, "Global point IDs have not been generated" );
+
+  std::vector< std::vector< vtkIdType > > pointsToSend( numRanks );
+  for( vtkIdType v = 0; v < numPts; ++v )
+  {
+    vtkIdType const gid = globalPointId->GetValue( v );
+    pointsToSend[gid % numRanks].push_back( gid );
+  }
+  std::vector< std::vector< vtkIdType > > const pointsReceived = exchangeBuffers( pointsToSend );
+
+  std::unordered_map< vtkIdType, std::vector< int > > pointToRanks;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    for( vtkIdType const gid : pointsReceived[r] )
+    {
+      pointToRanks[gid].push_back( r );
+    }
+  }
+
+  std::vector< std::set< int > > neighborsOfRank( numRanks );
+  for( auto const & p2r : pointToRanks )
+  {
+    for( int const r : p2r.second )
+    {
+      for( int const q : p2r.second )
+      {
+        if( q != r )
+        {
+          neighborsOfRank[r].insert( q );
+        }
+      }
+    }
+  }
+
+  std::vector< std::vector< int > > neighborsToSend( numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    neighborsToSend[r].assign( neighborsOfRank[r].begin(), neighborsOfRank[r].end() );
+  }
+  std::vector< std::vector< int > > const neighborsReceived = exchangeBuffers( neighborsToSend );
+
+  std::unordered_set< int > neighbors;
+  for( std::vector< int > const & n : neighborsReceived )
+  {
+    neighbors.insert( n.begin(), n.end() );
+  }
+  return neighbors;
+}
+
+#endif // GEOSX_USE_PARMETIS
+
 /**
  * @brief Get the GEOSX element type
  * @param[in] cellType The vtk cell type
@@ -960,12 +1601,53 @@ void VTKMeshGenerator::generateMesh( DomainPartition & domain )
   GEOSX_LOG_RANK_0( GEOSX_FMT( "{} '{}': reading mesh from {}", catalogName(), getName(), m_filePath ) );
   {
     vtkSmartPointer< vtkUnstructuredGrid > loadedMesh = loadVTKMesh( m_filePath );
-    std::vector< vtkBoundingBox > cuts;
-    m_vtkMesh = redistributeMesh( *loadedMesh, cuts );
 
-    // TODO Check that the neighbor information set is bulletproof
-    std::unordered_set< int > const neighbors = computeMPINeighborRanks( std::move( cuts ) );
-    domain.getMetisNeighborList().insert( neighbors.begin(), neighbors.end() );
+    int const readsCells = loadedMesh->GetNumberOfCells() > 0 ? 1 : 0;
+    GEOSX_LOG_RANK_0( GEOSX_FMT( "{} '{}': mesh read by {} of {} ranks, redistributing", catalogName(), getName(),
+                                 MpiWrapper::sum( readsCells ), MpiWrapper::commSize() ) );
+
+    if( m_partitionMethod == PartitionMethod::parmetis )
+    {
+#ifdef GEOSX_USE_PARMETIS
+      // ParMETIS requires every rank to hold cells: if some ranks did not read any,
+      // the kd-tree redistribution provides the initial distribution of the graph.
+      vtkSmartPointer< vtkUnstructuredGrid > distributedMesh;
+      if( MpiWrapper::min( readsCells ) == 0 )
+      {
+        std::vector< vtkBoundingBox > cuts;
+        distributedMesh = redistributeMesh( *loadedMesh, cuts );
+      }
+      else
+      {
+        distributedMesh = generateGlobalIds( *loadedMesh );
+      }
+      loadedMesh = nullptr;
+
+      array1d< pmet_idx_t > const cellWeights = computeCellWeights( *distributedMesh,
+                                                                    m_partitionWeightField,
+                                                                    m_attributeName,
+                                                                    m_partitionRegionAttributes,
+                                                                    m_partitionRegionWeights );
+      std::vector< array2d< real64 > > const wellSegments = collectWellSegments( getParent(), getName(), m_scale, m_translate );
+
+      m_vtkMesh = partitionMesh( *distributedMesh,
+                                 cellWeights,
+                                 wellSegments,
+                                 std::lround( m_partitionWellWeight ) );
+
+      std::unordered_set< int > const neighbors = computeMPINeighborRanksFromSharedPoints( *m_vtkMesh );
+      domain.getMetisNeighborList().insert( neighbors.begin(), neighbors.end() );
+#endif
+    }
+    else
+    {
+      std::vector< vtkBoundingBox > cuts;
+      m_vtkMesh = redistributeMesh( *loadedMesh, cuts );
+
+      // TODO Check that the neighbor information set is bulletproof
+      std::unordered_set< int > const neighbors = computeMPINeighborRanks( std::move( cuts ) );
+      domain.getMetisNeighborList().insert( neighbors.begin(), neighbors.end() );
+    }
   }
 
   GEOSX_LOG_RANK_0( GEOSX_FMT( "{} '{}': generating GEOSX mesh data structure", catalogName(), getName() ) );
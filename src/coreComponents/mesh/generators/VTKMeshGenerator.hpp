@@ -19,6 +19,7 @@
 #ifndef GEOSX_MESH_GENERATORS_VTKMESHGENERATOR_HPP
 #define GEOSX_MESH_GENERATORS_VTKMESHGENERATOR_HPP
 
+#include "codingUtilities/EnumStrings.hpp"
 #include "codingUtilities/StringUtilities.hpp"
 #include "codingUtilities/Utilities.hpp"
 #include "mesh/ElementType.hpp"
@@ -68,14 +69,21 @@ public:
    * The supported formats are the official VTK ones dedicated to
    * unstructured grids (.vtu, .pvtu and .vtk).
    *
-   * Please note that this mesh generator works only with a number of MPI processes than
-   * can be decomposed into a power of 2.
+   * Please note that, with the default kd-tree partitioning, this mesh generator works only with a number
+   * of MPI processes than can be decomposed into a power of 2.
    *
-   * - If a .vtu of .vtk file is used, the root MPI process will load it.
+   * - If a .vtk file is used, the root MPI process will load it.
    *   The mesh will be then redistribute among all the available MPI processes
-   * - If a .pvtu file is used, it means that the mesh is pre-partionned in the file system.
-   *   The available MPI processes will load the pre-partionned mesh. The mesh will be then
-   *   redistributed among ALL the available MPI processes.
+   * - If a .vtu or a .pvtu file is used, the pieces of the mesh stored in the file(s) are split
+   *   into contiguous ranges that are read in parallel by the available MPI processes, each process only
+   *   loading its own pieces. The mesh will be then redistributed among ALL the available MPI processes.
+   *   A .vtu file with a single piece is therefore loaded by a single process: large meshes should be
+   *   written with (at least) as many pieces as there are processes, preferably with raw appended data.
+   *
+   * The redistribution uses either geometric kd-tree cuts balancing the number of cells, or (if GEOSX is
+   * built with ParMETIS) a partitioning of the face-based dual graph of the cells. The vertices of the graph
+   * can be weighted by a cell property and/or by region, and the faces crossed by the wells defined in the
+   * same Mesh block can be made more expensive to cut, so that the well cells stay together.
    *
    * The properties on the mesh will be also and redistributed. The only compatible types are double and float.
    * The properties can be multi-dimensional.
@@ -111,6 +119,19 @@ public:
    */
   using CellMapType = std::map< ElementType, std::unordered_map< int, std::vector< vtkIdType > > >;
 
+  /**
+   * @brief Method used to distribute the cells among the MPI ranks.
+   */
+  enum class PartitionMethod : integer
+  {
+    kdtree,   ///< Geometric kd-tree cuts balancing the number of cells
+    parmetis  ///< ParMETIS partitioning of the weighted dual graph of the cells
+  };
+
+protected:
+
+  virtual void postProcessInput() override;
+
 private:
 
   void buildCellBlocks( CellBlockManager & cellBlockManager ) const;
@@ -128,6 +149,11 @@ private:
   struct viewKeyStruct
   {
     constexpr static char const * regionAttributeString() { return "regionAttribute"; }
+    constexpr static char const * partitionMethodString() { return "partitionMethod"; }
+    constexpr static char const * partitionWeightFieldString() { return "partitionWeightField"; }
+    constexpr static char const * partitionRegionAttributesString() { return "partitionRegionAttributes"; }
+    constexpr static char const * partitionRegionWeightsString() { return "partitionRegionWeights"; }
+    constexpr static char const * partitionWellWeightString() { return "partitionWellWeight"; }
   };
   /// @endcond
 
@@ -142,8 +168,46 @@ private:
 
   /// Lists of VTK cell ids, organized by element type, then by region
   CellMapType m_cellMap;
+
+  /// Method used to distribute the cells among the MPI ranks
+  PartitionMethod m_partitionMethod;
+
+  /// Name of the VTK cell attribute holding the computational cost of each cell
+  string m_partitionWeightField;
+
+  /// Region attribute values whose cells have a non-unit cost
+  array1d< integer > m_partitionRegionAttributes;
+
+  /// Cost factors of the cells of the regions listed in m_partitionRegionAttributes
+  array1d< real64 > m_partitionRegionWeights;
+
+  /// Weight of the dual graph edges between two cells crossed by the same well
+  real64 m_partitionWellWeight;
 };
 
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( VTKMeshGenerator::PartitionMethod,
+              "kdtree",
+              "parmetis" );
+
+namespace vtk
+{
+
+/**
+ * @brief Send the cells to the ranks they have been assigned to.
+ * @param[in] mesh the local part of the mesh, holding global point ids
+ * @param[in] ranks the rank assigned to each local cell
+ * @return the cells assigned to this rank
+ * @details The cells sent to each rank are extracted into a new grid, serialized and exchanged.
+ * The received grids are then appended, and the points they share are merged by global id
+ * (the points that are intentionally duplicated at the same location are kept).
+ */
+vtkSmartPointer< vtkUnstructuredGrid >
+migrateCells( vtkUnstructuredGrid & mesh,
+              arrayView1d< int const > const & ranks );
+
+} // namespace vtk
+
 } // namespace geosx
 
 #endif /* GEOSX_MESH_GENERATORS_VTKMESHGENERATOR_HPP */
@@ -19,6 +19,9 @@
 
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 
+#include "codingUtilities/StringUtilities.hpp"
+#include "common/Format.hpp"
+#include "common/Stopwatch.hpp"
 #include "common/TimingMacros.hpp"
 #include "mesh/mpiCommunications/MPI_iCommData.hpp"
 #include "mesh/mpiCommunications/NeighborCommunicator.hpp"
@@ -27,6 +30,10 @@
 #include "common/GEOS_RAJA_Interface.hpp"
 
 #include <algorithm>
+#include <array>
+#include <fstream>
+#include <functional>
+#include <numeric>
 
 namespace geosx
 {
@@ -36,7 +43,9 @@ CommunicationTools * CommunicationTools::m_instance = nullptr;
 
 using namespace dataRepository;
 
-CommunicationTools::CommunicationTools()
+CommunicationTools::CommunicationTools():
+  m_profiling( false ),
+  m_unpackTime( 0.0 )
 {
   for( int i = 0; i < NeighborCommunicator::maxComm; ++i )
   {
@@ -304,37 +313,54 @@ void CommunicationTools::assignGlobalIndices( ObjectManagerBase & object,
 void CommunicationTools::assignNewGlobalIndices( ObjectManagerBase & object,
                                                  std::set< localIndex > const & indexList )
 {
+  assignNewGlobalIndices( { &object }, { &indexList } );
+}
+
+void CommunicationTools::assignNewGlobalIndices( std::vector< ObjectManagerBase * > const & objects,
+                                                 std::vector< std::set< localIndex > const * > const & indexLists )
+{
+  GEOSX_ERROR_IF_NE( objects.size(), indexLists.size() );
+
   // TODO: This should be done with a prefix sum!
   int const thisRank = MpiWrapper::commRank( MPI_COMM_GEOSX );
-  int const commSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
-  localIndex numberOfNewObjectsHere = indexList.size();
-  localIndex_array numberOfNewObjects( commSize );
-  localIndex_array glocalIndexOffset( commSize );
-  MpiWrapper::allGather( numberOfNewObjectsHere, numberOfNewObjects );
+  localIndex const numObjectTypes = LvArray::integerConversion< localIndex >( objects.size() );
 
-
-  glocalIndexOffset[0] = 0;
-  for( int rank = 1; rank < commSize; ++rank )
+  // the counts of all the object types are gathered at once, laid out by rank then by object type
+  localIndex_array numberOfNewObjectsHere( numObjectTypes );
+  for( localIndex k = 0; k < numObjectTypes; ++k )
   {
-    glocalIndexOffset[rank] = glocalIndexOffset[rank - 1] + numberOfNewObjects[rank - 1];
+    numberOfNewObjectsHere[k] = LvArray::integerConversion< localIndex >( indexLists[k]->size() );
   }
+  localIndex_array numberOfNewObjects;
+  MpiWrapper::allGather( numberOfNewObjectsHere.toViewConst(), numberOfNewObjects );
 
-  arrayView1d< globalIndex > const & localToGlobal = object.localToGlobalMap();
-
-  localIndex nIndicesAssigned = 0;
-  for( localIndex const newLocalIndex : indexList )
+  for( localIndex k = 0; k < numObjectTypes; ++k )
   {
-    GEOSX_ERROR_IF( localToGlobal[newLocalIndex] != -1,
-                    "Local object " << newLocalIndex << " should be new but already has a global index "
-                                    << localToGlobal[newLocalIndex] );
+    ObjectManagerBase & object = *objects[k];
 
-    localToGlobal[newLocalIndex] = object.maxGlobalIndex() + glocalIndexOffset[thisRank] + nIndicesAssigned + 1;
-    object.updateGlobalToLocalMap( newLocalIndex );
+    localIndex glocalIndexOffset = 0;
+    for( int rank = 0; rank < thisRank; ++rank )
+    {
+      glocalIndexOffset += numberOfNewObjects[rank * numObjectTypes + k];
+    }
 
-    nIndicesAssigned += 1;
-  }
+    arrayView1d< globalIndex > const & localToGlobal = object.localToGlobalMap();
 
-  object.setMaxGlobalIndex();
+    localIndex nIndicesAssigned = 0;
+    for( localIndex const newLocalIndex : *indexLists[k] )
+    {
+      GEOSX_ERROR_IF( localToGlobal[newLocalIndex] != -1,
+                      "Local object " << newLocalIndex << " should be new but already has a global index "
+                                      << localToGlobal[newLocalIndex] );
+
+      localToGlobal[newLocalIndex] = object.maxGlobalIndex() + glocalIndexOffset + nIndicesAssigned + 1;
+      object.updateGlobalToLocalMap( newLocalIndex );
+
+      nIndicesAssigned += 1;
+    }
+
+    object.setMaxGlobalIndex();
+  }
 }
 
 void
@@ -784,12 +810,22 @@ void CommunicationTools::synchronizePackSendRecvSizes( const std::map< string, s
   icomm.fieldNames().insert( fieldNames.begin(), fieldNames.end() );
   icomm.resize( neighbors.size() );
 
+  SyncProfile step;
+  Stopwatch watch;
+
   parallelDeviceEvents events;
   for( std::size_t neighborIndex = 0; neighborIndex < neighbors.size(); ++neighborIndex )
   {
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
     int const bufferSize = neighbor.packCommSizeForSync( fieldNames, mesh, icomm.commID(), onDevice, events );
 
+    if( m_profiling )
+    {
+      NeighborProfile & neighborProfile = step.neighbors[ neighbor.neighborRank() ];
+      neighborProfile.numMessages += 1;
+      neighborProfile.bytesSent += bufferSize;
+    }
+
     neighbor.mpiISendReceiveBufferSizes( icomm.commID(),
                                          icomm.mpiSendBufferSizeRequest( neighborIndex ),
                                          icomm.mpiRecvBufferSizeRequest( neighborIndex ),
@@ -798,6 +834,12 @@ void CommunicationTools::synchronizePackSendRecvSizes( const std::map< string, s
     neighbor.resizeSendBuffer( icomm.commID(), bufferSize );
   }
   waitAllDeviceEvents( events );
+
+  if( m_profiling )
+  {
+    step.packTime = watch.elapsedTime();
+    recordProfile( fieldNames, step );
+  }
 }
 
 
@@ -809,10 +851,18 @@ void CommunicationTools::asyncPack( const std::map< string, string_array > & fie
                                     parallelDeviceEvents & events )
 {
   GEOSX_MARK_FUNCTION;
+  Stopwatch watch;
   for( NeighborCommunicator & neighbor : neighbors )
   {
     neighbor.packCommBufferForSync( fieldNames, mesh, icomm.commID(), onDevice, events );
   }
+
+  if( m_profiling )
+  {
+    SyncProfile step;
+    step.packTime = watch.elapsedTime();
+    recordProfile( fieldNames, step );
+  }
 }
 
 void CommunicationTools::asyncSendRecv( std::vector< NeighborCommunicator > & neighbors,
@@ -821,10 +871,13 @@ void CommunicationTools::asyncSendRecv( std::vector< NeighborCommunicator > & ne
                                         parallelDeviceEvents & events )
 {
   GEOSX_MARK_FUNCTION;
+  SyncProfile step;
+  Stopwatch watch;
   if( onDevice )
   {
     waitAllDeviceEvents( events );
   }
+  step.packTime = watch.elapsedTime();
 
   // could swap this to test and make this function call async as well, only launch the sends/recvs for
   // those we've already recv'd sizing for, go back to some usefule compute / launch some other compute, then
@@ -832,18 +885,30 @@ void CommunicationTools::asyncSendRecv( std::vector< NeighborCommunicator > & ne
   for( std::size_t count = 0; count < neighbors.size(); ++count )
   {
     int neighborIndex;
+    watch.zero();
     MpiWrapper::waitAny( icomm.size(),
                          icomm.mpiRecvBufferSizeRequest(),
                          &neighborIndex,
                          icomm.mpiRecvBufferSizeStatus() );
+    step.waitTime += watch.elapsedTime();
 
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
 
+    if( m_profiling )
+    {
+      step.neighbors[ neighbor.neighborRank() ].bytesReceived += neighbor.receiveBufferSize( icomm.commID() );
+    }
+
     neighbor.mpiISendReceiveBuffers( icomm.commID(),
                                      icomm.mpiSendBufferRequest( neighborIndex ),
                                      icomm.mpiRecvBufferRequest( neighborIndex ),
                                      MPI_COMM_GEOSX );
   }
+
+  if( m_profiling )
+  {
+    recordProfile( icomm.getFieldNames(), step );
+  }
 }
 
 void CommunicationTools::synchronizePackSendRecv( const std::map< string, string_array > & fieldNames,
@@ -876,11 +941,16 @@ bool CommunicationTools::asyncUnpack( MeshLevel & mesh,
                         &neighborIndices[0],
                         icomm.mpiRecvBufferStatus() );
 
+  Stopwatch watch;
   for( int recvIdx = 0; recvIdx < recvCount; ++recvIdx )
   {
     NeighborCommunicator & neighbor = neighbors[ neighborIndices[ recvIdx ] ];
     neighbor.unpackBufferForSync( icomm.getFieldNames(), mesh, icomm.commID(), onDevice, events );
   }
+  if( recvCount > 0 )
+  {
+    m_unpackTime += watch.elapsedTime();
+  }
 
   // we don't want to check if the request has completed,
   //  we want to check that we've processed the resulting buffer
@@ -907,14 +977,22 @@ void CommunicationTools::finalizeUnpack( MeshLevel & mesh,
                                          parallelDeviceEvents & events )
 {
   GEOSX_MARK_FUNCTION;
+  SyncProfile step;
+  Stopwatch watch;
+  m_unpackTime = 0.0;
 
   // poll mpi for completion then wait 10 nanoseconds 6,000,000,000 times (60 sec timeout)
   GEOSX_ASYNC_WAIT( 6000000000, 10, asyncUnpack( mesh, neighbors, icomm, onDevice, events ) );
+  step.waitTime = watch.elapsedTime() - m_unpackTime;
+
+  watch.zero();
   if( onDevice )
   {
     waitAllDeviceEvents( events );
   }
+  step.unpackTime = m_unpackTime + watch.elapsedTime();
 
+  watch.zero();
   MpiWrapper::waitAll( icomm.size(),
                        icomm.mpiSendBufferSizeRequest(),
                        icomm.mpiSendBufferSizeStatus() );
@@ -922,7 +1000,13 @@ void CommunicationTools::finalizeUnpack( MeshLevel & mesh,
   MpiWrapper::waitAll( icomm.size(),
                        icomm.mpiSendBufferRequest(),
                        icomm.mpiSendBufferStatus() );
+  step.waitTime += watch.elapsedTime();
 
+  if( m_profiling )
+  {
+    step.numCalls = 1;
+    recordProfile( icomm.getFieldNames(), step );
+  }
 }
 
 void CommunicationTools::synchronizeUnpack( MeshLevel & mesh,
@@ -948,4 +1032,266 @@ void CommunicationTools::synchronizeFields( const std::map< string, string_array
 }
 
 
+namespace
+{
+
+/// Name of the profile of all the messages posted by the neighbor communicators
+string const neighborMessagesProfileName = "all messages of the neighbor communicators";
+
+}
+
+void CommunicationTools::enableProfiling( string const & fileName )
+{
+  m_profiling = true;
+  m_profileFileName = fileName;
+
+  // Every rank holds this profile, even without neighbors, so that the profiles can be reduced
+  m_syncProfiles[ neighborMessagesProfileName ];
+}
+
+void CommunicationTools::recordNeighborMessage( int const neighborRank,
+                                                localIndex const bytesSent,
+                                                localIndex const bytesReceived )
+{
+  SyncProfile & profile = m_syncProfiles[ neighborMessagesProfileName ];
+  NeighborProfile & neighborProfile = profile.neighbors[ neighborRank ];
+  if( bytesSent > 0 )
+  {
+    profile.numCalls += 1;
+    neighborProfile.numMessages += 1;
+  }
+  neighborProfile.bytesSent += bytesSent;
+  neighborProfile.bytesReceived += bytesReceived;
+}
+
+void CommunicationTools::recordNeighborWait( real64 const waitTime )
+{
+  m_syncProfiles[ neighborMessagesProfileName ].waitTime += waitTime;
+}
+
+void CommunicationTools::recordProfile( std::map< string, string_array > const & fieldNames,
+                                        SyncProfile const & step )
+{
+  std::vector< string > fieldSets;
+  for( auto const & entry : fieldNames )
+  {
+    fieldSets.emplace_back( entry.first + ": " + stringutilities::join( entry.second, ", " ) );
+  }
+
+  addProfile( step, m_syncProfiles[ stringutilities::join( fieldSets, "; " ) ] );
+  addProfile( step, m_eventProfile );
+}
+
+void CommunicationTools::addProfile( SyncProfile const & step, SyncProfile & profile )
+{
+  profile.numCalls += step.numCalls;
+  profile.packTime += step.packTime;
+  profile.unpackTime += step.unpackTime;
+  profile.waitTime += step.waitTime;
+  for( auto const & entry : step.neighbors )
+  {
+    NeighborProfile & neighborProfile = profile.neighbors[ entry.first ];
+    neighborProfile.numMessages += entry.second.numMessages;
+    neighborProfile.bytesSent += entry.second.bytesSent;
+    neighborProfile.bytesReceived += entry.second.bytesReceived;
+  }
+}
+
+namespace
+{
+
+/// Number of values reduced across the ranks for each profile
+constexpr int numProfileValues = 6;
+
+/// Minimum, average and maximum across the ranks of the values of a profile
+using ProfileStats = std::array< std::array< real64, numProfileValues >, 3 >;
+
+/**
+ * @brief Reduce the statistics of several profiles across the ranks, in a single batch.
+ * @param values the values of the profiles (number of synchronizations, number of bytes sent, number of neighbors,
+ *               and times spent packing, unpacking and waiting), numProfileValues per profile
+ * @return the minimum, average and maximum of the values of each profile across the ranks
+ */
+std::vector< ProfileStats > reduceProfiles( std::vector< real64 > const & values )
+{
+  int const size = LvArray::integerConversion< int >( values.size() );
+  std::vector< real64 > min( size );
+  std::vector< real64 > sum( size );
+  std::vector< real64 > max( size );
+  MpiWrapper::allReduce( values.data(), min.data(), size, MPI_MIN, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( values.data(), sum.data(), size, MPI_SUM, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( values.data(), max.data(), size, MPI_MAX, MPI_COMM_GEOSX );
+
+  int const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  std::vector< ProfileStats > stats( values.size() / numProfileValues );
+  for( std::size_t i = 0; i < stats.size(); ++i )
+  {
+    for( int j = 0; j < numProfileValues; ++j )
+    {
+      std::size_t const k = numProfileValues * i + j;
+      stats[i][0][j] = min[k];
+      stats[i][1][j] = sum[k] / numRanks;
+      stats[i][2][j] = max[k];
+    }
+  }
+  return stats;
+}
+
+/**
+ * @brief Format the min / avg / max of a time across the ranks.
+ * @param stats the reduced statistics
+ * @param index the index of the time in @p stats
+ * @return the formatted times
+ */
+string formatTimes( ProfileStats const & stats, int const index )
+{
+  return GEOSX_FMT( "{:.3e} / {:.3e} / {:.3e} s", stats[0][index], stats[1][index], stats[2][index] );
+}
+
+}
+
+void CommunicationTools::logEventProfile( string const & eventName )
+{
+  if( !m_profiling )
+  {
+    return;
+  }
+
+  auto it = std::find_if( m_eventProfiles.begin(), m_eventProfiles.end(), [&]( std::pair< string, SyncProfile > const & entry )
+  {
+    return entry.first == eventName;
+  } );
+  if( it == m_eventProfiles.end() )
+  {
+    it = m_eventProfiles.emplace( m_eventProfiles.end(), eventName, SyncProfile() );
+  }
+
+  addProfile( m_eventProfile, it->second );
+  m_eventProfile = SyncProfile();
+}
+
+void CommunicationTools::reportProfile()
+{
+  if( !m_profiling )
+  {
+    return;
+  }
+
+  // The fields are synchronized collectively and the events are executed by all the ranks,
+  // hence every rank must hold the same events and sets of fields, in the same order, to reduce them together
+  string profileNames;
+  for( auto const & entry : m_eventProfiles )
+  {
+    profileNames += entry.first + '\n';
+  }
+  profileNames += '\n';
+  for( auto const & entry : m_syncProfiles )
+  {
+    profileNames += entry.first + '\n';
+  }
+  long long const namesHash = static_cast< long long >( std::hash< string >{}( profileNames ) );
+  GEOSX_ERROR_IF( MpiWrapper::min( namesHash ) != MpiWrapper::max( namesHash ),
+                  "The ranks have not synchronized the same sets of fields in the same events, cannot report the communication profile." );
+
+  // Reduce the statistics of all the events and sets of fields at once
+  std::vector< real64 > values;
+  auto const appendValues = [&]( SyncProfile const & profile )
+  {
+    localIndex bytesSent = 0;
+    for( auto const & neighbor : profile.neighbors )
+    {
+      bytesSent += neighbor.second.bytesSent;
+    }
+    values.insert( values.end(), { real64( profile.numCalls ), real64( bytesSent ), real64( profile.neighbors.size() ),
+                                   profile.packTime, profile.unpackTime, profile.waitTime } );
+  };
+  for( auto const & entry : m_eventProfiles )
+  {
+    appendValues( entry.second );
+  }
+  for( auto const & entry : m_syncProfiles )
+  {
+    appendValues( entry.second );
+  }
+  std::vector< ProfileStats > const allStats = reduceProfiles( values );
+
+  GEOSX_LOG_RANK_0( "Communication profile of the events (min / avg / max across ranks):" );
+  for( std::size_t i = 0; i < m_eventProfiles.size(); ++i )
+  {
+    ProfileStats const & stats = allStats[i];
+    if( stats[2][0] > 0 )
+    {
+      GEOSX_LOG_RANK_0( GEOSX_FMT( "  {}: {} calls, {} sent, wait {}, pack {}, unpack {}",
+                                   m_eventProfiles[i].first, stats[2][0],
+                                   LvArray::system::calculateSize( stats[1][1] * MpiWrapper::commSize( MPI_COMM_GEOSX ) ),
+                                   formatTimes( stats, 5 ), formatTimes( stats, 3 ), formatTimes( stats, 4 ) ) );
+    }
+  }
+
+  GEOSX_LOG_RANK_0( "Communication profile of the field synchronizations (min / avg / max across ranks):" );
+
+  // Per-neighbor statistics: set of fields, rank, neighbor rank, messages, bytes sent, bytes received
+  int const numColumns = 6;
+  std::vector< long long > rows;
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  int profileIndex = 0;
+  for( auto const & entry : m_syncProfiles )
+  {
+    for( auto const & neighbor : entry.second.neighbors )
+    {
+      rows.insert( rows.end(), { profileIndex, rank, neighbor.first, neighbor.second.numMessages,
+                                 neighbor.second.bytesSent, neighbor.second.bytesReceived } );
+    }
+
+    ProfileStats const & stats = allStats[ m_eventProfiles.size() + profileIndex ];
+    ++profileIndex;
+    GEOSX_LOG_RANK_0( GEOSX_FMT( "  {}\n"
+                                 "    calls: {}, neighbors: {} / {} / {}, sent per rank: {} / {} / {}\n"
+                                 "    pack {}, unpack {}, wait {}",
+                                 entry.first, stats[2][0], stats[0][2], stats[1][2], stats[2][2],
+                                 LvArray::system::calculateSize( stats[0][1] ),
+                                 LvArray::system::calculateSize( stats[1][1] ),
+                                 LvArray::system::calculateSize( stats[2][1] ),
+                                 formatTimes( stats, 3 ), formatTimes( stats, 4 ), formatTimes( stats, 5 ) ) );
+  }
+
+  if( m_profileFileName.empty() )
+  {
+    return;
+  }
+
+  int const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  int const numValues = LvArray::integerConversion< int >( rows.size() );
+  std::vector< int > counts( numRanks );
+  MpiWrapper::gather( &numValues, 1, counts.data(), 1, 0, MPI_COMM_GEOSX );
+
+  std::vector< int > offsets( numRanks + 1, 0 );
+  std::partial_sum( counts.begin(), counts.end(), offsets.begin() + 1 );
+  std::vector< long long > allRows( rank == 0 ? offsets.back() : 0 );
+  MpiWrapper::gatherv( rows.data(), numValues, allRows.data(), counts.data(), offsets.data(), 0, MPI_COMM_GEOSX );
+
+  if( rank == 0 )
+  {
+    std::vector< string > fieldSets;
+    for( auto const & entry : m_syncProfiles )
+    {
+      fieldSets.emplace_back( entry.first );
+    }
+
+    std::ofstream os( m_profileFileName );
+    GEOSX_WARNING_IF( !os, "Could not open " << m_profileFileName << " to write the communication profile" );
+    os << "fields,rank,neighbor,messages,bytesSent,bytesReceived\n";
+    for( std::size_t i = 0; i < allRows.size(); i += numColumns )
+    {
+      os << '"' << fieldSets[ LvArray::integerConversion< std::size_t >( allRows[i] ) ] << '"';
+      for( int j = 1; j < numColumns; ++j )
+      {
+        os << ',' << allRows[i + j];
+      }
+      os << '\n';
+    }
+    GEOSX_LOG_RANK_0( "Communication profile of each neighbor written to " << m_profileFileName );
+  }
+}
+
 } /* namespace geosx */
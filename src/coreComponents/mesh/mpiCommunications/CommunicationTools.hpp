@@ -25,6 +25,7 @@
 #include "common/DataTypes.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
 
+#include <map>
 #include <set>
 
 namespace geosx
@@ -56,6 +57,14 @@ public:
   void assignNewGlobalIndices( ObjectManagerBase & object,
                                std::set< localIndex > const & indexList );
 
+  /**
+   * @brief Assign global indices to the new objects of several managers, with a single gather of the counts.
+   * @param objects the managers
+   * @param indexLists the local indices of the new objects of each manager, in the order of @p objects
+   */
+  void assignNewGlobalIndices( std::vector< ObjectManagerBase * > const & objects,
+                               std::vector< std::set< localIndex > const * > const & indexLists );
+
   void assignNewGlobalIndices( ElementRegionManager & elementManager,
                                std::map< std::pair< localIndex, localIndex >, std::set< localIndex > > const & newElems );
 
@@ -115,10 +124,113 @@ public:
                        bool onDevice,
                        parallelDeviceEvents & events );
 
+  /**
+   * @brief Enable the profiling of the field synchronizations.
+   * @param fileName the CSV file in which reportProfile() writes the statistics of each neighbor
+   */
+  void enableProfiling( string const & fileName );
+
+  /**
+   * @brief Add the statistics of the synchronizations since the previous call to the profile of an event.
+   * @param eventName the name of the event that triggered the synchronizations
+   * @note This is a local operation, the profiles of the events are reduced across the ranks by reportProfile().
+   */
+  void logEventProfile( string const & eventName );
+
+  /**
+   * @brief Log the statistics of the synchronizations of the whole run for each event and each set of fields,
+   *        and write the statistics of each neighbor.
+   * @note This is a collective operation, which does nothing if the profiling is disabled.
+   */
+  void reportProfile();
+
+  /**
+   * @brief @return true iff the communications are profiled
+   */
+  bool isProfiling() const { return m_profiling; }
+
+  /**
+   * @brief Add the bytes posted by a NeighborCommunicator to the profile of all the neighbor messages.
+   * @param neighborRank the rank of the neighbor
+   * @param bytesSent the number of bytes sent to the neighbor
+   * @param bytesReceived the number of bytes received from the neighbor
+   * @note A message is counted for each non-empty send. This profile holds every message of the neighbor communicators,
+   *       including those of the field synchronizations, hence it is not added to the profile of the current event.
+   */
+  void recordNeighborMessage( int const neighborRank,
+                              localIndex const bytesSent,
+                              localIndex const bytesReceived );
+
+  /**
+   * @brief Add the time spent by a NeighborCommunicator waiting for its messages to the profile of all the neighbor messages.
+   * @param waitTime the time spent waiting
+   */
+  void recordNeighborWait( real64 const waitTime );
+
 private:
+
+  /// Messages exchanged with one neighbor
+  struct NeighborProfile
+  {
+    /// Number of messages sent
+    localIndex numMessages = 0;
+    /// Number of bytes sent
+    localIndex bytesSent = 0;
+    /// Number of bytes received
+    localIndex bytesReceived = 0;
+  };
+
+  /// Statistics of the synchronizations of a set of fields
+  struct SyncProfile
+  {
+    /// Number of synchronizations
+    localIndex numCalls = 0;
+    /// Time spent packing the send buffers
+    real64 packTime = 0.0;
+    /// Time spent unpacking the receive buffers
+    real64 unpackTime = 0.0;
+    /// Time spent waiting for the messages
+    real64 waitTime = 0.0;
+    /// Messages exchanged with each neighbor rank
+    std::map< int, NeighborProfile > neighbors;
+  };
+
+  /**
+   * @brief Add the statistics of one step of a synchronization to the profile of its fields and of the current event.
+   * @param fieldNames the names of the synchronized fields
+   * @param step the statistics of the step
+   */
+  void recordProfile( std::map< string, string_array > const & fieldNames,
+                      SyncProfile const & step );
+
+  /**
+   * @brief Add the statistics of a synchronization step to a profile.
+   * @param step the statistics of the step
+   * @param profile the profile to add to
+   */
+  static void addProfile( SyncProfile const & step, SyncProfile & profile );
+
   std::set< int > m_freeCommIDs;
   static CommunicationTools * m_instance;
 
+  /// True iff the field synchronizations are profiled
+  bool m_profiling;
+
+  /// File in which the statistics of each neighbor are written
+  string m_profileFileName;
+
+  /// Statistics of the whole run, for each set of synchronized fields
+  std::map< string, SyncProfile > m_syncProfiles;
+
+  /// Statistics of all the synchronizations since the last call to logEventProfile()
+  SyncProfile m_eventProfile;
+
+  /// Statistics of the whole run, for each event that triggered synchronizations, in order of first execution
+  std::vector< std::pair< string, SyncProfile > > m_eventProfiles;
+
+  /// Time spent unpacking by asyncUnpack() during the current call to finalizeUnpack()
+  real64 m_unpackTime;
+
 
 };
 
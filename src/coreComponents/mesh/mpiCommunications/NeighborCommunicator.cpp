@@ -18,8 +18,10 @@
  */
 
 #include "NeighborCommunicator.hpp"
+#include "CommunicationTools.hpp"
 #include "MPI_iCommData.hpp"
 
+#include "common/Stopwatch.hpp"
 #include "common/TimingMacros.hpp"
 #include "mesh/ObjectManagerBase.hpp"
 #include "mesh/MeshLevel.hpp"
@@ -29,6 +31,26 @@ namespace geosx
 
 using namespace dataRepository;
 
+namespace
+{
+
+/**
+ * @brief Add the bytes of a message posted to a neighbor to the communication profile, if enabled.
+ * @param neighborRank the rank of the neighbor
+ * @param bytesSent the number of bytes sent to the neighbor
+ * @param bytesReceived the number of bytes received from the neighbor
+ */
+void recordMessage( int const neighborRank, localIndex const bytesSent, localIndex const bytesReceived )
+{
+  CommunicationTools & commTools = CommunicationTools::getInstance();
+  if( commTools.isProfiling() )
+  {
+    commTools.recordNeighborMessage( neighborRank, bytesSent, bytesReceived );
+  }
+}
+
+}
+
 NeighborCommunicator::NeighborCommunicator( int rank ):
   m_neighborRank( rank ),
   m_sendBufferSize(),
@@ -63,6 +85,8 @@ void NeighborCommunicator::mpiISendReceive( buffer_unit_type const * const sendB
                      receiveTag,
                      mpiComm,
                      &receiveRequest );
+
+  recordMessage( m_neighborRank, sendSize, receiveSize );
 }
 
 
@@ -105,8 +129,15 @@ void NeighborCommunicator::mpiWaitAll( int const GEOSX_UNUSED_PARAM( commID ),
                                        MPI_Status & mpiReceiveStatus )
 
 {
+  Stopwatch watch;
   MpiWrapper::waitAll( 1, &mpiRecvRequest, &mpiReceiveStatus );
   MpiWrapper::waitAll( 1, &mpiSendRequest, &mpiSendStatus );
+
+  CommunicationTools & commTools = CommunicationTools::getInstance();
+  if( commTools.isProfiling() )
+  {
+    commTools.recordNeighborWait( watch.elapsedTime() );
+  }
 }
 
 void NeighborCommunicator::clear()
@@ -134,24 +165,30 @@ int NeighborCommunicator::postSizeRecv( int const commID,
                                         MPI_Request & mpiRecvSizeRequest )
 {
   int const recvTag = 101; //CommTag( m_neighborRank, MpiWrapper::commRank(), commID );
-  return MpiWrapper::iRecv( &m_receiveBufferSize[commID],
-                            1,
-                            m_neighborRank,
-                            recvTag,
-                            MPI_COMM_GEOSX,
-                            &mpiRecvSizeRequest );
+  int const err = MpiWrapper::iRecv( &m_receiveBufferSize[commID],
+                                     1,
+                                     m_neighborRank,
+                                     recvTag,
+                                     MPI_COMM_GEOSX,
+                                     &mpiRecvSizeRequest );
+
+  recordMessage( m_neighborRank, 0, static_cast< localIndex >( sizeof( int ) ) );
+  return err;
 }
 
 int NeighborCommunicator::postSizeSend( int const commID,
                                         MPI_Request & mpiSendSizeRequest )
 {
   int const sendTag = 101; //CommTag( m_neighborRank, MpiWrapper::commRank(), commID );
-  return MpiWrapper::iSend( &m_sendBufferSize[commID],
-                            1,
-                            m_neighborRank,
-                            sendTag,
-                            MPI_COMM_GEOSX,
-                            &mpiSendSizeRequest );
+  int const err = MpiWrapper::iSend( &m_sendBufferSize[commID],
+                                     1,
+                                     m_neighborRank,
+                                     sendTag,
+                                     MPI_COMM_GEOSX,
+                                     &mpiSendSizeRequest );
+
+  recordMessage( m_neighborRank, static_cast< localIndex >( sizeof( int ) ), 0 );
+  return err;
 }
 
 int NeighborCommunicator::postRecv( int const commID,
@@ -159,24 +196,30 @@ int NeighborCommunicator::postRecv( int const commID,
 {
   int const recvTag = 102; //CommTag( m_neighborRank, MpiWrapper::commRank(), commID );
   m_receiveBuffer[commID].resize( m_receiveBufferSize[commID] );
-  return MpiWrapper::iRecv( m_receiveBuffer[commID].data(),
-                            m_receiveBufferSize[commID],
-                            m_neighborRank,
-                            recvTag,
-                            MPI_COMM_GEOSX,
-                            &mpRecvRequest );
+  int const err = MpiWrapper::iRecv( m_receiveBuffer[commID].data(),
+                                     m_receiveBufferSize[commID],
+                                     m_neighborRank,
+                                     recvTag,
+                                     MPI_COMM_GEOSX,
+                                     &mpRecvRequest );
+
+  recordMessage( m_neighborRank, 0, m_receiveBufferSize[commID] );
+  return err;
 }
 
 int NeighborCommunicator::postSend( int const commID,
                                     MPI_Request & mpiSendRequest )
 {
   int const sendTag = 102; //CommTag( m_neighborRank, MpiWrapper::commRank(), commID );
-  return MpiWrapper::iSend( m_sendBuffer[commID].data(),
-                            m_sendBufferSize[commID],
-                            m_neighborRank,
-                            sendTag,
-                            MPI_COMM_GEOSX,
-                            &mpiSendRequest );
+  int const err = MpiWrapper::iSend( m_sendBuffer[commID].data(),
+                                     m_sendBufferSize[commID],
+                                     m_neighborRank,
+                                     sendTag,
+                                     MPI_COMM_GEOSX,
+                                     &mpiSendRequest );
+
+  recordMessage( m_neighborRank, m_sendBufferSize[commID], 0 );
+  return err;
 }
 
 using ElemAdjListViewType = ElementRegionManager::ElementViewAccessor< arrayView1d< localIndex > >;
@@ -106,6 +106,16 @@ int SpatialPartition::getColor()
   return color;
 }
 
+void SpatialPartition::setPartitionLocations( int const dim,
+                                              arrayView1d< real64 const > const & locations )
+{
+  m_PartitionLocations[dim].resize( locations.size() );
+  for( localIndex i = 0; i < locations.size(); ++i )
+  {
+    m_PartitionLocations[dim][i] = locations[i];
+  }
+}
+
 void SpatialPartition::addNeighbors( const unsigned int idim,
                                      MPI_Comm & cartcomm,
                                      int * ncoords )
@@ -45,6 +45,15 @@ public:
 
   int getColor() override;
 
+  /**
+   * @brief Set the locations of the partition boundaries along a direction, instead of an even spacing.
+   * @param dim the direction
+   * @param locations the coordinates of the (number of partitions - 1) boundaries, in increasing order
+   * @note Must be called before setSizes().
+   */
+  void setPartitionLocations( int const dim,
+                              arrayView1d< real64 const > const & locations );
+
   /// number of partitions
   array1d< int > m_Partitions;
   /**
@@ -99,6 +99,49 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Maximum number of time sub-steps allowed for the solver" );
 
+  registerWrapper( viewKeysStruct::timeStepControlString, &m_timeStepControl ).
+    setApplyDefaultValue( TimeStepControl::NewtonIterations ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Rule used to select the next time step: NewtonIterations (double or halve the time step based on dtIncIterLimit and dtCutIterLimit), "
+                    "IterationTarget (PID controller on the numbers of Newton and linear iterations), "
+                    "or StateChange (PID controller also on the largest pressure, phase volume fraction and component fraction changes)" );
+
+  registerWrapper( viewKeysStruct::targetNewtonIterationsString, &m_targetNewtonIterations ).
+    setApplyDefaultValue( 0.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of Newton iterations per time step targeted by the time step controller. "
+                    "If not positive, the middle of the range between dtIncIterLimit and dtCutIterLimit is targeted." );
+
+  registerWrapper( viewKeysStruct::targetLinearIterationsString, &m_targetLinearIterations ).
+    setApplyDefaultValue( 0.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Average number of linear iterations per Newton iteration targeted by the time step controller. "
+                    "The linear iterations are not controlled if not positive." );
+
+  registerWrapper( viewKeysStruct::maxTimeStepIncreaseString, &m_maxTimeStepIncrease ).
+    setApplyDefaultValue( 2.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum ratio between two successive time steps chosen by the time step controller." );
+
+  registerWrapper( viewKeysStruct::targetRelativePressureChangeString, &m_targetRelativePressureChange ).
+    setApplyDefaultValue( 0.2 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Largest relative pressure change per time step targeted by the StateChange time step control." );
+
+  registerWrapper( viewKeysStruct::targetPhaseVolFractionChangeString, &m_targetPhaseVolFractionChange ).
+    setApplyDefaultValue( 0.2 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Largest phase volume fraction change per time step targeted by the StateChange time step control." );
+
+  registerWrapper( viewKeysStruct::targetCompFractionChangeString, &m_targetCompFractionChange ).
+    setApplyDefaultValue( 0.1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Largest component fraction change per time step targeted by the StateChange time step control." );
+
+  registerWrapper( viewKeysStruct::numLinearIterationsString, &m_numLinearIterations ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Number of linear iterations of the Newton iterations of the last time step." );
+
 
 
 }
@@ -109,6 +152,13 @@ void NonlinearSolverParameters::postProcessInput()
   {
     GEOSX_ERROR( " dtIncIterLimit should be smaller than dtCutIterLimit!!" );
   }
+
+  GEOSX_THROW_IF_LT_MSG( m_maxTimeStepIncrease, 1.0,
+                         getName() << ": " << viewKeysStruct::maxTimeStepIncreaseString << " should be at least 1",
+                         InputError );
+  GEOSX_THROW_IF( m_targetRelativePressureChange <= 0.0 || m_targetPhaseVolFractionChange <= 0.0 || m_targetCompFractionChange <= 0.0,
+                  getName() << ": the target changes of the StateChange time step control should be positive",
+                  InputError );
 }
 
 
@@ -83,6 +83,15 @@ public:
     static constexpr auto minNumNewtonIterationsString  = "minNumberOfNewtonIterations";
     static constexpr auto timeStepCutFactorString       = "timestepCutFactor";
 
+    static constexpr auto timeStepControlString         = "timeStepControl";
+    static constexpr auto targetNewtonIterationsString  = "targetNewtonIterations";
+    static constexpr auto targetLinearIterationsString  = "targetLinearIterations";
+    static constexpr auto maxTimeStepIncreaseString     = "maxTimeStepIncrease";
+    static constexpr auto targetRelativePressureChangeString = "targetRelativePressureChange";
+    static constexpr auto targetPhaseVolFractionChangeString = "targetPhaseVolFractionChange";
+    static constexpr auto targetCompFractionChangeString     = "targetCompFractionChange";
+    static constexpr auto numLinearIterationsString     = "linearNumberOfIterations";
+
   } viewKeys;
 
 
@@ -93,7 +102,18 @@ public:
    */
   integer dtCutIterLimit() const
   {
-    return std::ceil( m_dtCutIterLimit * m_maxIterNewton );
+    return dtCutIterLimit( m_maxIterNewton );
+  }
+
+  /**
+   * @brief Calculates the upper limit for the number of iterations to allow a
+   * cut to the next timestep, for another maximum number of iterations.
+   * @param maxIterations the maximum number of iterations of a time step
+   * @return The scaled value of the limit (m_dtCutIterLimit * maxIterations)
+   */
+  integer dtCutIterLimit( integer const maxIterations ) const
+  {
+    return std::ceil( m_dtCutIterLimit * maxIterations );
   }
 
 
@@ -104,9 +124,49 @@ public:
    */
   integer dtIncIterLimit() const
   {
-    return std::ceil( m_dtIncIterLimit * m_maxIterNewton );
+    return dtIncIterLimit( m_maxIterNewton );
   }
 
+  /**
+   * @brief Calculates the lower limit for the number of iterations to force an
+   * increase to the next timestep, for another maximum number of iterations.
+   * @param maxIterations the maximum number of iterations of a time step
+   * @return The scaled value of the limit (m_dtIncIterLimit * maxIterations)
+   */
+  integer dtIncIterLimit( integer const maxIterations ) const
+  {
+    return std::ceil( m_dtIncIterLimit * maxIterations );
+  }
+
+  /**
+   * @brief Calculates the number of Newton iterations targeted by the time step controller.
+   * @return The target given in the input, or the middle of the range between dtIncIterLimit() and dtCutIterLimit()
+   */
+  real64 targetNewtonIterations() const
+  {
+    return targetNewtonIterations( m_maxIterNewton );
+  }
+
+  /**
+   * @brief Calculates the number of iterations targeted by the time step controller, for another maximum number of iterations.
+   * @param maxIterations the maximum number of iterations of a time step
+   * @return The target given in the input, or the middle of the range between dtIncIterLimit() and dtCutIterLimit()
+   */
+  real64 targetNewtonIterations( integer const maxIterations ) const
+  {
+    return m_targetNewtonIterations > 0 ? m_targetNewtonIterations : 0.5 * ( dtIncIterLimit( maxIterations ) + dtCutIterLimit( maxIterations ) );
+  }
+
+  /**
+   * @brief Indicates the rule used to select the size of the next time step.
+   */
+  enum class TimeStepControl : integer
+  {
+    NewtonIterations, ///< Double or halve the time step based on the number of Newton iterations.
+    IterationTarget,  ///< Drive the numbers of Newton and linear iterations towards their targets with a PID controller.
+    StateChange,      ///< Also drive the largest changes of the primary variables per step towards their targets.
+  };
+
   /**
    * @brief Indicates the handling of line search in a Newton loop.
    */
@@ -159,8 +219,37 @@ public:
   /// number of times that the time-step had to be cut
   integer m_numdtAttempts;
 
+  /// The rule used to select the size of the next time step
+  TimeStepControl m_timeStepControl;
+
+  /// Number of Newton iterations per time step targeted by the time step controller
+  real64 m_targetNewtonIterations;
+
+  /// Number of linear iterations per Newton iteration targeted by the time step controller
+  real64 m_targetLinearIterations;
+
+  /// Maximum ratio between two successive time steps chosen by the time step controller
+  real64 m_maxTimeStepIncrease;
+
+  /// Largest relative pressure change per time step targeted by the time step controller
+  real64 m_targetRelativePressureChange;
+
+  /// Largest phase volume fraction change per time step targeted by the time step controller
+  real64 m_targetPhaseVolFractionChange;
+
+  /// Largest component fraction change per time step targeted by the time step controller
+  real64 m_targetCompFractionChange;
+
+  /// The number of linear iterations of the nonlinear iterations that have been executed
+  integer m_numLinearIterations;
+
 };
 
+ENUM_STRINGS( NonlinearSolverParameters::TimeStepControl,
+              "NewtonIterations",
+              "IterationTarget",
+              "StateChange" );
+
 ENUM_STRINGS( NonlinearSolverParameters::LineSearchAction,
               "None",
               "Attempt",
@@ -38,7 +38,9 @@ SolverBase::SolverBase( string const & name,
   m_nextDt( 1e99 ),
   m_dofManager( name ),
   m_linearSolverParameters( groupKeyStruct::linearSolverParametersString(), this ),
-  m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString(), this )
+  m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString(), this ),
+  m_numRealizations( 1 ),
+  m_timeStepControlErrors{ { 1.0, 1.0, 1.0 } }
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -92,6 +94,23 @@ SolverBase::SolverBase( string const & name,
 
 SolverBase::~SolverBase() = default;
 
+void SolverBase::postProcessInput()
+{
+  ExecutableGroup::postProcessInput();
+
+  GEOSX_THROW_IF( m_nonlinearSolverParameters.m_timeStepControl == NonlinearSolverParameters::TimeStepControl::StateChange &&
+                  !hasStateChangeRatio(),
+                  GEOSX_FMT( "{}: the StateChange time step control is not supported by this solver", getName() ),
+                  InputError );
+}
+
+void SolverBase::initializePostInitialConditionsPostSubGroups()
+{
+  ExecutableGroup::initializePostInitialConditionsPostSubGroups();
+
+  // Do not carry the history of the time step controller over a restart or an ensemble realization
+  m_timeStepControlErrors = { { 1.0, 1.0, 1.0 } };
+}
 
 void SolverBase::initialize_postMeshGeneration()
 {
@@ -206,6 +225,11 @@ bool SolverBase::execute( real64 const time_n,
      * */
     dtRemaining -= dtAccepted;
 
+    if( m_nonlinearSolverParameters.m_timeStepControl != NonlinearSolverParameters::TimeStepControl::NewtonIterations )
+    {
+      updateTimeStepControlErrors( domain );
+    }
+
     if( dtRemaining > 0.0 )
     {
       setNextDt( dtAccepted, nextDt );
@@ -229,15 +253,22 @@ bool SolverBase::execute( real64 const time_n,
 void SolverBase::setNextDt( real64 const & currentDt,
                             real64 & nextDt )
 {
-  setNextDtBasedOnNewtonIter( currentDt, nextDt );
+  if( m_nonlinearSolverParameters.m_timeStepControl == NonlinearSolverParameters::TimeStepControl::NewtonIterations )
+  {
+    setNextDtBasedOnNewtonIter( currentDt, nextDt );
+  }
+  else
+  {
+    setNextDtBasedOnTargets( currentDt, nextDt );
+  }
 }
 
 void SolverBase::setNextDtBasedOnNewtonIter( real64 const & currentDt,
                                              real64 & nextDt )
 {
-  integer & newtonIter = m_nonlinearSolverParameters.m_numNewtonIterations;
-  integer const iterCutLimit = m_nonlinearSolverParameters.dtCutIterLimit();
-  integer const iterIncLimit = m_nonlinearSolverParameters.dtIncIterLimit();
+  integer const newtonIter = numTimeStepControlIterations();
+  integer const iterCutLimit = m_nonlinearSolverParameters.dtCutIterLimit( maxTimeStepControlIterations() );
+  integer const iterIncLimit = m_nonlinearSolverParameters.dtIncIterLimit( maxTimeStepControlIterations() );
 
   if( newtonIter < iterIncLimit )
   {
@@ -259,6 +290,60 @@ void SolverBase::setNextDtBasedOnNewtonIter( real64 const & currentDt,
   }
 }
 
+void SolverBase::updateTimeStepControlErrors( DomainPartition & domain )
+{
+  NonlinearSolverParameters const & params = m_nonlinearSolverParameters;
+
+  // Number of Newton iterations relative to the target
+  real64 error = numTimeStepControlIterations() / params.targetNewtonIterations( maxTimeStepControlIterations() );
+
+  // Average number of linear iterations per Newton iteration relative to the target
+  if( params.m_targetLinearIterations > 0.0 )
+  {
+    real64 const numLinearIterations = real64( params.m_numLinearIterations ) / std::max( params.m_numNewtonIterations, 1 );
+    error = std::max( error, numLinearIterations / params.m_targetLinearIterations );
+  }
+
+  // Largest change of the state relative to the targets
+  if( params.m_timeStepControl == NonlinearSolverParameters::TimeStepControl::StateChange )
+  {
+    error = std::max( error, computeStateChangeRatio( domain, params ) );
+  }
+
+  recordTimeStepControlError( error );
+}
+
+void SolverBase::recordTimeStepControlError( real64 const error )
+{
+  m_timeStepControlErrors[2] = m_timeStepControlErrors[1];
+  m_timeStepControlErrors[1] = m_timeStepControlErrors[0];
+  // Bound the error away from zero, as the controller divides by it
+  m_timeStepControlErrors[0] = std::max( error, 0.01 );
+}
+
+void SolverBase::setNextDtBasedOnTargets( real64 const & currentDt,
+                                          real64 & nextDt )
+{
+  // Gains of the PID controller (Valli, Carey and Coutinho, 2005)
+  real64 constexpr kP = 0.075;
+  real64 constexpr kI = 0.175;
+  real64 constexpr kD = 0.01;
+
+  real64 const e0 = m_timeStepControlErrors[0];
+  real64 const e1 = m_timeStepControlErrors[1];
+  real64 const e2 = m_timeStepControlErrors[2];
+
+  real64 factor = std::pow( e1 / e0, kP ) * std::pow( 1.0 / e0, kI ) * std::pow( e1 * e1 / ( e0 * e2 ), kD );
+
+  // Do not increase the time step right after a time step cut
+  real64 const maxFactor = m_nonlinearSolverParameters.m_numdtAttempts > 0 ? 1.0 : m_nonlinearSolverParameters.m_maxTimeStepIncrease;
+  factor = std::min( std::max( factor, m_nonlinearSolverParameters.m_timeStepCutFactor ), maxFactor );
+
+  nextDt = currentDt * factor;
+  GEOSX_LOG_LEVEL_RANK_0( 1, GEOSX_FMT( "{}: time step error with respect to the targets = {:.3f}, time step required will be multiplied by {:.3f}.",
+                                        getName(), e0, factor ) );
+}
+
 real64 SolverBase::linearImplicitStep( real64 const & time_n,
                                        real64 const & dt,
                                        integer const GEOSX_UNUSED_PARAM( cycleNumber ),
@@ -495,6 +580,7 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
     {
       resetStateToBeginningOfStep( domain );
     }
+    m_nonlinearSolverParameters.m_numLinearIterations = 0;
 
     // keep residual from previous iteration in case we need to do a line search
     real64 lastResidual = 1e99;
@@ -615,6 +701,7 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
 
       // Solve the linear system
       solveSystem( m_dofManager, m_matrix, m_rhs, m_solution );
+      m_nonlinearSolverParameters.m_numLinearIterations += m_linearSolverResult.numIterations;
 
       // Output the linear system solution for debugging purposes
       debugOutputSolution( time_n, cycleNumber, newtonIter, m_solution );
@@ -838,7 +925,17 @@ void SolverBase::solveSystem( DofManager const & dofManager,
   LinearSolverParameters const & params = m_linearSolverParameters.get();
   matrix.setDofManager( &dofManager );
 
-  if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
+  if( params.solverType == LinearSolverParameters::SolverType::direct )
+  {
+    if( !m_directSolver )
+    {
+      m_directSolver = LAInterface::createSolver( params );
+    }
+    m_directSolver->setup( matrix );
+    m_directSolver->solve( rhs, solution );
+    m_linearSolverResult = m_directSolver->result();
+  }
+  else if( !m_precond )
   {
     std::unique_ptr< LinearSolverBase< LAInterface > > solver = LAInterface::createSolver( params );
     solver->setup( matrix );
@@ -903,6 +1000,12 @@ void SolverBase::implicitStepComplete( real64 const & GEOSX_UNUSED_PARAM( time )
   GEOSX_ERROR( "SolverBase::ImplicitStepComplete called!. Should be overridden." );
 }
 
+void SolverBase::storeRealizationState( DomainPartition & GEOSX_UNUSED_PARAM( domain ),
+                                        integer const GEOSX_UNUSED_PARAM( realization ) )
+{
+  GEOSX_ERROR( GEOSX_FMT( "{}: the solver cannot advance the realizations of an ensemble together", getName() ) );
+}
+
 R1Tensor const SolverBase::gravityVector() const
 {
   R1Tensor rval;
@@ -27,6 +27,7 @@
 #include "physicsSolvers/LinearSolverParameters.hpp"
 
 
+#include <array>
 #include <limits>
 
 namespace geosx
@@ -150,6 +151,73 @@ public:
   void setNextDtBasedOnNewtonIter( real64 const & currentDt,
                                    real64 & nextDt );
 
+  /**
+   * @brief Set the next time step with a PID controller on the errors of the last time steps
+   *        with respect to the targets of the nonlinear solver parameters.
+   * @param [in] currentDt the current time step
+   * @param [out] nextDt the next time step
+   */
+  void setNextDtBasedOnTargets( real64 const & currentDt,
+                                real64 & nextDt );
+
+  /**
+   * @brief Compute the largest change of the state over the last time step, relative to its target.
+   * @param domain the domain partition
+   * @param params the nonlinear solver parameters holding the targets
+   * @return the largest ratio between a change of the state and its target over all the ranks,
+   *         used by the StateChange time step control
+   */
+  virtual real64 computeStateChangeRatio( DomainPartition const & domain,
+                                          NonlinearSolverParameters const & params ) const
+  {
+    GEOSX_UNUSED_VAR( domain, params );
+    return 0.0;
+  }
+
+  /**
+   * @brief Check whether the solver implements computeStateChangeRatio.
+   * @return true if the solver supports the StateChange time step control
+   */
+  virtual bool hasStateChangeRatio() const { return false; }
+
+  /**
+   * @brief Get the number of iterations of the last time step, on which the time step control is based.
+   * @return the number of Newton iterations, unless the solver iterates otherwise (e.g. sequential coupling)
+   */
+  virtual integer numTimeStepControlIterations() const { return m_nonlinearSolverParameters.m_numNewtonIterations; }
+
+  /**
+   * @brief Get the maximum number of iterations of a time step, which scales the limits of the time step control.
+   * @return the maximum number of Newton iterations, unless the solver iterates otherwise (e.g. sequential coupling)
+   */
+  virtual integer maxTimeStepControlIterations() const { return m_nonlinearSolverParameters.m_maxIterNewton; }
+
+  /**
+   * @brief Check whether the solver can advance all the realizations of an ensemble run together.
+   * @return true if the solver holds one set of state fields per realization and steps them all in a single call
+   */
+  virtual bool supportsEnsemble() const { return false; }
+
+  /**
+   * @brief Set the number of realizations advanced together by the solver.
+   * @param numRealizations the number of realizations, 1 outside of a batched ensemble run
+   * @note Must be called before the data of the solver is registered on the mesh.
+   */
+  void setNumRealizations( integer const numRealizations ) { m_numRealizations = numRealizations; }
+
+  /**
+   * @brief Get the number of realizations advanced together by the solver.
+   * @return the number of realizations, 1 outside of a batched ensemble run
+   */
+  integer numRealizations() const { return m_numRealizations; }
+
+  /**
+   * @brief Copy the initial state of a realization, set up in the regular fields of the solver, into its ensemble fields.
+   * @param domain the domain partition
+   * @param realization the index of the realization
+   */
+  virtual void storeRealizationState( DomainPartition & domain,
+                                      integer const realization );
 
   /**
    * @brief Entry function for an explicit time integration step
@@ -650,6 +718,16 @@ protected:
    */
   virtual void setConstitutiveNamesCallSuper( ElementSubRegionBase & subRegion ) const { GEOSX_UNUSED_VAR( subRegion ); }
 
+  virtual void postProcessInput() override;
+
+  virtual void initializePostInitialConditionsPostSubGroups() override;
+
+  /**
+   * @brief Record the error of the last time step with respect to the targets of the time step controller.
+   * @param error the largest ratio between the Newton/linear iterations or the state change and their targets
+   */
+  void recordTimeStepControlError( real64 const error );
+
   template< typename BASETYPE = constitutive::ConstitutiveBase, typename LOOKUP_TYPE >
   static BASETYPE const & getConstitutiveModel( dataRepository::Group const & dataGroup, LOOKUP_TYPE const & key );
 
@@ -677,6 +755,9 @@ protected:
   /// Custom preconditioner for the "native" iterative solver
   std::unique_ptr< PreconditionerBase< LAInterface > > m_precond;
 
+  /// Direct solver, kept across the solves to reuse the factorization data depending only on the sparsity pattern
+  std::unique_ptr< LinearSolverBase< LAInterface > > m_directSolver;
+
   /// Linear solver parameters
   LinearSolverParametersInput m_linearSolverParameters;
 
@@ -693,6 +774,9 @@ protected:
   /// List of names of regions the solver will be applied to
   array1d< string > m_targetRegionNames;
 
+  /// Number of realizations advanced together in a batched ensemble run
+  integer m_numRealizations;
+
 private:
 
   /**
@@ -703,6 +787,15 @@ private:
    */
   virtual void setConstitutiveNames( ElementSubRegionBase & subRegion ) const { GEOSX_UNUSED_VAR( subRegion ); }
 
+  /**
+   * @brief Record the error of the last time step with respect to the targets of the time step controller.
+   * @param domain the domain partition
+   */
+  void updateTimeStepControlErrors( DomainPartition & domain );
+
+  /// Errors of the last three time steps with respect to the targets of the time step controller, most recent first
+  std::array< real64, 3 > m_timeStepControlErrors;
+
 
 };
 
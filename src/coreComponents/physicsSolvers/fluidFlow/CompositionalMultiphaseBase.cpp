@@ -1710,4 +1710,69 @@ void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
   } );
 }
 
+real64 CompositionalMultiphaseBase::computeStateChangeRatio( DomainPartition const & domain,
+                                                             NonlinearSolverParameters const & params ) const
+{
+  integer const numComp = m_numComponents;
+  integer const numPhase = m_numPhases;
+
+  RAJA::ReduceMax< parallelDeviceReduce, real64 > maxPhaseVolFracChange( 0.0 );
+  RAJA::ReduceMax< parallelDeviceReduce, real64 > maxCompFracChange( 0.0 );
+
+  forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                               MeshLevel const & mesh,
+                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase const & subRegion )
+    {
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+
+      arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::phaseVolumeFraction >();
+      arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFracOld =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::phaseVolumeFractionOld >();
+      arrayView2d< real64 const, compflow::USD_COMP > const compDens =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompDensity >();
+      arrayView2d< real64 const, compflow::USD_COMP > const dCompDens =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaGlobalCompDensity >();
+
+      // at the end of the time step, the component densities have been incremented with the accumulated Newton updates
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        if( ghostRank[ei] >= 0 )
+        {
+          return;
+        }
+
+        for( integer ip = 0; ip < numPhase; ++ip )
+        {
+          maxPhaseVolFracChange.max( LvArray::math::abs( phaseVolFrac[ei][ip] - phaseVolFracOld[ei][ip] ) );
+        }
+
+        real64 totalDens = 0.0;
+        real64 totalDensOld = 0.0;
+        for( integer ic = 0; ic < numComp; ++ic )
+        {
+          totalDens += compDens[ei][ic];
+          totalDensOld += compDens[ei][ic] - dCompDens[ei][ic];
+        }
+        totalDens = LvArray::math::max( totalDens, minDensForDivision );
+        totalDensOld = LvArray::math::max( totalDensOld, minDensForDivision );
+        for( integer ic = 0; ic < numComp; ++ic )
+        {
+          real64 const compFrac = compDens[ei][ic] / totalDens;
+          real64 const compFracOld = ( compDens[ei][ic] - dCompDens[ei][ic] ) / totalDensOld;
+          maxCompFracChange.max( LvArray::math::abs( compFrac - compFracOld ) );
+        }
+      } );
+    } );
+  } );
+
+  real64 const ratio = std::max( MpiWrapper::max( maxPhaseVolFracChange.get() ) / params.m_targetPhaseVolFractionChange,
+                                 MpiWrapper::max( maxCompFracChange.get() ) / params.m_targetCompFractionChange );
+  return std::max( ratio, FlowSolverBase::computeStateChangeRatio( domain, params ) );
+}
+
 } // namespace geosx
@@ -307,6 +307,14 @@ public:
    */
   void chopNegativeDensities( DomainPartition & domain );
 
+  /**
+   * @brief Compute the largest relative pressure, phase volume fraction and component fraction changes
+   *        over the last time step, relative to their targets.
+   * @copydoc SolverBase::computeStateChangeRatio
+   */
+  virtual real64 computeStateChangeRatio( DomainPartition const & domain,
+                                          NonlinearSolverParameters const & params ) const override;
+
   virtual void initializePostInitialConditionsPreSubGroups() override;
 
 protected:
@@ -323,7 +331,6 @@ protected:
 
   virtual void initializePreSubGroups() override;
 
-
   /**
    * @brief Initialize the aquifer boundary condition (gravity vector, water phase index)
    * @param[in] cm reference to the global constitutive model manager
@@ -302,9 +302,9 @@ public:
     arraySlice1d< real64 const, compflow::USD_COMP - 1 > const dCompDens = m_dCompDens[ei];
     arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > const dCompFrac_dCompDens = m_dCompFrac_dCompDens[ei];
     arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const phaseDens = m_phaseDens[ei][0];
-    arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const dPhaseDens = m_dPhaseDens[ei][0];
+    arraySlice2d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC - 2 > const dPhaseDens = m_dPhaseDens[ei][0];
     arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const phaseFrac = m_phaseFrac[ei][0];
-    arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const dPhaseFrac = m_dPhaseFrac[ei][0];
+    arraySlice2d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC - 2 > const dPhaseFrac = m_dPhaseFrac[ei][0];
     arraySlice1d< real64, compflow::USD_PHASE - 1 > const phaseVolFrac = m_phaseVolFrac[ei];
     arraySlice1d< real64, compflow::USD_PHASE - 1 > const dPhaseVolFrac_dPres = m_dPhaseVolFrac_dPres[ei];
     arraySlice2d< real64, compflow::USD_PHASE_DC - 1 > const dPhaseVolFrac_dComp = m_dPhaseVolFrac_dComp[ei];
@@ -387,11 +387,11 @@ protected:
 
   /// Views on phase fractions
   arrayView3d< real64 const, multifluid::USD_PHASE > m_phaseFrac;
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > m_dPhaseFrac;
+  arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > m_dPhaseFrac;
 
   /// Views on phase densities
   arrayView3d< real64 const, multifluid::USD_PHASE > m_phaseDens;
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > m_dPhaseDens;
+  arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > m_dPhaseDens;
 
 };
 
@@ -743,11 +743,11 @@ public:
 
     arraySlice1d< real64 const, compflow::USD_PHASE - 1 > phaseDensOld = m_phaseDensOld[ei];
     arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > phaseDens = m_phaseDens[ei][0];
-    arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > dPhaseDens = m_dPhaseDens[ei][0];
+    arraySlice2d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC - 2 > dPhaseDens = m_dPhaseDens[ei][0];
 
     arraySlice2d< real64 const, compflow::USD_PHASE_COMP-1 > phaseCompFracOld = m_phaseCompFracOld[ei];
     arraySlice2d< real64 const, multifluid::USD_PHASE_COMP-2 > phaseCompFrac = m_phaseCompFrac[ei][0];
-    arraySlice3d< real64 const, multifluid::USD_PHASE_COMP_DC-2 > dPhaseCompFrac = m_dPhaseCompFrac[ei][0];
+    arraySlice3d< multifluid::DerivativeType const, multifluid::USD_PHASE_COMP_DC-2 > dPhaseCompFrac = m_dPhaseCompFrac[ei][0];
 
     // temporary work arrays
     real64 dPhaseAmount_dC[numComp]{};
@@ -942,12 +942,12 @@ protected:
   /// Views on the phase densities
   arrayView2d< real64 const, compflow::USD_PHASE > const m_phaseDensOld;
   arrayView3d< real64 const, multifluid::USD_PHASE > const m_phaseDens;
-  arrayView4d< real64 const, multifluid::USD_PHASE_DC > const m_dPhaseDens;
+  arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > const m_dPhaseDens;
 
   /// Views on the phase component fraction
   arrayView3d< real64 const, compflow::USD_PHASE_COMP > const m_phaseCompFracOld;
   arrayView4d< real64 const, multifluid::USD_PHASE_COMP > const m_phaseCompFrac;
-  arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > const m_dPhaseCompFrac;
+  arrayView5d< multifluid::DerivativeType const, multifluid::USD_PHASE_COMP_DC > const m_dPhaseCompFrac;
 
   /// View on the local CRS matrix
   CRSMatrixView< real64, globalIndex const > const m_localMatrix;
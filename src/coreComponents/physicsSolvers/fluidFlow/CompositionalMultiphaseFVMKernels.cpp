@@ -483,12 +483,12 @@ AquiferBCKernel::
            real64 const & aquiferWaterPhaseDens,
            arrayView1d< real64 const > const & aquiferWaterPhaseCompFrac,
            arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > phaseDens,
-           arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > dPhaseDens,
+           arraySlice2d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC - 2 > dPhaseDens,
            arraySlice1d< real64 const, compflow::USD_PHASE - 1 > phaseVolFrac,
            arraySlice1d< real64 const, compflow::USD_PHASE - 1 > dPhaseVolFrac_dPres,
            arraySlice2d< real64 const, compflow::USD_PHASE_DC - 1 > dPhaseVolFrac_dCompDens,
            arraySlice2d< real64 const, multifluid::USD_PHASE_COMP - 2 > phaseCompFrac,
-           arraySlice3d< real64 const, multifluid::USD_PHASE_COMP_DC - 2 > dPhaseCompFrac,
+           arraySlice3d< multifluid::DerivativeType const, multifluid::USD_PHASE_COMP_DC - 2 > dPhaseCompFrac,
            arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > dCompFrac_dCompDens,
            real64 const & dt,
            real64 (& localFlux)[NC],
@@ -573,9 +573,9 @@ AquiferBCKernel::
           ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dPhaseVolFrac_dCompDens,
           ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens,
           ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseDens,
-          ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens,
+          ElementViewConst< arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > > const & dPhaseDens,
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_COMP > > const & phaseCompFrac,
-          ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac,
+          ElementViewConst< arrayView5d< multifluid::DerivativeType const, multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac,
           real64 const & timeAtBeginningOfStep,
           real64 const & dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
@@ -688,9 +688,9 @@ AquiferBCKernel::
                   ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dPhaseVolFrac_dCompDens, \
                   ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens, \
                   ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseDens, \
-                  ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens, \
+                  ElementViewConst< arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > > const & dPhaseDens, \
                   ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_COMP > > const & phaseCompFrac, \
-                  ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac, \
+                  ElementViewConst< arrayView5d< multifluid::DerivativeType const, multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac, \
                   real64 const & timeAtBeginningOfStep, \
                   real64 const & dt, \
                   CRSMatrixView< real64, globalIndex const > const & localMatrix, \
@@ -82,6 +82,20 @@ void CompositionalMultiphaseHybridFVM::registerDataOnMesh( Group & meshBodies )
     // auxiliary data for the buoyancy coefficient
     faceManager.registerExtrinsicData< extrinsicMeshData::flow::mimGravityCoefficient >( getName() );
   } );
+
+  // 3) Register the cached transmissibility matrices
+  forMeshTargets( meshBodies, [&] ( string const &,
+                                    MeshLevel & mesh,
+                                    arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             CellElementSubRegion & subRegion )
+    {
+      subRegion.registerExtrinsicData< extrinsicMeshData::flow::transMatrix >( getName() );
+      subRegion.registerExtrinsicData< extrinsicMeshData::flow::transMatrixGravity >( getName() );
+    } );
+  } );
 }
 
 void CompositionalMultiphaseHybridFVM::initializePreSubGroups()
@@ -202,6 +216,13 @@ void CompositionalMultiphaseHybridFVM::precomputeData( MeshLevel & mesh, arrayVi
 
   real64 const lengthTolerance = m_lengthTolerance;
 
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  HybridMimeticDiscretization const & hmDiscretization = fvManager.getHybridMimeticDiscretization( m_discretizationName );
+  MimeticInnerProductBase const & mimeticInnerProductBase =
+    hmDiscretization.getReference< MimeticInnerProductBase >( HybridMimeticDiscretization::viewKeyStruct::innerProductString() );
+
   mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                         CellElementSubRegion & subRegion )
   {
@@ -236,6 +257,47 @@ void CompositionalMultiphaseHybridFVM::precomputeData( MeshLevel & mesh, arrayVi
                                                                            mimFaceGravCoefDenominator.toView(),
                                                                            mimFaceGravCoef );
 
+    // here we cache the transmissibility matrices used in the FluxKernel
+    // they are used as long as the permeability is constant, otherwise the FluxKernel recomputes them at each iteration
+    localIndex const numFacesPerElement = subRegion.numFacesPerElement();
+    array3d< real64 > & transMatrix =
+      subRegion.getReference< array3d< real64 > >( extrinsicMeshData::flow::transMatrix::key() );
+    array3d< real64 > & transMatrixGrav =
+      subRegion.getReference< array3d< real64 > >( extrinsicMeshData::flow::transMatrixGravity::key() );
+    transMatrix.resizeDimension< 1, 2 >( numFacesPerElement, numFacesPerElement );
+    transMatrixGrav.resizeDimension< 1, 2 >( numFacesPerElement, numFacesPerElement );
+
+    mimeticInnerProductReducedDispatch( mimeticInnerProductBase,
+                                        [&] ( auto const mimeticInnerProduct )
+    {
+      using IP_TYPE = TYPEOFREF( mimeticInnerProduct );
+      singlePhaseHybridFVMKernels::KernelLaunchSelector< IP_TYPE,
+                                                         hybridFVMKernels::TransMatrixKernel >( numFacesPerElement,
+                                                                                                subRegion.size(),
+                                                                                                nodePosition,
+                                                                                                transMultiplier,
+                                                                                                faceToNodes,
+                                                                                                elemToFaces,
+                                                                                                elemCenter,
+                                                                                                elemVolume,
+                                                                                                elemPerm,
+                                                                                                lengthTolerance,
+                                                                                                transMatrix.toView() );
+    } );
+
+    // the gravity term is always treated with TPFA (see above)
+    singlePhaseHybridFVMKernels::KernelLaunchSelector< mimeticInnerProduct::TPFAInnerProduct,
+                                                       hybridFVMKernels::TransMatrixKernel >( numFacesPerElement,
+                                                                                              subRegion.size(),
+                                                                                              nodePosition,
+                                                                                              transMultiplier,
+                                                                                              faceToNodes,
+                                                                                              elemToFaces,
+                                                                                              elemCenter,
+                                                                                              elemVolume,
+                                                                                              elemPerm,
+                                                                                              lengthTolerance,
+                                                                                              transMatrixGrav.toView() );
   } );
 
 }
@@ -373,13 +435,13 @@ void CompositionalMultiphaseHybridFVM::assembleFluxTerms( real64 const dt,
       string const fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
       MultiFluidBase const & fluid = getConstitutiveModel< MultiFluidBase >( subRegion, fluidName );
       arrayView4d< real64 const, multifluid::USD_PHASE_COMP > const & phaseCompFrac = fluid.phaseCompFraction();
-      arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > const & dPhaseCompFrac = fluid.dPhaseCompFraction();
+      arrayView5d< multifluid::DerivativeType const, multifluid::USD_PHASE_COMP_DC > const & dPhaseCompFrac = fluid.dPhaseCompFraction();
 
       arrayView3d< real64 const, multifluid::USD_PHASE > const & phaseMassDens = fluid.phaseMassDensity();
-      arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dPhaseMassDens = fluid.dPhaseMassDensity();
+      arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > const & dPhaseMassDens = fluid.dPhaseMassDensity();
 
       arrayView3d< real64 const, multifluid::USD_PHASE > const & phaseDens = fluid.phaseDensity();
-      arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dPhaseDens = fluid.dPhaseDensity();
+      arrayView4d< multifluid::DerivativeType const, multifluid::USD_PHASE_DC > const & dPhaseDens = fluid.dPhaseDensity();
 
       forAll< parallelDevicePolicy<> >( subRegion.size(),
                                         [phaseCompFrac, dPhaseCompFrac,
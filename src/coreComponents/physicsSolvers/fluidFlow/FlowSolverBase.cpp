@@ -53,6 +53,23 @@ void execute1( POROUSWRAPPER_TYPE porousWrapper,
   } );
 }
 
+template< typename POROUSWRAPPER_TYPE >
+void executeFixedStress( POROUSWRAPPER_TYPE porousWrapper,
+                         CellElementSubRegion & subRegion,
+                         arrayView1d< real64 const > const & pressure,
+                         arrayView1d< real64 const > const & deltaPressure )
+{
+  forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_DEVICE ( localIndex const k )
+  {
+    for( localIndex q = 0; q < porousWrapper.numGauss(); ++q )
+    {
+      porousWrapper.updateStateFromPressureFixedStress( k, q,
+                                                        pressure[k],
+                                                        deltaPressure[k] );
+    }
+  } );
+}
+
 template< typename POROUSWRAPPER_TYPE >
 void execute2( POROUSWRAPPER_TYPE porousWrapper,
                SurfaceElementSubRegion & subRegion,
@@ -78,6 +95,7 @@ FlowSolverBase::FlowSolverBase( string const & name,
                                 Group * const parent ):
   SolverBase( name, parent ),
   m_poroElasticFlag( 0 ),
+  m_fixedStressPoromechanicsFlag( 0 ),
   m_coupledWellsFlag( 0 ),
   m_numDofPerCell( 0 ),
   m_fluxEstimate()
@@ -276,12 +294,24 @@ void FlowSolverBase::updatePorosityAndPermeability( CellElementSubRegion & subRe
   string const & solidName = subRegion.getReference< string >( viewKeyStruct::solidNamesString() );
   CoupledSolidBase & porousSolid = subRegion.template getConstitutiveModel< CoupledSolidBase >( solidName );
 
-  constitutive::ConstitutivePassThru< CoupledSolidBase >::execute( porousSolid, [=, &subRegion] ( auto & castedPorousSolid )
+  if( m_fixedStressPoromechanicsFlag )
   {
-    typename TYPEOFREF( castedPorousSolid ) ::KernelWrapper porousWrapper = castedPorousSolid.createKernelUpdates();
+    constitutive::ConstitutivePassThru< PorousSolidBase >::execute( porousSolid, [=, &subRegion] ( auto & castedPorousSolid )
+    {
+      typename TYPEOFREF( castedPorousSolid ) ::KernelWrapper porousWrapper = castedPorousSolid.createKernelUpdates();
 
-    execute1( porousWrapper, subRegion, pressure, deltaPressure );
-  } );
+      executeFixedStress( porousWrapper, subRegion, pressure, deltaPressure );
+    } );
+  }
+  else
+  {
+    constitutive::ConstitutivePassThru< CoupledSolidBase >::execute( porousSolid, [=, &subRegion] ( auto & castedPorousSolid )
+    {
+      typename TYPEOFREF( castedPorousSolid ) ::KernelWrapper porousWrapper = castedPorousSolid.createKernelUpdates();
+
+      execute1( porousWrapper, subRegion, pressure, deltaPressure );
+    } );
+  }
 }
 
 void FlowSolverBase::updatePorosityAndPermeability( SurfaceElementSubRegion & subRegion ) const
@@ -463,4 +493,37 @@ void FlowSolverBase::saveAquiferConvergedState( real64 const & time,
 }
 
 
+real64 FlowSolverBase::computeStateChangeRatio( DomainPartition const & domain,
+                                                NonlinearSolverParameters const & params ) const
+{
+  RAJA::ReduceMax< parallelDeviceReduce, real64 > maxRelativePresChange( 0.0 );
+
+  forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                               MeshLevel const & mesh,
+                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase const & subRegion )
+    {
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+      arrayView1d< real64 const > const pres = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+      arrayView1d< real64 const > const dPres = subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaPressure >();
+
+      // at the end of the time step, the pressure has been incremented with the accumulated Newton updates
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        if( ghostRank[ei] < 0 )
+        {
+          real64 const presOld = LvArray::math::abs( pres[ei] - dPres[ei] );
+          maxRelativePresChange.max( LvArray::math::abs( dPres[ei] ) / LvArray::math::max( presOld, LvArray::NumericLimits< real64 >::epsilon ) );
+        }
+      } );
+    } );
+  } );
+
+  return MpiWrapper::max( maxRelativePresChange.get() ) / params.m_targetRelativePressureChange;
+}
+
+
 } // namespace geosx
@@ -61,6 +61,12 @@ public:
 
   void setPoroElasticCoupling() { m_poroElasticFlag = 1; }
 
+  /**
+   * @brief Make this solver the flow step of a fixed-stress split, in which the porosity
+   *        is updated with the mean total stress of the last mechanics solve held fixed.
+   */
+  void setFixedStressPoromechanicsUpdate() { m_fixedStressPoromechanicsFlag = 1; }
+
   void setReservoirWellsCoupling() { m_coupledWellsFlag = 1; }
 
   localIndex numDofPerCell() const { return m_numDofPerCell; }
@@ -97,6 +103,14 @@ public:
                                                arrayView1d< real64 > const & maxElevation,
                                                arrayView1d< real64 > const & minElevation ) const;
 
+  /**
+   * @brief Compute the largest relative pressure change over the last time step, relative to its target.
+   * @copydoc SolverBase::computeStateChangeRatio
+   */
+  virtual real64 computeStateChangeRatio( DomainPartition const & domain,
+                                          NonlinearSolverParameters const & params ) const override;
+
+  virtual bool hasStateChangeRatio() const override { return true; }
 
 protected:
 
@@ -125,6 +139,9 @@ protected:
   /// flag to determine whether or not coupled with solid solver
   integer m_poroElasticFlag;
 
+  /// flag to determine whether or not this solver is the flow step of a fixed-stress split
+  integer m_fixedStressPoromechanicsFlag;
+
   /// flag to determine whether or not coupled with wells
   integer m_coupledWellsFlag;
 
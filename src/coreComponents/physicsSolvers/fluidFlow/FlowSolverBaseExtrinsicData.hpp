@@ -112,6 +112,22 @@ EXTRINSIC_MESH_DATA_TRAIT( mimGravityCoefficient,
                            WRITE_AND_READ,
                            "Mimetic gravity coefficient" );
 
+EXTRINSIC_MESH_DATA_TRAIT( transMatrix,
+                           "transMatrix",
+                           array3d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Transmissibility matrix of the mimetic inner product in each element" );
+
+EXTRINSIC_MESH_DATA_TRAIT( transMatrixGravity,
+                           "transMatrixGravity",
+                           array3d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "TPFA transmissibility matrix used for the gravity term in each element" );
+
 }
 
 }
@@ -34,20 +34,30 @@ namespace fluxKernelsHelper
 template< typename VIEWTYPE >
 using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
 
+/**
+ * @brief Compute the single-phase flux through a two-point connection from the values of the two cells.
+ * @param[in] transmissibility the transmissibilities of the connection
+ * @param[in] dTrans_dPres the derivatives of the transmissibilities with respect to pressure
+ * @param[in] pres the pressures of the two cells, including their increments
+ * @param[in] gravCoef the gravity coefficients of the two cells
+ * @param[in] dens the densities of the two cells
+ * @param[in] dDens_dPres the derivatives of the densities with respect to pressure
+ * @param[in] mob the mobilities of the two cells
+ * @param[in] dMob_dPres the derivatives of the mobilities with respect to pressure
+ * @param[out] fluxVal the flux
+ * @param[out] dFlux_dP the derivatives of the flux with respect to the pressures of the two cells
+ * @param[out] dFlux_dTrans the derivative of the flux with respect to the transmissibility
+ */
 GEOSX_HOST_DEVICE
 GEOSX_FORCE_INLINE
-void computeSinglePhaseFlux( localIndex const ( &seri )[2],
-                             localIndex const ( &sesri )[2],
-                             localIndex const ( &sei )[2],
-                             real64 const ( &transmissibility )[2],
+void computeSinglePhaseFlux( real64 const ( &transmissibility )[2],
                              real64 const ( &dTrans_dPres )[2],
-                             ElementViewConst< arrayView1d< real64 const > > const & pres,
-                             ElementViewConst< arrayView1d< real64 const > > const & dPres,
-                             ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
-                             ElementViewConst< arrayView2d< real64 const > > const & dens,
-                             ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
-                             ElementViewConst< arrayView1d< real64 const > > const & mob,
-                             ElementViewConst< arrayView1d< real64 const > > const & dMob_dPres,
+                             real64 const ( &pres )[2],
+                             real64 const ( &gravCoef )[2],
+                             real64 const ( &dens )[2],
+                             real64 const ( &dDens_dPres )[2],
+                             real64 const ( &mob )[2],
+                             real64 const ( &dMob_dPres )[2],
                              real64 & fluxVal,
                              real64 ( & dFlux_dP )[2],
                              real64 & dFlux_dTrans )
@@ -58,8 +68,8 @@ void computeSinglePhaseFlux( localIndex const ( &seri )[2],
 
   for( localIndex ke = 0; ke < 2; ++ke )
   {
-    densMean        += 0.5 * dens[seri[ke]][sesri[ke]][sei[ke]][0];
-    dDensMean_dP[ke] = 0.5 * dDens_dPres[seri[ke]][sesri[ke]][sei[ke]][0];
+    densMean        += 0.5 * dens[ke];
+    dDensMean_dP[ke] = 0.5 * dDens_dPres[ke];
   }
 
   // compute potential difference
@@ -71,12 +81,8 @@ void computeSinglePhaseFlux( localIndex const ( &seri )[2],
 
   for( localIndex ke = 0; ke < 2; ++ke )
   {
-    localIndex const er  = seri[ke];
-    localIndex const esr = sesri[ke];
-    localIndex const ei  = sei[ke];
-
-    real64 const pressure = pres[er][esr][ei] + dPres[er][esr][ei];
-    real64 const gravD = gravCoef[er][esr][ei];
+    real64 const pressure = pres[ke];
+    real64 const gravD = gravCoef[ke];
     real64 const pot = transmissibility[ke] * ( pressure - densMean * gravD );
 
     potDif += pot;
@@ -99,8 +105,8 @@ void computeSinglePhaseFlux( localIndex const ( &seri )[2],
   {
     // happy path: single upwind direction
     localIndex const ke = 1 - localIndex( fmax( fmin( alpha, 1.0 ), 0.0 ) );
-    mobility = mob[seri[ke]][sesri[ke]][sei[ke]];
-    dMobility_dP[ke] = dMob_dPres[seri[ke]][sesri[ke]][sei[ke]];
+    mobility = mob[ke];
+    dMobility_dP[ke] = dMob_dPres[ke];
   }
   else
   {
@@ -108,8 +114,8 @@ void computeSinglePhaseFlux( localIndex const ( &seri )[2],
     real64 const mobWeights[2] = { alpha, 1.0 - alpha };
     for( localIndex ke = 0; ke < 2; ++ke )
     {
-      mobility += mobWeights[ke] * mob[seri[ke]][sesri[ke]][sei[ke]];
-      dMobility_dP[ke] = mobWeights[ke] * dMob_dPres[seri[ke]][sesri[ke]][sei[ke]];
+      mobility += mobWeights[ke] * mob[ke];
+      dMobility_dP[ke] = mobWeights[ke] * dMob_dPres[ke];
     }
   }
 
@@ -125,6 +131,52 @@ void computeSinglePhaseFlux( localIndex const ( &seri )[2],
   }
 }
 
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void computeSinglePhaseFlux( localIndex const ( &seri )[2],
+                             localIndex const ( &sesri )[2],
+                             localIndex const ( &sei )[2],
+                             real64 const ( &transmissibility )[2],
+                             real64 const ( &dTrans_dPres )[2],
+                             ElementViewConst< arrayView1d< real64 const > > const & pres,
+                             ElementViewConst< arrayView1d< real64 const > > const & dPres,
+                             ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
+                             ElementViewConst< arrayView2d< real64 const > > const & dens,
+                             ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+                             ElementViewConst< arrayView1d< real64 const > > const & mob,
+                             ElementViewConst< arrayView1d< real64 const > > const & dMob_dPres,
+                             real64 & fluxVal,
+                             real64 ( & dFlux_dP )[2],
+                             real64 & dFlux_dTrans )
+{
+  real64 cellPres[2];
+  real64 cellGravCoef[2];
+  real64 cellDens[2];
+  real64 cellDDens_dPres[2];
+  real64 cellMob[2];
+  real64 cellDMob_dPres[2];
+
+  for( localIndex ke = 0; ke < 2; ++ke )
+  {
+    localIndex const er  = seri[ke];
+    localIndex const esr = sesri[ke];
+    localIndex const ei  = sei[ke];
+
+    cellPres[ke] = pres[er][esr][ei] + dPres[er][esr][ei];
+    cellGravCoef[ke] = gravCoef[er][esr][ei];
+    cellDens[ke] = dens[er][esr][ei][0];
+    cellDDens_dPres[ke] = dDens_dPres[er][esr][ei][0];
+    cellMob[ke] = mob[er][esr][ei];
+    cellDMob_dPres[ke] = dMob_dPres[er][esr][ei];
+  }
+
+  computeSinglePhaseFlux( transmissibility, dTrans_dPres,
+                          cellPres, cellGravCoef,
+                          cellDens, cellDDens_dPres,
+                          cellMob, cellDMob_dPres,
+                          fluxVal, dFlux_dP, dFlux_dTrans );
+}
+
 /******************************** AquiferBCKernel ********************************/
 
 /**
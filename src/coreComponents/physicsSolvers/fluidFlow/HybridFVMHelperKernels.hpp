@@ -85,6 +85,57 @@ struct CellConnectivity
 
 };
 
+/******************************** TransMatrixKernel ********************************/
+
+struct TransMatrixKernel
+{
+
+  /**
+   * @brief Compute and store the transmissibility matrix of each element of a subRegion
+   * @tparam IP_TYPE the type of inner product used to compute the transmissibility matrices
+   * @tparam NF the number of faces per element
+   * @param[in] subRegionSize the number of elements in the subRegion
+   * @param[in] nodePosition position of the nodes
+   * @param[in] transMultiplier the transmissibility multiplier at the mesh faces
+   * @param[in] faceToNodes map from face to nodes
+   * @param[in] elemToFaces the map from one-sided face to face
+   * @param[in] elemCenter the center of the elements
+   * @param[in] elemVolume the volume of the elements
+   * @param[in] elemPerm the permeability of the elements
+   * @param[in] lengthTolerance tolerance used in the transmissibility matrix computation
+   * @param[out] transMatrix the transmissibility matrix of each element (size: subRegionSize x NF x NF)
+   */
+  template< typename IP_TYPE, localIndex NF >
+  static void
+  launch( localIndex const subRegionSize,
+          arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+          arrayView1d< real64 const > const & transMultiplier,
+          ArrayOfArraysView< localIndex const > const & faceToNodes,
+          arrayView2d< localIndex const > const & elemToFaces,
+          arrayView2d< real64 const > const & elemCenter,
+          arrayView1d< real64 const > const & elemVolume,
+          arrayView3d< real64 const > const & elemPerm,
+          real64 const & lengthTolerance,
+          arrayView3d< real64 > const & transMatrix )
+  {
+    forAll< parallelDevicePolicy<> >( subRegionSize, [=] GEOSX_DEVICE ( localIndex const ei )
+    {
+      real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+      IP_TYPE::template compute< NF >( nodePosition,
+                                       transMultiplier,
+                                       faceToNodes,
+                                       elemToFaces[ei],
+                                       elemCenter[ei],
+                                       elemVolume[ei],
+                                       perm,
+                                       lengthTolerance,
+                                       transMatrix[ei] );
+    } );
+  }
+
+};
+
 
 } // namespace hybridFVMUpwindingKernels
 
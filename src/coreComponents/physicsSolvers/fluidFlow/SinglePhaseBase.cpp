@@ -26,6 +26,7 @@
 #include "constitutive/fluid/singleFluidSelector.hpp"
 #include "constitutive/permeability/PermeabilityExtrinsicData.hpp"
 #include "constitutive/solid/CoupledSolidBase.hpp"
+#include "constitutive/solid/porosity/PressurePorosity.hpp"
 #include "fieldSpecification/AquiferBoundaryCondition.hpp"
 #include "fieldSpecification/EquilibriumInitialCondition.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
@@ -82,7 +83,31 @@ void SinglePhaseBase::registerDataOnMesh( Group & meshBodies )
 
       subRegion.registerExtrinsicData< densityOld >( getName() );
 
-
+      if( m_numRealizations > 1 )
+      {
+        subRegion.registerExtrinsicData< ensemblePressure >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensembleDeltaPressure >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensembleReferencePorosity >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensemblePorosity >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensembleDPorosity_dPressure >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensemblePorosityOld >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensembleDensity >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensembleDDensity_dPressure >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensembleDensityOld >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensembleMobility >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+        subRegion.registerExtrinsicData< ensembleDMobility_dPressure >( getName() ).
+          reference().resizeDimension< 1 >( m_numRealizations );
+      }
     } );
 
     FaceManager & faceManager = mesh.getFaceManager();
@@ -200,6 +225,38 @@ void SinglePhaseBase::updateMobility( ObjectManagerBase & dataGroup ) const
                                                                             dMob_dPres );
 }
 
+void SinglePhaseBase::updateEnsembleState( CellElementSubRegion & subRegion ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  using namespace extrinsicMeshData::flow;
+
+  SingleFluidBase & fluid =
+    getConstitutiveModel< SingleFluidBase >( subRegion, subRegion.getReference< string >( viewKeyStruct::fluidNamesString() ) );
+  CoupledSolidBase const & porousSolid =
+    getConstitutiveModel< CoupledSolidBase >( subRegion, subRegion.getReference< string >( viewKeyStruct::solidNamesString() ) );
+  PressurePorosity const & porosityModel =
+    getConstitutiveModel< PressurePorosity >( subRegion, porousSolid.getReference< string >( CoupledSolidBase::viewKeyStruct::porosityModelNameString() ) );
+  PressurePorosity::KernelWrapper const porosityWrapper = porosityModel.createKernelUpdates();
+
+  constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    EnsembleStateUpdateKernel::launch( subRegion.size(),
+                                       fluidWrapper,
+                                       porosityWrapper,
+                                       subRegion.getExtrinsicData< ensemblePressure >(),
+                                       subRegion.getExtrinsicData< ensembleDeltaPressure >(),
+                                       subRegion.getExtrinsicData< ensembleReferencePorosity >(),
+                                       subRegion.getExtrinsicData< ensemblePorosity >(),
+                                       subRegion.getExtrinsicData< ensembleDPorosity_dPressure >(),
+                                       subRegion.getExtrinsicData< ensembleDensity >(),
+                                       subRegion.getExtrinsicData< ensembleDDensity_dPressure >(),
+                                       subRegion.getExtrinsicData< ensembleMobility >(),
+                                       subRegion.getExtrinsicData< ensembleDMobility_dPressure >() );
+  } );
+}
+
 void SinglePhaseBase::initializePostInitialConditionsPreSubGroups()
 {
   GEOSX_MARK_FUNCTION;
@@ -522,7 +579,30 @@ void SinglePhaseBase::implicitStepSetup( real64 const & GEOSX_UNUSED_PARAM( time
 
     backupFields( mesh, regionNames );
 
+    if( m_numRealizations > 1 )
+    {
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                           CellElementSubRegion & subRegion )
+      {
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::ensembleDeltaPressure >().zero();
+        updateEnsembleState( subRegion );
+
+        // save the state at the beginning of the step, as backupFields and saveConvergedState do for the regular fields
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::ensembleDensityOld >().
+          setValues< parallelDevicePolicy<> >( subRegion.getExtrinsicData< extrinsicMeshData::flow::ensembleDensity >() );
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::ensemblePorosityOld >().
+          setValues< parallelDevicePolicy<> >( subRegion.getExtrinsicData< extrinsicMeshData::flow::ensemblePorosity >() );
+      } );
+    }
   } );
+
+  if( m_numRealizations > 1 )
+  {
+    localIndex const numRows = m_localMatrix.numRows();
+    m_ensembleJacobian.resize( m_localMatrix.getOffsets()[numRows], m_numRealizations );
+    m_ensembleRhs.resize( numRows, m_numRealizations );
+    m_ensembleSolution.resize( numRows, m_numRealizations );
+  }
 }
 
 void SinglePhaseBase::implicitStepComplete( real64 const & time,
@@ -539,6 +619,34 @@ void SinglePhaseBase::implicitStepComplete( real64 const & time,
                                                MeshLevel & mesh,
                                                arrayView1d< string const > const & regionNames )
   {
+    if( m_numRealizations > 1 )
+    {
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                           CellElementSubRegion & subRegion )
+      {
+        arrayView2d< real64 const > const ensDPres = subRegion.getExtrinsicData< extrinsicMeshData::flow::ensembleDeltaPressure >();
+        arrayView2d< real64 > const ensPres = subRegion.getExtrinsicData< extrinsicMeshData::flow::ensemblePressure >();
+
+        arrayView1d< real64 > const pres = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+        arrayView1d< real64 > const dPres = subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaPressure >();
+
+        forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+        {
+          for( localIndex r = 0; r < ensPres.size( 1 ); ++r )
+          {
+            ensPres[ei][r] += ensDPres[ei][r];
+          }
+
+          // the regular fields hold the first realization, for the outputs and the coupled solvers
+          pres[ei] = ensPres[ei][0];
+          dPres[ei] = 0.0;
+        } );
+
+        updatePorosityAndPermeability( subRegion );
+        updateFluidState( subRegion );
+      } );
+    }
+
     mesh.getElemManager().forElementSubRegions( regionNames, [&]( localIndex const,
                                                                   ElementSubRegionBase & subRegion )
     {
@@ -596,6 +704,48 @@ void SinglePhaseBase::assembleSystem( real64 const time_n,
 {
   GEOSX_MARK_FUNCTION;
 
+  if( m_numRealizations > 1 )
+  {
+    // the linear systems of the realizations are assembled in the ensemble arrays,
+    // and the one of the first realization is copied in the solver system with the boundary conditions
+    m_ensembleJacobian.zero();
+    m_ensembleRhs.zero();
+
+    globalIndex const rankOffset = dofManager.rankOffset();
+    string const dofKey = dofManager.getKey( extrinsicMeshData::flow::pressure::key() );
+    arrayView2d< real64 > const ensembleJacobian = m_ensembleJacobian.toView();
+    arrayView2d< real64 > const ensembleRhs = m_ensembleRhs.toView();
+
+    forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                 MeshLevel & mesh,
+                                                 arrayView1d< string const > const & regionNames )
+    {
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                           CellElementSubRegion & subRegion )
+      {
+        using namespace extrinsicMeshData::flow;
+
+        EnsembleAccumulationKernel::launch( subRegion.size(),
+                                            rankOffset,
+                                            subRegion.getReference< array1d< globalIndex > >( dofKey ),
+                                            subRegion.ghostRank(),
+                                            subRegion.getElementVolume(),
+                                            subRegion.getExtrinsicData< ensemblePorosityOld >(),
+                                            subRegion.getExtrinsicData< ensemblePorosity >(),
+                                            subRegion.getExtrinsicData< ensembleDPorosity_dPressure >(),
+                                            subRegion.getExtrinsicData< ensembleDensityOld >(),
+                                            subRegion.getExtrinsicData< ensembleDensity >(),
+                                            subRegion.getExtrinsicData< ensembleDDensity_dPressure >(),
+                                            localMatrix,
+                                            ensembleJacobian,
+                                            ensembleRhs );
+      } );
+    } );
+
+    assembleEnsembleFluxTerms( dt, domain, dofManager, localMatrix );
+    return;
+  }
+
   assembleAccumulationTerms( domain,
                              dofManager,
                              localMatrix,
@@ -610,6 +760,14 @@ void SinglePhaseBase::assembleSystem( real64 const time_n,
 
 }
 
+void SinglePhaseBase::assembleEnsembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( dt ),
+                                                 DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
+                                                 DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
+                                                 CRSMatrixView< real64, globalIndex const > const & GEOSX_UNUSED_PARAM( localMatrix ) )
+{
+  GEOSX_ERROR( GEOSX_FMT( "{}: the flux terms of an ensemble cannot be assembled by this solver", getName() ) );
+}
+
 void SinglePhaseBase::accumulationLaunch( CellElementSubRegion const & subRegion,
                                           DofManager const & dofManager,
                                           CRSMatrixView< real64, globalIndex const > const & localMatrix,
@@ -742,6 +900,13 @@ void SinglePhaseBase::applyBoundaryConditions( real64 time_n,
 {
   GEOSX_MARK_FUNCTION;
 
+  if( m_numRealizations > 1 )
+  {
+    applyEnsembleBoundaryConditions( time_n, dt, domain, dofManager, localMatrix );
+    copyRealizationSystem( 0, localMatrix, localRhs );
+    return;
+  }
+
   applySourceFluxBC( time_n, dt, domain, dofManager, localMatrix, localRhs );
   applyDirichletBC( time_n, dt, domain, dofManager, localMatrix, localRhs );
   applyAquiferBC( time_n, dt, domain, dofManager, localMatrix, localRhs );
@@ -863,6 +1028,118 @@ void SinglePhaseBase::applySourceFluxBC( real64 const time_n,
   } );
 }
 
+void SinglePhaseBase::applyEnsembleBoundaryConditions( real64 const time_n,
+                                                       real64 const dt,
+                                                       DomainPartition & domain,
+                                                       DofManager const & dofManager,
+                                                       CRSMatrixView< real64, globalIndex const > const & localMatrix )
+{
+  GEOSX_MARK_FUNCTION;
+
+  FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
+  string const dofKey = dofManager.getKey( extrinsicMeshData::flow::pressure::key() );
+  globalIndex const rankOffset = dofManager.rankOffset();
+  arrayView2d< real64 > const ensembleJacobian = m_ensembleJacobian.toView();
+  arrayView2d< real64 > const ensembleRhs = m_ensembleRhs.toView();
+
+  // the source fluxes are the same for all the realizations
+  fsManager.apply( time_n + dt,
+                   domain,
+                   "ElementRegions",
+                   FieldSpecificationBase::viewKeyStruct::fluxBoundaryConditionString(),
+                   [&]( FieldSpecificationBase const & fs,
+                        string const &,
+                        SortedArrayView< localIndex const > const & targetSet,
+                        Group & subRegion,
+                        string const & )
+  {
+    arrayView1d< globalIndex const > const dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
+
+    array1d< globalIndex > dof( targetSet.size() );
+    array1d< real64 > rhsContribution( targetSet.size() );
+    fs.computeRhsContribution< FieldSpecificationAdd,
+                               parallelDevicePolicy<> >( targetSet.toViewConst(),
+                                                         time_n + dt,
+                                                         dt,
+                                                         subRegion,
+                                                         dofNumber,
+                                                         rankOffset,
+                                                         localMatrix,
+                                                         dof.toView(),
+                                                         rhsContribution.toView(),
+                                                         [] GEOSX_HOST_DEVICE ( localIndex const )
+    {
+      return 0.0;
+    } );
+
+    EnsembleSourceFluxKernel::launch( dof.toViewConst(),
+                                      rankOffset,
+                                      rhsContribution.toViewConst(),
+                                      ensembleRhs );
+  } );
+
+  // the imposed pressures are the same for all the realizations, but not the rows of their Jacobians
+  fsManager.apply( time_n + dt,
+                   domain,
+                   "ElementRegions",
+                   extrinsicMeshData::flow::pressure::key(),
+                   [&]( FieldSpecificationBase const & fs,
+                        string const &,
+                        SortedArrayView< localIndex const > const & lset,
+                        Group & subRegion,
+                        string const & )
+  {
+    arrayView1d< globalIndex const > const dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
+
+    // with a unit time step, the contribution computed by FieldSpecificationAdd is the imposed pressure
+    array1d< globalIndex > dof( lset.size() );
+    array1d< real64 > bcValue( lset.size() );
+    fs.computeRhsContribution< FieldSpecificationAdd,
+                               parallelDevicePolicy<> >( lset,
+                                                         time_n + dt,
+                                                         1.0,
+                                                         subRegion,
+                                                         dofNumber,
+                                                         rankOffset,
+                                                         localMatrix,
+                                                         dof.toView(),
+                                                         bcValue.toView(),
+                                                         [] GEOSX_HOST_DEVICE ( localIndex const )
+    {
+      return 0.0;
+    } );
+
+    EnsembleDirichletKernel::launch( lset,
+                                     dof.toViewConst(),
+                                     rankOffset,
+                                     bcValue.toViewConst(),
+                                     subRegion.getReference< array2d< real64 > >( extrinsicMeshData::flow::ensemblePressure::key() ),
+                                     subRegion.getReference< array2d< real64 > >( extrinsicMeshData::flow::ensembleDeltaPressure::key() ),
+                                     localMatrix,
+                                     ensembleJacobian,
+                                     ensembleRhs );
+  } );
+}
+
+void SinglePhaseBase::copyRealizationSystem( integer const realization,
+                                             CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                             arrayView1d< real64 > const & localRhs ) const
+{
+  arrayView2d< real64 const > const ensembleJacobian = m_ensembleJacobian.toViewConst();
+  arrayView2d< real64 const > const ensembleRhs = m_ensembleRhs.toViewConst();
+
+  forAll< parallelDevicePolicy<> >( localMatrix.numRows(), [=] GEOSX_HOST_DEVICE ( localIndex const row )
+  {
+    arraySlice1d< real64 > const entries = localMatrix.getEntries( row );
+    localIndex const offset = localMatrix.getOffsets()[row];
+    for( localIndex j = 0; j < localMatrix.numNonZeros( row ); ++j )
+    {
+      entries[j] = ensembleJacobian[offset + j][realization];
+    }
+    localRhs[row] = ensembleRhs[row][realization];
+  } );
+}
+
 void SinglePhaseBase::updateFluidState( ObjectManagerBase & subRegion ) const
 {
   updateFluidModel( subRegion );
@@ -877,6 +1154,17 @@ void SinglePhaseBase::updateState( DomainPartition & domain )
                                                MeshLevel & mesh,
                                                arrayView1d< string const > const & regionNames )
   {
+    if( m_numRealizations > 1 )
+    {
+      // the regular fields hold the first realization at the beginning of the step, and are updated at the end of the step
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                           CellElementSubRegion & subRegion )
+      {
+        updateEnsembleState( subRegion );
+      } );
+      return;
+    }
+
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion, SurfaceElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                                                    auto & subRegion )
     {
@@ -893,6 +1181,43 @@ void SinglePhaseBase::solveSystem( DofManager const & dofManager,
 {
   GEOSX_MARK_FUNCTION;
 
+  if( m_numRealizations > 1 )
+  {
+    // The linear systems of the realizations share the sparsity pattern, the degrees of freedom and the linear solver
+    // (and the factorization workspace of a direct solver). The system of the first realization is already in the solver system.
+    integer numLinearIterations = 0;
+    arrayView2d< real64 > const ensembleSolution = m_ensembleSolution.toView();
+    for( integer realization = 0; realization < m_numRealizations; ++realization )
+    {
+      if( realization > 0 )
+      {
+        arrayView1d< real64 > const localRhs = rhs.open();
+        copyRealizationSystem( realization, m_localMatrix.toViewConstSizes(), localRhs );
+        rhs.close();
+
+        if( m_precond )
+        {
+          m_precond->clear();
+        }
+        matrix.create( m_localMatrix.toViewConst(), dofManager.numLocalDofs(), MPI_COMM_GEOSX );
+      }
+
+      rhs.scale( -1.0 );
+      solution.zero();
+
+      SolverBase::solveSystem( dofManager, matrix, rhs, solution );
+      numLinearIterations += m_linearSolverResult.numIterations;
+
+      arrayView1d< real64 const > const localSolution = solution.values();
+      forAll< parallelDevicePolicy<> >( localSolution.size(), [=] GEOSX_HOST_DEVICE ( localIndex const row )
+      {
+        ensembleSolution[row][realization] = localSolution[row];
+      } );
+    }
+    m_linearSolverResult.numIterations = numLinearIterations;
+    return;
+  }
+
   rhs.scale( -1.0 );
   solution.zero();
 
@@ -916,6 +1241,49 @@ void SinglePhaseBase::resetStateToBeginningOfStep( DomainPartition & domain )
       updatePorosityAndPermeability( subRegion );
       updateFluidState( subRegion );
     } );
+
+    if( m_numRealizations > 1 )
+    {
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                           CellElementSubRegion & subRegion )
+      {
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::ensembleDeltaPressure >().zero();
+        updateEnsembleState( subRegion );
+      } );
+    }
+  } );
+}
+
+void SinglePhaseBase::storeRealizationState( DomainPartition & domain,
+                                             integer const realization )
+{
+  GEOSX_MARK_FUNCTION;
+
+  forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                               MeshLevel & mesh,
+                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                         CellElementSubRegion & subRegion )
+    {
+      CoupledSolidBase const & porousSolid =
+        getConstitutiveModel< CoupledSolidBase >( subRegion, subRegion.getReference< string >( viewKeyStruct::solidNamesString() ) );
+      PressurePorosity const & porosityModel =
+        getConstitutiveModel< PressurePorosity >( subRegion, porousSolid.getReference< string >( CoupledSolidBase::viewKeyStruct::porosityModelNameString() ) );
+
+      arrayView1d< real64 const > const pres = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+      arrayView1d< real64 const > const refPoro = porosityModel.getReferencePorosity();
+
+      arrayView2d< real64 > const ensPres = subRegion.getExtrinsicData< extrinsicMeshData::flow::ensemblePressure >();
+      arrayView2d< real64 > const ensRefPoro = subRegion.getExtrinsicData< extrinsicMeshData::flow::ensembleReferencePorosity >();
+
+      // the other ensemble fields are computed from these ones at the beginning of each step
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        ensPres[ei][realization] = pres[ei];
+        ensRefPoro[ei][realization] = refPoro[ei];
+      } );
+    } );
   } );
 }
 
@@ -126,6 +126,10 @@ public:
                         real64 const & dt,
                         DomainPartition & domain ) override;
 
+  virtual void
+  storeRealizationState( DomainPartition & domain,
+                         integer const realization ) override;
+
   void accumulationLaunch( CellElementSubRegion const & subRegion,
                            DofManager const & dofManager,
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
@@ -208,6 +212,19 @@ public:
                               arrayView1d< real64 > const & localRhs,
                               CRSMatrixView< real64, localIndex const > const & dR_dAper ) = 0;
 
+  /**
+   * @brief assembles the flux terms of all the realizations of a batched ensemble run
+   * @param dt time step
+   * @param domain the physical domain object
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localMatrix the system matrix, providing the sparsity pattern of the linear systems of the realizations
+   */
+  virtual void
+  assembleEnsembleFluxTerms( real64 const dt,
+                             DomainPartition const & domain,
+                             DofManager const & dofManager,
+                             CRSMatrixView< real64, globalIndex const > const & localMatrix );
+
   /**
    * @brief Function to perform the Application of Dirichlet type BC's
    * @param time current time
@@ -347,6 +364,45 @@ protected:
    */
   virtual FluidPropViews getFluidProperties( constitutive::ConstitutiveBase const & fluid ) const;
 
+  /**
+   * @brief Update the porosity, the fluid properties and the mobility of all the realizations of a batched ensemble run.
+   * @param subRegion the element subregion
+   */
+  void updateEnsembleState( CellElementSubRegion & subRegion ) const;
+
+  /**
+   * @brief Apply the source flux and Dirichlet boundary conditions to the linear systems of all the realizations.
+   * @param time_n previous time value
+   * @param dt time step
+   * @param domain the domain
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localMatrix the system matrix, providing the sparsity pattern of the linear systems of the realizations
+   */
+  void applyEnsembleBoundaryConditions( real64 const time_n,
+                                        real64 const dt,
+                                        DomainPartition & domain,
+                                        DofManager const & dofManager,
+                                        CRSMatrixView< real64, globalIndex const > const & localMatrix );
+
+  /**
+   * @brief Copy the linear system of a realization into the system of the solver.
+   * @param realization the index of the realization
+   * @param localMatrix the system matrix
+   * @param localRhs the system right-hand side vector
+   */
+  void copyRealizationSystem( integer const realization,
+                              CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                              arrayView1d< real64 > const & localRhs ) const;
+
+  /// Jacobians of the realizations of a batched ensemble run: one row per entry of the system matrix, one column per realization
+  array2d< real64 > m_ensembleJacobian;
+
+  /// Residuals of the realizations of a batched ensemble run: one row per local degree of freedom, one column per realization
+  array2d< real64 > m_ensembleRhs;
+
+  /// Newton updates of the realizations of a batched ensemble run: one row per local degree of freedom, one column per realization
+  array2d< real64 > m_ensembleSolution;
+
 
 private:
   virtual void setConstitutiveNames( ElementSubRegionBase & subRegion ) const override;
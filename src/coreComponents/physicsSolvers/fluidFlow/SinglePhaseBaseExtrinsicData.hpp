@@ -56,6 +56,97 @@ EXTRINSIC_MESH_DATA_TRAIT( densityOld,
                            NO_WRITE,
                            "Density at the previous converged time step" );
 
+// The ensemble fields hold one value per realization of a batched ensemble run, the realizations of an element
+// being contiguous. They are not written to the restart files, since an ensemble run cannot be restarted.
+
+EXTRINSIC_MESH_DATA_TRAIT( ensemblePressure,
+                           "ensemblePressure",
+                           array2d< real64 >,
+                           0,
+                           LEVEL_0,
+                           NO_WRITE,
+                           "Pressure of each realization of the ensemble" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensembleDeltaPressure,
+                           "ensembleDeltaPressure",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Accumulated pressure updates of each realization of the ensemble" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensembleReferencePorosity,
+                           "ensembleReferencePorosity",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Reference porosity of each realization of the ensemble" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensemblePorosity,
+                           "ensemblePorosity",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Porosity of each realization of the ensemble" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensembleDPorosity_dPressure,
+                           "ensembleDPorosity_dPressure",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Derivative of the porosity of each realization of the ensemble with respect to pressure" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensemblePorosityOld,
+                           "ensemblePorosityOld",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Porosity of each realization of the ensemble at the previous converged time step" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensembleDensity,
+                           "ensembleDensity",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Density of each realization of the ensemble" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensembleDDensity_dPressure,
+                           "ensembleDDensity_dPressure",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Derivative of the density of each realization of the ensemble with respect to pressure" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensembleDensityOld,
+                           "ensembleDensityOld",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Density of each realization of the ensemble at the previous converged time step" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensembleMobility,
+                           "ensembleMobility",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Mobility of each realization of the ensemble" );
+
+EXTRINSIC_MESH_DATA_TRAIT( ensembleDMobility_dPressure,
+                           "ensembleDMobility_dPressure",
+                           array2d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Derivative of the mobility of each realization of the ensemble with respect to pressure" );
+
 }
 
 }
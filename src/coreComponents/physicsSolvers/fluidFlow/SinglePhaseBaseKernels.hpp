@@ -340,6 +340,310 @@ struct SolutionCheckKernel
 
 };
 
+/******************************** Ensemble kernels ********************************/
+
+/*
+ * The ensemble kernels advance all the realizations of a batched ensemble run together.
+ * The ensemble fields and the ensemble linear systems store the values of the realizations of an element,
+ * or of a matrix entry, next to each other: the realizations are looped over in the innermost loops.
+ * The linear systems of the realizations share the sparsity pattern of the solver matrix, and the Jacobian
+ * of each realization is stored in a column of an array indexed as the entries of the solver matrix.
+ */
+
+/**
+ * @brief Find the index of an entry of the solver matrix in the ensemble Jacobian.
+ * @param[in] localMatrix the solver matrix, providing the sparsity pattern
+ * @param[in] localRow the local row of the entry
+ * @param[in] col the global column of the entry
+ * @return the index of the entry
+ */
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+localIndex ensembleEntryIndex( CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                               localIndex const localRow,
+                               globalIndex const col )
+{
+  arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+  localIndex const pos = LvArray::sortedArrayManipulation::find( columns.dataIfContiguous(),
+                                                                 localMatrix.numNonZeros( localRow ),
+                                                                 col );
+  GEOSX_ASSERT_GT( localMatrix.numNonZeros( localRow ), pos );
+  return localMatrix.getOffsets()[localRow] + pos;
+}
+
+struct EnsembleStateUpdateKernel
+{
+  /**
+   * @brief Update the porosity, the fluid properties and the mobility of all the realizations.
+   * @param[in] size the number of elements
+   * @param[in] fluidWrapper the kernel wrapper of the fluid model
+   * @param[in] porosityWrapper the kernel wrapper of the porosity model
+   * @param[in] pres the pressures at the beginning of the time step
+   * @param[in] dPres the accumulated pressure updates
+   * @param[in] referencePorosity the reference porosities
+   * @param[out] porosity the porosities
+   * @param[out] dPoro_dPres the derivatives of the porosities with respect to pressure
+   * @param[out] dens the densities
+   * @param[out] dDens_dPres the derivatives of the densities with respect to pressure
+   * @param[out] mob the mobilities
+   * @param[out] dMob_dPres the derivatives of the mobilities with respect to pressure
+   */
+  template< typename FLUID_WRAPPER, typename POROSITY_WRAPPER >
+  static void launch( localIndex const size,
+                      FLUID_WRAPPER const & fluidWrapper,
+                      POROSITY_WRAPPER const & porosityWrapper,
+                      arrayView2d< real64 const > const & pres,
+                      arrayView2d< real64 const > const & dPres,
+                      arrayView2d< real64 const > const & referencePorosity,
+                      arrayView2d< real64 > const & porosity,
+                      arrayView2d< real64 > const & dPoro_dPres,
+                      arrayView2d< real64 > const & dens,
+                      arrayView2d< real64 > const & dDens_dPres,
+                      arrayView2d< real64 > const & mob,
+                      arrayView2d< real64 > const & dMob_dPres )
+  {
+    forAll< parallelDevicePolicy<> >( size, [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      for( localIndex r = 0; r < pres.size( 1 ); ++r )
+      {
+        real64 const newPres = pres[ei][r] + dPres[ei][r];
+        porosityWrapper.computePorosity( newPres,
+                                         porosity[ei][r],
+                                         dPoro_dPres[ei][r],
+                                         referencePorosity[ei][r] );
+
+        real64 visc, dVisc_dPres;
+        fluidWrapper.compute( newPres,
+                              dens[ei][r],
+                              dDens_dPres[ei][r],
+                              visc,
+                              dVisc_dPres );
+
+        MobilityKernel::compute( dens[ei][r],
+                                 dDens_dPres[ei][r],
+                                 visc,
+                                 dVisc_dPres,
+                                 mob[ei][r],
+                                 dMob_dPres[ei][r] );
+      }
+    } );
+  }
+};
+
+struct EnsembleAccumulationKernel
+{
+  /**
+   * @brief Assemble the accumulation terms of all the realizations.
+   * @param[in] size the number of elements
+   * @param[in] rankOffset the offset of the degrees of freedom of this rank
+   * @param[in] dofNumber the degrees of freedom of the elements
+   * @param[in] elemGhostRank the ghost ranks of the elements
+   * @param[in] volume the volumes of the elements
+   * @param[in] porosityOld the porosities at the beginning of the time step
+   * @param[in] porosityNew the current porosities
+   * @param[in] dPoro_dPres the derivatives of the porosities with respect to pressure
+   * @param[in] densOld the densities at the beginning of the time step
+   * @param[in] dens the current densities
+   * @param[in] dDens_dPres the derivatives of the densities with respect to pressure
+   * @param[in] localMatrix the solver matrix, providing the sparsity pattern
+   * @param[inout] ensembleJacobian the Jacobians of the realizations
+   * @param[inout] ensembleRhs the residuals of the realizations
+   */
+  static void launch( localIndex const size,
+                      globalIndex const rankOffset,
+                      arrayView1d< globalIndex const > const & dofNumber,
+                      arrayView1d< integer const > const & elemGhostRank,
+                      arrayView1d< real64 const > const & volume,
+                      arrayView2d< real64 const > const & porosityOld,
+                      arrayView2d< real64 const > const & porosityNew,
+                      arrayView2d< real64 const > const & dPoro_dPres,
+                      arrayView2d< real64 const > const & densOld,
+                      arrayView2d< real64 const > const & dens,
+                      arrayView2d< real64 const > const & dDens_dPres,
+                      CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                      arrayView2d< real64 > const & ensembleJacobian,
+                      arrayView2d< real64 > const & ensembleRhs )
+  {
+    forAll< parallelDevicePolicy<> >( size, [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( elemGhostRank[ei] < 0 )
+      {
+        globalIndex const elemDOF = dofNumber[ei];
+        localIndex const localElemDof = elemDOF - rankOffset;
+        localIndex const entry = ensembleEntryIndex( localMatrix, localElemDof, elemDOF );
+
+        for( localIndex r = 0; r < ensembleRhs.size( 1 ); ++r )
+        {
+          real64 localAccum, localAccumJacobian;
+
+          real64 const poreVolNew = volume[ei] * porosityNew[ei][r];
+          real64 const poreVolOld = volume[ei] * porosityOld[ei][r];
+          real64 const dPoreVol_dPres = volume[ei] * dPoro_dPres[ei][r];
+
+          AccumulationKernel::compute( dens[ei][r],
+                                       densOld[ei][r],
+                                       dDens_dPres[ei][r],
+                                       poreVolNew,
+                                       poreVolOld,
+                                       dPoreVol_dPres,
+                                       localAccum,
+                                       localAccumJacobian );
+
+          // no need for atomics here
+          ensembleJacobian[entry][r] += localAccumJacobian;
+          ensembleRhs[localElemDof][r] += localAccum;
+        }
+      }
+    } );
+  }
+};
+
+struct EnsembleSourceFluxKernel
+{
+  /**
+   * @brief Add the contributions of a source flux boundary condition to the residuals of all the realizations.
+   * @param[in] dof the degrees of freedom of the target elements
+   * @param[in] rankOffset the offset of the degrees of freedom of this rank
+   * @param[in] rhsContribution the contributions of the boundary condition, shared by all the realizations
+   * @param[inout] ensembleRhs the residuals of the realizations
+   */
+  static void launch( arrayView1d< globalIndex const > const & dof,
+                      globalIndex const rankOffset,
+                      arrayView1d< real64 const > const & rhsContribution,
+                      arrayView2d< real64 > const & ensembleRhs )
+  {
+    forAll< parallelDevicePolicy<> >( dof.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+    {
+      globalIndex const localRow = dof[i] - rankOffset;
+      if( localRow >= 0 && localRow < ensembleRhs.size( 0 ) )
+      {
+        for( localIndex r = 0; r < ensembleRhs.size( 1 ); ++r )
+        {
+          ensembleRhs[localRow][r] += rhsContribution[i];
+        }
+      }
+    } );
+  }
+};
+
+struct EnsembleDirichletKernel
+{
+  /**
+   * @brief Impose the pressure of a Dirichlet boundary condition in the linear systems of all the realizations.
+   * @param[in] targetSet the target elements
+   * @param[in] dof the degrees of freedom of the target elements
+   * @param[in] rankOffset the offset of the degrees of freedom of this rank
+   * @param[in] bcValue the pressures imposed on the target elements, shared by all the realizations
+   * @param[in] pres the pressures at the beginning of the time step
+   * @param[in] dPres the accumulated pressure updates
+   * @param[in] localMatrix the solver matrix, providing the sparsity pattern
+   * @param[inout] ensembleJacobian the Jacobians of the realizations
+   * @param[inout] ensembleRhs the residuals of the realizations
+   * @details The rows are modified as in FieldSpecificationEqual::SpecifyFieldValue.
+   */
+  static void launch( SortedArrayView< localIndex const > const & targetSet,
+                      arrayView1d< globalIndex const > const & dof,
+                      globalIndex const rankOffset,
+                      arrayView1d< real64 const > const & bcValue,
+                      arrayView2d< real64 const > const & pres,
+                      arrayView2d< real64 const > const & dPres,
+                      CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                      arrayView2d< real64 > const & ensembleJacobian,
+                      arrayView2d< real64 > const & ensembleRhs )
+  {
+    forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+    {
+      localIndex const a = targetSet[i];
+      globalIndex const localRow = dof[i] - rankOffset;
+      if( localRow < 0 || localRow >= localMatrix.numRows() )
+      {
+        return;
+      }
+
+      arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+      localIndex const numEntries = localMatrix.numNonZeros( localRow );
+      localIndex const offset = localMatrix.getOffsets()[localRow];
+
+      real64 const minDiagonal = 1e-15;
+      for( localIndex r = 0; r < ensembleRhs.size( 1 ); ++r )
+      {
+        real64 diagonal = 0;
+        for( localIndex j = 0; j < numEntries; ++j )
+        {
+          real64 & entry = ensembleJacobian[offset + j][r];
+          if( columns[j] == dof[i] )
+          {
+            // check that the entry is large enough to enforce the boundary condition
+            if( entry >= 0 && entry < minDiagonal )
+            {
+              entry = minDiagonal;
+            }
+            else if( entry < 0 && entry > -minDiagonal )
+            {
+              entry = -minDiagonal;
+            }
+            diagonal = entry;
+          }
+          else
+          {
+            entry = 0;
+          }
+        }
+        ensembleRhs[localRow][r] = -diagonal * ( bcValue[i] - ( pres[a][r] + dPres[a][r] ) );
+      }
+    } );
+  }
+};
+
+struct EnsembleResidualNormKernel
+{
+  /**
+   * @brief Compute the contributions of this rank to the residual norms of all the realizations.
+   * @param[in] ensembleRhs the residuals of the realizations
+   * @param[in] rankOffset the offset of the degrees of freedom of this rank
+   * @param[in] presDofNumber the degrees of freedom of the elements
+   * @param[in] ghostRank the ghost ranks of the elements
+   * @param[in] volume the volumes of the elements
+   * @param[in] densOld the densities at the beginning of the time step
+   * @param[in] poroOld the porosities at the beginning of the time step
+   * @param[inout] localResidualNorm the sums of the squared residuals, of the normalizers and of the element counts, per realization
+   */
+  template< typename POLICY, typename REDUCE_POLICY >
+  static void launch( arrayView2d< real64 const > const & ensembleRhs,
+                      globalIndex const rankOffset,
+                      arrayView1d< globalIndex const > const & presDofNumber,
+                      arrayView1d< integer const > const & ghostRank,
+                      arrayView1d< real64 const > const & volume,
+                      arrayView2d< real64 const > const & densOld,
+                      arrayView2d< real64 const > const & poroOld,
+                      arrayView2d< real64 > const & localResidualNorm )
+  {
+    // one reduction per realization: the norms are cheap compared to the assembly and the solves
+    for( localIndex r = 0; r < ensembleRhs.size( 1 ); ++r )
+    {
+      RAJA::ReduceSum< REDUCE_POLICY, real64 > localSum( 0.0 );
+      RAJA::ReduceSum< REDUCE_POLICY, real64 > normSum( 0.0 );
+      RAJA::ReduceSum< REDUCE_POLICY, localIndex > count( 0 );
+
+      forAll< POLICY >( presDofNumber.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+      {
+        if( ghostRank[a] < 0 )
+        {
+          localIndex const lid = presDofNumber[a] - rankOffset;
+          real64 const val = ensembleRhs[lid][r];
+          localSum += val * val;
+          normSum += poroOld[a][r] * densOld[a][r] * volume[a];
+          count += 1;
+        }
+      } );
+
+      localResidualNorm[r][0] += localSum.get();
+      localResidualNorm[r][1] += normSum.get();
+      localResidualNorm[r][2] += count.get();
+    }
+  }
+};
+
 /******************************** HydrostaticPressureKernel ********************************/
 
 struct HydrostaticPressureKernel
@@ -21,13 +21,17 @@
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/fluid/singleFluidSelector.hpp"
+#include "constitutive/permeability/ConstantPermeability.hpp"
 #include "constitutive/permeability/PermeabilityExtrinsicData.hpp"
+#include "constitutive/solid/CoupledSolidBase.hpp"
+#include "constitutive/solid/porosity/PressurePorosity.hpp"
 #include "constitutive/ConstitutivePassThru.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "finiteVolume/BoundaryStencil.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
+#include "finiteVolume/TwoPointFluxApproximation.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "fieldSpecification/AquiferBoundaryCondition.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
@@ -71,6 +75,97 @@ void SinglePhaseFVM< BASE >::initializePreSubGroups()
   }
 }
 
+template< typename BASE >
+bool SinglePhaseFVM< BASE >::supportsEnsemble() const
+{
+  if( !std::is_same< BASE, SinglePhaseBase >::value )
+  {
+    return false;
+  }
+
+  DomainPartition const & domain = this->template getGroupByPath< DomainPartition >( "/Problem/domain" );
+  FiniteVolumeManager const & fvManager = domain.getNumericalMethodManager().getFiniteVolumeManager();
+  if( dynamic_cast< TwoPointFluxApproximation const * >( &fvManager.getFluxApproximation( m_discretizationName ) ) == nullptr )
+  {
+    return false;
+  }
+
+  // the boundary conditions on faces (Dirichlet, aquifers) are not assembled for the realizations
+  bool supported = true;
+  FieldSpecificationManager::getInstance().forSubGroups< FieldSpecificationBase >( [&]( FieldSpecificationBase const & fs )
+  {
+    if( !fs.initialCondition() && fs.getObjectPath().find( "faceManager" ) != string::npos )
+    {
+      supported = false;
+    }
+  } );
+
+  // the transmissibilities are computed once per realization, and the porosities are only functions of pressure
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel const & mesh,
+                                                arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase const & subRegion )
+    {
+      string const solidName = SolverBase::getConstitutiveName< CoupledSolidBase >( subRegion );
+      if( dynamic_cast< CellElementSubRegion const * >( &subRegion ) == nullptr || solidName.empty() )
+      {
+        supported = false;
+        return;
+      }
+
+      Group const & constitutiveModels = subRegion.getConstitutiveModels();
+      CoupledSolidBase const & porousSolid = constitutiveModels.getGroup< CoupledSolidBase >( solidName );
+      string const & porosityName = porousSolid.getReference< string >( CoupledSolidBase::viewKeyStruct::porosityModelNameString() );
+      string const & permeabilityName = porousSolid.getReference< string >( CoupledSolidBase::viewKeyStruct::permeabilityModelNameString() );
+      supported = supported &&
+                  constitutiveModels.getGroup< ConstitutiveBase >( porosityName ).getCatalogName() == PressurePorosity::catalogName() &&
+                  constitutiveModels.getGroup< ConstitutiveBase >( permeabilityName ).getCatalogName() == ConstantPermeability::catalogName();
+    } );
+  } );
+
+  return supported;
+}
+
+template< typename BASE >
+void SinglePhaseFVM< BASE >::storeRealizationState( DomainPartition & domain,
+                                                    integer const realization )
+{
+  GEOSX_MARK_FUNCTION;
+
+  BASE::storeRealizationState( domain, realization );
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  // the transmissibilities of a realization only depend on its constant permeabilities
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const & meshBodyName,
+                                                MeshLevel const & mesh,
+                                                arrayView1d< string const > const & )
+  {
+    ElementRegionManager const & elemManager = mesh.getElemManager();
+    typename FluxKernel::PermeabilityAccessors permAccessors( elemManager, this->getName() );
+
+    fluxApprox.forStencils< CellElementStencilTPFA >( mesh, [&]( CellElementStencilTPFA const & stencil )
+    {
+      array2d< real64 > & transmissibility = m_ensembleTransmissibility[meshBodyName];
+      if( realization == 0 )
+      {
+        transmissibility.resize( stencil.size(), m_numRealizations );
+      }
+
+      EnsembleFluxKernel::storeTransmissibility( stencil.createKernelWrapper(),
+                                                 permAccessors.get< extrinsicMeshData::permeability::permeability >(),
+                                                 permAccessors.get< extrinsicMeshData::permeability::dPerm_dPressure >(),
+                                                 realization,
+                                                 transmissibility.toView() );
+    } );
+  } );
+}
+
 template< typename BASE >
 void SinglePhaseFVM< BASE >::setupDofs( DomainPartition const & domain,
                                         DofManager & dofManager ) const
@@ -118,6 +213,50 @@ real64 SinglePhaseFVM< BASE >::calculateResidualNorm( DomainPartition const & do
   string const dofKey = dofManager.getKey( extrinsicMeshData::flow::pressure::key() );
   globalIndex const rankOffset = dofManager.rankOffset();
 
+  if( m_numRealizations > 1 )
+  {
+    // the Newton loop goes on until all the realizations have converged
+    forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                  MeshLevel const & mesh,
+                                                  arrayView1d< string const > const & regionNames )
+    {
+      array2d< real64 > localResidualNorm( m_numRealizations, 3 );
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                          [&]( localIndex const,
+                                                                               CellElementSubRegion const & subRegion )
+      {
+        EnsembleResidualNormKernel::launch< parallelDevicePolicy<>,
+                                            parallelDeviceReduce >( m_ensembleRhs.toViewConst(),
+                                                                    rankOffset,
+                                                                    subRegion.getReference< array1d< globalIndex > >( dofKey ),
+                                                                    subRegion.ghostRank(),
+                                                                    subRegion.getElementVolume(),
+                                                                    subRegion.getExtrinsicData< extrinsicMeshData::flow::ensembleDensityOld >(),
+                                                                    subRegion.getExtrinsicData< extrinsicMeshData::flow::ensemblePorosityOld >(),
+                                                                    localResidualNorm.toView() );
+      } );
+
+      // compute the global residual norms of all the realizations with a single reduction
+      array2d< real64 > globalResidualNorm( m_numRealizations, 3 );
+      MpiWrapper::allReduce( localResidualNorm.data(),
+                             globalResidualNorm.data(),
+                             3 * m_numRealizations,
+                             MPI_SUM,
+                             MPI_COMM_GEOSX );
+
+      real64 maxResidual = 0.0;
+      for( integer r = 0; r < m_numRealizations; ++r )
+      {
+        maxResidual = LvArray::math::max( maxResidual,
+                                          sqrt( globalResidualNorm[r][0] ) / ( ( globalResidualNorm[r][1] + m_fluxEstimate ) / (globalResidualNorm[r][2]+1) ) );
+      }
+      residual += maxResidual;
+      numMeshTargets++;
+    } );
+
+    return residual / numMeshTargets;
+  }
+
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel const & mesh,
                                                 arrayView1d< string const > const & regionNames )
@@ -170,6 +309,45 @@ void SinglePhaseFVM< BASE >::applySystemSolution( DofManager const & dofManager,
                                                   real64 const scalingFactor,
                                                   DomainPartition & domain )
 {
+  if( m_numRealizations > 1 )
+  {
+    string const dofKey = dofManager.getKey( extrinsicMeshData::flow::pressure::key() );
+    globalIndex const rankOffset = dofManager.rankOffset();
+    arrayView2d< real64 const > const ensembleSolution = m_ensembleSolution.toViewConst();
+
+    forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                  MeshLevel & mesh,
+                                                  arrayView1d< string const > const & regionNames )
+    {
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                          [&]( localIndex const,
+                                                                               CellElementSubRegion & subRegion )
+      {
+        arrayView1d< globalIndex const > const dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
+        arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+        arrayView2d< real64 > const ensDPres = subRegion.getExtrinsicData< extrinsicMeshData::flow::ensembleDeltaPressure >();
+
+        forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+        {
+          if( ghostRank[ei] < 0 )
+          {
+            localIndex const lid = LvArray::integerConversion< localIndex >( dofNumber[ei] - rankOffset );
+            for( localIndex r = 0; r < ensDPres.size( 1 ); ++r )
+            {
+              ensDPres[ei][r] += scalingFactor * ensembleSolution[lid][r];
+            }
+          }
+        } );
+      } );
+
+      std::map< string, string_array > fieldNames;
+      fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::ensembleDeltaPressure::key() ) );
+
+      CommunicationTools::getInstance().synchronizeFields( fieldNames, mesh, domain.getNeighbors(), true );
+    } );
+    return;
+  }
+
   dofManager.addVectorToField( localSolution,
                                extrinsicMeshData::flow::pressure::key(),
                                extrinsicMeshData::flow::deltaPressure::key(),
@@ -243,6 +421,75 @@ void SinglePhaseFVM< SinglePhaseBase >::assembleFluxTerms( real64 const GEOSX_UN
 }
 
 
+template< typename BASE >
+void SinglePhaseFVM< BASE >::assembleEnsembleFluxTerms( real64 const dt,
+                                                        DomainPartition const & domain,
+                                                        DofManager const & dofManager,
+                                                        CRSMatrixView< real64, globalIndex const > const & localMatrix )
+{
+  GEOSX_MARK_FUNCTION;
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  string const & dofKey = dofManager.getKey( extrinsicMeshData::flow::pressure::key() );
+
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const & meshBodyName,
+                                                MeshLevel const & mesh,
+                                                arrayView1d< string const > const & )
+  {
+    ElementRegionManager const & elemManager = mesh.getElemManager();
+    ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > >
+    elemDofNumber = elemManager.constructArrayViewAccessor< globalIndex, 1 >( dofKey );
+    elemDofNumber.setName( this->getName() + "/accessors/" + dofKey );
+
+    auto const ensembleAccessor = [&]( string const & key )
+    {
+      ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > >
+      accessor = elemManager.constructArrayViewAccessor< real64, 2 >( key );
+      accessor.setName( this->getName() + "/accessors/" + key );
+      return accessor;
+    };
+
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const pres =
+      ensembleAccessor( extrinsicMeshData::flow::ensemblePressure::key() );
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const dPres =
+      ensembleAccessor( extrinsicMeshData::flow::ensembleDeltaPressure::key() );
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const dens =
+      ensembleAccessor( extrinsicMeshData::flow::ensembleDensity::key() );
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const dDens_dPres =
+      ensembleAccessor( extrinsicMeshData::flow::ensembleDDensity_dPressure::key() );
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const mob =
+      ensembleAccessor( extrinsicMeshData::flow::ensembleMobility::key() );
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const dMob_dPres =
+      ensembleAccessor( extrinsicMeshData::flow::ensembleDMobility_dPressure::key() );
+
+    typename FluxKernel::SinglePhaseFlowAccessors flowAccessors( elemManager, this->getName() );
+    arrayView2d< real64 const > const transmissibility = m_ensembleTransmissibility.at( meshBodyName ).toViewConst();
+
+    fluxApprox.forStencils< CellElementStencilTPFA >( mesh, [&]( CellElementStencilTPFA const & stencil )
+    {
+      EnsembleFluxKernel::launch( stencil.createKernelWrapper(),
+                                  transmissibility,
+                                  dt,
+                                  dofManager.rankOffset(),
+                                  elemDofNumber.toNestedViewConst(),
+                                  flowAccessors.get< extrinsicMeshData::ghostRank >(),
+                                  flowAccessors.get< extrinsicMeshData::flow::gravityCoefficient >(),
+                                  pres.toNestedViewConst(),
+                                  dPres.toNestedViewConst(),
+                                  dens.toNestedViewConst(),
+                                  dDens_dPres.toNestedViewConst(),
+                                  mob.toNestedViewConst(),
+                                  dMob_dPres.toNestedViewConst(),
+                                  localMatrix,
+                                  m_ensembleJacobian.toView(),
+                                  m_ensembleRhs.toView() );
+    } );
+  } );
+}
+
 template<>
 void SinglePhaseFVM< SinglePhaseProppantBase >::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM ( time_n ),
                                                                    real64 const dt,
@@ -442,6 +689,11 @@ SinglePhaseFVM< BASE >::applyBoundaryConditions( real64 const time_n,
   GEOSX_MARK_FUNCTION;
 
   BASE::applyBoundaryConditions( time_n, dt, domain, dofManager, localMatrix, localRhs );
+  if( m_numRealizations > 1 )
+  {
+    // no face boundary condition in an ensemble run, see supportsEnsemble
+    return;
+  }
   applyFaceDirichletBC( time_n, dt, dofManager, domain, localMatrix, localRhs );
 }
 
@@ -57,6 +57,7 @@ public:
   using BASE::m_localMatrix;
   using BASE::m_linearSolverParameters;
   using BASE::m_nonlinearSolverParameters;
+  using BASE::m_numRealizations;
 
   // Aliasing public/protected members/methods of FlowSolverBase so we don't
   // have to use this->member etc.
@@ -68,6 +69,9 @@ public:
 
   // Aliasing public/protected members/methods of SinglePhaseBase so we don't
   // have to use this->member etc.
+  using BASE::m_ensembleJacobian;
+  using BASE::m_ensembleSolution;
+  using BASE::m_ensembleRhs;
 
   /**
    * @brief main constructor for Group Objects
@@ -193,6 +197,21 @@ public:
 
   virtual void initializePreSubGroups() override;
 
+  /**
+   * @brief Check whether the realizations of an ensemble can be advanced together.
+   * @return true for a two-point discretization of cell regions, with pressure-dependent porosities,
+   *         constant permeabilities and without face or aquifer boundary conditions
+   */
+  virtual bool supportsEnsemble() const override;
+
+  virtual void storeRealizationState( DomainPartition & domain,
+                                      integer const realization ) override;
+
+  virtual void assembleEnsembleFluxTerms( real64 const dt,
+                                          DomainPartition const & domain,
+                                          DofManager const & dofManager,
+                                          CRSMatrixView< real64, globalIndex const > const & localMatrix ) override;
+
 private:
 
   /**
@@ -211,7 +230,8 @@ private:
                              CRSMatrixView< real64, globalIndex const > const & localMatrix,
                              arrayView1d< real64 > const & localRhs );
 
-  // no data needed here, see SinglePhaseBase
+  /// Transmissibilities of the two-point stencils of each mesh body, one column per realization
+  std::map< string, array2d< real64 > > m_ensembleTransmissibility;
 
 };
 
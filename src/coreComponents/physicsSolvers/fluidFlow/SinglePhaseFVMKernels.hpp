@@ -278,6 +278,152 @@ struct FluxKernel
   }
 };
 
+/******************************** EnsembleFluxKernel ********************************/
+
+struct EnsembleFluxKernel
+{
+  template< typename VIEWTYPE >
+  using ElementViewConst = FluxKernel::ElementViewConst< VIEWTYPE >;
+
+  /**
+   * @brief Store the transmissibilities of a realization, which only depend on the constant permeabilities.
+   * @param[in] stencilWrapper the two-point stencil
+   * @param[in] permeability the permeabilities of the realization
+   * @param[in] dPerm_dPres the derivatives of the permeabilities with respect to pressure
+   * @param[in] realization the index of the realization
+   * @param[out] transmissibility the transmissibilities of the connections, one column per realization
+   */
+  static void
+  storeTransmissibility( CellElementStencilTPFA::KernelWrapper const & stencilWrapper,
+                         ElementViewConst< arrayView3d< real64 const > > const & permeability,
+                         ElementViewConst< arrayView3d< real64 const > > const & dPerm_dPres,
+                         integer const realization,
+                         arrayView2d< real64 > const & transmissibility )
+  {
+    forAll< parallelDevicePolicy<> >( stencilWrapper.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      real64 trans[1][2];
+      real64 dTrans_dPres[1][2];
+      stencilWrapper.computeWeights( iconn, permeability, dPerm_dPres, trans, dTrans_dPres );
+      transmissibility[iconn][realization] = trans[0][0];
+    } );
+  }
+
+  /**
+   * @brief Assemble the flux terms of all the realizations.
+   * @param[in] stencilWrapper the two-point stencil
+   * @param[in] transmissibility the transmissibilities of the connections, one column per realization
+   * @param[in] dt the time step
+   * @param[in] rankOffset the offset of the degrees of freedom of this rank
+   * @param[in] dofNumber the degrees of freedom of the elements
+   * @param[in] ghostRank the ghost ranks of the elements
+   * @param[in] gravCoef the gravity coefficients of the elements
+   * @param[in] pres the pressures at the beginning of the time step
+   * @param[in] dPres the accumulated pressure updates
+   * @param[in] dens the densities
+   * @param[in] dDens_dPres the derivatives of the densities with respect to pressure
+   * @param[in] mob the mobilities
+   * @param[in] dMob_dPres the derivatives of the mobilities with respect to pressure
+   * @param[in] localMatrix the solver matrix, providing the sparsity pattern
+   * @param[inout] ensembleJacobian the Jacobians of the realizations
+   * @param[inout] ensembleRhs the residuals of the realizations
+   * @details The rows and the matrix entries of a connection are found once for all the realizations.
+   */
+  static void
+  launch( CellElementStencilTPFA::KernelWrapper const & stencilWrapper,
+          arrayView2d< real64 const > const & transmissibility,
+          real64 const dt,
+          globalIndex const rankOffset,
+          ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+          ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+          ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
+          ElementViewConst< arrayView2d< real64 const > > const & pres,
+          ElementViewConst< arrayView2d< real64 const > > const & dPres,
+          ElementViewConst< arrayView2d< real64 const > > const & dens,
+          ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+          ElementViewConst< arrayView2d< real64 const > > const & mob,
+          ElementViewConst< arrayView2d< real64 const > > const & dMob_dPres,
+          CRSMatrixView< real64, globalIndex const > const & localMatrix,
+          arrayView2d< real64 > const & ensembleJacobian,
+          arrayView2d< real64 > const & ensembleRhs )
+  {
+    CellElementStencilTPFA::KernelWrapper::IndexContainerViewConstType const & seri = stencilWrapper.getElementRegionIndices();
+    CellElementStencilTPFA::KernelWrapper::IndexContainerViewConstType const & sesri = stencilWrapper.getElementSubRegionIndices();
+    CellElementStencilTPFA::KernelWrapper::IndexContainerViewConstType const & sei = stencilWrapper.getElementIndices();
+
+    forAll< parallelDevicePolicy<> >( stencilWrapper.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      localIndex er[2], esr[2], ei[2];
+      globalIndex dofs[2];
+      real64 gravD[2];
+      for( localIndex ke = 0; ke < 2; ++ke )
+      {
+        er[ke] = seri[iconn][ke];
+        esr[ke] = sesri[iconn][ke];
+        ei[ke] = sei[iconn][ke];
+        dofs[ke] = dofNumber[er[ke]][esr[ke]][ei[ke]];
+        gravD[ke] = gravCoef[er[ke]][esr[ke]][ei[ke]];
+      }
+
+      bool isOwned[2];
+      localIndex localRow[2]{};
+      localIndex entry[2][2]{};
+      for( localIndex ke = 0; ke < 2; ++ke )
+      {
+        isOwned[ke] = ghostRank[er[ke]][esr[ke]][ei[ke]] < 0;
+        if( isOwned[ke] )
+        {
+          localRow[ke] = LvArray::integerConversion< localIndex >( dofs[ke] - rankOffset );
+          GEOSX_ASSERT_GE( localRow[ke], 0 );
+          GEOSX_ASSERT_GT( localMatrix.numRows(), localRow[ke] );
+          for( localIndex kc = 0; kc < 2; ++kc )
+          {
+            entry[ke][kc] = singlePhaseBaseKernels::ensembleEntryIndex( localMatrix, localRow[ke], dofs[kc] );
+          }
+        }
+      }
+
+      real64 const dTrans_dPres[2] = { 0.0, 0.0 };
+      real64 const sign[2] = { 1.0, -1.0 };
+
+      for( localIndex r = 0; r < ensembleRhs.size( 1 ); ++r )
+      {
+        real64 const trans[2] = { transmissibility[iconn][r], -transmissibility[iconn][r] };
+        real64 cellPres[2], cellDens[2], cellDDens_dPres[2], cellMob[2], cellDMob_dPres[2];
+        for( localIndex ke = 0; ke < 2; ++ke )
+        {
+          cellPres[ke] = pres[er[ke]][esr[ke]][ei[ke]][r] + dPres[er[ke]][esr[ke]][ei[ke]][r];
+          cellDens[ke] = dens[er[ke]][esr[ke]][ei[ke]][r];
+          cellDDens_dPres[ke] = dDens_dPres[er[ke]][esr[ke]][ei[ke]][r];
+          cellMob[ke] = mob[er[ke]][esr[ke]][ei[ke]][r];
+          cellDMob_dPres[ke] = dMob_dPres[er[ke]][esr[ke]][ei[ke]][r];
+        }
+
+        real64 fluxVal = 0.0;
+        real64 dFlux_dP[2] = { 0.0, 0.0 };
+        real64 dFlux_dTrans = 0.0;
+        computeSinglePhaseFlux( trans, dTrans_dPres,
+                                cellPres, gravD,
+                                cellDens, cellDDens_dPres,
+                                cellMob, cellDMob_dPres,
+                                fluxVal, dFlux_dP, dFlux_dTrans );
+
+        for( localIndex ke = 0; ke < 2; ++ke )
+        {
+          if( isOwned[ke] )
+          {
+            RAJA::atomicAdd( parallelDeviceAtomic{}, &ensembleRhs[localRow[ke]][r], sign[ke] * dt * fluxVal );
+            for( localIndex kc = 0; kc < 2; ++kc )
+            {
+              RAJA::atomicAdd( parallelDeviceAtomic{}, &ensembleJacobian[entry[ke][kc]][r], sign[ke] * dt * dFlux_dP[kc] );
+            }
+          }
+        }
+      }
+    } );
+  }
+};
+
 struct FaceDirichletBCKernel
 {
   template< typename VIEWTYPE >
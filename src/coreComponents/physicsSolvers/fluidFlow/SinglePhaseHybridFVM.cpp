@@ -71,6 +71,19 @@ void SinglePhaseHybridFVM::registerDataOnMesh( Group & meshBodies )
     // primary variables: face pressures changes
     faceManager.registerExtrinsicData< extrinsicMeshData::flow::deltaFacePressure >( getName() );
   } );
+
+  // 3) Register the cached transmissibility matrices
+  forMeshTargets( meshBodies, [&] ( string const &,
+                                    MeshLevel & mesh,
+                                    arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             CellElementSubRegion & subRegion )
+    {
+      subRegion.registerExtrinsicData< extrinsicMeshData::flow::transMatrix >( getName() );
+    } );
+  } );
 }
 
 void SinglePhaseHybridFVM::initializePreSubGroups()
@@ -151,6 +164,66 @@ void SinglePhaseHybridFVM::initializePostInitialConditionsPreSubGroups()
   } );
 }
 
+void SinglePhaseHybridFVM::precomputeData( MeshLevel & mesh, arrayView1d< string const > const & regionNames )
+{
+  SinglePhaseBase::precomputeData( mesh, regionNames );
+
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  HybridMimeticDiscretization const & hmDiscretization = fvManager.getHybridMimeticDiscretization( m_discretizationName );
+  MimeticInnerProductBase const & mimeticInnerProductBase =
+    hmDiscretization.getReference< MimeticInnerProductBase >( HybridMimeticDiscretization::viewKeyStruct::innerProductString() );
+
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  FaceManager const & faceManager = mesh.getFaceManager();
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition = nodeManager.referencePosition();
+
+  arrayView1d< real64 const > const & transMultiplier =
+    faceManager.getReference< array1d< real64 > >( viewKeyStruct::transMultiplierString() );
+  ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
+
+  // tolerance for transmissibility calculation
+  real64 const lengthTolerance = domain.getMeshBody( 0 ).getGlobalLengthScale() * m_areaRelTol;
+
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                        CellElementSubRegion & subRegion )
+  {
+    arrayView2d< real64 const > const & elemCenter = subRegion.getElementCenter();
+    arrayView1d< real64 const > const & elemVolume = subRegion.getElementVolume();
+    arrayView2d< localIndex const > const & elemToFaces = subRegion.faceList();
+
+    string const & permName = subRegion.getReference< string >( viewKeyStruct::permeabilityNamesString() );
+    arrayView3d< real64 const > const & elemPerm =
+      getConstitutiveModel< PermeabilityBase >( subRegion, permName ).permeability();
+
+    // here we cache the transmissibility matrices used in the FluxKernel
+    // they are used as long as the permeability is constant, otherwise the FluxKernel recomputes them at each iteration
+    localIndex const numFacesPerElement = subRegion.numFacesPerElement();
+    array3d< real64 > & transMatrix =
+      subRegion.getReference< array3d< real64 > >( extrinsicMeshData::flow::transMatrix::key() );
+    transMatrix.resizeDimension< 1, 2 >( numFacesPerElement, numFacesPerElement );
+
+    mimeticInnerProductDispatch( mimeticInnerProductBase,
+                                 [&] ( auto const mimeticInnerProduct )
+    {
+      using IP_TYPE = TYPEOFREF( mimeticInnerProduct );
+      KernelLaunchSelector< IP_TYPE, hybridFVMKernels::TransMatrixKernel >( numFacesPerElement,
+                                                                            subRegion.size(),
+                                                                            nodePosition,
+                                                                            transMultiplier,
+                                                                            faceToNodes,
+                                                                            elemToFaces,
+                                                                            elemCenter,
+                                                                            elemVolume,
+                                                                            elemPerm,
+                                                                            lengthTolerance,
+                                                                            transMatrix.toView() );
+    } );
+  } );
+}
+
 void SinglePhaseHybridFVM::implicitStepSetup( real64 const & time_n,
                                               real64 const & dt,
                                               DomainPartition & domain )
@@ -175,6 +175,11 @@ public:
 
   virtual void initializePostInitialConditionsPreSubGroups() override;
 
+protected:
+
+  /// precompute the transmissibility matrices used in the flux assembly
+  void precomputeData( MeshLevel & mesh, arrayView1d< string const > const & regionNames ) override;
+
 private:
 
   /// Dof key for the member functions that do not have access to the coupled Dof manager
@@ -21,6 +21,7 @@
 
 #include "common/DataTypes.hpp"
 #include "constitutive/fluid/SingleFluidBase.hpp"
+#include "constitutive/permeability/ConstantPermeability.hpp"
 #include "constitutive/permeability/PermeabilityBase.hpp"
 #include "finiteVolume/mimeticInnerProducts/MimeticInnerProductBase.hpp"
 #include "finiteVolume/mimeticInnerProducts/TPFAInnerProduct.hpp"
@@ -567,6 +568,12 @@ struct FluxKernel
     // TODO add this dependency to the compute function
     //arrayView3d< real64 const > const elemdPermdPres = permeabilityModel.dPerm_dPressure();
 
+    // the transmissibility matrices only depend on the reference geometry and on the permeability
+    // if the permeability is constant, we use the matrices computed once and for all in precomputeData
+    bool const useCachedTransMatrix = dynamicCast< constitutive::ConstantPermeability const * >( &permeabilityModel ) != nullptr;
+    arrayView3d< real64 const > const cachedTransMatrix =
+      subRegion.getExtrinsicData< extrinsicMeshData::flow::transMatrix >();
+
     // get the cell-centered depth
     arrayView1d< real64 const > const elemGravCoef =
       subRegion.getExtrinsicData< extrinsicMeshData::flow::gravityCoefficient >();
@@ -582,21 +589,26 @@ struct FluxKernel
     {
 
       // transmissibility matrix
-      stackArray2d< real64, NF *NF > transMatrix( NF, NF );
-
-      real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
-
-      // recompute the local transmissibility matrix at each iteration
-      // we can decide later to precompute transMatrix if needed
-      IP_TYPE::template compute< NF >( nodePosition,
-                                       transMultiplier,
-                                       faceToNodes,
-                                       elemToFaces[ei],
-                                       elemCenter[ei],
-                                       elemVolume[ei],
-                                       perm,
-                                       lengthTolerance,
-                                       transMatrix );
+      stackArray2d< real64, NF *NF > localTransMatrix( NF, NF );
+
+      if( !useCachedTransMatrix )
+      {
+        real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+        // the permeability may have changed since the last iteration, so we recompute the local transmissibility matrix
+        IP_TYPE::template compute< NF >( nodePosition,
+                                         transMultiplier,
+                                         faceToNodes,
+                                         elemToFaces[ei],
+                                         elemCenter[ei],
+                                         elemVolume[ei],
+                                         perm,
+                                         lengthTolerance,
+                                         localTransMatrix );
+      }
+
+      arraySlice2d< real64 const > const transMatrix =
+        useCachedTransMatrix ? cachedTransMatrix[ei] : localTransMatrix.toSliceConst();
 
       // perform flux assembly in this element
       singlePhaseHybridFVMKernels::AssemblerKernel::compute< NF >( er, esr, ei,
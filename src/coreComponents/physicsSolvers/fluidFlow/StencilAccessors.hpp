@@ -24,6 +24,7 @@
 #include "codingUtilities/Utilities.hpp"
 
 #include <tuple>
+#include <typeinfo>
 
 namespace geosx
 {
@@ -60,6 +61,8 @@ public:
    * @brief Constructor for the struct
    * @param[in] elemManager a reference to the elemRegionManager
    * @param[in] solverName the name of the solver creating the view accessors
+   * @note The lookups of the fields are cached in @p elemManager, and are only done again
+   *       when the element subregions have changed.
    */
   StencilAccessors( ElementRegionManager const & elemManager,
                     string const & solverName )
@@ -69,9 +72,13 @@ public:
       GEOSX_UNUSED_VAR( t );
       using TRAIT = TYPEOFREF( t );
 
-      auto & acc = std::get< idx() >( m_accessors );
-      acc = elemManager.constructExtrinsicAccessor< TRAIT >();
-      acc.setName( solverName + "/accessors/" + TRAIT::key() );
+      string const name = solverName + "/accessors/" + TRAIT::key();
+      std::get< idx() >( m_accessors ) =
+        elemManager.getCachedAccessor< typename TRAIT::type,
+                                       traits::ViewTypeConst< typename TRAIT::type > >( name, []( ElementSubRegionBase const & subRegion )
+      {
+        return subRegion.getWrapperPointer< typename TRAIT::type >( TRAIT::key() );
+      } );
     } );
   }
 
@@ -114,10 +121,23 @@ public:
       GEOSX_UNUSED_VAR( t );
       using TRAIT = TYPEOFREF( t );
 
-      auto & acc = std::get< idx() >( m_accessors );
-      bool const allowMissingViews = false;
-      acc = elemManager.constructMaterialExtrinsicAccessor< MATERIAL_TYPE, TRAIT >( allowMissingViews );
-      acc.setName( solverName + "/accessors/" + TRAIT::key() );
+      // the material type is part of the cache key, since the same field may be accessed for several material types
+      string const name = solverName + "/accessors/" + TRAIT::key() + "/" + typeid( MATERIAL_TYPE ).name();
+      std::get< idx() >( m_accessors ) =
+        elemManager.getCachedAccessor< typename TRAIT::type,
+                                       traits::ViewTypeConst< typename TRAIT::type > >( name, []( ElementSubRegionBase const & subRegion )
+      {
+        // same material lookup as in constructMaterialViewAccessor
+        dataRepository::WrapperBase const * wrapper = nullptr;
+        subRegion.getConstitutiveModels().forSubGroups< MATERIAL_TYPE >( [&]( MATERIAL_TYPE const & material )
+        {
+          if( material.hasWrapper( TRAIT::key() ) )
+          {
+            wrapper = &material.getWrapperBase( TRAIT::key() );
+          }
+        } );
+        return wrapper;
+      } );
     } );
   }
 };
@@ -58,6 +58,13 @@ void FlowProppantTransportSolver::postProcessInput()
   m_flowSolver = &this->getParent().getGroup< FlowSolverBase >( m_flowSolverName );
 }
 
+real64 FlowProppantTransportSolver::computeStateChangeRatio( DomainPartition const & domain,
+                                                             NonlinearSolverParameters const & params ) const
+{
+  // the time step of the coupled problem is controlled by the change of the flow variables
+  return m_flowSolver->computeStateChangeRatio( domain, params );
+}
+
 FlowProppantTransportSolver::~FlowProppantTransportSolver() = default;
 
 void FlowProppantTransportSolver::preStepUpdate( real64 const & time_n,
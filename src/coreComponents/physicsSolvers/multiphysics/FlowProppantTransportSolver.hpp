@@ -50,6 +50,11 @@ public:
   virtual void
   resetStateToBeginningOfStep( DomainPartition & domain ) override;
 
+  virtual real64 computeStateChangeRatio( DomainPartition const & domain,
+                                          NonlinearSolverParameters const & params ) const override;
+
+  virtual bool hasStateChangeRatio() const override { return true; }
+
   struct viewKeyStruct : SolverBase::viewKeyStruct
   {
     constexpr static char const * proppantSolverNameString() { return "proppantSolverName"; }
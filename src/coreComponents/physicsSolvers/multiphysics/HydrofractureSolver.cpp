@@ -50,6 +50,7 @@ using namespace constitutive;
 HydrofractureSolver::HydrofractureSolver( const string & name,
                                           Group * const parent ):
   SinglePhasePoromechanicsSolver( name, parent ),
+  m_systemSetupMeshSize( -1 ),
   m_contactRelationName(),
   m_surfaceGeneratorName(),
   m_surfaceGenerator( nullptr ),
@@ -72,6 +73,14 @@ HydrofractureSolver::HydrofractureSolver( const string & name,
     setInputFlag( InputFlags::REQUIRED ).
     setDescription( "Coupling method. Valid options:\n* " + EnumStrings< CouplingTypeOption >::concat( "\n* " ) );
 
+  // the fixed-stress split is not available in this solver
+  this->getWrapper< CouplingType >( PoromechanicsSolverBase::viewKeyStruct::couplingTypeString() ).
+    setInputFlag( InputFlags::FALSE );
+  this->getWrapper< real64 >( PoromechanicsSolverBase::viewKeyStruct::fixedStressToleranceString() ).
+    setInputFlag( InputFlags::FALSE );
+  this->getWrapper< integer >( PoromechanicsSolverBase::viewKeyStruct::maxFixedStressIterationsString() ).
+    setInputFlag( InputFlags::FALSE );
+
   m_numResolves[0] = 0;
 
   m_linearSolverParameters.get().mgr.strategy = LinearSolverParameters::MGR::StrategyType::hydrofracture;
@@ -182,11 +191,18 @@ real64 HydrofractureSolver::solverStep( real64 const & time_n,
       int locallyFractured = 0;
       int globallyFractured = 0;
 
-      setupSystem( domain,
-                   m_dofManager,
-                   m_localMatrix,
-                   m_rhs,
-                   m_solution );
+      // The linear system only has to be set up again if the mesh has changed since the last setup,
+      // i.e. at the first step and after the fracture has propagated
+      localIndex const meshSize = countMeshObjects( domain );
+      if( MpiWrapper::max( static_cast< int >( meshSize != m_systemSetupMeshSize ) ) )
+      {
+        setupSystem( domain,
+                     m_dofManager,
+                     m_localMatrix,
+                     m_rhs,
+                     m_solution );
+        m_systemSetupMeshSize = meshSize;
+      }
 
       // currently the only method is implicit time integration
       dtReturn = nonlinearImplicitStep( time_n, dt, cycleNumber, domain );
@@ -236,6 +252,18 @@ real64 HydrofractureSolver::solverStep( real64 const & time_n,
   return dtReturn;
 }
 
+localIndex HydrofractureSolver::countMeshObjects( DomainPartition const & domain ) const
+{
+  // The surface generator only adds objects (split nodes and faces, new face elements) to the mesh
+  MeshLevel const & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  localIndex numObjects = mesh.getNodeManager().size() + mesh.getFaceManager().size();
+  mesh.getElemManager().forElementSubRegions< FaceElementSubRegion >( [&]( FaceElementSubRegion const & subRegion )
+  {
+    numObjects += subRegion.size();
+  } );
+  return numObjects;
+}
+
 void HydrofractureSolver::updateDeformationForCoupling( DomainPartition & domain )
 {
   MeshLevel & meshLevel = domain.getMeshBody( 0 ).getMeshLevel( 0 );
@@ -489,33 +517,13 @@ void HydrofractureSolver::setupSystem( DomainPartition & domain,
 
   localIndex const numLocalRows = dofManager.numLocalDofs();
 
-  SparsityPattern< globalIndex > patternOriginal;
-  dofManager.setSparsityPattern( patternOriginal );
+  // Count the nonzeros induced by the flux-aperture coupling, which is not known to the dofManager
+  array1d< localIndex > couplingRowLengths( numLocalRows );
+  addFluxApertureCouplingNNZ( domain, dofManager, couplingRowLengths.toView() );
 
-  // Get the original row lengths (diagonal blocks only)
-  array1d< localIndex > rowLengths( patternOriginal.numRows() );
-  for( localIndex localRow = 0; localRow < patternOriginal.numRows(); ++localRow )
-  {
-    rowLengths[localRow] = patternOriginal.numNonZeros( localRow );
-  }
-
-  // Add the number of nonzeros induced by coupling
-  addFluxApertureCouplingNNZ( domain, dofManager, rowLengths.toView() );
-
-  // Create a new pattern with enough capacity for coupled matrix
+  // Create the pattern with enough capacity for the coupling, whose nonzeros are then inserted in place
   SparsityPattern< globalIndex > pattern;
-  pattern.resizeFromRowCapacities< parallelHostPolicy >( patternOriginal.numRows(),
-                                                         patternOriginal.numColumns(),
-                                                         rowLengths.data() );
-
-  // Copy the original nonzeros
-  for( localIndex localRow = 0; localRow < patternOriginal.numRows(); ++localRow )
-  {
-    globalIndex const * cols = patternOriginal.getColumns( localRow ).dataIfContiguous();
-    pattern.insertNonZeros( localRow, cols, cols + patternOriginal.numNonZeros( localRow ) );
-  }
-
-  // Add the nonzeros from coupling
+  dofManager.setSparsityPattern( pattern, couplingRowLengths.toViewConst() );
   addFluxApertureCouplingSparsityPattern( domain, dofManager, pattern.toView() );
 
   localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
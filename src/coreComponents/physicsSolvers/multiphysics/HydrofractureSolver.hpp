@@ -201,6 +201,15 @@ protected:
                                    DofManager const & dofManager,
                                    CRSMatrix< real64, globalIndex > & localMatrix );
 
+  /**
+   * @brief Count the objects of the mesh that may be created by the surface generator.
+   * @param domain the physical domain object
+   * @return the total number of nodes, faces and face elements of the mesh
+   */
+  localIndex countMeshObjects( DomainPartition const & domain ) const;
+
+  /// Number of mesh objects (see countMeshObjects) when the linear system was last set up
+  localIndex m_systemSetupMeshSize;
 
 private:
 
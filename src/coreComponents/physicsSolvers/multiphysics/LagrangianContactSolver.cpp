@@ -266,6 +266,10 @@ void LagrangianContactSolver::implicitStepSetup( real64 const & time_n,
   computeRotationMatrices( domain );
   computeTolerances( domain );
   computeFaceDisplacementJump( domain );
+  computeStabilizationMatrices( domain );
+
+  // The ghost fracture states are then kept up to date by updateFractureState
+  synchronizeFractureState( domain );
 
   m_solidSolver->implicitStepSetup( time_n, dt, domain );
 }
@@ -1037,8 +1041,6 @@ void LagrangianContactSolver::assembleSystem( real64 const time,
 {
   GEOSX_MARK_FUNCTION;
 
-  synchronizeFractureState( domain );
-
   m_solidSolver->assembleSystem( time,
                                  dt,
                                  domain,
@@ -1754,25 +1756,21 @@ void LagrangianContactSolver::
   } );
 }
 
-void LagrangianContactSolver::assembleStabilization( DomainPartition const & domain,
-                                                     DofManager const & dofManager,
-                                                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                                                     arrayView1d< real64 > const & localRhs )
+void LagrangianContactSolver::computeStabilizationMatrices( DomainPartition const & domain )
 {
   GEOSX_MARK_FUNCTION;
 
+  // The matrices of all the stencils are stored one after the other, in the order of traversal
+  m_stabilizationMatrix.resize( 0, 3, 3 );
+
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel const & mesh,
                                                 arrayView1d< string const > const & )
   {
-
     FaceManager const & faceManager = mesh.getFaceManager();
     NodeManager const & nodeManager = mesh.getNodeManager();
     ElementRegionManager const & elemManager = mesh.getElemManager();
 
-    string const & tracDofKey = dofManager.getKey( viewKeyStruct::tractionString() );
-    globalIndex const rankOffset = dofManager.rankOffset();
-
     // Get the finite volume method used to compute the stabilization
     NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
     FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
@@ -1789,20 +1787,9 @@ void LagrangianContactSolver::assembleStabilization( DomainPartition const & dom
     surfaceGenerator = this->getParent().getGroup< SurfaceGenerator >( "SurfaceGen" );
     SurfaceElementRegion const & fractureRegion = elemManager.getRegion< SurfaceElementRegion >( surfaceGenerator.getFractureRegionName() );
     FaceElementSubRegion const & fractureSubRegion = fractureRegion.getSubRegion< FaceElementSubRegion >( "faceElementSubRegion" );
-    GEOSX_ERROR_IF( !fractureSubRegion.hasWrapper( m_tractionKey ), "The fracture subregion must contain traction field." );
     arrayView2d< localIndex const > const faceMap = fractureSubRegion.faceList();
     GEOSX_ERROR_IF( faceMap.size( 1 ) != 2, "A fracture face has to be shared by two cells." );
 
-    // Get the state of fracture elements
-    arrayView1d< integer const > const & fractureState =
-      fractureSubRegion.getReference< array1d< integer > >( viewKeyStruct::fractureStateString() );
-
-    // Get the tractions and stabilization contribution to the local jump
-    arrayView2d< real64 const > const & traction =
-      fractureSubRegion.getReference< array2d< real64 > >( viewKeyStruct::tractionString() );
-    arrayView2d< real64 const > const & deltaTraction =
-      fractureSubRegion.getReference< array2d< real64 > >( viewKeyStruct::deltaTractionString() );
-
     // Get the volume for all elements
     ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > const elemVolume =
       elemManager.constructViewAccessor< real64_array, arrayView1d< real64 const > >( ElementSubRegionBase::viewKeyStruct::elementVolumeString() );
@@ -1828,13 +1815,15 @@ void LagrangianContactSolver::assembleStabilization( DomainPartition const & dom
       elemManager.constructViewAccessor< CellElementSubRegion::NodeMapType, NodeMapViewType >( ElementSubRegionBase::viewKeyStruct::nodeListString() );
     ElementRegionManager::ElementViewConst< NodeMapViewType > const elemToNodeView = elemToNode.toNestedViewConst();
 
-    arrayView1d< globalIndex const > const & tracDofNumber = fractureSubRegion.getReference< globalIndex_array >( tracDofKey );
-
     stabilizationMethod.forStencils< SurfaceElementStencil >( mesh, [&]( SurfaceElementStencil const & stencil )
     {
       typename SurfaceElementStencil::IndexContainerViewConstType const & sei = stencil.getElementIndices();
 
-      forAll< serialPolicy >( stencil.size(), [=] ( localIndex const iconn )
+      localIndex const connOffset = m_stabilizationMatrix.size( 0 );
+      m_stabilizationMatrix.resize( connOffset + stencil.size(), 3, 3 );
+      arrayView3d< real64 > const stabilizationMatrix = m_stabilizationMatrix.toView();
+
+      forAll< serialPolicy >( stencil.size(), [&] ( localIndex const iconn )
       {
         localIndex const numFluxElems = sei.sizeOfArray( iconn );
 
@@ -2014,14 +2003,77 @@ void LagrangianContactSolver::assembleStabilization( DomainPartition const & dom
           LvArray::tensorOps::Rij_eq_AikBkj< 3, 3, 3 >( rotatedInvStiffApprox, temp, avgRotationMatrix );
 
           // Add nodal area contribution
-          stackArray2d< real64, 3*3 > totalInvStiffApprox( 3, 3 );
           for( localIndex i = 0; i < 3; ++i )
           {
             for( localIndex j = 0; j < 3; ++j )
             {
-              totalInvStiffApprox( i, j ) = -rotatedInvStiffApprox[ i ][ j ] * areafac;
+              stabilizationMatrix[connOffset + iconn][i][j] = -rotatedInvStiffApprox[ i ][ j ] * areafac;
             }
           }
+        }
+      } );
+    } );
+  } );
+}
+
+void LagrangianContactSolver::assembleStabilization( DomainPartition const & domain,
+                                                     DofManager const & dofManager,
+                                                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                     arrayView1d< real64 > const & localRhs )
+{
+  GEOSX_MARK_FUNCTION;
+
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel const & mesh,
+                                                arrayView1d< string const > const & )
+  {
+    ElementRegionManager const & elemManager = mesh.getElemManager();
+
+    string const & tracDofKey = dofManager.getKey( viewKeyStruct::tractionString() );
+    globalIndex const rankOffset = dofManager.rankOffset();
+
+    // Get the finite volume method used to compute the stabilization
+    NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+    FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+    FluxApproximationBase const & stabilizationMethod = fvManager.getFluxApproximation( m_stabilizationName );
+
+    SurfaceGenerator const &
+    surfaceGenerator = this->getParent().getGroup< SurfaceGenerator >( "SurfaceGen" );
+    SurfaceElementRegion const & fractureRegion = elemManager.getRegion< SurfaceElementRegion >( surfaceGenerator.getFractureRegionName() );
+    FaceElementSubRegion const & fractureSubRegion = fractureRegion.getSubRegion< FaceElementSubRegion >( "faceElementSubRegion" );
+    GEOSX_ERROR_IF( !fractureSubRegion.hasWrapper( m_tractionKey ), "The fracture subregion must contain traction field." );
+
+    // Get the state of fracture elements
+    arrayView1d< integer const > const & fractureState =
+      fractureSubRegion.getReference< array1d< integer > >( viewKeyStruct::fractureStateString() );
+
+    // Get the tractions and stabilization contribution to the local jump
+    arrayView2d< real64 const > const & traction =
+      fractureSubRegion.getReference< array2d< real64 > >( viewKeyStruct::tractionString() );
+    arrayView2d< real64 const > const & deltaTraction =
+      fractureSubRegion.getReference< array2d< real64 > >( viewKeyStruct::deltaTractionString() );
+
+    arrayView1d< globalIndex const > const & tracDofNumber = fractureSubRegion.getReference< globalIndex_array >( tracDofKey );
+
+    // The stabilization matrices only depend on the geometry and elastic properties, they are computed once per step
+    arrayView3d< real64 const > const stabilizationMatrix = m_stabilizationMatrix.toViewConst();
+    localIndex connOffset = 0;
+
+    stabilizationMethod.forStencils< SurfaceElementStencil >( mesh, [&]( SurfaceElementStencil const & stencil )
+    {
+      typename SurfaceElementStencil::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+
+      GEOSX_ERROR_IF_GT_MSG( connOffset + stencil.size(), stabilizationMatrix.size( 0 ),
+                             "The stabilization matrices are not up to date with the stencil." );
+
+      forAll< parallelHostPolicy >( stencil.size(), [=] ( localIndex const iconn )
+      {
+        localIndex const numFluxElems = sei.sizeOfArray( iconn );
+
+        // A fracture connector has to be an edge shared by two faces
+        if( numFluxElems == 2 )
+        {
+          arraySlice2d< real64 const > const totalInvStiffApprox = stabilizationMatrix[connOffset + iconn];
 
           // Get DOF numbering
           localIndex fractureIndex[2];
@@ -2065,11 +2117,11 @@ void LagrangianContactSolver::assembleStabilization( DomainPartition const & dom
           {
             for( localIndex j = 0; j < nDof[0]; ++j )
             {
-              totalInvStiffApprox00( i, j ) = totalInvStiffApprox( i, j );
+              totalInvStiffApprox00( i, j ) = totalInvStiffApprox[ i ][ j ];
             }
             for( localIndex j = 0; j < nDof[1]; ++j )
             {
-              totalInvStiffApprox01( i, j ) = -totalInvStiffApprox( i, j );
+              totalInvStiffApprox01( i, j ) = -totalInvStiffApprox[ i ][ j ];
             }
           }
 
@@ -2077,11 +2129,11 @@ void LagrangianContactSolver::assembleStabilization( DomainPartition const & dom
           {
             for( localIndex j = 0; j < nDof[0]; ++j )
             {
-              totalInvStiffApprox10( i, j ) = -totalInvStiffApprox( i, j );
+              totalInvStiffApprox10( i, j ) = -totalInvStiffApprox[ i ][ j ];
             }
             for( localIndex j = 0; j < nDof[1]; ++j )
             {
-              totalInvStiffApprox11( i, j ) = totalInvStiffApprox( i, j );
+              totalInvStiffApprox11( i, j ) = totalInvStiffApprox[ i ][ j ];
             }
           }
 
@@ -2144,7 +2196,6 @@ void LagrangianContactSolver::assembleStabilization( DomainPartition const & dom
             stackArray1d< real64, 3 > const & rhs = ( kf == 0 ) ? rhs0 : rhs1;
 
             // Only assemble contribution if "row" fracture element is local
-            // TODO: use parallel atomics
             if( localRow >= 0 && localRow < localMatrix.numRows() )
             {
               for( localIndex idof = 0; idof < nDof[kf]; ++idof )
@@ -2170,6 +2221,8 @@ void LagrangianContactSolver::assembleStabilization( DomainPartition const & dom
           }
         }
       } );
+
+      connOffset += stencil.size();
     } );
   } );
 }
@@ -2255,6 +2308,7 @@ bool LagrangianContactSolver::updateFractureState( DomainPartition & domain ) co
   GEOSX_MARK_FUNCTION;
 
   bool checkActiveSet = true;
+  integer stateChanged = 0;
 
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel & mesh,
@@ -2262,8 +2316,6 @@ bool LagrangianContactSolver::updateFractureState( DomainPartition & domain ) co
   {
     ElementRegionManager & elemManager = mesh.getElemManager();
 
-
-
     elemManager.forElementSubRegions< FaceElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                 FaceElementSubRegion & subRegion )
     {
@@ -2282,6 +2334,7 @@ bool LagrangianContactSolver::updateFractureState( DomainPartition & domain ) co
           subRegion.getReference< array1d< real64 > >( viewKeyStruct::normalDisplacementToleranceString() );
 
         RAJA::ReduceMin< parallelHostReduce, integer > checkActiveSetSub( 1 );
+        RAJA::ReduceMax< parallelHostReduce, integer > stateChangedSub( 0 );
 
         constitutiveUpdatePassThru( contact, [&] ( auto & castedContact )
         {
@@ -2344,6 +2397,7 @@ bool LagrangianContactSolver::updateFractureState( DomainPartition & domain ) co
 
               if( originalFractureState != fractureState[kfe] )
               {
+                stateChangedSub.max( 1 );
                 //            GEOSX_LOG_LEVEL_BY_RANK( 3, "element " << kfe << " traction: " << traction[kfe]
                 //                                                   << " previous state <"
                 //                                                   << FractureStateToString( originalFractureState )
@@ -2357,11 +2411,17 @@ bool LagrangianContactSolver::updateFractureState( DomainPartition & domain ) co
         } );
 
         checkActiveSet &= checkActiveSetSub.get();
+        stateChanged = std::max( stateChanged, stateChangedSub.get() );
       }
     } );
   } );
-  // Need to synchronize the fracture state due to the use will be made of in AssemblyStabilization
-  synchronizeFractureState( domain );
+
+  // Need to synchronize the fracture state due to the use will be made of in AssemblyStabilization,
+  // unless no locally owned element has changed state on any rank
+  if( MpiWrapper::max( stateChanged ) > 0 )
+  {
+    synchronizeFractureState( domain );
+  }
 
   // Compute if globally the fracture state has changed
   bool globalCheckActiveSet;
@@ -212,6 +212,9 @@ private:
 
   real64 m_initialResidual[3] = {0.0, 0.0, 0.0};
 
+  /// Stabilization matrix of each connection of the stabilization stencils, in the order of traversal
+  array3d< real64 > m_stabilizationMatrix;
+
   /**
    * @struct FractureState
    *
@@ -266,9 +269,9 @@ public:
 
   void setFractureStateForElasticStep( DomainPartition & domain ) const;
 
-  bool updateFractureState( DomainPartition & domain ) const;
+  virtual bool updateFractureState( DomainPartition & domain ) const;
 
-  void synchronizeFractureState( DomainPartition & domain ) const;
+  virtual void synchronizeFractureState( DomainPartition & domain ) const;
 
   bool isFractureAllInStickCondition( DomainPartition const & domain ) const;
 
@@ -282,6 +285,14 @@ public:
 
   void computeTolerances( DomainPartition & domain ) const;
 
+  /**
+   * @brief Compute the (rotated and area-weighted) stabilization matrix of each connection of the stabilization stencil.
+   * @param domain the domain partition
+   * @details These matrices only depend on the geometry and the elastic properties, they are computed
+   *          once per time step and reused at every Newton iteration by assembleStabilization.
+   */
+  void computeStabilizationMatrices( DomainPartition const & domain );
+
   void computeFaceNodalArea( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
                              ArrayOfArraysView< localIndex const > const & faceToNodeMap,
                              localIndex const kf0,
@@ -84,6 +84,9 @@ public:
    * @brief Constructor
    * @copydoc geosx::finiteElement::ImplicitKernelBase::ImplicitKernelBase
    * @param inputGravityVector The gravity vector.
+   *
+   * An empty @p inputFlowDofKey restricts the kernel to the linear momentum balance,
+   * with the flow variables treated as given fields.
    */
   Multiphase( NodeManager const & nodeManager,
               EdgeManager const & edgeManager,
@@ -118,13 +121,17 @@ public:
     m_gravityVector{ inputGravityVector[0], inputGravityVector[1], inputGravityVector[2] },
     m_gravityAcceleration( LvArray::tensorOps::l2Norm< 3 >( inputGravityVector ) ),
     m_solidDensity( inputConstitutiveType.getDensity() ),
+    m_momentumBalanceOnly( inputFlowDofKey.empty() ),
     m_numComponents( numComponents ),
     m_numPhases( numPhases )
   {
     GEOSX_ERROR_IF_GT_MSG( m_numComponents, numMaxComponents,
                            "MultiphasePoroelastic solver allows at most " << numMaxComponents << " components at the moment" );
 
-    m_flowDofNumber = elementSubRegion.template getReference< array1d< globalIndex > >( inputFlowDofKey );
+    if( !m_momentumBalanceOnly )
+    {
+      m_flowDofNumber = elementSubRegion.template getReference< array1d< globalIndex > >( inputFlowDofKey );
+    }
 
     // extract fluid constitutive data views
     {
@@ -265,6 +272,11 @@ public:
       }
     }
 
+    if( m_momentumBalanceOnly )
+    {
+      return;
+    }
+
     stack.localPressureDofIndex[0] = m_flowDofNumber[k];
     for( int flowDofIndex=0; flowDofIndex < numMaxComponents; ++flowDofIndex )
     {
@@ -401,6 +413,11 @@ public:
         detJxW );
     }
 
+    if( m_momentumBalanceOnly )
+    {
+      return;
+    }
+
     // Compute local linear momentum balance residual derivatives with respect to pressure
     BilinearFormUtilities::compute< displacementTestSpace,
                                     pressureTrialSpace,
@@ -561,6 +578,10 @@ public:
         RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[dof], stack.localResidualMomentum[numDofPerTestSupportPoint * localNode + dim] );
         maxForce = fmax( maxForce, fabs( stack.localResidualMomentum[numDofPerTestSupportPoint * localNode + dim] ) );
 
+        if( m_momentumBalanceOnly )
+        {
+          continue;
+        }
         m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
                                                                                 stack.localPressureDofIndex,
                                                                                 stack.dLocalResidualMomentum_dPressure[numDofPerTestSupportPoint * localNode + dim],
@@ -573,6 +594,11 @@ public:
       }
     }
 
+    if( m_momentumBalanceOnly )
+    {
+      return maxForce;
+    }
+
     localIndex const dof = LvArray::integerConversion< localIndex >( stack.localPressureDofIndex[0] - m_dofRankOffset );
     if( 0 <= dof && dof < m_matrix.numRows() )
     {
@@ -630,14 +656,14 @@ protected:
 
   arrayView3d< real64 const, constitutive::multifluid::USD_PHASE > m_fluidPhaseDensity;
   arrayView2d< real64 const, compflow::USD_PHASE > m_fluidPhaseDensityOld;
-  arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_DC > m_dFluidPhaseDensity;
+  arrayView4d< constitutive::multifluid::DerivativeType const, constitutive::multifluid::USD_PHASE_DC > m_dFluidPhaseDensity;
 
   arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_COMP > m_fluidPhaseCompFrac;
   arrayView3d< real64 const, compflow::USD_PHASE_COMP > m_fluidPhaseCompFracOld;
-  arrayView5d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC > m_dFluidPhaseCompFrac;
+  arrayView5d< constitutive::multifluid::DerivativeType const, constitutive::multifluid::USD_PHASE_COMP_DC > m_dFluidPhaseCompFrac;
 
   arrayView3d< real64 const, constitutive::multifluid::USD_PHASE > m_fluidPhaseMassDensity;
-  arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_DC > m_dFluidPhaseMassDensity;
+  arrayView4d< constitutive::multifluid::DerivativeType const, constitutive::multifluid::USD_PHASE_DC > m_dFluidPhaseMassDensity;
 
   arrayView2d< real64 const, constitutive::multifluid::USD_FLUID > m_initialFluidTotalMassDensity;
 
@@ -648,6 +674,9 @@ protected:
 
   arrayView3d< real64 const, compflow::USD_COMP_DC > m_dGlobalCompFraction_dGlobalCompDensity;
 
+  /// Flag to assemble the linear momentum balance only, with the flow variables treated as given fields
+  bool const m_momentumBalanceOnly;
+
   /// The global degree of freedom number
   arrayView1d< globalIndex const > m_flowDofNumber;
 
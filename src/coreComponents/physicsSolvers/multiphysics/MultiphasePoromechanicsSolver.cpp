@@ -46,19 +46,9 @@ using namespace constitutive;
 
 MultiphasePoromechanicsSolver::MultiphasePoromechanicsSolver( const string & name,
                                                               Group * const parent ):
-  SolverBase( name, parent ),
-  m_solidSolverName(),
-  m_flowSolverName()
-
+  PoromechanicsSolverBase( name, parent ),
+  m_flowSolver( nullptr )
 {
-  registerWrapper( viewKeyStruct::solidSolverNameString(), &m_solidSolverName ).
-    setInputFlag( InputFlags::REQUIRED ).
-    setDescription( "Name of the solid mechanics solver to use in the poroelastic solver" );
-
-  registerWrapper( viewKeyStruct::fluidSolverNameString(), &m_flowSolverName ).
-    setInputFlag( InputFlags::REQUIRED ).
-    setDescription( "Name of the fluid mechanics solver to use in the poroelastic solver" );
-
   m_linearSolverParameters.get().mgr.strategy = LinearSolverParameters::MGR::StrategyType::multiphasePoromechanics;
   m_linearSolverParameters.get().mgr.separateComponents = true;
   m_linearSolverParameters.get().mgr.displacementFieldName = keys::TotalDisplacement;
@@ -77,51 +67,6 @@ void MultiphasePoromechanicsSolver::setupDofs( DomainPartition const & domain,
                           DofManager::Connector::Elem );
 }
 
-void MultiphasePoromechanicsSolver::registerDataOnMesh( Group & meshBodies )
-{
-  SolverBase::registerDataOnMesh( meshBodies );
-
-  forMeshTargets( meshBodies, [&] ( string const &,
-                                    MeshLevel & mesh,
-                                    arrayView1d< string const > const & regionNames )
-  {
-
-    ElementRegionManager & elemManager = mesh.getElemManager();
-
-    elemManager.forElementSubRegions< ElementSubRegionBase >( regionNames,
-                                                              [&]( localIndex const,
-                                                                   ElementSubRegionBase & subRegion )
-    {
-      subRegion.registerWrapper< string >( viewKeyStruct::porousMaterialNamesString() ).
-        setPlotLevel( PlotLevel::NOPLOT ).
-        setRestartFlags( RestartFlags::NO_WRITE ).
-        setSizedFromParent( 0 );
-    } );
-  } );
-}
-
-void MultiphasePoromechanicsSolver::initializePreSubGroups()
-{
-  SolverBase::initializePreSubGroups();
-
-  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
-
-  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
-                                                MeshLevel & mesh,
-                                                arrayView1d< string const > const & regionNames )
-  {
-    ElementRegionManager & elementRegionManager = mesh.getElemManager();
-    elementRegionManager.forElementSubRegions< ElementSubRegionBase >( regionNames,
-                                                                       [&]( localIndex const,
-                                                                            ElementSubRegionBase & subRegion )
-    {
-      string & porousName = subRegion.getReference< string >( viewKeyStruct::porousMaterialNamesString() );
-      porousName = getConstitutiveName< CoupledSolidBase >( subRegion );
-      GEOSX_ERROR_IF( porousName.empty(), GEOSX_FMT( "Solid model not found on subregion {}", subRegion.getName() ) );
-    } );
-  } );
-}
-
 void MultiphasePoromechanicsSolver::setupSystem( DomainPartition & domain,
                                                  DofManager & dofManager,
                                                  CRSMatrix< real64, globalIndex > & localMatrix,
@@ -178,10 +123,15 @@ void MultiphasePoromechanicsSolver::implicitStepComplete( real64 const & time_n,
 
 void MultiphasePoromechanicsSolver::postProcessInput()
 {
-  SolverBase::postProcessInput();
-
+  // the flow solver is needed by the base class to set up the fixed-stress split
   m_flowSolver = &this->getParent().getGroup< CompositionalMultiphaseBase >( m_flowSolverName );
-  m_solidSolver = &this->getParent().getGroup< SolidMechanicsLagrangianFEM >( m_solidSolverName );
+
+  PoromechanicsSolverBase::postProcessInput();
+}
+
+FlowSolverBase * MultiphasePoromechanicsSolver::getFlowSolver() const
+{
+  return m_flowSolver;
 }
 
 MultiphasePoromechanicsSolver::~MultiphasePoromechanicsSolver()
@@ -200,6 +150,11 @@ real64 MultiphasePoromechanicsSolver::solverStep( real64 const & time_n,
                                                   int const cycleNumber,
                                                   DomainPartition & domain )
 {
+  if( m_couplingType == CouplingType::FixedStress )
+  {
+    return fixedStressStep( time_n, dt, cycleNumber, domain );
+  }
+
   real64 dt_return = dt;
 
   setupSystem( domain,
@@ -228,6 +183,29 @@ void MultiphasePoromechanicsSolver::assembleSystem( real64 const time_n,
 
   GEOSX_UNUSED_VAR( time_n );
 
+  // Cell-based contributions
+  assembleCellBasedTerms( domain,
+                          dofManager,
+                          dofManager.getKey( CompositionalMultiphaseBase::viewKeyStruct::elemDofFieldString() ),
+                          localMatrix,
+                          localRhs );
+
+  // Face-based contributions
+  m_flowSolver->assembleFluxTerms( dt,
+                                   domain,
+                                   dofManager,
+                                   localMatrix,
+                                   localRhs );
+}
+
+void MultiphasePoromechanicsSolver::assembleCellBasedTerms( DomainPartition & domain,
+                                                            DofManager const & dofManager,
+                                                            string const & flowDofKey,
+                                                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                            arrayView1d< real64 > const & localRhs )
+{
+  GEOSX_MARK_FUNCTION;
+
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel & mesh,
                                                 arrayView1d< string const > const & regionNames )
@@ -238,8 +216,6 @@ void MultiphasePoromechanicsSolver::assembleSystem( real64 const time_n,
     string const displacementDofKey = dofManager.getKey( dataRepository::keys::TotalDisplacement );
     arrayView1d< globalIndex const > const & displacementDofNumber = nodeManager.getReference< globalIndex_array >( displacementDofKey );
 
-    string const flowDofKey = dofManager.getKey( CompositionalMultiphaseBase::viewKeyStruct::elemDofFieldString() );
-
     localIndex const numComponents = m_flowSolver->numFluidComponents();
     localIndex const numPhases = m_flowSolver->numFluidPhases();
 
@@ -255,7 +231,6 @@ void MultiphasePoromechanicsSolver::assembleSystem( real64 const time_n,
                                                                  localMatrix,
                                                                  localRhs );
 
-    // Cell-based contributions
     m_solidSolver->getMaxForce() =
       finiteElement::
         regionBasedKernelApplication< parallelDevicePolicy< 32 >,
@@ -266,13 +241,6 @@ void MultiphasePoromechanicsSolver::assembleSystem( real64 const time_n,
                                                               viewKeyStruct::porousMaterialNamesString(),
                                                               kernelFactory );
   } );
-
-  // Face-based contributions
-  m_flowSolver->assembleFluxTerms( dt,
-                                   domain,
-                                   dofManager,
-                                   localMatrix,
-                                   localRhs );
 }
 
 void MultiphasePoromechanicsSolver::applyBoundaryConditions( real64 const time_n,
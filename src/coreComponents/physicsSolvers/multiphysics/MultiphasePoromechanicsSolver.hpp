@@ -20,17 +20,15 @@
 #ifndef GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_MULTIPHASEPOROMECHANICSSOLVER_HPP_
 #define GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_MULTIPHASEPOROMECHANICSSOLVER_HPP_
 
-#include "codingUtilities/EnumStrings.hpp"
-#include "physicsSolvers/SolverBase.hpp"
+#include "physicsSolvers/multiphysics/PoromechanicsSolverBase.hpp"
 
 namespace geosx
 {
 
 
-class SolidMechanicsLagrangianFEM;
 class CompositionalMultiphaseBase;
 
-class MultiphasePoromechanicsSolver : public SolverBase
+class MultiphasePoromechanicsSolver : public PoromechanicsSolverBase
 {
 public:
   MultiphasePoromechanicsSolver( const string & name,
@@ -43,8 +41,6 @@ public:
    */
   static string catalogName() { return "MultiphasePoromechanics"; }
 
-  virtual void registerDataOnMesh( Group & MeshBodies ) override;
-
   virtual void setupSystem( DomainPartition & domain,
                             DofManager & dofManager,
                             CRSMatrix< real64, globalIndex > & localMatrix,
@@ -110,29 +106,22 @@ public:
 
   virtual void updateState( DomainPartition & domain ) override;
 
-  struct viewKeyStruct : SolverBase::viewKeyStruct
-  {
-    constexpr static char const * solidSolverNameString() { return "solidSolverName"; }
-    constexpr static char const * fluidSolverNameString() { return "fluidSolverName"; }
+  virtual void
+  assembleCellBasedTerms( DomainPartition & domain,
+                          DofManager const & dofManager,
+                          string const & flowDofKey,
+                          CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                          arrayView1d< real64 > const & localRhs ) override;
 
-    constexpr static char const * porousMaterialNamesString() { return "porousMaterialNames"; }
-  };
+  virtual FlowSolverBase * getFlowSolver() const override;
 
 protected:
 
   virtual void postProcessInput() override;
 
-  virtual void initializePreSubGroups() override;
-
-  string m_solidSolverName;
-  string m_flowSolverName;
-
   // pointer to the flow sub-solver
   CompositionalMultiphaseBase * m_flowSolver;
 
-  // pointer to the solid mechanics sub-solver
-  SolidMechanicsLagrangianFEM * m_solidSolver;
-
 };
 
 } /* namespace geosx */
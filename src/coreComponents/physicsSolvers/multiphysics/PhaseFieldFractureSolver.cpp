@@ -114,6 +114,8 @@ void PhaseFieldFractureSolver::implicitStepComplete( real64 const & GEOSX_UNUSED
 
 void PhaseFieldFractureSolver::postProcessInput()
 {
+  SolverBase::postProcessInput();
+
   if( m_couplingTypeOption == CouplingTypeOption::FixedStress )
   {
     // For this coupled solver the minimum number of Newton Iter should be 0 for both flow and solid solver otherwise it
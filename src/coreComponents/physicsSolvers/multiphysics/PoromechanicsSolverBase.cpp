@@ -0,0 +1,307 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PoromechanicsSolverBase.cpp
+ *
+ */
+
+#include "PoromechanicsSolverBase.hpp"
+
+#include "constitutive/solid/CoupledSolidBase.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBase.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+using namespace constitutive;
+
+PoromechanicsSolverBase::PoromechanicsSolverBase( const string & name,
+                                                  Group * const parent ):
+  SolverBase( name, parent ),
+  m_solidSolverName(),
+  m_flowSolverName(),
+  m_solidSolver( nullptr ),
+  m_couplingType( CouplingType::FullyImplicit ),
+  m_fixedStressTolerance( 1e-6 ),
+  m_maxFixedStressIterations( 20 ),
+  m_numFixedStressIterations( 0 )
+{
+  registerWrapper( viewKeyStruct::solidSolverNameString(), &m_solidSolverName ).
+    setInputFlag( InputFlags::REQUIRED ).
+    setDescription( "Name of the solid mechanics solver to use in the poromechanics solver" );
+
+  registerWrapper( viewKeyStruct::fluidSolverNameString(), &m_flowSolverName ).
+    setInputFlag( InputFlags::REQUIRED ).
+    setDescription( "Name of the fluid mechanics solver to use in the poromechanics solver" );
+
+  registerWrapper( viewKeyStruct::couplingTypeString(), &m_couplingType ).
+    setApplyDefaultValue( CouplingType::FullyImplicit ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Coupling option. Valid options:\n* " + EnumStrings< CouplingType >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::fixedStressToleranceString(), &m_fixedStressTolerance ).
+    setApplyDefaultValue( 1e-6 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Tolerance on the residual norm of the momentum balance, evaluated with the pressure of the last flow step, "
+                    "to stop the fixed-stress iterations" );
+
+  registerWrapper( viewKeyStruct::maxFixedStressIterationsString(), &m_maxFixedStressIterations ).
+    setApplyDefaultValue( 20 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of fixed-stress iterations in a time step" );
+}
+
+PoromechanicsSolverBase::~PoromechanicsSolverBase() = default;
+
+void PoromechanicsSolverBase::registerDataOnMesh( Group & meshBodies )
+{
+  SolverBase::registerDataOnMesh( meshBodies );
+
+  forMeshTargets( meshBodies, [&] ( string const &,
+                                    MeshLevel & mesh,
+                                    arrayView1d< string const > const & regionNames )
+  {
+
+    ElementRegionManager & elemManager = mesh.getElemManager();
+
+    elemManager.forElementSubRegions< ElementSubRegionBase >( regionNames,
+                                                              [&]( localIndex const,
+                                                                   ElementSubRegionBase & subRegion )
+    {
+      subRegion.registerWrapper< string >( viewKeyStruct::porousMaterialNamesString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE ).
+        setSizedFromParent( 0 );
+    } );
+  } );
+}
+
+void PoromechanicsSolverBase::initializePreSubGroups()
+{
+  SolverBase::initializePreSubGroups();
+
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel & mesh,
+                                                arrayView1d< string const > const & regionNames )
+  {
+    ElementRegionManager & elementRegionManager = mesh.getElemManager();
+    elementRegionManager.forElementSubRegions< ElementSubRegionBase >( regionNames,
+                                                                       [&]( localIndex const,
+                                                                            ElementSubRegionBase & subRegion )
+    {
+      string & porousName = subRegion.getReference< string >( viewKeyStruct::porousMaterialNamesString() );
+      porousName = getConstitutiveName< CoupledSolidBase >( subRegion );
+      GEOSX_ERROR_IF( porousName.empty(), GEOSX_FMT( "Solid model not found on subregion {}", subRegion.getName() ) );
+    } );
+  } );
+}
+
+void PoromechanicsSolverBase::postProcessInput()
+{
+  SolverBase::postProcessInput();
+
+  m_solidSolver = &this->getParent().getGroup< SolidMechanicsLagrangianFEM >( m_solidSolverName );
+
+  if( m_couplingType == CouplingType::FixedStress )
+  {
+    getFlowSolver()->setFixedStressPoromechanicsUpdate();
+  }
+}
+
+real64 PoromechanicsSolverBase::computeStateChangeRatio( DomainPartition const & domain,
+                                                         NonlinearSolverParameters const & params ) const
+{
+  // the time step of the coupled problem is controlled by the change of the flow variables
+  return getFlowSolver()->computeStateChangeRatio( domain, params );
+}
+
+integer PoromechanicsSolverBase::numTimeStepControlIterations() const
+{
+  return m_couplingType == CouplingType::FixedStress ? m_numFixedStressIterations : SolverBase::numTimeStepControlIterations();
+}
+
+integer PoromechanicsSolverBase::maxTimeStepControlIterations() const
+{
+  return m_couplingType == CouplingType::FixedStress ? m_maxFixedStressIterations : SolverBase::maxTimeStepControlIterations();
+}
+
+real64 PoromechanicsSolverBase::fixedStressStep( real64 const & time_n,
+                                                 real64 const & dt,
+                                                 integer const cycleNumber,
+                                                 DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+  real64 dtReturn = dt;
+
+  FlowSolverBase & flowSolver = *getFlowSolver();
+
+  // the flow and the mechanics are solved on their own systems, with the linear solvers of the sub-solvers
+  flowSolver.setupSystem( domain,
+                          flowSolver.getDofManager(),
+                          flowSolver.getLocalMatrix(),
+                          flowSolver.getSystemRhs(),
+                          flowSolver.getSystemSolution() );
+
+  m_solidSolver->setupSystem( domain,
+                              m_solidSolver->getDofManager(),
+                              m_solidSolver->getLocalMatrix(),
+                              m_solidSolver->getSystemRhs(),
+                              m_solidSolver->getSystemSolution() );
+
+  implicitStepSetup( time_n, dt, domain );
+
+  integer iter = 0;
+  bool isConverged = false;
+  while( iter < m_maxFixedStressIterations )
+  {
+    // 1. Flow step, with the mean total stress of the last mechanics step held fixed
+    GEOSX_LOG_LEVEL_RANK_0( 1, GEOSX_FMT( "    Fixed-stress iteration {}: flow step", iter + 1 ) );
+
+    real64 const dtFlow = flowSolver.nonlinearImplicitStep( time_n, dtReturn, cycleNumber, domain );
+    if( dtFlow < dtReturn )
+    {
+      // the time step has been cut, restart the iterations from the beginning of the step
+      resetStateToBeginningOfStep( domain );
+      resetPorousMaterialsToBeginningOfStep( domain );
+      dtReturn = dtFlow;
+      iter = 0;
+      continue;
+    }
+
+    // 2. Mechanics step, with the pressure of the flow step held fixed
+    GEOSX_LOG_LEVEL_RANK_0( 1, GEOSX_FMT( "    Fixed-stress iteration {}: mechanics step", iter + 1 ) );
+
+    real64 const residualNorm = mechanicsStep( time_n, dtReturn, domain );
+    GEOSX_LOG_LEVEL_RANK_0( 1, GEOSX_FMT( "    Fixed-stress iteration {}: momentum balance residual norm = {:4.2e}", iter + 1, residualNorm ) );
+    if( residualNorm < m_fixedStressTolerance )
+    {
+      isConverged = true;
+      break;
+    }
+
+    ++iter;
+  }
+
+  integer const numIterations = isConverged ? iter + 1 : iter;
+  if( isConverged )
+  {
+    GEOSX_LOG_LEVEL_RANK_0( 1, GEOSX_FMT( "    The fixed-stress iterations have converged in {} iterations", numIterations ) );
+  }
+  else
+  {
+    GEOSX_ERROR_IF( getNonlinearSolverParameters().m_allowNonConverged == 0,
+                    GEOSX_FMT( "{}: the fixed-stress iterations did not converge in {} iterations", getName(), m_maxFixedStressIterations ) );
+    GEOSX_LOG_RANK_0( GEOSX_FMT( "{}: the fixed-stress iterations did not converge, accepting the solution anyway", getName() ) );
+  }
+
+  // the time-step control is based on the fixed-stress iterations, see numTimeStepControlIterations
+  m_numFixedStressIterations = numIterations;
+
+  implicitStepComplete( time_n, dtReturn, domain );
+
+  return dtReturn;
+}
+
+real64 PoromechanicsSolverBase::mechanicsStep( real64 const & time_n,
+                                               real64 const & dt,
+                                               DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  DofManager const & dofManager = m_solidSolver->getDofManager();
+  CRSMatrix< real64, globalIndex > & localMatrix = m_solidSolver->getLocalMatrix();
+  ParallelMatrix & matrix = m_solidSolver->getSystemMatrix();
+  ParallelVector & rhs = m_solidSolver->getSystemRhs();
+  ParallelVector & solution = m_solidSolver->getSystemSolution();
+  NonlinearSolverParameters const & solidParams = m_solidSolver->getNonlinearSolverParameters();
+
+  real64 initialResidualNorm = 0.0;
+  for( integer newtonIter = 0; newtonIter < solidParams.m_maxIterNewton; ++newtonIter )
+  {
+    localMatrix.zero();
+    rhs.zero();
+
+    {
+      arrayView1d< real64 > const localRhs = rhs.open();
+
+      // only the momentum balance is assembled, on the displacement degrees of freedom of the solid mechanics solver
+      assembleCellBasedTerms( domain,
+                              dofManager,
+                              string(),
+                              localMatrix.toViewConstSizes(),
+                              localRhs );
+
+      m_solidSolver->applyBoundaryConditions( time_n,
+                                              dt,
+                                              domain,
+                                              dofManager,
+                                              localMatrix.toViewConstSizes(),
+                                              localRhs );
+
+      rhs.close();
+    }
+
+    real64 const residualNorm = m_solidSolver->calculateResidualNorm( domain, dofManager, rhs.values() );
+    GEOSX_LOG_LEVEL_RANK_0( 2, GEOSX_FMT( "    Mechanics NewtonIter: {:2}, ( Rsolid ) = ( {:4.2e} )", newtonIter, residualNorm ) );
+
+    if( newtonIter == 0 )
+    {
+      initialResidualNorm = residualNorm;
+
+      // the mechanics is already in equilibrium with the pressure of the flow step
+      if( residualNorm < m_fixedStressTolerance )
+      {
+        break;
+      }
+    }
+
+    if( residualNorm < solidParams.m_newtonTol && newtonIter >= solidParams.m_minIterNewton )
+    {
+      break;
+    }
+
+    matrix.create( localMatrix.toViewConst(), dofManager.numLocalDofs(), MPI_COMM_GEOSX );
+
+    m_solidSolver->solveSystem( dofManager, matrix, rhs, solution );
+
+    m_solidSolver->applySystemSolution( dofManager, solution.values(), 1.0, domain );
+  }
+
+  return initialResidualNorm;
+}
+
+void PoromechanicsSolverBase::resetPorousMaterialsToBeginningOfStep( DomainPartition & domain ) const
+{
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel & mesh,
+                                                arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< ElementSubRegionBase >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             ElementSubRegionBase & subRegion )
+    {
+      string const & porousName = subRegion.getReference< string >( viewKeyStruct::porousMaterialNamesString() );
+      CoupledSolidBase const & porousMaterial = getConstitutiveModel< CoupledSolidBase >( subRegion, porousName );
+      porousMaterial.resetStateToBeginningOfStep();
+    } );
+  } );
+}
+
+} /* namespace geosx */
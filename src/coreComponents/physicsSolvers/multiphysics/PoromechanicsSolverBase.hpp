@@ -0,0 +1,183 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PoromechanicsSolverBase.hpp
+ *
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_POROMECHANICSSOLVERBASE_HPP_
+#define GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_POROMECHANICSSOLVERBASE_HPP_
+
+#include "codingUtilities/EnumStrings.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+namespace geosx
+{
+
+class FlowSolverBase;
+class SolidMechanicsLagrangianFEM;
+
+/**
+ * @class PoromechanicsSolverBase
+ *
+ * Base class of the solvers coupling a flow solver and a solid mechanics solver.
+ * Provides the input common to these solvers and the fixed-stress sequential coupling.
+ */
+class PoromechanicsSolverBase : public SolverBase
+{
+public:
+
+  /**
+   * @brief main constructor for Group Objects
+   * @param name the name of this instantiation of Group in the repository
+   * @param parent the parent group of this instantiation of Group
+   */
+  PoromechanicsSolverBase( const string & name,
+                           Group * const parent );
+
+  /**
+   * @brief default destructor
+   */
+  virtual ~PoromechanicsSolverBase() override;
+
+  /// deleted copy constructor
+  PoromechanicsSolverBase( PoromechanicsSolverBase const & ) = delete;
+
+  /// default move constructor
+  PoromechanicsSolverBase( PoromechanicsSolverBase && ) = default;
+
+  /// deleted assignment operator
+  PoromechanicsSolverBase & operator=( PoromechanicsSolverBase const & ) = delete;
+
+  /// deleted move operator
+  PoromechanicsSolverBase & operator=( PoromechanicsSolverBase && ) = delete;
+
+  virtual void registerDataOnMesh( Group & meshBodies ) override;
+
+  virtual real64 computeStateChangeRatio( DomainPartition const & domain,
+                                          NonlinearSolverParameters const & params ) const override;
+
+  virtual bool hasStateChangeRatio() const override { return true; }
+
+  virtual integer numTimeStepControlIterations() const override;
+
+  virtual integer maxTimeStepControlIterations() const override;
+
+  /**
+   * @brief Perform a time step with the fixed-stress split: the flow and the mechanics are solved in turn,
+   *        each on its own system with its own linear solver, until the mechanics is in equilibrium
+   *        with the pressure of the last flow step.
+   * @param time_n the time at the beginning of the step
+   * @param dt the desired time step
+   * @param cycleNumber the cycle number
+   * @param domain the domain partition
+   * @return the time step achieved
+   */
+  real64 fixedStressStep( real64 const & time_n,
+                          real64 const & dt,
+                          integer const cycleNumber,
+                          DomainPartition & domain );
+
+  /**
+   * @brief Assemble the cell-based terms of the poromechanics problem.
+   * @param domain the domain partition
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param flowDofKey the key of the flow degrees of freedom, or an empty string to assemble
+   *                   the linear momentum balance only, with the flow variables treated as given fields
+   * @param localMatrix the system matrix
+   * @param localRhs the system right-hand side vector
+   */
+  virtual void assembleCellBasedTerms( DomainPartition & domain,
+                                       DofManager const & dofManager,
+                                       string const & flowDofKey,
+                                       CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                       arrayView1d< real64 > const & localRhs ) = 0;
+
+  /**
+   * @brief accessor for the pointer to the flow solver
+   * @return a pointer to the flow solver
+   */
+  virtual FlowSolverBase * getFlowSolver() const = 0;
+
+  enum class CouplingType : integer
+  {
+    FullyImplicit,
+    FixedStress
+  };
+
+  struct viewKeyStruct : SolverBase::viewKeyStruct
+  {
+    constexpr static char const * solidSolverNameString() { return "solidSolverName"; }
+    constexpr static char const * fluidSolverNameString() { return "fluidSolverName"; }
+    constexpr static char const * porousMaterialNamesString() { return "porousMaterialNames"; }
+    constexpr static char const * couplingTypeString() { return "couplingType"; }
+    constexpr static char const * fixedStressToleranceString() { return "fixedStressTolerance"; }
+    constexpr static char const * maxFixedStressIterationsString() { return "maxFixedStressIterations"; }
+  };
+
+protected:
+
+  virtual void postProcessInput() override;
+
+  virtual void initializePreSubGroups() override;
+
+  string m_solidSolverName;
+  string m_flowSolverName;
+
+  // pointer to the solid mechanics sub-solver
+  SolidMechanicsLagrangianFEM * m_solidSolver;
+
+  /// coupling between the flow and the mechanics
+  CouplingType m_couplingType;
+
+  /// tolerance on the residual of the momentum balance to stop the fixed-stress iterations
+  real64 m_fixedStressTolerance;
+
+  /// maximum number of fixed-stress iterations in a time step
+  integer m_maxFixedStressIterations;
+
+  /// number of fixed-stress iterations of the last time step
+  integer m_numFixedStressIterations;
+
+private:
+
+  /**
+   * @brief Solve the linear momentum balance on the system of the solid mechanics solver,
+   *        with the flow variables of the last flow step treated as given fields.
+   * @param time_n the time at the beginning of the step
+   * @param dt the time step
+   * @param domain the domain partition
+   * @return the residual norm of the momentum balance before the first update
+   */
+  real64 mechanicsStep( real64 const & time_n,
+                        real64 const & dt,
+                        DomainPartition & domain );
+
+  /**
+   * @brief Reset the porous materials to the beginning of the time step, after a cut of the time step
+   *        during the fixed-stress iterations.
+   * @param domain the domain partition
+   */
+  void resetPorousMaterialsToBeginningOfStep( DomainPartition & domain ) const;
+
+};
+
+ENUM_STRINGS( PoromechanicsSolverBase::CouplingType,
+              "FullyImplicit",
+              "FixedStress" );
+
+} /* namespace geosx */
+
+#endif /* GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_POROMECHANICSSOLVERBASE_HPP_ */
@@ -65,6 +65,13 @@ void ReservoirSolverBase::postProcessInput()
   m_flowSolver->setReservoirWellsCoupling();
 }
 
+real64 ReservoirSolverBase::computeStateChangeRatio( DomainPartition const & domain,
+                                                     NonlinearSolverParameters const & params ) const
+{
+  // the time step of the coupled problem is controlled by the change of the flow variables
+  return m_flowSolver->computeStateChangeRatio( domain, params );
+}
+
 void ReservoirSolverBase::initializePostInitialConditionsPreSubGroups()
 {
   SolverBase::initializePostInitialConditionsPreSubGroups( );
@@ -170,6 +170,11 @@ public:
 
   WellSolverBase * getWellSolver() const { return m_wellSolver; }
 
+  virtual real64 computeStateChangeRatio( DomainPartition const & domain,
+                                          NonlinearSolverParameters const & params ) const override;
+
+  virtual bool hasStateChangeRatio() const override { return true; }
+
   struct viewKeyStruct : SolverBase::viewKeyStruct
   {
     // solver that assembles the reservoir equations
@@ -83,6 +83,9 @@ public:
    * @brief Constructor
    * @copydoc geosx::finiteElement::ImplicitKernelBase::ImplicitKernelBase
    * @param inputGravityVector The gravity vector.
+   *
+   * An empty @p inputFlowDofKey restricts the kernel to the linear momentum balance,
+   * with the pressure treated as a given field.
    */
   SinglePhase( NodeManager const & nodeManager,
                EdgeManager const & edgeManager,
@@ -119,7 +122,10 @@ public:
     m_fluidDensityOld( elementSubRegion.template getExtrinsicData< extrinsicMeshData::flow::densityOld >() ),
     m_initialFluidDensity( elementSubRegion.template getConstitutiveModel< constitutive::SingleFluidBase >( elementSubRegion.template getReference< string >( fluidModelKey ) ).initialDensity() ),
     m_dFluidDensity_dPressure( elementSubRegion.template getConstitutiveModel< constitutive::SingleFluidBase >( elementSubRegion.template getReference< string >( fluidModelKey ) ).dDensity_dPressure() ),
-    m_flowDofNumber( elementSubRegion.template getReference< array1d< globalIndex > >( inputFlowDofKey )),
+    m_momentumBalanceOnly( inputFlowDofKey.empty() ),
+    m_flowDofNumber( m_momentumBalanceOnly
+                     ? arrayView1d< globalIndex const >()
+                     : elementSubRegion.template getReference< array1d< globalIndex > >( inputFlowDofKey ).toViewConst() ),
     m_initialFluidPressure( elementSubRegion.template getExtrinsicData< extrinsicMeshData::flow::initialPressure >() ),
     m_fluidPressureOld( elementSubRegion.template getExtrinsicData< extrinsicMeshData::flow::pressure >() ),
     m_deltaFluidPressure( elementSubRegion.template getExtrinsicData< extrinsicMeshData::flow::deltaPressure >() )
@@ -212,7 +218,10 @@ public:
       }
     }
 
-    stack.localFlowDofIndex[0] = m_flowDofNumber[k];
+    if( !m_momentumBalanceOnly )
+    {
+      stack.localFlowDofIndex[0] = m_flowDofNumber[k];
+    }
 
   }
 
@@ -361,6 +370,11 @@ public:
         detJxW );
     }
 
+    if( m_momentumBalanceOnly )
+    {
+      return;
+    }
+
     // Compute local linear momentum balance residual derivatives with respect to pressure
     BilinearFormUtilities::compute< displacementTestSpace,
                                     pressureTrialSpace,
@@ -450,6 +464,10 @@ public:
         RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[dof], stack.localResidualMomentum[numDofPerTestSupportPoint * localNode + dim] );
         maxForce = fmax( maxForce, fabs( stack.localResidualMomentum[numDofPerTestSupportPoint * localNode + dim] ) );
 
+        if( m_momentumBalanceOnly )
+        {
+          continue;
+        }
         m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
                                                                                 stack.localFlowDofIndex,
                                                                                 stack.dLocalResidualMomentum_dPressure[numDofPerTestSupportPoint * localNode + dim],
@@ -458,6 +476,10 @@ public:
       }
     }
 
+    if( m_momentumBalanceOnly )
+    {
+      return maxForce;
+    }
 
     localIndex const dof = LvArray::integerConversion< localIndex >( stack.localFlowDofIndex[0] - m_dofRankOffset );
     if( 0 <= dof && dof < m_matrix.numRows() )
@@ -497,6 +519,9 @@ protected:
   arrayView2d< real64 const > const m_initialFluidDensity;
   arrayView2d< real64 const > const m_dFluidDensity_dPressure;
 
+  /// Flag to assemble the linear momentum balance only, with the pressure treated as a given field
+  bool const m_momentumBalanceOnly;
+
   /// The global degree of freedom number
   arrayView1d< globalIndex const > const m_flowDofNumber;
 
@@ -47,70 +47,15 @@ using namespace constitutive;
 
 SinglePhasePoromechanicsSolver::SinglePhasePoromechanicsSolver( const string & name,
                                                                 Group * const parent ):
-  SolverBase( name, parent ),
-  m_solidSolverName(),
-  m_flowSolverName()
-
+  PoromechanicsSolverBase( name, parent ),
+  m_flowSolver( nullptr )
 {
-  registerWrapper( viewKeyStruct::solidSolverNameString(), &m_solidSolverName ).
-    setInputFlag( InputFlags::REQUIRED ).
-    setDescription( "Name of the solid mechanics solver to use in the poromechanics solver" );
-
-  registerWrapper( viewKeyStruct::fluidSolverNameString(), &m_flowSolverName ).
-    setInputFlag( InputFlags::REQUIRED ).
-    setDescription( "Name of the fluid mechanics solver to use in the poromechanics solver" );
-
   m_linearSolverParameters.get().mgr.strategy = LinearSolverParameters::MGR::StrategyType::singlePhasePoromechanics;
   m_linearSolverParameters.get().mgr.separateComponents = true;
   m_linearSolverParameters.get().mgr.displacementFieldName = keys::TotalDisplacement;
   m_linearSolverParameters.get().dofsPerNode = 3;
 }
 
-void SinglePhasePoromechanicsSolver::registerDataOnMesh( Group & meshBodies )
-{
-  SolverBase::registerDataOnMesh( meshBodies );
-
-  forMeshTargets( meshBodies, [&] ( string const &,
-                                    MeshLevel & mesh,
-                                    arrayView1d< string const > const & regionNames )
-  {
-
-    ElementRegionManager & elemManager = mesh.getElemManager();
-
-    elemManager.forElementSubRegions< ElementSubRegionBase >( regionNames,
-                                                              [&]( localIndex const,
-                                                                   ElementSubRegionBase & subRegion )
-    {
-      subRegion.registerWrapper< string >( viewKeyStruct::porousMaterialNamesString() ).
-        setPlotLevel( PlotLevel::NOPLOT ).
-        setRestartFlags( RestartFlags::NO_WRITE ).
-        setSizedFromParent( 0 );
-    } );
-  } );
-}
-
-void SinglePhasePoromechanicsSolver::initializePreSubGroups()
-{
-  SolverBase::initializePreSubGroups();
-
-  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
-
-  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
-                                                MeshLevel & mesh,
-                                                arrayView1d< string const > const & regionNames )
-  {
-    ElementRegionManager & elementRegionManager = mesh.getElemManager();
-    elementRegionManager.forElementSubRegions< ElementSubRegionBase >( regionNames,
-                                                                       [&]( localIndex const,
-                                                                            ElementSubRegionBase & subRegion )
-    {
-      string & porousName = subRegion.getReference< string >( viewKeyStruct::porousMaterialNamesString() );
-      porousName = getConstitutiveName< CoupledSolidBase >( subRegion );
-      GEOSX_ERROR_IF( porousName.empty(), GEOSX_FMT( "Solid model not found on subregion {}", subRegion.getName() ) );
-    } );
-  } );
-}
-
 void SinglePhasePoromechanicsSolver::setupDofs( DomainPartition const & domain,
                                                 DofManager & dofManager ) const
 {
@@ -162,10 +107,15 @@ void SinglePhasePoromechanicsSolver::implicitStepComplete( real64 const & time_n
 
 void SinglePhasePoromechanicsSolver::postProcessInput()
 {
-  SolverBase::postProcessInput();
-
+  // the flow solver is needed by the base class to set up the fixed-stress split
   m_flowSolver = &this->getParent().getGroup< SinglePhaseBase >( m_flowSolverName );
-  m_solidSolver = &this->getParent().getGroup< SolidMechanicsLagrangianFEM >( m_solidSolverName );
+
+  PoromechanicsSolverBase::postProcessInput();
+}
+
+FlowSolverBase * SinglePhasePoromechanicsSolver::getFlowSolver() const
+{
+  return m_flowSolver;
 }
 
 void SinglePhasePoromechanicsSolver::initializePostInitialConditionsPreSubGroups()
@@ -192,6 +142,11 @@ real64 SinglePhasePoromechanicsSolver::solverStep( real64 const & time_n,
                                                    int const cycleNumber,
                                                    DomainPartition & domain )
 {
+  if( m_couplingType == CouplingType::FixedStress )
+  {
+    return fixedStressStep( time_n, dt, cycleNumber, domain );
+  }
+
   real64 dt_return = dt;
 
   setupSystem( domain,
@@ -218,6 +173,30 @@ void SinglePhasePoromechanicsSolver::assembleSystem( real64 const time_n,
 {
 
   GEOSX_MARK_FUNCTION;
+
+  // Cell-based contributions
+  assembleCellBasedTerms( domain,
+                          dofManager,
+                          dofManager.getKey( extrinsicMeshData::flow::pressure::key() ),
+                          localMatrix,
+                          localRhs );
+
+  m_flowSolver->assemblePoroelasticFluxTerms( time_n, dt,
+                                              domain,
+                                              dofManager,
+                                              localMatrix,
+                                              localRhs,
+                                              " " );
+}
+
+void SinglePhasePoromechanicsSolver::assembleCellBasedTerms( DomainPartition & domain,
+                                                             DofManager const & dofManager,
+                                                             string const & flowDofKey,
+                                                             CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                             arrayView1d< real64 > const & localRhs )
+{
+  GEOSX_MARK_FUNCTION;
+
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel & mesh,
                                                 arrayView1d< string const > const & regionNames )
@@ -227,21 +206,18 @@ void SinglePhasePoromechanicsSolver::assembleSystem( real64 const time_n,
     string const dofKey = dofManager.getKey( dataRepository::keys::TotalDisplacement );
     arrayView1d< globalIndex const > const & dispDofNumber = nodeManager.getReference< globalIndex_array >( dofKey );
 
-    string const pDofKey = dofManager.getKey( extrinsicMeshData::flow::pressure::key() );
-
 //  m_solidSolver->resetStressToBeginningOfStep( domain );
 
     real64 const gravityVectorData[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( gravityVector() );
 
     poromechanicsKernels::SinglePhaseKernelFactory kernelFactory( dispDofNumber,
-                                                                  pDofKey,
+                                                                  flowDofKey,
                                                                   dofManager.rankOffset(),
                                                                   localMatrix,
                                                                   localRhs,
                                                                   gravityVectorData,
                                                                   FlowSolverBase::viewKeyStruct::fluidNamesString() );
 
-    // Cell-based contributions
     m_solidSolver->getMaxForce() =
       finiteElement::
         regionBasedKernelApplication< parallelDevicePolicy< 32 >,
@@ -253,13 +229,6 @@ void SinglePhasePoromechanicsSolver::assembleSystem( real64 const time_n,
                                                               kernelFactory );
 
   } );
-
-  m_flowSolver->assemblePoroelasticFluxTerms( time_n, dt,
-                                              domain,
-                                              dofManager,
-                                              localMatrix,
-                                              localRhs,
-                                              " " );
 }
 
 void SinglePhasePoromechanicsSolver::applyBoundaryConditions( real64 const time_n,
@@ -20,17 +20,15 @@
 #ifndef GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_SINGLEPHASEPOROMECHANICSSOLVER_HPP_
 #define GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_SINGLEPHASEPOROMECHANICSSOLVER_HPP_
 
-#include "codingUtilities/EnumStrings.hpp"
-#include "physicsSolvers/SolverBase.hpp"
+#include "physicsSolvers/multiphysics/PoromechanicsSolverBase.hpp"
 
 namespace geosx
 {
 
 
-class SolidMechanicsLagrangianFEM;
 class SinglePhaseBase;
 
-class SinglePhasePoromechanicsSolver : public SolverBase
+class SinglePhasePoromechanicsSolver : public PoromechanicsSolverBase
 {
 public:
   SinglePhasePoromechanicsSolver( const string & name,
@@ -43,8 +41,6 @@ public:
    */
   static string catalogName() { return "SinglePhasePoromechanics"; }
 
-  virtual void registerDataOnMesh( Group & MeshBodies ) override;
-
   virtual void setupSystem( DomainPartition & domain,
                             DofManager & dofManager,
                             CRSMatrix< real64, globalIndex > & localMatrix,
@@ -111,12 +107,18 @@ public:
               int const cycleNumber,
               DomainPartition & domain ) override;
 
-  struct viewKeyStruct : SolverBase::viewKeyStruct
+  virtual void
+  assembleCellBasedTerms( DomainPartition & domain,
+                          DofManager const & dofManager,
+                          string const & flowDofKey,
+                          CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                          arrayView1d< real64 > const & localRhs ) override;
+
+  virtual FlowSolverBase * getFlowSolver() const override;
+
+  struct viewKeyStruct : PoromechanicsSolverBase::viewKeyStruct
   {
     constexpr static char const * dPerm_dDisplacementString() { return "dPerm_dDisplacement"; }
-    constexpr static char const * solidSolverNameString() { return "solidSolverName"; }
-    constexpr static char const * fluidSolverNameString() { return "fluidSolverName"; }
-    constexpr static char const * porousMaterialNamesString() { return "porousMaterialNames"; }
   };
 
 protected:
@@ -125,17 +127,9 @@ protected:
 
   virtual void initializePostInitialConditionsPreSubGroups() override;
 
-  virtual void initializePreSubGroups() override;
-
-  string m_solidSolverName;
-  string m_flowSolverName;
-
   // pointer to the flow sub-solver
   SinglePhaseBase * m_flowSolver;
 
-  // pointer to the solid mechanics sub-solver
-  SolidMechanicsLagrangianFEM * m_solidSolver;
-
 private:
 
   void createPreconditioner();
@@ -59,6 +59,14 @@ SinglePhasePoromechanicsSolverEmbeddedFractures::SinglePhasePoromechanicsSolverE
 
   this->getWrapper< string >( viewKeyStruct::discretizationString() ).
     setInputFlag( InputFlags::FALSE );
+
+  // the fixed-stress split is not available in this solver
+  this->getWrapper< CouplingType >( viewKeyStruct::couplingTypeString() ).
+    setInputFlag( InputFlags::FALSE );
+  this->getWrapper< real64 >( viewKeyStruct::fixedStressToleranceString() ).
+    setInputFlag( InputFlags::FALSE );
+  this->getWrapper< integer >( viewKeyStruct::maxFixedStressIterationsString() ).
+    setInputFlag( InputFlags::FALSE );
 }
 
 SinglePhasePoromechanicsSolverEmbeddedFractures::~SinglePhasePoromechanicsSolverEmbeddedFractures()
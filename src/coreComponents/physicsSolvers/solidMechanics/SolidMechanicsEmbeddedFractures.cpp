@@ -76,6 +76,8 @@ SolidMechanicsEmbeddedFractures::~SolidMechanicsEmbeddedFractures()
 
 void SolidMechanicsEmbeddedFractures::postProcessInput()
 {
+  SolverBase::postProcessInput();
+
   m_solidSolver = &this->getParent().getGroup< SolidMechanicsLagrangianFEM >( m_solidSolverName );
 
   LinearSolverParameters & linParams = m_linearSolverParameters.get();
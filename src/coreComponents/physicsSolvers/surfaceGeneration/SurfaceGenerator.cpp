@@ -92,6 +92,19 @@ void ModifiedObjectLists::insert( ModifiedObjectLists const & modifiedObjects )
 
 }
 
+bool ModifiedObjectLists::empty() const
+{
+  auto const noElements = []( map< std::pair< localIndex, localIndex >, std::set< localIndex > > const & elements )
+  {
+    return std::all_of( elements.begin(), elements.end(), []( auto const & iter ) { return iter.second.empty(); } );
+  };
+
+  return newNodes.empty() && modifiedNodes.empty() &&
+         newEdges.empty() && modifiedEdges.empty() &&
+         newFaces.empty() && modifiedFaces.empty() &&
+         noElements( newElements ) && noElements( modifiedElements );
+}
+
 static localIndex GetOtherFaceEdge( const map< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
                                     const localIndex thisFace, const localIndex thisEdge )
 {
@@ -515,10 +528,8 @@ int SurfaceGenerator::separationDriver( DomainPartition & domain,
   FaceManager & faceManager = mesh.getFaceManager();
   ElementRegionManager & elementManager = mesh.getElemManager();
 
-  std::vector< std::set< localIndex > > nodesToRupturedFaces;
-  std::vector< std::set< localIndex > > edgesToRupturedFaces;
-
-  ArrayOfArrays< localIndex > const & nodeToElementMap = nodeManager.elementList();
+  ArrayOfSets< localIndex > nodesToRupturedFaces;
+  ArrayOfSets< localIndex > edgesToRupturedFaces;
 
   map< string, string_array > fieldNames;
   fieldNames["face"].emplace_back( string( extrinsicMeshData::RuptureState::key() ) );
@@ -568,62 +579,51 @@ int SurfaceGenerator::separationDriver( DomainPartition & domain,
   int rval = 0;
   //  array1d<MaterialBaseStateDataT*>&  temp = elementManager.m_ElementRegions["PM1"].m_materialStates;
 
-  array1d< integer > const & isNodeGhost = nodeManager.ghostRank();
-
   for( int color=0; color<numTileColors; ++color )
   {
     ModifiedObjectLists modifiedObjects;
     if( color==tileColor )
     {
-      for( localIndex a=0; a<nodeManager.size(); ++a )
-      {
-        int didSplit = 0;
-        if( isNodeGhost[a]<0 &&
-            nodeToElementMap.sizeOfArray( a )>1 )
-        {
-          didSplit += processNode( a,
-                                   time_np1,
-                                   nodeManager,
-                                   edgeManager,
-                                   faceManager,
-                                   elementManager,
-                                   nodesToRupturedFaces,
-                                   edgesToRupturedFaces,
-                                   elementManager,
-                                   modifiedObjects, prefrac );
-          if( didSplit > 0 )
-          {
-            rval += didSplit;
-            --a;
-          }
-        }
-      }
+      rval += processNodes( time_np1,
+                            nodeManager,
+                            edgeManager,
+                            faceManager,
+                            elementManager,
+                            nodesToRupturedFaces.toViewConst(),
+                            edgesToRupturedFaces.toViewConst(),
+                            modifiedObjects );
     }
 
 #ifdef GEOSX_USE_MPI
 
     modifiedObjects.clearNewFromModified();
 
-    // 1) Assign new global indices to the new objects
-    CommunicationTools::getInstance().assignNewGlobalIndices( nodeManager, modifiedObjects.newNodes );
-    CommunicationTools::getInstance().assignNewGlobalIndices( edgeManager, modifiedObjects.newEdges );
-    CommunicationTools::getInstance().assignNewGlobalIndices( faceManager, modifiedObjects.newFaces );
-//    CommunicationTools::getInstance().AssignNewGlobalIndices( elementManager, modifiedObjects.newElements );
-
-    ModifiedObjectLists receivedObjects;
-
-    /// Nodes to edges in process node is not being set on rank 2. need to check that the new node->edge map is properly
-    /// communicated
-    parallelTopologyChange::synchronizeTopologyChange( &mesh,
-                                                       neighbors,
-                                                       modifiedObjects,
-                                                       receivedObjects,
-                                                       m_mpiCommOrder );
-
-    synchronizeTipSets( faceManager,
-                        edgeManager,
-                        nodeManager,
-                        receivedObjects );
+    // Most colors do not split anything on any rank: the (collective) topology change exchanges are skipped in that case.
+    // The exchanges stay per color, since the ranks of a color may only split objects their neighbors do not split.
+    if( MpiWrapper::max( static_cast< int >( !modifiedObjects.empty() ) ) > 0 )
+    {
+      // 1) Assign new global indices to the new objects, with a single gather of the counts for all the managers
+      CommunicationTools::getInstance().assignNewGlobalIndices( { &nodeManager, &edgeManager, &faceManager },
+                                                                { &modifiedObjects.newNodes,
+                                                                  &modifiedObjects.newEdges,
+                                                                  &modifiedObjects.newFaces } );
+//      CommunicationTools::getInstance().AssignNewGlobalIndices( elementManager, modifiedObjects.newElements );
+
+      ModifiedObjectLists receivedObjects;
+
+      /// Nodes to edges in process node is not being set on rank 2. need to check that the new node->edge map is properly
+      /// communicated
+      parallelTopologyChange::synchronizeTopologyChange( &mesh,
+                                                         neighbors,
+                                                         modifiedObjects,
+                                                         receivedObjects,
+                                                         m_mpiCommOrder );
+
+      synchronizeTipSets( faceManager,
+                          edgeManager,
+                          nodeManager,
+                          receivedObjects );
+    }
 
 
 #else
@@ -859,62 +859,150 @@ void SurfaceGenerator::synchronizeTipSets ( FaceManager & faceManager,
 //**********************************************************************************************************************
 //**********************************************************************************************************************
 //**********************************************************************************************************************
-bool SurfaceGenerator::processNode( const localIndex nodeID,
-                                    real64 const time_np1,
+int SurfaceGenerator::processNodes( real64 const time_np1,
                                     NodeManager & nodeManager,
                                     EdgeManager & edgeManager,
                                     FaceManager & faceManager,
-                                    ElementRegionManager & elemManager,
-                                    std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                    std::vector< std::set< localIndex > > & edgesToRupturedFaces,
                                     ElementRegionManager & elementManager,
-                                    ModifiedObjectLists & modifiedObjects,
-                                    const bool GEOSX_UNUSED_PARAM( prefrac ) )
+                                    ArrayOfSetsView< localIndex const > const & nodesToRupturedFaces,
+                                    ArrayOfSetsView< localIndex const > const & edgesToRupturedFaces,
+                                    ModifiedObjectLists & modifiedObjects )
 {
-  bool didSplit = false;
-  bool fracturePlaneFlag = true;
+  // findFracturePlanes cannot find a separation path around a node that is not attached to a ruptured face,
+  // so the (costly) search is skipped for the nodes away from the fracture fronts.
+  // The node arrays are fetched on each call since the splits resize the node manager.
+  auto const isCandidate = [&]( localIndex const a )
+  {
+    arrayView1d< localIndex const > const & parentNodeIndices = nodeManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
+    return nodeManager.ghostRank()[a] < 0 &&
+           nodeManager.elementList().sizeOfArray( a ) > 1 &&
+           nodesToRupturedFaces.sizeOfSet( ObjectManagerBase::getParentRecusive( parentNodeIndices, a ) ) > 0;
+  };
 
+  // The round in which each cell element was last claimed by a node. The separation path of a node only depends on
+  // the elements around it, and a split only modifies the elements around the split node (and their faces and edges):
+  // the nodes which do not share any element are independent.
+  array1d< array1d< array1d< integer > > > elementRound( elementManager.numRegions() );
+  elementManager.forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                            localIndex const esr,
+                                                                            ElementRegionBase & region,
+                                                                            CellElementSubRegion & subRegion )
   {
-    std::set< localIndex > facialRupturePath;
+    elementRound[er].resize( region.numSubRegions() );
+    elementRound[er][esr].resize( subRegion.size() );
+    elementRound[er][esr].setValues< serialPolicy >( -1 );
+  } );
+
+  auto const forElementsOfNode = [&]( localIndex const a, auto && lambda )
+  {
+    arraySlice1d< localIndex const > const & nodeToRegionMap = nodeManager.elementRegionList()[a];
+    arraySlice1d< localIndex const > const & nodeToSubRegionMap = nodeManager.elementSubRegionList()[a];
+    arraySlice1d< localIndex const > const & nodeToElementMap = nodeManager.elementList()[a];
+    for( localIndex k = 0; k < nodeToElementMap.size(); ++k )
+    {
+      lambda( elementRound[ nodeToRegionMap[k] ][ nodeToSubRegionMap[k] ][ nodeToElementMap[k] ] );
+    }
+  };
+
+  struct SeparationPath
+  {
+    bool found = false;
+    std::set< localIndex > faces;
     map< localIndex, int > edgeLocations;
     map< localIndex, int > faceLocations;
     map< std::pair< CellElementSubRegion const *, localIndex >, int > elemLocations;
+  };
+
+  array1d< localIndex > candidates;
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    if( isCandidate( a ) )
+    {
+      candidates.emplace_back( a );
+    }
+  }
 
-    fracturePlaneFlag = findFracturePlanes( nodeID,
-                                            nodeManager,
-                                            edgeManager,
-                                            faceManager,
-                                            elemManager,
-                                            nodesToRupturedFaces,
-                                            edgesToRupturedFaces,
-                                            facialRupturePath,
-                                            edgeLocations,
-                                            faceLocations,
-                                            elemLocations );
-    if( fracturePlaneFlag )
+  int numSplits = 0;
+  for( integer round = 0; !candidates.empty(); ++round )
+  {
+    // The paths of all the candidates are searched concurrently on the mesh at the beginning of the round
+    std::vector< SeparationPath > paths( candidates.size() );
+    forAll< parallelHostPolicy >( candidates.size(), [&]( localIndex const i )
     {
-      mapConsistencyCheck( nodeID, nodeManager, edgeManager, faceManager, elementManager, elemLocations );
-
-      didSplit = true;
-      performFracture( nodeID,
-                       time_np1,
-                       nodeManager,
-                       edgeManager,
-                       faceManager,
-                       elementManager,
-                       modifiedObjects,
-                       nodesToRupturedFaces,
-                       edgesToRupturedFaces,
-                       facialRupturePath,
-                       edgeLocations,
-                       faceLocations,
-                       elemLocations );
-      mapConsistencyCheck( nodeID, nodeManager, edgeManager, faceManager, elementManager, elemLocations );
+      SeparationPath & path = paths[i];
+      path.found = findFracturePlanes( candidates[i],
+                                       nodeManager,
+                                       edgeManager,
+                                       faceManager,
+                                       elementManager,
+                                       nodesToRupturedFaces,
+                                       edgesToRupturedFaces,
+                                       path.faces,
+                                       path.edgeLocations,
+                                       path.faceLocations,
+                                       path.elemLocations );
+    } );
 
+    // The splits are then performed in the order of the nodes. A node sharing an element with a node split or deferred
+    // earlier in the round is deferred to the next round, where its path is searched again on the modified mesh.
+    array1d< localIndex > nextCandidates;
+    for( localIndex i = 0; i < candidates.size(); ++i )
+    {
+      localIndex const nodeID = candidates[i];
+      SeparationPath const & path = paths[i];
+
+      bool isClaimed = false;
+      forElementsOfNode( nodeID, [&]( integer const claimRound ) { isClaimed = isClaimed || claimRound == round; } );
+
+      if( isClaimed || path.found )
+      {
+        forElementsOfNode( nodeID, [&]( integer & claimRound ) { claimRound = round; } );
+      }
+
+      if( isClaimed )
+      {
+        nextCandidates.emplace_back( nodeID );
+      }
+      else if( path.found )
+      {
+        localIndex const numNodesBefore = nodeManager.size();
+
+        mapConsistencyCheck( nodeID, nodeManager, edgeManager, faceManager, elementManager, path.elemLocations );
+        performFracture( nodeID,
+                         time_np1,
+                         nodeManager,
+                         edgeManager,
+                         faceManager,
+                         elementManager,
+                         modifiedObjects,
+                         path.faces,
+                         path.edgeLocations,
+                         path.faceLocations,
+                         path.elemLocations );
+        mapConsistencyCheck( nodeID, nodeManager, edgeManager, faceManager, elementManager, path.elemLocations );
+        ++numSplits;
+
+        // the split node may split again, and so may the nodes it created
+        nextCandidates.emplace_back( nodeID );
+        for( localIndex newNodeIndex = numNodesBefore; newNodeIndex < nodeManager.size(); ++newNodeIndex )
+        {
+          nextCandidates.emplace_back( newNodeIndex );
+        }
+      }
+    }
+
+    std::sort( nextCandidates.begin(), nextCandidates.end() );
+    candidates.clear();
+    for( localIndex const a : nextCandidates )
+    {
+      if( isCandidate( a ) )
+      {
+        candidates.emplace_back( a );
+      }
     }
   }
 
-  return didSplit;
+  return numSplits;
 }
 
 //**********************************************************************************************************************
@@ -925,8 +1013,8 @@ bool SurfaceGenerator::findFracturePlanes( localIndex const nodeID,
                                            EdgeManager const & edgeManager,
                                            FaceManager const & faceManager,
                                            ElementRegionManager const & elemManager,
-                                           std::vector< std::set< localIndex > > const & nodesToRupturedFaces,
-                                           std::vector< std::set< localIndex > > const & edgesToRupturedFaces,
+                                           ArrayOfSetsView< localIndex const > const & nodesToRupturedFaces,
+                                           ArrayOfSetsView< localIndex const > const & edgesToRupturedFaces,
                                            std::set< localIndex > & separationPathFaces,
                                            map< localIndex, int > & edgeLocations,
                                            map< localIndex, int > & faceLocations,
@@ -939,8 +1027,6 @@ bool SurfaceGenerator::findFracturePlanes( localIndex const nodeID,
   arrayView1d< localIndex const > const & parentFaceIndices = faceManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
   arrayView1d< localIndex const > const & childFaceIndices = faceManager.getExtrinsicData< extrinsicMeshData::ChildIndex >();
 
-  std::set< localIndex > const & vNodeToRupturedFaces = nodesToRupturedFaces[parentNodeIndex];
-
   ArrayOfSetsView< localIndex const > const & nodeToEdgeMap = nodeManager.edgeList().toViewConst();
   ArrayOfSetsView< localIndex const > const & nodeToFaceMap = nodeManager.faceList().toViewConst();
 
@@ -1004,7 +1090,7 @@ bool SurfaceGenerator::findFracturePlanes( localIndex const nodeID,
   {
     const localIndex parentFaceIndex = ( parentFaceIndices[i] == -1 ) ? i : parentFaceIndices[i];
 
-    if( vNodeToRupturedFaces.count( parentFaceIndex ) > 0 )
+    if( nodesToRupturedFaces.contains( parentNodeIndex, parentFaceIndex ) )
     {
       nodeToRuptureReadyFaces.insert( parentFaceIndex );
     }
@@ -1015,7 +1101,7 @@ bool SurfaceGenerator::findFracturePlanes( localIndex const nodeID,
   map< localIndex, std::set< localIndex > > edgesToRuptureReadyFaces;
   for( localIndex const edgeIndex : m_originalNodetoEdges[ parentNodeIndex ] )
   {
-    if( !(edgesToRupturedFaces[edgeIndex].empty()) )
+    if( edgesToRupturedFaces.sizeOfSet( edgeIndex ) > 0 )
       edgesToRuptureReadyFaces[edgeIndex].insert( edgesToRupturedFaces[edgeIndex].begin(), edgesToRupturedFaces[edgeIndex].end() );
   }
 
@@ -1616,8 +1702,6 @@ void SurfaceGenerator::performFracture( const localIndex nodeID,
                                         FaceManager & faceManager,
                                         ElementRegionManager & elementManager,
                                         ModifiedObjectLists & modifiedObjects,
-                                        std::vector< std::set< localIndex > > & GEOSX_UNUSED_PARAM( nodesToRupturedFaces ),
-                                        std::vector< std::set< localIndex > > & GEOSX_UNUSED_PARAM( edgesToRupturedFaces ),
                                         const std::set< localIndex > & separationPathFaces,
                                         const map< localIndex, int > & edgeLocations,
                                         const map< localIndex, int > & faceLocations,
@@ -4229,38 +4313,60 @@ void SurfaceGenerator::postUpdateRuptureStates( NodeManager const & nodeManager,
                                                 EdgeManager const & edgeManager,
                                                 FaceManager const & faceManager,
                                                 ElementRegionManager const & GEOSX_UNUSED_PARAM( elementManager ),
-                                                std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                                std::vector< std::set< localIndex > > & edgesToRupturedFaces )
+                                                ArrayOfSets< localIndex > & nodesToRupturedFaces,
+                                                ArrayOfSets< localIndex > & edgesToRupturedFaces )
 {
   ArrayOfArraysView< localIndex const > const & faceToNodeMap = faceManager.nodeList().toViewConst();
   ArrayOfArraysView< localIndex const > const & faceToEdgeMap = faceManager.edgeList().toViewConst();
-  nodesToRupturedFaces.resize( nodeManager.size() );
-  edgesToRupturedFaces.resize( edgeManager.size() );
 
   arrayView1d< integer const > const & faceRuptureState = faceManager.getExtrinsicData< extrinsicMeshData::RuptureState >();
   arrayView1d< localIndex const > const & faceParentIndex = faceManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
 
-  // assign the values of the nodeToRupturedFaces and edgeToRupturedFaces arrays.
+  // count the ruptured faces attached to each node and edge, so that the sets are allocated at once
+  array1d< localIndex > nodeCapacities( nodeManager.size() );
+  array1d< localIndex > edgeCapacities( edgeManager.size() );
+  for( localIndex kf=0; kf<faceManager.size(); ++kf )
+  {
+    if( faceRuptureState[kf] >0 )
+    {
+      for( localIndex const nodeIndex : faceToNodeMap[kf] )
+      {
+        ++nodeCapacities[nodeIndex];
+      }
+      for( localIndex const edgeIndex : faceToEdgeMap[kf] )
+      {
+        ++edgeCapacities[edgeIndex];
+      }
+    }
+  }
+
+  GEOSX_ASSERT_EQ( nodesToRupturedFaces.size(), 0 );
+  GEOSX_ASSERT_EQ( edgesToRupturedFaces.size(), 0 );
+  for( localIndex a=0; a<nodeManager.size(); ++a )
+  {
+    nodesToRupturedFaces.appendSet( nodeCapacities[a] );
+  }
+  for( localIndex ke=0; ke<edgeManager.size(); ++ke )
+  {
+    edgesToRupturedFaces.appendSet( edgeCapacities[ke] );
+  }
+
+  // assign the values of the nodeToRupturedFaces and edgeToRupturedFaces arrays: a child face is registered
+  // through its parent face.
   for( localIndex kf=0; kf<faceManager.size(); ++kf )
   {
     if( faceRuptureState[kf] >0 )
     {
-      int const n = faceParentIndex[kf]==-1 ? 1 : 2;
       localIndex const faceIndex = faceParentIndex[kf]==-1 ? kf : faceParentIndex[kf];
 
-      for( int i=0; i<n; ++i )
+      for( localIndex const nodeIndex : faceToNodeMap[kf] )
       {
-        for( localIndex a=0; a<faceToNodeMap.sizeOfArray( kf ); ++a )
-        {
-          const localIndex nodeIndex = faceToNodeMap( kf, a );
-          nodesToRupturedFaces[nodeIndex].insert( faceIndex );
-        }
+        nodesToRupturedFaces.insertIntoSet( nodeIndex, faceIndex );
+      }
 
-        for( localIndex a=0; a<faceToEdgeMap.sizeOfArray( kf ); ++a )
-        {
-          const localIndex edgeIndex = faceToEdgeMap( kf, a );
-          edgesToRupturedFaces[edgeIndex].insert( faceIndex );
-        }
+      for( localIndex const edgeIndex : faceToEdgeMap[kf] )
+      {
+        edgesToRupturedFaces.insertIntoSet( edgeIndex, faceIndex );
       }
     }
   }
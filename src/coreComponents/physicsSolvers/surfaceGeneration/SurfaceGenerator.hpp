@@ -39,6 +39,12 @@ struct ModifiedObjectLists
   void clearNewFromModified();
 
   void insert( ModifiedObjectLists const & lists );
+
+  /**
+   * @brief Check whether no object was created or modified.
+   * @return true if all the lists are empty, including the element lists of every subregion
+   */
+  bool empty() const;
 };
 
 
@@ -253,15 +259,15 @@ private:
    * @param edgeManager
    * @param faceManager
    * @param elementManager
-   * @param nodesToRupturedFaces
-   * @param edgesToRupturedFaces
+   * @param nodesToRupturedFaces empty on input, filled with the (parent) ruptured faces attached to each node
+   * @param edgesToRupturedFaces empty on input, filled with the (parent) ruptured faces attached to each edge
    */
   void postUpdateRuptureStates( NodeManager const & nodeManager,
                                 EdgeManager const & edgeManager,
                                 FaceManager const & faceManager,
                                 ElementRegionManager const & elementManager,
-                                std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                std::vector< std::set< localIndex > > & edgesToRupturedFaces );
+                                ArrayOfSets< localIndex > & nodesToRupturedFaces,
+                                ArrayOfSets< localIndex > & edgesToRupturedFaces );
 
   /**
    *
@@ -292,30 +298,29 @@ private:
 //  void UpdatePathCheckingArrays();
 
   /**
-   * @brief check and split node in mesh
-   * @param nodeID
+   * @brief check and split the nodes of the mesh attached to ruptured faces
+   * @details The nodes are processed in rounds. The separation paths of the nodes are searched concurrently,
+   *          then the nodes are split in order, except the nodes sharing an element with a node split (or deferred)
+   *          earlier in the round, which are deferred to the next round. A split node and the nodes it created
+   *          are checked again in the next round.
+   * @param time_np1
    * @param nodeManager
    * @param edgeManager
    * @param faceManager
-   * @param elemManager
+   * @param elementManager
    * @param nodesToRupturedFaces
    * @param edgesToRupturedFaces
-   * @param elementManager
    * @param modifiedObjects
-   * @param prefrac
-   * @return
+   * @return the number of splits
    */
-  bool processNode( const localIndex nodeID,
-                    real64 const time,
+  int processNodes( real64 const time_np1,
                     NodeManager & nodeManager,
                     EdgeManager & edgeManager,
                     FaceManager & faceManager,
-                    ElementRegionManager & elemManager,
-                    std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                    std::vector< std::set< localIndex > > & edgesToRupturedFaces,
                     ElementRegionManager & elementManager,
-                    ModifiedObjectLists & modifiedObjects,
-                    const bool prefrac );
+                    ArrayOfSetsView< localIndex const > const & nodesToRupturedFaces,
+                    ArrayOfSetsView< localIndex const > const & edgesToRupturedFaces,
+                    ModifiedObjectLists & modifiedObjects );
 
   /**
    * @brief Find a fracture path for surface generation
@@ -337,8 +342,8 @@ private:
                            EdgeManager const & edgeManager,
                            FaceManager const & faceManager,
                            ElementRegionManager const & elemManager,
-                           std::vector< std::set< localIndex > > const & nodesToRupturedFaces,
-                           std::vector< std::set< localIndex > > const & edgesToRupturedFaces,
+                           ArrayOfSetsView< localIndex const > const & nodesToRupturedFaces,
+                           ArrayOfSetsView< localIndex const > const & edgesToRupturedFaces,
                            std::set< localIndex > & separationPathFaces,
                            map< localIndex, int > & edgeLocations,
                            map< localIndex, int > & faceLocations,
@@ -353,8 +358,6 @@ private:
    * @param faceManager
    * @param elementManager
    * @param modifiedObjects
-   * @param nodesToRupturedFaces
-   * @param edgesToRupturedFaces
    * @param separationPathFaces
    * @param edgeLocations
    * @param faceLocations
@@ -367,8 +370,6 @@ private:
                         FaceManager & faceManager,
                         ElementRegionManager & elementManager,
                         ModifiedObjectLists & modifiedObjects,
-                        std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                        std::vector< std::set< localIndex > > & edgesToRupturedFaces,
                         std::set< localIndex > const & separationPathFaces,
                         map< localIndex, int > const & edgeLocations,
                         map< localIndex, int > const & faceLocations,
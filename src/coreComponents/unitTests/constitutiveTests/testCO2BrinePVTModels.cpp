@@ -27,6 +27,7 @@
 #include "constitutive/fluid/PVTFunctions/CO2Enthalpy.hpp"
 #include "constitutive/fluid/PVTFunctions/BrineInternalEnergy.hpp"
 #include "constitutive/fluid/PVTFunctions/CO2InternalEnergy.hpp"
+#include "constitutive/fluid/PVTFunctions/MultiPropertyTable.hpp"
 #include "mainInterface/GeosxState.hpp"
 #include "mainInterface/initialization.hpp"
 
@@ -214,6 +215,54 @@ void testNumericalDerivatives( PVT_WRAPPER const & pvtFunctionWrapper,
   }
 }
 
+template< typename PVT_WRAPPER >
+void testMolarAndMassAgainstCompute( PVT_WRAPPER const & pvtFunctionWrapper,
+                                     real64 const pressure,
+                                     real64 const temperature,
+                                     arraySlice1d< real64 const > const & phaseComposition,
+                                     real64 const relTol )
+{
+  using Deriv = multifluid::DerivativeOffset;
+
+  integer constexpr numComp  = 2;
+  integer constexpr numDof   = numComp + 2;
+
+  stackArray2d< real64, numDof *numComp > dPhaseComposition( numComp, numDof );
+  dPhaseComposition[0][Deriv::dC]   = 1.0;
+  dPhaseComposition[1][Deriv::dC+1] = 1.0;
+
+  // 1) Compute the molar and mass densities separately
+  real64 molarValue = 0.0;
+  real64 massValue = 0.0;
+  stackArray1d< real64, numDof > dMolarValue( numDof );
+  stackArray1d< real64, numDof > dMassValue( numDof );
+  pvtFunctionWrapper.compute( pressure, temperature, phaseComposition, dPhaseComposition.toSliceConst(),
+                              molarValue, dMolarValue.toSlice(), false );
+  pvtFunctionWrapper.compute( pressure, temperature, phaseComposition, dPhaseComposition.toSliceConst(),
+                              massValue, dMassValue.toSlice(), true );
+
+  // 2) Compute them together, with and without derivatives
+  real64 combinedMolarValue = 0.0;
+  real64 combinedMassValue = 0.0;
+  stackArray1d< real64, numDof > dCombinedMolarValue( numDof );
+  stackArray1d< real64, numDof > dCombinedMassValue( numDof );
+  pvtFunctionWrapper.computeMolarAndMass( pressure, temperature, phaseComposition, dPhaseComposition.toSliceConst(),
+                                          combinedMolarValue, dCombinedMolarValue.toSlice(),
+                                          combinedMassValue, dCombinedMassValue.toSlice() );
+  checkRelativeError( combinedMolarValue, molarValue, relTol );
+  checkRelativeError( combinedMassValue, massValue, relTol );
+  for( integer i = 0; i < numDof; ++i )
+  {
+    checkRelativeError( dCombinedMolarValue[i], dMolarValue[i], relTol );
+    checkRelativeError( dCombinedMassValue[i], dMassValue[i], relTol );
+  }
+
+  pvtFunctionWrapper.computeMolarAndMass( pressure, temperature, phaseComposition,
+                                          combinedMolarValue, combinedMassValue );
+  checkRelativeError( combinedMolarValue, molarValue, relTol );
+  checkRelativeError( combinedMassValue, massValue, relTol );
+}
+
 template< typename FLASH_WRAPPER >
 void testNumericalDerivatives( FLASH_WRAPPER const & flashModelWrapper,
                                real64 const pressure,
@@ -666,6 +715,7 @@ TEST_F( PhillipsBrineDensityTest, brineCO2DensityMolarValuesAndDeriv )
       for( integer iTemp = 0; iTemp < 3; ++iTemp )
       {
         testNumericalDerivatives( pvtFunctionWrapper, P[iPres], TC[iTemp], comp, false, eps, relTol );
+        testMolarAndMassAgainstCompute( pvtFunctionWrapper, P[iPres], TC[iTemp], comp, 1e-12 );
         counter++;
       }
     }
@@ -748,6 +798,7 @@ TEST_F( EzrokhiBrineDensityTest, brineCO2DensityMolarValuesAndDeriv )
       for( integer iTemp = 0; iTemp < 3; ++iTemp )
       {
         testNumericalDerivatives( pvtFunctionWrapper, P[iPres], TC[iTemp], comp, false, eps, relTol );
+        testMolarAndMassAgainstCompute( pvtFunctionWrapper, P[iPres], TC[iTemp], comp, 1e-12 );
         counter++;
       }
     }
@@ -1012,6 +1063,7 @@ TEST_F( BrineEnthalpyTest, BrineEnthalpyMolarValuesAndDeriv )
         testValuesAgainstPreviousImplementation( pvtFunctionWrapper,
                                                  P[iPres], TC[iTemp], comp, savedValues[counter], false, relTol );
         testNumericalDerivatives( pvtFunctionWrapper, P[iPres], TC[iTemp], comp, false, eps, relTol );
+        testMolarAndMassAgainstCompute( pvtFunctionWrapper, P[iPres], TC[iTemp], comp, 1e-12 );
         counter++;
       }
     }
@@ -1324,6 +1376,137 @@ TEST_F( CO2InternalEnergyTest, CO2InternalEnergyMolarValuesAndDeriv )
 }
 
 
+class MultiPropertyTableTest : public ::testing::Test
+{
+public:
+  MultiPropertyTableTest()
+  {
+    writeTableToFile( gasFilename, pvtGasTableContent );
+    writeTableToFile( flashFilename, co2FlashTableContent );
+    density = makePVTFunction< SpanWagnerCO2Density >( gasFilename, "DensityFun" );
+    viscosity = makePVTFunction< FenghourCO2Viscosity >( gasFilename, "ViscosityFun" );
+    flashModel = makeFlashModel< CO2Solubility >( flashFilename, "FlashModel" );
+  }
+
+  ~MultiPropertyTableTest() override
+  {
+    removeFile( gasFilename );
+    removeFile( flashFilename );
+  }
+
+protected:
+  string const gasFilename = "pvtgas.txt";
+  string const flashFilename = "co2flash.txt";
+  std::unique_ptr< SpanWagnerCO2Density > density;
+  std::unique_ptr< FenghourCO2Viscosity > viscosity;
+  std::unique_ptr< CO2Solubility > flashModel;
+};
+
+TEST_F( MultiPropertyTableTest, interleavedValuesMatchSeparateTables )
+{
+  TableFunction const * const densityTable = density->pressureTemperatureTable();
+  TableFunction const * const viscosityTable = viscosity->pressureTemperatureTable();
+  TableFunction const * const solubilityTable = flashModel->pressureTemperatureTable();
+
+  // the density and solubility tables share their axes, the viscosity table is tabulated on other axes
+  MultiPropertyTable const multiPropertyTable( { densityTable, viscosityTable, solubilityTable, nullptr } );
+  ASSERT_EQ( multiPropertyTable.numProperties(), 2 );
+  integer const densityColumn = multiPropertyTable.column( densityTable );
+  integer const solubilityColumn = multiPropertyTable.column( solubilityTable );
+  ASSERT_GE( densityColumn, 0 );
+  ASSERT_GE( solubilityColumn, 0 );
+  EXPECT_NE( densityColumn, solubilityColumn );
+  EXPECT_EQ( multiPropertyTable.column( viscosityTable ), -1 );
+  EXPECT_EQ( multiPropertyTable.column( nullptr ), -1 );
+
+  MultiPropertyTable::KernelWrapper const multiPropertyTableWrapper = multiPropertyTable.createKernelWrapper();
+  TableFunction::KernelWrapper const densityTableWrapper = densityTable->createKernelWrapper();
+  TableFunction::KernelWrapper const solubilityTableWrapper = solubilityTable->createKernelWrapper();
+
+  // the first and last values of each axis are outside of the tables
+  real64 const P[5] = { 5e4, 5.012e6, 7.546e6, 1.289e7, 8e7 };
+  real64 const TC[5] = { 5.0, 94.5, 95.1, 95.6, 150.0 };
+  real64 const relTol = 1e-14;
+
+  for( integer iPres = 0; iPres < 5; ++iPres )
+  {
+    for( integer iTemp = 0; iTemp < 5; ++iTemp )
+    {
+      PTTableValue tableValues[MultiPropertyTable::maxNumProperties];
+      multiPropertyTableWrapper.compute( P[iPres], TC[iTemp], tableValues );
+
+      PTTableValue const densityValue = PTTableValue::interpolateWithDerivatives( densityTableWrapper, P[iPres], TC[iTemp] );
+      PTTableValue const solubilityValue = PTTableValue::interpolateWithDerivatives( solubilityTableWrapper, P[iPres], TC[iTemp] );
+      checkRelativeError( tableValues[densityColumn].value, densityValue.value, relTol );
+      checkRelativeError( tableValues[solubilityColumn].value, solubilityValue.value, relTol );
+      for( integer i = 0; i < 2; ++i )
+      {
+        checkRelativeError( tableValues[densityColumn].dValue[i], densityValue.dValue[i], relTol );
+        checkRelativeError( tableValues[solubilityColumn].dValue[i], solubilityValue.dValue[i], relTol );
+      }
+
+      // the value-only interpolation is the same as well
+      checkRelativeError( tableValues[densityColumn].value,
+                          PTTableValue::interpolate( densityTableWrapper, P[iPres], TC[iTemp] ).value, relTol );
+    }
+  }
+}
+
+TEST_F( MultiPropertyTableTest, densityFromInterleavedTableMatchesDensity )
+{
+  using Deriv = multifluid::DerivativeOffset;
+
+  integer constexpr numComp  = 2;
+  integer constexpr numDof   = numComp + 2;
+
+  TableFunction const * const densityTable = density->pressureTemperatureTable();
+  MultiPropertyTable const multiPropertyTable( { densityTable, flashModel->pressureTemperatureTable() } );
+  MultiPropertyTable::KernelWrapper const multiPropertyTableWrapper = multiPropertyTable.createKernelWrapper();
+  SpanWagnerCO2Density::KernelWrapper const densityWrapper = density->createKernelWrapper();
+
+  real64 const pressure = 7.546e6;
+  real64 const temperature = 95.1;
+  real64 const relTol = 1e-14;
+  array1d< real64 > comp( numComp );
+  comp[0] = 0.304; comp[1] = 0.696;
+  stackArray2d< real64, numDof *numComp > dComp( numComp, numDof );
+  dComp[0][Deriv::dC]   = 1.0;
+  dComp[1][Deriv::dC+1] = 1.0;
+
+  // 1) Compute the densities with their own table lookup
+  real64 molarValue = 0.0;
+  real64 massValue = 0.0;
+  stackArray1d< real64, numDof > dMolarValue( numDof );
+  stackArray1d< real64, numDof > dMassValue( numDof );
+  densityWrapper.computeMolarAndMass( pressure, temperature, comp.toSliceConst(), dComp.toSliceConst(),
+                                      molarValue, dMolarValue.toSlice(), massValue, dMassValue.toSlice() );
+
+  // 2) Compute them from the value interpolated in the MultiPropertyTable
+  PTTableValue tableValues[MultiPropertyTable::maxNumProperties];
+  multiPropertyTableWrapper.compute( pressure, temperature, tableValues );
+  PTTableValue const & densityValue = tableValues[multiPropertyTable.column( densityTable )];
+
+  real64 fusedMolarValue = 0.0;
+  real64 fusedMassValue = 0.0;
+  stackArray1d< real64, numDof > dFusedMolarValue( numDof );
+  stackArray1d< real64, numDof > dFusedMassValue( numDof );
+  densityWrapper.computeMolarAndMass( densityValue, pressure, temperature, comp.toSliceConst(), dComp.toSliceConst(),
+                                      fusedMolarValue, dFusedMolarValue.toSlice(), fusedMassValue, dFusedMassValue.toSlice() );
+  checkRelativeError( fusedMolarValue, molarValue, relTol );
+  checkRelativeError( fusedMassValue, massValue, relTol );
+  for( integer i = 0; i < numDof; ++i )
+  {
+    checkRelativeError( dFusedMolarValue[i], dMolarValue[i], relTol );
+    checkRelativeError( dFusedMassValue[i], dMassValue[i], relTol );
+  }
+
+  densityWrapper.computeMolarAndMass( densityValue, pressure, temperature, comp.toSliceConst(),
+                                      fusedMolarValue, fusedMassValue );
+  checkRelativeError( fusedMolarValue, molarValue, relTol );
+  checkRelativeError( fusedMassValue, massValue, relTol );
+}
+
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
@@ -0,0 +1,192 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "dataRepository/ConduitRestart.hpp"
+#include "fileIO/Outputs/RestartOutput.hpp"
+#include "fileIO/Outputs/TimeHistoryOutput.hpp"
+#include "fileIO/timeHistory/PackCollection.hpp"
+#include "fileIO/timeHistory/TimeHistHDF.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <map>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// the same element centers are written by a synchronous and an asynchronous time history output, and restarted
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{ C3D8 }\"\n"
+  "                  xCoords=\"{ 0, 10 }\"\n"
+  "                  yCoords=\"{ 0, 1 }\"\n"
+  "                  zCoords=\"{ 0, 1 }\"\n"
+  "                  nx=\"{ 10 }\"\n"
+  "                  ny=\"{ 1 }\"\n"
+  "                  nz=\"{ 1 }\"\n"
+  "                  cellBlockNames=\"{ cb1 }\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb1 }\" materialList=\"{}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Tasks>\n"
+  "    <PackCollection name=\"syncCollection\" objectPath=\"ElementRegions/region/cb1\" fieldName=\"elementCenter\"/>\n"
+  "    <PackCollection name=\"asyncCollection\" objectPath=\"ElementRegions/region/cb1\" fieldName=\"elementCenter\"/>\n"
+  "  </Tasks>\n"
+  "  <Outputs>\n"
+  "    <TimeHistory name=\"syncOutput\" sources=\"{ /Tasks/syncCollection }\" filename=\"syncHistory\"/>\n"
+  "    <TimeHistory name=\"asyncOutput\" sources=\"{ /Tasks/asyncCollection }\" filename=\"asyncHistory\" asyncWrite=\"1\"/>\n"
+  "    <Restart name=\"restartOutput\"/>\n"
+  "  </Outputs>\n"
+  "</Problem>";
+
+herr_t appendDatasetName( hid_t, char const * name, H5L_info_t const *, void * names )
+{
+  static_cast< std::vector< string > * >( names )->emplace_back( name );
+  return 0;
+}
+
+/// Read every dataset of a time history file as raw bytes, by dataset name
+std::map< string, std::vector< char > > readDatasets( string const & filename )
+{
+  std::map< string, std::vector< char > > datasets;
+  HDFFile file( filename, false, true, MPI_COMM_GEOSX );
+
+  std::vector< string > names;
+  H5Literate( file, H5_INDEX_NAME, H5_ITER_INC, nullptr, appendDatasetName, &names );
+  for( string const & name : names )
+  {
+    hid_t const dataset = H5Dopen( file, name.c_str(), H5P_DEFAULT );
+    hid_t const type = H5Dget_type( dataset );
+    hid_t const space = H5Dget_space( dataset );
+    std::vector< char > & data = datasets[ name ];
+    data.resize( H5Tget_size( type ) * H5Sget_simple_extent_npoints( space ) );
+    H5Dread( dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data() );
+    H5Sclose( space );
+    H5Tclose( type );
+    H5Dclose( dataset );
+  }
+  return datasets;
+}
+
+TEST( testAsyncOutputs, asyncTimeHistoryEqualsSyncTimeHistory )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  setupProblemFromXML( problemManager, xmlInput );
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+  ElementSubRegionBase & subRegion = domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "region" ).getSubRegion( "cb1" );
+  arrayView2d< real64 > const centers = subRegion.getReference< array2d< real64 > >( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
+
+  Group & tasks = problemManager.getGroup( problemManager.groupKeys.tasksManager );
+  Group & outputs = problemManager.getGroup( problemManager.groupKeys.outputManager );
+  PackCollection & syncCollection = tasks.getGroup< PackCollection >( "syncCollection" );
+  PackCollection & asyncCollection = tasks.getGroup< PackCollection >( "asyncCollection" );
+  TimeHistoryOutput & syncOutput = outputs.getGroup< TimeHistoryOutput >( "syncOutput" );
+  TimeHistoryOutput & asyncOutput = outputs.getGroup< TimeHistoryOutput >( "asyncOutput" );
+
+  // collect every cycle and write every third one, so that the rows of a write are collected while the previous one is pending
+  real64 const dt = 0.5;
+  real64 time = 0.0;
+  integer const numCycles = 10;
+  for( integer cycle = 0; cycle < numCycles; ++cycle )
+  {
+    forAll< serialPolicy >( centers.size( 0 ), [=]( localIndex const ei )
+    {
+      centers[ei][0] += 1.0;
+    } );
+
+    syncCollection.execute( time, dt, cycle, 0, 0.0, domain );
+    asyncCollection.execute( time, dt, cycle, 0, 0.0, domain );
+    if( cycle % 3 == 2 )
+    {
+      syncOutput.execute( time, dt, cycle, 0, 0.0, domain );
+      asyncOutput.execute( time, dt, cycle, 0, 0.0, domain );
+    }
+    time += dt;
+  }
+  syncOutput.cleanup( time, numCycles, 0, 0.0, domain );
+  asyncOutput.cleanup( time, numCycles, 0, 0.0, domain );
+
+  std::map< string, std::vector< char > > const syncDatasets = readDatasets( joinPath( OutputBase::getOutputDirectory(), "syncHistory" ) );
+  std::map< string, std::vector< char > > const asyncDatasets = readDatasets( joinPath( OutputBase::getOutputDirectory(), "asyncHistory" ) );
+  ASSERT_FALSE( syncDatasets.empty() );
+  EXPECT_EQ( asyncDatasets, syncDatasets );
+}
+
+TEST( testAsyncOutputs, asyncRestartEqualsSyncRestart )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  setupProblemFromXML( problemManager, xmlInput );
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+  ElementSubRegionBase & subRegion = domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "region" ).getSubRegion( "cb1" );
+  arrayView2d< real64 > const centers = subRegion.getReference< array2d< real64 > >( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
+
+  Group & outputs = problemManager.getGroup( problemManager.groupKeys.outputManager );
+  RestartOutput & restartOutput = outputs.getGroup< RestartOutput >( "restartOutput" );
+
+  // the same state is written synchronously at cycle 1 and asynchronously at cycle 2
+  restartOutput.execute( 0.0, 0.0, 1, 0, 0.0, domain );
+  ASSERT_TRUE( restartOutput.executeAsync( 0.0, 0.0, 2, 0, 0.0, domain ) );
+
+  // the state changes while the snapshot is written, as the events following an asynchronous one do
+  forAll< serialPolicy >( centers.size( 0 ), [=]( localIndex const ei )
+  {
+    centers[ei][0] += 1.0;
+  } );
+
+  // an event listing the restart in its waitFor attribute only executes after the write completes
+  restartOutput.waitForPendingExecution();
+
+  conduit::Node syncRestart;
+  conduit::Node asyncRestart;
+  loadTree( joinPath( OutputBase::getOutputDirectory(), GEOSX_FMT( "{}_restart_{:09}", OutputBase::getFileNameRoot(), 1 ) ), syncRestart );
+  loadTree( joinPath( OutputBase::getOutputDirectory(), GEOSX_FMT( "{}_restart_{:09}", OutputBase::getFileNameRoot(), 2 ) ), asyncRestart );
+
+  conduit::Node info;
+  EXPECT_FALSE( syncRestart.diff( asyncRestart, info ) ) << info.to_yaml();
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  // the background writes need MPI_THREAD_MULTIPLE, without it they fall back to synchronous writes
+  std::vector< char * > args( argv, argv + argc );
+  string threadMultiple = "--mpi-thread-multiple";
+  args.emplace_back( &threadMultiple[0] );
+  int numArgs = LvArray::integerConversion< int >( args.size() );
+  char * * argsData = args.data();
+
+  g_commandLineOptions = *geosx::basicSetup( numArgs, argsData );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -5,6 +5,8 @@
 
 #include <gtest/gtest.h>
 
+#include <future>
+
 using namespace geosx;
 
 TEST( testHDFIO, HDFFile )
@@ -114,6 +116,58 @@ TEST( testHDFIO, IdxArrayHistory )
   }
 }
 
+TEST( testHDFIO, DoubleBufferedHistory )
+{
+  string filename( "double_buffered" );
+  HistoryMetadata spec( "Double Buffered History", 1, std::type_index( typeid(real64)));
+
+  localIndex const numRowsPerWrite = 10;
+  // start from an empty file
+  HDFFile( filename, true, true, MPI_COMM_GEOSX );
+  HDFHistIO io( filename, spec );
+  io.init( false );
+
+  real64 value = 0.0;
+  auto collectRows = [&]()
+  {
+    for( localIndex row = 0; row < numRowsPerWrite; ++row )
+    {
+      buffer_unit_type * buffer = io.getBufferHead( );
+      memcpy( buffer, &value, sizeof(real64));
+      value += 1.0;
+    }
+  };
+
+  // write the first rows in the background while the next ones are collected
+  collectRows();
+  io.swapBuffers( );
+  std::future< void > pendingWrite = std::async( std::launch::async, [&io]() { io.writeSwapped( ); } );
+  collectRows();
+  pendingWrite.get();
+  io.write( );
+  io.compressInFile( );
+
+  // read the data back and check that no row was lost or overwritten
+  {
+    HDFFile file( filename, false, true, MPI_COMM_GEOSX );
+    hid_t dataset = H5Dopen( file, "Double Buffered History", H5P_DEFAULT );
+    hid_t filespace = H5Dget_space( dataset );
+    hsize_t dims[2] = { 0, 0 };
+    H5Sget_simple_extent_dims( filespace, dims, nullptr );
+    ASSERT_EQ( dims[0], LvArray::integerConversion< hsize_t >( 2 * numRowsPerWrite ) );
+    ASSERT_EQ( dims[1], hsize_t( 1 ) );
+
+    std::vector< real64 > data( 2 * numRowsPerWrite );
+    H5Dread( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data() );
+    for( localIndex row = 0; row < 2 * numRowsPerWrite; ++row )
+    {
+      EXPECT_EQ( data[row], static_cast< real64 >( row ) );
+    }
+    H5Sclose( filespace );
+    H5Dclose( dataset );
+  }
+}
+
 int main( int ac, char * av[] )
 {
   ::testing::InitGoogleTest( &ac, av );
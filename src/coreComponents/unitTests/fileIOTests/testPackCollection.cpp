@@ -0,0 +1,185 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "fileIO/timeHistory/PackCollection.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// ten unit cells along x, with centers at x = 0.5, 1.5, ..., 9.5 and y = z = 0.5
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{ C3D8 }\"\n"
+  "                  xCoords=\"{ 0, 10 }\"\n"
+  "                  yCoords=\"{ 0, 1 }\"\n"
+  "                  zCoords=\"{ 0, 1 }\"\n"
+  "                  nx=\"{ 10 }\"\n"
+  "                  ny=\"{ 1 }\"\n"
+  "                  nz=\"{ 1 }\"\n"
+  "                  cellBlockNames=\"{ cb1 }\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb1 }\" materialList=\"{}\"/>\n"
+  "  </ElementRegions>\n"
+  "</Problem>";
+
+class PackCollectionTest : public ::testing::Test
+{
+public:
+
+  PackCollectionTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+  }
+
+  ElementSubRegionBase & getSubRegion()
+  {
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    return domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "region" ).getSubRegion( "cb1" );
+  }
+
+  PackCollection & makeCollector( string const & name,
+                                  string const & fieldName,
+                                  PackCollection::ReductionType const reduction,
+                                  real64 const percentile = 50.0,
+                                  string_array const & setNames = string_array() )
+  {
+    Group & tasks = state.getProblemManager().getGroup( state.getProblemManager().groupKeys.tasksManager );
+    PackCollection & collector = tasks.registerGroup< PackCollection >( name );
+    collector.getReference< string >( PackCollection::viewKeysStruct::objectPathString() ) = "ElementRegions/region/cb1";
+    collector.getReference< string >( PackCollection::viewKeysStruct::fieldNameString() ) = fieldName;
+    collector.getReference< PackCollection::ReductionType >( PackCollection::viewKeysStruct::reductionString() ) = reduction;
+    collector.getReference< real64 >( PackCollection::viewKeysStruct::percentileString() ) = percentile;
+    collector.getReference< string_array >( PackCollection::viewKeysStruct::setNamesString() ) = setNames;
+    collector.postProcessInputRecursive();
+    return collector;
+  }
+
+  array1d< real64 > collectCenters( PackCollection::ReductionType const reduction,
+                                    real64 const percentile = 50.0,
+                                    string_array const & setNames = string_array() )
+  {
+    PackCollection & collector = makeCollector( EnumStrings< PackCollection::ReductionType >::toString( reduction ) + std::to_string( ++m_numCollectors ),
+                                                ElementSubRegionBase::viewKeyStruct::elementCenterString(),
+                                                reduction,
+                                                percentile,
+                                                setNames );
+    collector.initializePostSubGroups();
+
+    // one reduced value per component of the element centers
+    array1d< real64 > result( 3 );
+    collector.registerBufferCall( 0, [&]() { return reinterpret_cast< buffer_unit_type * >( result.data() ); } );
+    collector.execute( 0.0, 0.0, 0, 0, 0.0, state.getProblemManager().getDomainPartition() );
+    return result;
+  }
+
+  GeosxState state;
+
+private:
+
+  integer m_numCollectors = 0;
+};
+
+TEST_F( PackCollectionTest, sumAndMeans )
+{
+  array1d< real64 > const sum = collectCenters( PackCollection::ReductionType::sum );
+  EXPECT_DOUBLE_EQ( sum[0], 50.0 );
+  EXPECT_DOUBLE_EQ( sum[1], 5.0 );
+  EXPECT_DOUBLE_EQ( sum[2], 5.0 );
+
+  array1d< real64 > const mean = collectCenters( PackCollection::ReductionType::mean );
+  EXPECT_DOUBLE_EQ( mean[0], 5.0 );
+  EXPECT_DOUBLE_EQ( mean[1], 0.5 );
+  EXPECT_DOUBLE_EQ( mean[2], 0.5 );
+
+  // the cells have the same volume
+  array1d< real64 > const weightedMean = collectCenters( PackCollection::ReductionType::volumeWeightedMean );
+  EXPECT_DOUBLE_EQ( weightedMean[0], 5.0 );
+  EXPECT_DOUBLE_EQ( weightedMean[1], 0.5 );
+  EXPECT_DOUBLE_EQ( weightedMean[2], 0.5 );
+}
+
+TEST_F( PackCollectionTest, extrema )
+{
+  array1d< real64 > const min = collectCenters( PackCollection::ReductionType::min );
+  EXPECT_DOUBLE_EQ( min[0], 0.5 );
+  EXPECT_DOUBLE_EQ( min[1], 0.5 );
+
+  array1d< real64 > const max = collectCenters( PackCollection::ReductionType::max );
+  EXPECT_DOUBLE_EQ( max[0], 9.5 );
+  EXPECT_DOUBLE_EQ( max[1], 0.5 );
+}
+
+TEST_F( PackCollectionTest, percentiles )
+{
+  // nearest rank: the k-th smallest of the ten values, with k = max( ceil( percentile / 10 ), 1 )
+  EXPECT_DOUBLE_EQ( collectCenters( PackCollection::ReductionType::percentile, 0.0 )[0], 0.5 );
+  EXPECT_DOUBLE_EQ( collectCenters( PackCollection::ReductionType::percentile, 30.0 )[0], 2.5 );
+  EXPECT_DOUBLE_EQ( collectCenters( PackCollection::ReductionType::percentile, 35.0 )[0], 3.5 );
+  EXPECT_DOUBLE_EQ( collectCenters( PackCollection::ReductionType::percentile, 50.0 )[0], 4.5 );
+  EXPECT_DOUBLE_EQ( collectCenters( PackCollection::ReductionType::percentile, 100.0 )[0], 9.5 );
+  EXPECT_DOUBLE_EQ( collectCenters( PackCollection::ReductionType::percentile, 50.0 )[2], 0.5 );
+}
+
+TEST_F( PackCollectionTest, emptySet )
+{
+  getSubRegion().sets().registerWrapper< SortedArray< localIndex > >( "empty" );
+  string_array setNames;
+  setNames.emplace_back( "empty" );
+
+  EXPECT_DOUBLE_EQ( collectCenters( PackCollection::ReductionType::sum, 50.0, setNames )[0], 0.0 );
+  EXPECT_TRUE( std::isnan( collectCenters( PackCollection::ReductionType::mean, 50.0, setNames )[0] ) );
+  EXPECT_TRUE( std::isnan( collectCenters( PackCollection::ReductionType::volumeWeightedMean, 50.0, setNames )[0] ) );
+  EXPECT_TRUE( std::isnan( collectCenters( PackCollection::ReductionType::min, 50.0, setNames )[0] ) );
+  EXPECT_TRUE( std::isnan( collectCenters( PackCollection::ReductionType::max, 50.0, setNames )[0] ) );
+  EXPECT_TRUE( std::isnan( collectCenters( PackCollection::ReductionType::percentile, 50.0, setNames )[0] ) );
+}
+
+TEST_F( PackCollectionTest, rejectsUnsupportedType )
+{
+  PackCollection & collector = makeCollector( "ghostRankMax",
+                                              ObjectManagerBase::viewKeyStruct::ghostRankString(),
+                                              PackCollection::ReductionType::max );
+  EXPECT_THROW( collector.initializePostSubGroups(), InputError );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -111,8 +111,8 @@ void checkDerivative( ArraySlice< real64 const, DIM, USD1 > const & valueEps,
 
 // invert compositional derivative array layout to move innermost slice on the top
 // (this is needed so we can use checkDerivative() to check derivative w.r.t. for each compositional var)
-template< int USD >
-array1d< real64 > invertLayout( arraySlice1d< real64 const, USD > const & input,
+template< typename T, int USD >
+array1d< real64 > invertLayout( arraySlice1d< T const, USD > const & input,
                                 localIndex N )
 {
   array1d< real64 > output( N );
@@ -124,8 +124,8 @@ array1d< real64 > invertLayout( arraySlice1d< real64 const, USD > const & input,
   return output;
 }
 
-template< int USD >
-array2d< real64 > invertLayout( arraySlice2d< real64 const, USD > const & input,
+template< typename T, int USD >
+array2d< real64 > invertLayout( arraySlice2d< T const, USD > const & input,
                                 localIndex N1,
                                 localIndex N2 )
 {
@@ -142,8 +142,8 @@ array2d< real64 > invertLayout( arraySlice2d< real64 const, USD > const & input,
   return output;
 }
 
-template< int USD >
-array3d< real64 > invertLayout( arraySlice3d< real64 const, USD > const & input,
+template< typename T, int USD >
+array3d< real64 > invertLayout( arraySlice3d< T const, USD > const & input,
                                 localIndex N1,
                                 localIndex N2,
                                 localIndex N3 )
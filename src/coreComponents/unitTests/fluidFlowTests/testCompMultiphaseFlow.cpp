@@ -282,6 +282,176 @@ TEST_F( CompositionalMultiphaseFlowTest, jacobianNumericalCheck_flux )
   } );
 }
 
+template< typename MESH_DATA_TRAIT >
+void perturbByReducedPrecisionError( MultiFluidBase & fluid )
+{
+  // two units in the last place of real32 bound the error of a single-precision storage of the derivatives,
+  // and still change a derivative that is already stored in single precision (GEOSX_ENABLE_MIXED_PRECISION_FLUID)
+  real64 const relPerturb = 2.0 * std::numeric_limits< real32 >::epsilon();
+
+  typename MESH_DATA_TRAIT::type & values = fluid.getReference< typename MESH_DATA_TRAIT::type >( MESH_DATA_TRAIT::key() );
+  using ValueType = std::remove_pointer_t< decltype( values.data() ) >;
+  values.move( LvArray::MemorySpace::host, true );
+  for( localIndex i = 0; i < values.size(); ++i )
+  {
+    real64 const factor = ( i % 2 == 0 ) ? 1.0 + relPerturb : 1.0 - relPerturb;
+    values.data()[i] = static_cast< ValueType >( values.data()[i] * factor );
+  }
+}
+
+void perturbFluidDerivatives( CompositionalMultiphaseFVM & solver,
+                              DomainPartition & domain )
+{
+  // perturb the stored fluid derivatives, then recompute the mobilities derived from them
+  solver.forMeshTargets( domain.getMeshBodies(),
+                         [&]( string const,
+                              MeshLevel & mesh,
+                              arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      string const & fluidName = subRegion.getReference< string >( CompositionalMultiphaseBase::viewKeyStruct::fluidNamesString() );
+      MultiFluidBase & fluid = subRegion.getConstitutiveModel< MultiFluidBase >( fluidName );
+
+      perturbByReducedPrecisionError< extrinsicMeshData::multifluid::dPhaseFraction >( fluid );
+      perturbByReducedPrecisionError< extrinsicMeshData::multifluid::dPhaseDensity >( fluid );
+      perturbByReducedPrecisionError< extrinsicMeshData::multifluid::dPhaseMassDensity >( fluid );
+      perturbByReducedPrecisionError< extrinsicMeshData::multifluid::dPhaseViscosity >( fluid );
+      perturbByReducedPrecisionError< extrinsicMeshData::multifluid::dPhaseCompFraction >( fluid );
+      perturbByReducedPrecisionError< extrinsicMeshData::multifluid::dTotalDensity >( fluid );
+
+      solver.updatePhaseVolumeFraction( subRegion );
+      solver.updateRelPermModel( subRegion );
+      solver.updatePhaseMobility( subRegion );
+    } );
+  } );
+}
+
+integer constexpr maxNewtonIterReducedPrecision = 20;
+
+integer solveNewton( CompositionalMultiphaseFVM & solver,
+                     DomainPartition & domain,
+                     real64 const time,
+                     real64 const dt,
+                     bool const perturbDerivatives )
+{
+  real64 constexpr newtonTol = 1e-8;
+
+  DofManager const & dofManager = solver.getDofManager();
+  CRSMatrix< real64, globalIndex > & localMatrix = solver.getLocalMatrix();
+  ParallelMatrix & matrix = solver.getSystemMatrix();
+  ParallelVector & rhs = solver.getSystemRhs();
+  ParallelVector & solution = solver.getSystemSolution();
+
+  if( perturbDerivatives )
+  {
+    perturbFluidDerivatives( solver, domain );
+  }
+
+  for( integer newtonIter = 0; newtonIter < maxNewtonIterReducedPrecision; ++newtonIter )
+  {
+    localMatrix.zero();
+    rhs.zero();
+
+    {
+      arrayView1d< real64 > const localRhs = rhs.open();
+      solver.assembleSystem( time, dt, domain, dofManager, localMatrix.toViewConstSizes(), localRhs );
+      solver.applyBoundaryConditions( time, dt, domain, dofManager, localMatrix.toViewConstSizes(), localRhs );
+      rhs.close();
+    }
+
+    if( solver.calculateResidualNorm( domain, dofManager, rhs.values() ) < newtonTol )
+    {
+      return newtonIter;
+    }
+
+    matrix.create( localMatrix.toViewConst(), dofManager.numLocalDofs(), MPI_COMM_GEOSX );
+    solver.solveSystem( dofManager, matrix, rhs, solution );
+
+    real64 const scaleFactor = solver.scalingForSystemSolution( domain, dofManager, solution.values() );
+    solver.applySystemSolution( dofManager, solution.values(), scaleFactor, domain );
+    solver.updateState( domain );
+
+    if( perturbDerivatives )
+    {
+      perturbFluidDerivatives( solver, domain );
+    }
+  }
+  return maxNewtonIterReducedPrecision;
+}
+
+TEST_F( CompositionalMultiphaseFlowTest, jacobianReducedPrecisionFluidDerivatives_flux )
+{
+  // single-precision storage of the fluid derivatives (GEOSX_ENABLE_MIXED_PRECISION_FLUID) should
+  // perturb the assembled jacobian by no more than a few roundoff errors of real32
+  real64 const tol = 1e2 * std::numeric_limits< real32 >::epsilon();
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  auto const assembleFlux = [&] ( CRSMatrix< real64, globalIndex > & jacobian,
+                                  array1d< real64 > & residual )
+  {
+    residual.zero();
+    jacobian.zero();
+    solver->assembleFluxTerms( dt, domain, solver->getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+    jacobian.move( LvArray::MemorySpace::host );
+    residual.move( LvArray::MemorySpace::host, false );
+  };
+
+  solver->resetStateToBeginningOfStep( domain );
+
+  CRSMatrix< real64, globalIndex > jacobianStored( solver->getLocalMatrix() );
+  array1d< real64 > residualStored( jacobianStored.numRows() );
+  assembleFlux( jacobianStored, residualStored );
+
+  perturbFluidDerivatives( *solver, domain );
+
+  CRSMatrix< real64, globalIndex > jacobianPerturbed( solver->getLocalMatrix() );
+  array1d< real64 > residualPerturbed( jacobianPerturbed.numRows() );
+  assembleFlux( jacobianPerturbed, residualPerturbed );
+
+  // the residual does not depend on the derivatives
+  for( localIndex i = 0; i < residualStored.size(); ++i )
+  {
+    EXPECT_DOUBLE_EQ( residualPerturbed[i], residualStored[i] );
+  }
+  compareLocalMatrices( jacobianPerturbed.toViewConst(), jacobianStored.toViewConst(), tol );
+}
+
+TEST_F( CompositionalMultiphaseFlowTest, newtonConvergenceReducedPrecisionFluidDerivatives )
+{
+  // the derivatives are perturbed by the error of a single-precision storage in both build configurations,
+  // so this compares the two precisions whether or not GEOSX_ENABLE_MIXED_PRECISION_FLUID is on
+  integer constexpr numSteps = 3;
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  real64 stepTime = time;
+  for( integer step = 0; step < numSteps; ++step )
+  {
+    SCOPED_TRACE( "time step " + std::to_string( step ) );
+
+    if( step > 0 )
+    {
+      solver->implicitStepSetup( stepTime, dt, domain );
+    }
+
+    integer const numIterPerturbed = solveNewton( *solver, domain, stepTime, dt, true );
+    solver->resetStateToBeginningOfStep( domain );
+    integer const numIterStored = solveNewton( *solver, domain, stepTime, dt, false );
+
+    // a single-precision Jacobian of the fluid properties should cost at most one extra Newton iteration
+    EXPECT_LT( numIterStored, maxNewtonIterReducedPrecision );
+    EXPECT_LT( numIterPerturbed, maxNewtonIterReducedPrecision );
+    EXPECT_LE( std::abs( numIterPerturbed - numIterStored ), 1 );
+
+    solver->implicitStepComplete( stepTime, dt, domain );
+    stepTime += dt;
+  }
+}
+
 /*
  * Accumulation numerical test not passing due to some numerical catastrophic cancellation
  * happenning in the kernel for the particular set of initial conditions we're running.
@@ -13,7 +13,10 @@
  */
 
 #include "constitutive/fluid/MultiFluidBase.hpp"
+#include "constitutive/permeability/ConstantPermeability.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
+#include "finiteVolume/mimeticInnerProducts/BdVLMInnerProduct.hpp"
+#include "finiteVolume/mimeticInnerProducts/TPFAInnerProduct.hpp"
 #include "mainInterface/initialization.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "mainInterface/ProblemManager.hpp"
@@ -306,6 +309,68 @@ TEST_F( CompositionalMultiphaseHybridFlowTest, jacobianNumericalCheck_flux )
   } );
 }
 
+TEST_F( CompositionalMultiphaseHybridFlowTest, cachedTransMatricesEqualRecomputation )
+{
+  localIndex constexpr NF = 6;
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  MeshLevel const & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  FaceManager const & faceManager = mesh.getFaceManager();
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const nodePosition = nodeManager.referencePosition();
+  nodeManager.referencePosition().move( LvArray::MemorySpace::host, false );
+  arrayView1d< real64 const > const transMultiplier =
+    faceManager.getReference< array1d< real64 > >( FlowSolverBase::viewKeyStruct::transMultiplierString() );
+  transMultiplier.move( LvArray::MemorySpace::host, false );
+  ArrayOfArraysView< localIndex const > const faceToNodes = faceManager.nodeList().toViewConst();
+  real64 const lengthTolerance = domain.getMeshBody( 0 ).getGlobalLengthScale() * 1e-8;
+
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    ASSERT_EQ( subRegion.numFacesPerElement(), NF );
+
+    string const & permModelName = subRegion.getReference< string >( FlowSolverBase::viewKeyStruct::permeabilityNamesString() );
+    PermeabilityBase const & permModel = subRegion.getConstitutiveModels().getGroup< PermeabilityBase >( permModelName );
+    ASSERT_NE( dynamicCast< ConstantPermeability const * >( &permModel ), nullptr );
+
+    arrayView3d< real64 const > const elemPerm = permModel.permeability();
+    elemPerm.move( LvArray::MemorySpace::host, false );
+    arrayView2d< real64 const > const elemCenter = subRegion.getElementCenter();
+    arrayView1d< real64 const > const elemVolume = subRegion.getElementVolume();
+    arrayView2d< localIndex const > const elemToFaces = subRegion.faceList();
+
+    arrayView3d< real64 const > const transMatrix = subRegion.getExtrinsicData< extrinsicMeshData::flow::transMatrix >();
+    arrayView3d< real64 const > const transMatrixGrav = subRegion.getExtrinsicData< extrinsicMeshData::flow::transMatrixGravity >();
+    transMatrix.move( LvArray::MemorySpace::host, false );
+    transMatrixGrav.move( LvArray::MemorySpace::host, false );
+
+    array2d< real64 > recomputed( NF, NF );
+    array2d< real64 > recomputedGrav( NF, NF );
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+      // the flux inner product of the discretization, and the TPFA inner product of the gravity term
+      mimeticInnerProduct::BdVLMInnerProduct::compute< NF >( nodePosition, transMultiplier, faceToNodes, elemToFaces[ei],
+                                                             elemCenter[ei], elemVolume[ei], perm, lengthTolerance,
+                                                             recomputed.toSlice() );
+      mimeticInnerProduct::TPFAInnerProduct::compute< NF >( nodePosition, transMultiplier, faceToNodes, elemToFaces[ei],
+                                                            elemCenter[ei], elemVolume[ei], perm, lengthTolerance,
+                                                            recomputedGrav.toSlice() );
+
+      for( localIndex i = 0; i < NF; ++i )
+      {
+        for( localIndex j = 0; j < NF; ++j )
+        {
+          EXPECT_DOUBLE_EQ( transMatrix[ei][i][j], recomputed[i][j] );
+          EXPECT_DOUBLE_EQ( transMatrixGrav[ei][i][j], recomputedGrav[i][j] );
+        }
+      }
+    }
+  } );
+}
+
 
 int main( int argc, char * * argv )
 {
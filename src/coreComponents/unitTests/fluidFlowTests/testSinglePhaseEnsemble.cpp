@@ -0,0 +1,198 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseBaseExtrinsicData.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <SinglePhaseFVM name=\"flowSolver\"\n"
+  "                    discretization=\"singlePhaseTPFA\"\n"
+  "                    targetRegions=\"{ Region1 }\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-8\"\n"
+  "                                 newtonMaxIter=\"8\"/>\n"
+  "      <LinearSolverParameters directParallel=\"0\"/>\n"
+  "    </SinglePhaseFVM>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{ C3D8 }\"\n"
+  "                  xCoords=\"{ 0, 5 }\"\n"
+  "                  yCoords=\"{ 0, 5 }\"\n"
+  "                  zCoords=\"{ 0, 1 }\"\n"
+  "                  nx=\"{ 5 }\"\n"
+  "                  ny=\"{ 5 }\"\n"
+  "                  nz=\"{ 1 }\"\n"
+  "                  cellBlockNames=\"{ block1 }\"/>\n"
+  "  </Mesh>\n"
+  "  <Geometry>\n"
+  "    <Box name=\"source\" xMin=\"{ -0.01, -0.01, -0.01 }\" xMax=\"{ 1.01, 1.01, 1.01 }\"/>\n"
+  "    <Box name=\"sink\" xMin=\"{ 3.99, 3.99, -0.01 }\" xMax=\"{ 5.01, 5.01, 1.01 }\"/>\n"
+  "  </Geometry>\n"
+  "  <Events maxTime=\"3e3\">\n"
+  "    <PeriodicEvent name=\"solverApplications\"\n"
+  "                   forceDt=\"1e3\"\n"
+  "                   target=\"/Solvers/flowSolver\"/>\n"
+  "  </Events>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"singlePhaseTPFA\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region1\" cellBlocks=\"{ block1 }\" materialList=\"{ water, rock }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  compressibility=\"5e-10\"\n"
+  "                                  viscosibility=\"0.0\"/>\n"
+  "    <CompressibleSolidConstantPermeability name=\"rock\"\n"
+  "                                           solidModelName=\"nullSolid\"\n"
+  "                                           porosityModelName=\"rockPorosity\"\n"
+  "                                           permeabilityModelName=\"rockPerm\"/>\n"
+  "    <NullModel name=\"nullSolid\"/>\n"
+  "    <PressurePorosity name=\"rockPorosity\"\n"
+  "                      defaultReferencePorosity=\"0.05\"\n"
+  "                      referencePressure=\"0.0\"\n"
+  "                      compressibility=\"1.0e-9\"/>\n"
+  "    <ConstantPermeability name=\"rockPerm\"\n"
+  "                          permeabilityComponents=\"{ 2.0e-16, 2.0e-16, 2.0e-16 }\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"initialPressure\"\n"
+  "                        initialCondition=\"1\"\n"
+  "                        setNames=\"{ all }\"\n"
+  "                        objectPath=\"ElementRegions/Region1/block1\"\n"
+  "                        fieldName=\"pressure\"\n"
+  "                        scale=\"5e6\"/>\n"
+  "    <SourceFlux name=\"sourceTerm\"\n"
+  "                objectPath=\"ElementRegions/Region1/block1\"\n"
+  "                scale=\"-0.001\"\n"
+  "                setNames=\"{ source }\"/>\n"
+  "    <FieldSpecification name=\"sinkTerm\"\n"
+  "                        objectPath=\"ElementRegions/Region1/block1\"\n"
+  "                        fieldName=\"pressure\"\n"
+  "                        scale=\"5e6\"\n"
+  "                        setNames=\"{ sink }\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>";
+
+/**
+ * @brief Run the problem and copy the pressures of its realizations at the end of the simulation.
+ * @param numRealizations the number of realizations, all with the same inputs
+ * @return the pressures of the cells, one column per realization
+ */
+array2d< real64 > runEnsemble( integer const numRealizations )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+
+  Group & commandLine = problemManager.getGroup< Group >( problemManager.groupKeys.commandLine );
+  commandLine.getReference< integer >( problemManager.viewKeys.numRealizations ) = numRealizations;
+  commandLine.getReference< string >( problemManager.viewKeys.outputDirectory ) = ".";
+
+  setupProblemFromXML( problemManager, xmlInput );
+
+  // the realizations are advanced together by the solver, not one after another
+  SolverBase const & solver = problemManager.getPhysicsSolverManager().getGroup< SolverBase >( "flowSolver" );
+  EXPECT_EQ( solver.numRealizations(), numRealizations );
+
+  problemManager.runSimulation();
+
+  ElementSubRegionBase const & subRegion =
+    problemManager.getDomainPartition().getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "Region1" ).getSubRegion( "block1" );
+  arrayView1d< real64 const > const pressure = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+
+  array2d< real64 > pressures( subRegion.size(), numRealizations );
+  if( numRealizations == 1 )
+  {
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      pressures[ei][0] = pressure[ei];
+    }
+    return pressures;
+  }
+
+  arrayView2d< real64 const > const ensemblePressure = subRegion.getExtrinsicData< extrinsicMeshData::flow::ensemblePressure >();
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    // the regular pressure holds the first realization
+    EXPECT_EQ( pressure[ei], ensemblePressure[ei][0] );
+    for( integer r = 0; r < numRealizations; ++r )
+    {
+      pressures[ei][r] = ensemblePressure[ei][r];
+    }
+  }
+  return pressures;
+}
+
+TEST( SinglePhaseEnsemble, identicalRealizationsHaveIdenticalSolutions )
+{
+  array2d< real64 > const pressures = runEnsemble( 2 );
+
+  for( localIndex ei = 0; ei < pressures.size( 0 ); ++ei )
+  {
+    SCOPED_TRACE( "element " + std::to_string( ei ) );
+    EXPECT_EQ( pressures[ei][1], pressures[ei][0] );
+  }
+}
+
+TEST( SinglePhaseEnsemble, realizationsMatchSingleRun )
+{
+  array2d< real64 > const singleRun = runEnsemble( 1 );
+  array2d< real64 > const ensemble = runEnsemble( 2 );
+  ASSERT_EQ( singleRun.size( 0 ), ensemble.size( 0 ) );
+
+  // the flux and accumulation terms are evaluated in another order in the ensemble kernels
+  real64 const relTol = 1e-10;
+  for( localIndex ei = 0; ei < singleRun.size( 0 ); ++ei )
+  {
+    SCOPED_TRACE( "element " + std::to_string( ei ) );
+    for( integer r = 0; r < 2; ++r )
+    {
+      EXPECT_NEAR( ensemble[ei][r], singleRun[ei][0], relTol * LvArray::math::abs( singleRun[ei][0] ) );
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,145 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/initialization.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+/**
+ * @brief Solver giving access to the error history of the time step controller.
+ */
+class TimeStepControlSolver : public SolverBase
+{
+public:
+  TimeStepControlSolver( string const & name,
+                         Group * const parent ):
+    SolverBase( name, parent )
+  {}
+
+  using SolverBase::recordTimeStepControlError;
+};
+
+class TimeStepControlTest : public ::testing::Test
+{
+protected:
+
+  TimeStepControlTest():
+    root( "root", node ),
+    solver( "solver", &root ),
+    params( solver.getNonlinearSolverParameters() )
+  {
+    params.m_timeStepControl = NonlinearSolverParameters::TimeStepControl::IterationTarget;
+    params.m_numdtAttempts = 0;
+  }
+
+  /// Factor of the PID controller for the errors e0 (most recent), e1 and e2, before clamping
+  static real64 pidFactor( real64 const e0, real64 const e1, real64 const e2 )
+  {
+    return std::pow( e1 / e0, 0.075 ) * std::pow( 1.0 / e0, 0.175 ) * std::pow( e1 * e1 / ( e0 * e2 ), 0.01 );
+  }
+
+  conduit::Node node;
+  Group root;
+  TimeStepControlSolver solver;
+  NonlinearSolverParameters & params;
+};
+
+TEST_F( TimeStepControlTest, keepsTimeStepAtTargets )
+{
+  real64 nextDt = 0.0;
+  solver.recordTimeStepControlError( 1.0 );
+  solver.setNextDtBasedOnTargets( 10.0, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 10.0 );
+}
+
+TEST_F( TimeStepControlTest, followsKnownErrorHistory )
+{
+  real64 const dt = 10.0;
+  real64 nextDt = 0.0;
+
+  // errors of the history, oldest first
+  real64 const errors[3] = { 0.8, 1.5, 1.2 };
+  for( real64 const error : errors )
+  {
+    solver.recordTimeStepControlError( error );
+  }
+  solver.setNextDtBasedOnTargets( dt, nextDt );
+  EXPECT_NEAR( nextDt, dt * pidFactor( 1.2, 1.5, 0.8 ), 1e-12 * dt );
+
+  // one more step below the target increases the time step
+  solver.recordTimeStepControlError( 0.7 );
+  solver.setNextDtBasedOnTargets( dt, nextDt );
+  EXPECT_NEAR( nextDt, dt * pidFactor( 0.7, 1.2, 1.5 ), 1e-12 * dt );
+  EXPECT_GT( nextDt, dt );
+}
+
+TEST_F( TimeStepControlTest, clampsFactor )
+{
+  real64 const dt = 10.0;
+  real64 nextDt = 0.0;
+
+  // errors close to zero are bounded, and the increase is capped by maxTimeStepIncrease
+  solver.recordTimeStepControlError( 0.0 );
+  solver.recordTimeStepControlError( 0.0 );
+  solver.setNextDtBasedOnTargets( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, dt * params.m_maxTimeStepIncrease );
+
+  // no increase right after a time step cut
+  params.m_numdtAttempts = 1;
+  solver.setNextDtBasedOnTargets( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, dt );
+
+  // large errors are capped by timeStepCutFactor
+  params.m_numdtAttempts = 0;
+  solver.recordTimeStepControlError( 1e3 );
+  solver.recordTimeStepControlError( 1e6 );
+  solver.setNextDtBasedOnTargets( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, dt * params.m_timeStepCutFactor );
+}
+
+TEST_F( TimeStepControlTest, resetsHistoryAtInitialization )
+{
+  real64 const dt = 10.0;
+  real64 nextDt = 0.0;
+
+  solver.recordTimeStepControlError( 3.0 );
+  solver.recordTimeStepControlError( 0.5 );
+  solver.initializePostInitialConditions();
+
+  // the history of the previous run does not contribute anymore
+  solver.recordTimeStepControlError( 1.5 );
+  solver.setNextDtBasedOnTargets( dt, nextDt );
+  EXPECT_NEAR( nextDt, dt * pidFactor( 1.5, 1.0, 1.0 ), 1e-12 * dt );
+}
+
+TEST_F( TimeStepControlTest, rejectsUnsupportedStateChange )
+{
+  params.m_timeStepControl = NonlinearSolverParameters::TimeStepControl::StateChange;
+  EXPECT_THROW( solver.postProcessInputRecursive(), InputError );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
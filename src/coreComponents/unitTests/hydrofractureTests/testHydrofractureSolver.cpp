@@ -0,0 +1,342 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "physicsSolvers/multiphysics/HydrofractureSolver.hpp"
+#include "physicsSolvers/surfaceGeneration/SurfaceGenerator.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+/**
+ * @brief Hydrofracture solver recording, for each outer iteration, the size of the mesh and whether the
+ *        linear system has been set up.
+ */
+class HydrofractureSolverSetupRecorder : public HydrofractureSolver
+{
+public:
+
+  HydrofractureSolverSetupRecorder( string const & name,
+                                    Group * const parent ):
+    HydrofractureSolver( name, parent )
+  {}
+
+  static string catalogName()
+  {
+    return "HydrofractureSetupRecorder";
+  }
+
+  virtual void setupSystem( DomainPartition & domain,
+                            DofManager & dofManager,
+                            CRSMatrix< real64, globalIndex > & localMatrix,
+                            ParallelVector & rhs,
+                            ParallelVector & solution,
+                            bool const setSparsity = true ) override
+  {
+    HydrofractureSolver::setupSystem( domain, dofManager, localMatrix, rhs, solution, setSparsity );
+    m_systemSetUp = true;
+  }
+
+  /// Called once per outer iteration of solverStep, right after the (possibly skipped) system setup
+  virtual real64 nonlinearImplicitStep( real64 const & time_n,
+                                        real64 const & dt,
+                                        integer const cycleNumber,
+                                        DomainPartition & domain ) override
+  {
+    meshSizes.emplace_back( countMeshObjects( domain ) );
+    systemSetUps.emplace_back( m_systemSetUp );
+    m_systemSetUp = false;
+
+    if( alwaysSetUpSystem )
+    {
+      // the system is set up again at the next outer iteration, as before the setups were skipped
+      m_systemSetupMeshSize = -1;
+    }
+    return HydrofractureSolver::nonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  }
+
+  /// Whether the linear system is set up at every outer iteration
+  bool alwaysSetUpSystem = false;
+
+  /// Number of mesh objects at each outer iteration
+  std::vector< localIndex > meshSizes;
+
+  /// Whether the linear system has been set up at each outer iteration
+  std::vector< bool > systemSetUps;
+
+private:
+
+  bool m_systemSetUp = false;
+};
+
+REGISTER_CATALOG_ENTRY( SolverBase, HydrofractureSolverSetupRecorder, string const &, Group * const )
+
+// KGD fracture propagation, as in inputFiles/hydraulicFracturing/kgdNodeBased_C3D6_smoke.xml
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"{ 0.0, 0.0, 0.0 }\">\n"
+  "    <HydrofractureSetupRecorder name=\"hydrofracture\"\n"
+  "                                solidSolverName=\"lagsolve\"\n"
+  "                                fluidSolverName=\"SinglePhaseFlow\"\n"
+  "                                surfaceGeneratorName=\"SurfaceGen\"\n"
+  "                                couplingTypeOption=\"FIM\"\n"
+  "                                discretization=\"FE1\"\n"
+  "                                targetRegions=\"{ Fracture }\"\n"
+  "                                contactRelationName=\"fractureContact\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-5\"\n"
+  "                                 newtonMaxIter=\"50\"\n"
+  "                                 lineSearchMaxCuts=\"10\"/>\n"
+  "      <LinearSolverParameters directParallel=\"0\"/>\n"
+  "    </HydrofractureSetupRecorder>\n"
+  "    <SolidMechanicsLagrangianSSLE name=\"lagsolve\"\n"
+  "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+  "                                  discretization=\"FE1\"\n"
+  "                                  targetRegions=\"{ Domain, Fracture }\"\n"
+  "                                  contactRelationName=\"fractureContact\"/>\n"
+  "    <SinglePhaseFVM name=\"SinglePhaseFlow\"\n"
+  "                    discretization=\"singlePhaseTPFA\"\n"
+  "                    targetRegions=\"{ Fracture }\"/>\n"
+  "    <SurfaceGenerator name=\"SurfaceGen\"\n"
+  "                      targetRegions=\"{ Domain }\"\n"
+  "                      rockToughness=\"0.707e7\"\n"
+  "                      nodeBasedSIF=\"1\"\n"
+  "                      mpiCommOrder=\"1\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{ C3D6 }\"\n"
+  "                  xCoords=\"{ -5, 5 }\"\n"
+  "                  yCoords=\"{ 0, 15 }\"\n"
+  "                  zCoords=\"{ 0, 1 }\"\n"
+  "                  nx=\"{ 10 }\"\n"
+  "                  ny=\"{ 15 }\"\n"
+  "                  nz=\"{ 1 }\"\n"
+  "                  cellBlockNames=\"{ cb1 }\"/>\n"
+  "  </Mesh>\n"
+  "  <Geometry>\n"
+  "    <Box name=\"fracture\" xMin=\"{ -0.01, -0.01, -0.01 }\" xMax=\"{ 0.01, 1.01, 1.01 }\"/>\n"
+  "    <Box name=\"source\" xMin=\"{ -0.01, -0.01, -0.01 }\" xMax=\"{ 0.01, 1.01, 1.01 }\"/>\n"
+  "    <Box name=\"core\" xMin=\"{ -0.01, -0.01, -0.01 }\" xMax=\"{ 0.01, 100.01, 1.01 }\"/>\n"
+  "  </Geometry>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"singlePhaseTPFA\" meanPermCoefficient=\"0.8\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Domain\" cellBlocks=\"{ cb1 }\" materialList=\"{ water, rock }\"/>\n"
+  "    <SurfaceElementRegion name=\"Fracture\"\n"
+  "                          defaultAperture=\"1.0e-4\"\n"
+  "                          materialList=\"{ water, rock, fractureFilling, fractureContact }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  compressibility=\"5e-10\"\n"
+  "                                  referenceViscosity=\"1.0e-3\"\n"
+  "                                  viscosibility=\"0.0\"/>\n"
+  "    <ElasticIsotropic name=\"rock\"\n"
+  "                      defaultDensity=\"2700\"\n"
+  "                      defaultBulkModulus=\"1.0e9\"\n"
+  "                      defaultShearModulus=\"1.0e9\"/>\n"
+  "    <CompressibleSolidParallelPlatesPermeability name=\"fractureFilling\"\n"
+  "                                                 solidModelName=\"nullSolid\"\n"
+  "                                                 porosityModelName=\"fracturePorosity\"\n"
+  "                                                 permeabilityModelName=\"fracturePerm\"/>\n"
+  "    <NullModel name=\"nullSolid\"/>\n"
+  "    <PressurePorosity name=\"fracturePorosity\"\n"
+  "                      defaultReferencePorosity=\"1.00\"\n"
+  "                      referencePressure=\"0.0\"\n"
+  "                      compressibility=\"0.0\"/>\n"
+  "    <ParallelPlatesPermeability name=\"fracturePerm\"/>\n"
+  "    <FrictionlessContact name=\"fractureContact\"\n"
+  "                         penaltyStiffness=\"0.0e8\"\n"
+  "                         apertureTableName=\"apertureTable\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"waterDensity\" initialCondition=\"1\" setNames=\"{ fracture }\"\n"
+  "                        objectPath=\"ElementRegions\" fieldName=\"water_density\" scale=\"1000\"/>\n"
+  "    <FieldSpecification name=\"frac\" initialCondition=\"1\" setNames=\"{ fracture }\"\n"
+  "                        objectPath=\"faceManager\" fieldName=\"ruptureState\" scale=\"1\"/>\n"
+  "    <FieldSpecification name=\"separableFace\" initialCondition=\"1\" setNames=\"{ core }\"\n"
+  "                        objectPath=\"faceManager\" fieldName=\"isFaceSeparable\" scale=\"1\"/>\n"
+  "    <FieldSpecification name=\"yconstraint\" objectPath=\"nodeManager\" fieldName=\"TotalDisplacement\"\n"
+  "                        component=\"1\" scale=\"0.0\" setNames=\"{ all }\"/>\n"
+  "    <FieldSpecification name=\"zconstraint\" objectPath=\"nodeManager\" fieldName=\"TotalDisplacement\"\n"
+  "                        component=\"2\" scale=\"0.0\" setNames=\"{ all }\"/>\n"
+  "    <FieldSpecification name=\"left\" objectPath=\"nodeManager\" fieldName=\"TotalDisplacement\"\n"
+  "                        component=\"0\" scale=\"0.0\" setNames=\"{ xneg }\"/>\n"
+  "    <FieldSpecification name=\"right\" objectPath=\"nodeManager\" fieldName=\"TotalDisplacement\"\n"
+  "                        component=\"0\" scale=\"-0.0\" setNames=\"{ xpos }\"/>\n"
+  "    <SourceFlux name=\"sourceTerm\" objectPath=\"ElementRegions/Fracture\" scale=\"-5.0\" setNames=\"{ source }\"/>\n"
+  "  </FieldSpecifications>\n"
+  "  <Functions>\n"
+  "    <TableFunction name=\"apertureTable\" coordinates=\"{ -1.0e-3, 0.0 }\" values=\"{ 1.0e-6, 1.0e-4 }\"/>\n"
+  "  </Functions>\n"
+  "</Problem>";
+
+/**
+ * @brief Fracture solution and setup history of a run.
+ */
+struct HydrofractureRun
+{
+  std::vector< localIndex > meshSizes;
+  std::vector< bool > systemSetUps;
+  std::vector< real64 > pressure;
+  std::vector< real64 > aperture;
+  std::vector< real64 > displacement;
+};
+
+/**
+ * @brief Propagate the KGD fracture for a few time steps.
+ * @param alwaysSetUpSystem whether the linear system is set up at every outer iteration
+ * @return the setup history, and the fracture pressure and aperture and the displacement at the end of the run
+ */
+HydrofractureRun runKGD( bool const alwaysSetUpSystem )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput );
+
+  PhysicsSolverManager & solverManager = state.getProblemManager().getPhysicsSolverManager();
+  HydrofractureSolverSetupRecorder & solver = solverManager.getGroup< HydrofractureSolverSetupRecorder >( "hydrofracture" );
+  SurfaceGenerator & surfaceGenerator = solverManager.getGroup< SurfaceGenerator >( "SurfaceGen" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  solver.alwaysSetUpSystem = alwaysSetUpSystem;
+
+  // the initial fracture, as the preFracture event of the input files
+  surfaceGenerator.execute( 0.0, 0.0, 0, 0, 0.0, domain );
+
+  real64 const dt = 1.0;
+  integer const numSteps = 8;
+  for( integer cycle = 0; cycle < numSteps; ++cycle )
+  {
+    solver.solverStep( cycle * dt, dt, cycle, domain );
+  }
+
+  HydrofractureRun run;
+  run.meshSizes = solver.meshSizes;
+  run.systemSetUps = solver.systemSetUps;
+
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  mesh.getElemManager().getRegion( "Fracture" ).forElementSubRegions< FaceElementSubRegion >( [&]( FaceElementSubRegion const & subRegion )
+  {
+    arrayView1d< real64 const > const pressure = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+    arrayView1d< real64 const > const aperture = subRegion.getElementAperture();
+    pressure.move( LvArray::MemorySpace::host, false );
+    aperture.move( LvArray::MemorySpace::host, false );
+    run.pressure.insert( run.pressure.end(), pressure.begin(), pressure.end() );
+    run.aperture.insert( run.aperture.end(), aperture.begin(), aperture.end() );
+  } );
+
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const displacement = mesh.getNodeManager().totalDisplacement();
+  displacement.move( LvArray::MemorySpace::host, false );
+  for( localIndex a = 0; a < displacement.size( 0 ); ++a )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      run.displacement.emplace_back( displacement( a, i ) );
+    }
+  }
+
+  return run;
+}
+
+/**
+ * @brief Compare two fields, relatively to the largest value of the reference field.
+ * @param values the field to check
+ * @param reference the reference field
+ * @param relTol the relative tolerance
+ */
+void expectNear( std::vector< real64 > const & values, std::vector< real64 > const & reference, real64 const relTol )
+{
+  ASSERT_EQ( values.size(), reference.size() );
+  real64 maxValue = 0.0;
+  for( real64 const value : reference )
+  {
+    maxValue = std::max( maxValue, std::fabs( value ) );
+  }
+  ASSERT_GT( maxValue, 0.0 );
+  for( std::size_t i = 0; i < values.size(); ++i )
+  {
+    SCOPED_TRACE( "index " + std::to_string( i ) );
+    EXPECT_NEAR( values[i], reference[i], relTol * maxValue );
+  }
+}
+
+TEST( HydrofractureSolverTest, systemSetupOnlyWhenMeshChanges )
+{
+  HydrofractureRun const skipped = runKGD( false );
+  HydrofractureRun const alwaysSetUp = runKGD( true );
+
+  // the setup is skipped if and only if the mesh is unchanged since the previous outer iteration
+  ASSERT_FALSE( skipped.meshSizes.empty() );
+  EXPECT_TRUE( skipped.systemSetUps[0] );
+  integer numSkipped = 0;
+  integer numPropagations = 0;
+  for( std::size_t i = 1; i < skipped.meshSizes.size(); ++i )
+  {
+    SCOPED_TRACE( "outer iteration " + std::to_string( i ) );
+    bool const meshChanged = skipped.meshSizes[i] != skipped.meshSizes[i-1];
+    EXPECT_EQ( skipped.systemSetUps[i], meshChanged );
+    numSkipped += !meshChanged;
+    numPropagations += meshChanged;
+  }
+
+  // both branches are exercised: the fracture propagates, and most steps leave the mesh unchanged
+  EXPECT_GT( numSkipped, 0 );
+  EXPECT_GT( numPropagations, 0 );
+
+  // the reference run sets the system up at every outer iteration, and follows the same propagation
+  for( bool const systemSetUp : alwaysSetUp.systemSetUps )
+  {
+    EXPECT_TRUE( systemSetUp );
+  }
+  EXPECT_EQ( alwaysSetUp.meshSizes, skipped.meshSizes );
+
+  // the reused system gives the same solution
+  real64 const relTol = 1e-10;
+  expectNear( skipped.pressure, alwaysSetUp.pressure, relTol );
+  expectNear( skipped.aperture, alwaysSetUp.aperture, relTol );
+  expectNear( skipped.displacement, alwaysSetUp.displacement, relTol );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,186 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/surfaceGeneration/SurfaceGenerator.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+/**
+ * @brief Input with two separable planes, at x = -1 and x = 1, of a 4x4x1 mesh.
+ * @param rupturedSetNames the sets of faces ruptured initially, or an empty string for no initial fracture
+ * @return the xml input
+ */
+string makeXmlInput( string const & rupturedSetNames )
+{
+  string const ruptureSpecification = rupturedSetNames.empty() ? "" :
+                                       "    <FieldSpecification name=\"frac\" initialCondition=\"1\" setNames=\"" + rupturedSetNames + "\"\n"
+                                       "                        objectPath=\"faceManager\" fieldName=\"ruptureState\" scale=\"1\"/>\n";
+  return
+    "<Problem>\n"
+    "  <Solvers gravityVector=\"{ 0.0, 0.0, 0.0 }\">\n"
+    "    <SolidMechanicsLagrangianSSLE name=\"lagsolve\"\n"
+    "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+    "                                  discretization=\"FE1\"\n"
+    "                                  targetRegions=\"{ Domain, Fracture }\"/>\n"
+    "    <SurfaceGenerator name=\"SurfaceGen\"\n"
+    "                      targetRegions=\"{ Domain }\"\n"
+    "                      rockToughness=\"1.0e6\"\n"
+    "                      mpiCommOrder=\"1\"/>\n"
+    "  </Solvers>\n"
+    "  <Mesh>\n"
+    "    <InternalMesh name=\"mesh1\"\n"
+    "                  elementTypes=\"{ C3D8 }\"\n"
+    "                  xCoords=\"{ -2, 2 }\"\n"
+    "                  yCoords=\"{ 0, 4 }\"\n"
+    "                  zCoords=\"{ 0, 1 }\"\n"
+    "                  nx=\"{ 4 }\"\n"
+    "                  ny=\"{ 4 }\"\n"
+    "                  nz=\"{ 1 }\"\n"
+    "                  cellBlockNames=\"{ cb1 }\"/>\n"
+    "  </Mesh>\n"
+    "  <Geometry>\n"
+    "    <Box name=\"leftFracture\" xMin=\"{ -1.01, -0.01, -0.01 }\" xMax=\"{ -0.99, 2.01, 1.01 }\"/>\n"
+    "    <Box name=\"rightFracture\" xMin=\"{ 0.99, -0.01, -0.01 }\" xMax=\"{ 1.01, 2.01, 1.01 }\"/>\n"
+    "    <Box name=\"leftCore\" xMin=\"{ -1.01, -0.01, -0.01 }\" xMax=\"{ -0.99, 4.01, 1.01 }\"/>\n"
+    "    <Box name=\"rightCore\" xMin=\"{ 0.99, -0.01, -0.01 }\" xMax=\"{ 1.01, 4.01, 1.01 }\"/>\n"
+    "  </Geometry>\n"
+    "  <NumericalMethods>\n"
+    "    <FiniteElements>\n"
+    "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+    "    </FiniteElements>\n"
+    "  </NumericalMethods>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion name=\"Domain\" cellBlocks=\"{ cb1 }\" materialList=\"{ rock }\"/>\n"
+    "    <SurfaceElementRegion name=\"Fracture\" defaultAperture=\"1.0e-4\" materialList=\"{ rock }\"/>\n"
+    "  </ElementRegions>\n"
+    "  <Constitutive>\n"
+    "    <ElasticIsotropic name=\"rock\"\n"
+    "                      defaultDensity=\"2700\"\n"
+    "                      defaultBulkModulus=\"1.0e9\"\n"
+    "                      defaultShearModulus=\"1.0e9\"/>\n"
+    "  </Constitutive>\n"
+    "  <FieldSpecifications>\n"
+    + ruptureSpecification +
+    "    <FieldSpecification name=\"separableFace\" initialCondition=\"1\" setNames=\"{ leftCore, rightCore }\"\n"
+    "                        objectPath=\"faceManager\" fieldName=\"isFaceSeparable\" scale=\"1\"/>\n"
+    "  </FieldSpecifications>\n"
+    "</Problem>";
+}
+
+/**
+ * @brief Numbers of locally owned objects, summed over the ranks.
+ */
+struct MeshCounts
+{
+  globalIndex numNodes;
+  globalIndex numEdges;
+  globalIndex numFaces;
+  globalIndex numFaceElements;
+};
+
+template< typename T >
+globalIndex countOwned( T const & objectManager )
+{
+  arrayView1d< integer const > const ghostRank = objectManager.ghostRank();
+  globalIndex numOwned = 0;
+  for( localIndex i = 0; i < objectManager.size(); ++i )
+  {
+    numOwned += ghostRank[i] < 0;
+  }
+  return MpiWrapper::sum( numOwned );
+}
+
+MeshCounts countMesh( DomainPartition const & domain )
+{
+  MeshLevel const & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  MeshCounts counts{};
+  counts.numNodes = countOwned( mesh.getNodeManager() );
+  counts.numEdges = countOwned( mesh.getEdgeManager() );
+  counts.numFaces = countOwned( mesh.getFaceManager() );
+  counts.numFaceElements = countOwned( mesh.getElemManager().getRegion( "Fracture" ).getSubRegion< FaceElementSubRegion >( 0 ) );
+  return counts;
+}
+
+void expectSameCounts( MeshCounts const & counts, MeshCounts const & reference )
+{
+  EXPECT_EQ( counts.numNodes, reference.numNodes );
+  EXPECT_EQ( counts.numEdges, reference.numEdges );
+  EXPECT_EQ( counts.numFaces, reference.numFaces );
+  EXPECT_EQ( counts.numFaceElements, reference.numFaceElements );
+}
+
+TEST( SurfaceGeneratorTest, noRupturedFaceLeavesMeshUnchanged )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), makeXmlInput( "" ).c_str() );
+
+  SurfaceGenerator & surfaceGenerator = state.getProblemManager().getPhysicsSolverManager().getGroup< SurfaceGenerator >( "SurfaceGen" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  // no node is attached to a ruptured face: no candidate node, and no topology change on any rank
+  MeshCounts const initial = countMesh( domain );
+  EXPECT_EQ( initial.numNodes, 50 );
+  EXPECT_EQ( initial.numFaceElements, 0 );
+
+  surfaceGenerator.execute( 0.0, 0.0, 0, 0, 0.0, domain );
+  expectSameCounts( countMesh( domain ), initial );
+}
+
+TEST( SurfaceGeneratorTest, independentFracturesSplitOnce )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), makeXmlInput( "{ leftFracture, rightFracture }" ).c_str() );
+
+  SurfaceGenerator & surfaceGenerator = state.getProblemManager().getPhysicsSolverManager().getGroup< SurfaceGenerator >( "SurfaceGen" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  MeshCounts const initial = countMesh( domain );
+
+  // each fracture covers two faces: its four nodes at y = 0 and y = 1 are split, the tip nodes at y = 2 are not.
+  // The two fractures do not share any element, so that their nodes are split in the same rounds.
+  surfaceGenerator.execute( 0.0, 0.0, 0, 0, 0.0, domain );
+  MeshCounts const fractured = countMesh( domain );
+  EXPECT_EQ( fractured.numNodes, initial.numNodes + 8 );
+  EXPECT_EQ( fractured.numFaces, initial.numFaces + 4 );
+  EXPECT_EQ( fractured.numFaceElements, 4 );
+
+  // the nodes attached to the ruptured faces are checked again, but no separation path is left
+  surfaceGenerator.execute( 0.0, 0.0, 1, 0, 0.0, domain );
+  expectSameCounts( countMesh( domain ), fractured );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,173 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{ C3D8 }\"\n"
+  "                  xCoords=\"{ 0, 4 }\"\n"
+  "                  yCoords=\"{ 0, 1 }\"\n"
+  "                  zCoords=\"{ 0, 1 }\"\n"
+  "                  nx=\"{ 4 }\"\n"
+  "                  ny=\"{ 1 }\"\n"
+  "                  nz=\"{ 1 }\"\n"
+  "                  cellBlockNames=\"{ cb1 }\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb1 }\" materialList=\"{}\"/>\n"
+  "  </ElementRegions>\n"
+  "</Problem>";
+
+/// A row of the CSV file of the communication profile
+struct ProfileRow
+{
+  string fields;
+  int rank;
+  int neighbor;
+  long long messages;
+  long long bytesSent;
+  long long bytesReceived;
+};
+
+/**
+ * @brief Read the rows of a CSV file written by CommunicationTools::reportProfile().
+ * @param fileName the name of the file
+ * @return the rows, without the header
+ */
+std::vector< ProfileRow > readProfile( string const & fileName )
+{
+  std::ifstream is( fileName );
+  EXPECT_TRUE( is.good() );
+
+  string line;
+  std::getline( is, line );
+  EXPECT_EQ( line, "fields,rank,neighbor,messages,bytesSent,bytesReceived" );
+
+  std::vector< ProfileRow > rows;
+  while( std::getline( is, line ) )
+  {
+    // the names of the fields are quoted since they may contain commas
+    std::size_t const end = line.rfind( '"' );
+    EXPECT_EQ( line.front(), '"' );
+    EXPECT_NE( end, std::size_t( 0 ) );
+
+    ProfileRow row;
+    row.fields = line.substr( 1, end - 1 );
+    std::istringstream values( line.substr( end + 1 ) );
+    char comma;
+    values >> comma >> row.rank >> comma >> row.neighbor >> comma >> row.messages
+           >> comma >> row.bytesSent >> comma >> row.bytesReceived;
+    EXPECT_FALSE( values.fail() );
+    rows.push_back( row );
+  }
+  return rows;
+}
+
+TEST( CommunicationProfile, csvOutput )
+{
+  string const fileName = "testCommunicationProfile.csv";
+  std::unique_ptr< CommandLineOptions > options = std::make_unique< CommandLineOptions >( g_commandLineOptions );
+  options->communicationProfile = fileName;
+  GeosxState state( std::move( options ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput );
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
+  CommunicationTools & commTools = CommunicationTools::getInstance();
+  for( int i = 0; i < 2; ++i )
+  {
+    commTools.synchronizeFields( fieldNames, domain.getMeshBody( 0 ).getMeshLevel( 0 ), domain.getNeighbors(), false );
+  }
+  commTools.logEventProfile( "event" );
+  commTools.reportProfile();
+
+  if( MpiWrapper::commRank( MPI_COMM_GEOSX ) != 0 )
+  {
+    return;
+  }
+
+  std::vector< ProfileRow > const rows = readProfile( fileName );
+  int const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  if( numRanks == 1 )
+  {
+    // no neighbor, no message
+    EXPECT_TRUE( rows.empty() );
+    return;
+  }
+
+  // the elements are split along x, hence each rank exchanges with its neighbors in the partition
+  std::map< std::pair< int, int >, ProfileRow > fieldRows;
+  bool hasNeighborMessages = false;
+  for( ProfileRow const & row : rows )
+  {
+    SCOPED_TRACE( row.fields + ", rank " + std::to_string( row.rank ) + ", neighbor " + std::to_string( row.neighbor ) );
+    EXPECT_NE( row.rank, row.neighbor );
+    EXPECT_EQ( std::abs( row.rank - row.neighbor ), 1 );
+    if( row.fields == "elems: elementCenter" )
+    {
+      EXPECT_GT( row.messages, 0 );
+      EXPECT_GT( row.bytesSent, 0 );
+      fieldRows[ { row.rank, row.neighbor } ] = row;
+    }
+    else
+    {
+      // the messages of the ghosting and of the synchronizations, posted by the neighbor communicators
+      EXPECT_EQ( row.fields, "all messages of the neighbor communicators" );
+      EXPECT_GT( row.bytesSent, 0 );
+      EXPECT_GT( row.bytesReceived, 0 );
+      hasNeighborMessages = true;
+    }
+  }
+  EXPECT_TRUE( hasNeighborMessages );
+
+  // both sides of each synchronization report the same number of bytes
+  EXPECT_EQ( LvArray::integerConversion< int >( fieldRows.size() ), 2 * ( numRanks - 1 ) );
+  for( auto const & entry : fieldRows )
+  {
+    auto const other = fieldRows.find( { entry.first.second, entry.first.first } );
+    ASSERT_NE( other, fieldRows.end() );
+    EXPECT_EQ( entry.second.bytesSent, other->second.bytesReceived );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
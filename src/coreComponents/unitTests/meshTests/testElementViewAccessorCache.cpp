@@ -0,0 +1,107 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{ C3D8 }\"\n"
+  "                  xCoords=\"{ 0, 4 }\"\n"
+  "                  yCoords=\"{ 0, 2 }\"\n"
+  "                  zCoords=\"{ 0, 1 }\"\n"
+  "                  nx=\"{ 4 }\"\n"
+  "                  ny=\"{ 2 }\"\n"
+  "                  nz=\"{ 1 }\"\n"
+  "                  cellBlockNames=\"{ cb1 }\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb1 }\" materialList=\"{}\"/>\n"
+  "  </ElementRegions>\n"
+  "</Problem>";
+
+TEST( ElementViewAccessorCache, accessorIsRebuiltAfterResize )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  setupProblemFromXML( problemManager, xmlInput );
+
+  ElementRegionManager & elemManager = problemManager.getDomainPartition().getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager();
+  CellElementSubRegion & subRegion = elemManager.getRegion( 0 ).getSubRegion< CellElementSubRegion >( 0 );
+  array1d< real64 > & field = subRegion.registerWrapper< array1d< real64 > >( "accessorCacheTestField" ).reference();
+  ASSERT_EQ( field.size(), subRegion.size() );
+
+  int numLookups = 0;
+  auto const getAccessor = [&]()
+  {
+    return elemManager.getCachedAccessor< array1d< real64 >, arrayView1d< real64 const > >( "test/accessorCacheTestField",
+                                                                                             [&]( ElementSubRegionBase const & sr )
+    {
+      ++numLookups;
+      return sr.getWrapperPointer< array1d< real64 > >( "accessorCacheTestField" );
+    } );
+  };
+
+  {
+    ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > const accessor = getAccessor();
+    ASSERT_EQ( accessor.size(), 1 );
+    ASSERT_EQ( accessor[0].size(), 1 );
+    EXPECT_EQ( accessor[0][0].size(), field.size() );
+    EXPECT_EQ( accessor[0][0].data(), field.data() );
+  }
+  EXPECT_EQ( numLookups, 1 );
+
+  // the resize reallocates the field: the new accessor views the new data, without a new lookup of the field
+  localIndex const newSize = 4 * subRegion.size();
+  subRegion.resize( newSize );
+  ASSERT_EQ( field.size(), newSize );
+
+  {
+    ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > const accessor = getAccessor();
+    ASSERT_EQ( accessor.size(), 1 );
+    ASSERT_EQ( accessor[0].size(), 1 );
+    EXPECT_EQ( accessor[0][0].size(), newSize );
+    EXPECT_EQ( accessor[0][0].data(), field.data() );
+  }
+  EXPECT_EQ( numLookups, 1 );
+
+  // the lookup is done again once the cache is cleared
+  elemManager.clearAccessorCache();
+  getAccessor();
+  EXPECT_EQ( numLookups, 2 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
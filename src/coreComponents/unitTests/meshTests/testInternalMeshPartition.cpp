@@ -0,0 +1,108 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+/**
+ * @brief Generate two blocks of four elements along x, and collect the element centers of this rank.
+ * @param blockWeights the cellBlockWeights attribute, or an empty string for the uniform partition
+ * @return the abscissa of the centers of the locally owned elements, sorted
+ */
+std::vector< real64 > localElementAbscissas( string const & blockWeights )
+{
+  string const weightsAttribute = blockWeights.empty() ? "" : "cellBlockWeights=\"" + blockWeights + "\"";
+  string const xmlInput =
+    "<Problem>\n"
+    "  <Mesh>\n"
+    "    <InternalMesh name=\"mesh\"\n"
+    "                  elementTypes=\"{ C3D8 }\"\n"
+    "                  xCoords=\"{ 0, 4, 8 }\"\n"
+    "                  yCoords=\"{ 0, 1 }\"\n"
+    "                  zCoords=\"{ 0, 1 }\"\n"
+    "                  nx=\"{ 4, 4 }\"\n"
+    "                  ny=\"{ 1 }\"\n"
+    "                  nz=\"{ 1 }\"\n"
+    "                  cellBlockNames=\"{ cb1, cb2 }\"\n"
+    "                  " + weightsAttribute + "/>\n"
+    "  </Mesh>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb1, cb2 }\" materialList=\"{}\"/>\n"
+    "  </ElementRegions>\n"
+    "</Problem>";
+
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+
+  std::vector< real64 > abscissas;
+  ElementRegionManager const & elemManager = state.getProblemManager().getDomainPartition().getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager();
+  elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< real64 const > const centers = subRegion.getElementCenter();
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        abscissas.push_back( centers[ei][0] );
+      }
+    }
+  } );
+  std::sort( abscissas.begin(), abscissas.end() );
+  return abscissas;
+}
+
+TEST( InternalMeshPartition, uniformWeightsMatchUniformPartition )
+{
+  std::vector< real64 > const baseline = localElementAbscissas( "" );
+  EXPECT_EQ( baseline.size(), expected< std::size_t >( 8, { 4, 4 } ) );
+
+  // equal costs give the same boundaries as the even spacing
+  EXPECT_EQ( localElementAbscissas( "{ 2.0, 2.0 }" ), baseline );
+}
+
+TEST( InternalMeshPartition, weightedBoundaries )
+{
+  // the cost of the first block is three times the cost of the second one: the total cost of 16 is split
+  // after the third element (cost 9, closer to 8 than the cost 6 after the second element)
+  std::vector< real64 > const abscissas = localElementAbscissas( "{ 3.0, 1.0 }" );
+  ASSERT_EQ( abscissas.size(), expected< std::size_t >( 8, { 3, 5 } ) );
+  EXPECT_DOUBLE_EQ( abscissas.front(), expected( 0.5, { 0.5, 3.5 } ) );
+  EXPECT_DOUBLE_EQ( abscissas.back(), expected( 7.5, { 2.5, 7.5 } ) );
+
+  // no element is lost or duplicated
+  EXPECT_EQ( MpiWrapper::sum( LvArray::integerConversion< int >( abscissas.size() ) ), 8 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
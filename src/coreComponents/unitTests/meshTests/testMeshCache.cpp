@@ -0,0 +1,229 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "common/Path.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/MeshManager.hpp"
+#include "mesh/mpiCommunications/SpatialPartition.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+/// The mesh data restored by the cache, with the local indices replaced by global ones
+struct MeshSnapshot
+{
+  bool loadedFromCache;
+  std::vector< globalIndex > nodeGlobalIndices;
+  std::vector< real64 > nodePositions;
+  std::vector< integer > nodeGhostRanks;
+  std::vector< globalIndex > faceToNodes;
+  std::vector< globalIndex > elemGlobalIndices;
+  std::vector< integer > elemGhostRanks;
+  std::vector< globalIndex > elemToNodes;
+  std::vector< globalIndex > elemToFaces;
+  std::vector< int > neighbors;
+  std::vector< int > partitions;
+  std::vector< int > periodic;
+  std::vector< int > coords;
+};
+
+/**
+ * @brief Build a small mesh, possibly through the mesh cache, and record its data.
+ * @param cacheDirectory the cacheDirectory attribute of the mesh, or an empty string to disable the cache
+ * @return the data of the mesh of this rank
+ */
+MeshSnapshot buildMesh( string const & cacheDirectory )
+{
+  string const cacheAttribute = cacheDirectory.empty() ? "" : "cacheDirectory=\"" + cacheDirectory + "\"";
+  string const xmlInput =
+    "<Problem>\n"
+    "  <Mesh " + cacheAttribute + ">\n"
+    "    <InternalMesh name=\"mesh\"\n"
+    "                  elementTypes=\"{ C3D8 }\"\n"
+    "                  xCoords=\"{ 0, 4 }\"\n"
+    "                  yCoords=\"{ 0, 2 }\"\n"
+    "                  zCoords=\"{ 0, 1 }\"\n"
+    "                  nx=\"{ 4 }\"\n"
+    "                  ny=\"{ 2 }\"\n"
+    "                  nz=\"{ 1 }\"\n"
+    "                  cellBlockNames=\"{ cb1 }\"/>\n"
+    "  </Mesh>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion name=\"region\" cellBlocks=\"{ cb1 }\" materialList=\"{}\"/>\n"
+    "  </ElementRegions>\n"
+    "</Problem>";
+
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  setupProblemFromXML( problemManager, xmlInput.c_str() );
+
+  MeshSnapshot snapshot;
+  snapshot.loadedFromCache = problemManager.getGroup< MeshManager >( problemManager.groupKeys.meshManager ).isLoadedFromCache();
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+  MeshLevel const & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  FaceManager const & faceManager = mesh.getFaceManager();
+
+  arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const nodePositions = nodeManager.referencePosition();
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    snapshot.nodeGlobalIndices.push_back( nodeLocalToGlobal[a] );
+    snapshot.nodeGhostRanks.push_back( nodeManager.ghostRank()[a] );
+    for( int i = 0; i < 3; ++i )
+    {
+      snapshot.nodePositions.push_back( nodePositions[a][i] );
+    }
+  }
+
+  ArrayOfArraysView< localIndex const > const faceToNodes = faceManager.nodeList().toViewConst();
+  for( localIndex f = 0; f < faceManager.size(); ++f )
+  {
+    for( localIndex const a : faceToNodes[f] )
+    {
+      snapshot.faceToNodes.push_back( nodeLocalToGlobal[a] );
+    }
+  }
+
+  arrayView1d< globalIndex const > const faceLocalToGlobal = faceManager.localToGlobalMap();
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      snapshot.elemGlobalIndices.push_back( subRegion.localToGlobalMap()[ei] );
+      snapshot.elemGhostRanks.push_back( subRegion.ghostRank()[ei] );
+      for( localIndex a = 0; a < subRegion.numNodesPerElement(); ++a )
+      {
+        snapshot.elemToNodes.push_back( nodeLocalToGlobal[ subRegion.nodeList( ei, a ) ] );
+      }
+      for( localIndex f = 0; f < subRegion.numFacesPerElement(); ++f )
+      {
+        snapshot.elemToFaces.push_back( faceLocalToGlobal[ subRegion.faceList( ei, f ) ] );
+      }
+    }
+  } );
+
+  for( NeighborCommunicator const & neighbor : domain.getNeighbors() )
+  {
+    snapshot.neighbors.push_back( neighbor.neighborRank() );
+  }
+
+  SpatialPartition const & partition = dynamicCast< SpatialPartition const & >( domain.getReference< PartitionBase >( keys::partitionManager ) );
+  snapshot.partitions.assign( partition.m_Partitions.begin(), partition.m_Partitions.end() );
+  snapshot.periodic.assign( partition.m_Periodic.begin(), partition.m_Periodic.end() );
+  snapshot.coords.assign( partition.m_coords.begin(), partition.m_coords.end() );
+
+  return snapshot;
+}
+
+/// Recursively remove a directory written by the mesh cache
+void removeDirectory( string const & path )
+{
+  for( string const & fileName : readDirectory( path ) )
+  {
+    if( fileName == "." || fileName == ".." )
+    {
+      continue;
+    }
+    string const filePath = joinPath( path, fileName );
+    struct stat fileStat;
+    if( stat( filePath.c_str(), &fileStat ) == 0 && S_ISDIR( fileStat.st_mode ) )
+    {
+      removeDirectory( filePath );
+    }
+    else
+    {
+      std::remove( filePath.c_str() );
+    }
+  }
+  std::remove( path.c_str() );
+}
+
+void expectSameMesh( MeshSnapshot const & snapshot, MeshSnapshot const & reference )
+{
+  EXPECT_EQ( snapshot.nodeGlobalIndices, reference.nodeGlobalIndices );
+  EXPECT_EQ( snapshot.nodePositions, reference.nodePositions );
+  EXPECT_EQ( snapshot.nodeGhostRanks, reference.nodeGhostRanks );
+  EXPECT_EQ( snapshot.faceToNodes, reference.faceToNodes );
+  EXPECT_EQ( snapshot.elemGlobalIndices, reference.elemGlobalIndices );
+  EXPECT_EQ( snapshot.elemGhostRanks, reference.elemGhostRanks );
+  EXPECT_EQ( snapshot.elemToNodes, reference.elemToNodes );
+  EXPECT_EQ( snapshot.elemToFaces, reference.elemToFaces );
+  EXPECT_EQ( snapshot.neighbors, reference.neighbors );
+  EXPECT_EQ( snapshot.partitions, reference.partitions );
+  EXPECT_EQ( snapshot.periodic, reference.periodic );
+  EXPECT_EQ( snapshot.coords, reference.coords );
+}
+
+TEST( MeshCache, roundTrip )
+{
+  // a directory of its own, so that the first run never finds an entry
+  string cacheDirectory;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    cacheDirectory = GEOSX_FMT( "testMeshCache_{}", getpid() );
+  }
+  MpiWrapper::broadcast( cacheDirectory, 0 );
+
+  MeshSnapshot const generated = buildMesh( "" );
+  EXPECT_FALSE( generated.loadedFromCache );
+  EXPECT_EQ( generated.elemGlobalIndices.size() - std::count_if( generated.elemGhostRanks.begin(),
+                                                                 generated.elemGhostRanks.end(),
+                                                                 []( integer const r ) { return r >= 0; } ),
+             expected< std::size_t >( 8, { 4, 4 } ) );
+
+  // the first run with the cache generates the mesh and writes it
+  MeshSnapshot const written = buildMesh( cacheDirectory );
+  EXPECT_FALSE( written.loadedFromCache );
+  expectSameMesh( written, generated );
+
+  // the second run loads it
+  MeshSnapshot const loaded = buildMesh( cacheDirectory );
+  EXPECT_TRUE( loaded.loadedFromCache );
+  expectSameMesh( loaded, generated );
+
+  MpiWrapper::barrier();
+  if( MpiWrapper::commRank() == 0 )
+  {
+    removeDirectory( cacheDirectory );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
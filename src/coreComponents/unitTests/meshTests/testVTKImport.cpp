@@ -21,6 +21,7 @@
 #include "mesh/MeshManager.hpp"
 #include "mesh/generators/CellBlockManagerABC.hpp"
 #include "mesh/generators/CellBlockABC.hpp"
+#include "mesh/generators/VTKMeshGenerator.hpp"
 
 // special CMake-generated include
 #include "tests/meshDirName.hpp"
@@ -28,6 +29,15 @@
 // TPL includes
 #include <gtest/gtest.h>
 #include <conduit.hpp>
+#include <vtkCellData.h>
+#include <vtkCellType.h>
+#include <vtkIdTypeArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <set>
 
 using namespace geosx;
 using namespace geosx::testing;
@@ -223,6 +233,109 @@ TEST( VTKImport, medley )
 }
 
 
+/// Abscissa of the point planes of the three hexahedra of the migration test, the plane x = 2 being duplicated
+real64 const planeAbscissa[5] = { 0.0, 1.0, 2.0, 2.0, 3.0 };
+
+/// Global id of a point of the migration test: the four points of a plane are numbered by y + 2 z
+vtkIdType pointGlobalId( int const plane, int const y, int const z )
+{
+  return 4 * plane + y + 2 * z;
+}
+
+/**
+ * @brief Build some of three unit hexahedra along x, the last two being split by duplicated points.
+ * @param cells the global ids of the cells to build
+ * @return the grid of the cells, with global point and cell ids
+ */
+vtkSmartPointer< vtkUnstructuredGrid > buildSplitHexahedra( std::vector< vtkIdType > const & cells )
+{
+  // point planes of the cells: the second and third cells do not share points
+  int const cellPlanes[3][2] = { { 0, 1 }, { 1, 2 }, { 3, 4 } };
+
+  vtkNew< vtkPoints > points;
+  vtkNew< vtkIdTypeArray > pointIds;
+  vtkNew< vtkIdTypeArray > cellIds;
+  vtkSmartPointer< vtkUnstructuredGrid > mesh = vtkSmartPointer< vtkUnstructuredGrid >::New();
+  mesh->Allocate( LvArray::integerConversion< vtkIdType >( cells.size() ) );
+
+  std::map< vtkIdType, vtkIdType > globalToLocal;
+  auto const addPoint = [&]( int const plane, int const y, int const z )
+  {
+    vtkIdType const globalId = pointGlobalId( plane, y, z );
+    auto const inserted = globalToLocal.emplace( globalId, points->GetNumberOfPoints() );
+    if( inserted.second )
+    {
+      points->InsertNextPoint( planeAbscissa[plane], y, z );
+      pointIds->InsertNextValue( globalId );
+    }
+    return inserted.first->second;
+  };
+
+  for( vtkIdType const c : cells )
+  {
+    int const x0 = cellPlanes[c][0];
+    int const x1 = cellPlanes[c][1];
+    vtkIdType const hexPoints[8] = { addPoint( x0, 0, 0 ), addPoint( x1, 0, 0 ), addPoint( x1, 1, 0 ), addPoint( x0, 1, 0 ),
+                                     addPoint( x0, 0, 1 ), addPoint( x1, 0, 1 ), addPoint( x1, 1, 1 ), addPoint( x0, 1, 1 ) };
+    mesh->InsertNextCell( VTK_HEXAHEDRON, 8, hexPoints );
+    cellIds->InsertNextValue( c );
+  }
+
+  mesh->SetPoints( points );
+  mesh->GetPointData()->SetGlobalIds( pointIds );
+  mesh->GetCellData()->SetGlobalIds( cellIds );
+  return mesh;
+}
+
+TEST( VTKImport, migrateCells )
+{
+  // In serial, rank 0 holds the three cells. With two ranks, the cells sharing points are held by different ranks.
+  // Every cell is sent to rank 0, which must merge the points shared by the first two cells only.
+  int const rank = MpiWrapper::commRank();
+  std::vector< vtkIdType > const localCells = expected( std::vector< vtkIdType >{ 0, 1, 2 },
+                                                        { std::vector< vtkIdType >{ 0, 2 }, std::vector< vtkIdType >{ 1 } } );
+  vtkSmartPointer< vtkUnstructuredGrid > const mesh = buildSplitHexahedra( localCells );
+
+  array1d< int > ranks( mesh->GetNumberOfCells() );
+  vtkSmartPointer< vtkUnstructuredGrid > const migrated = vtk::migrateCells( *mesh, ranks.toViewConst() );
+
+  if( rank != 0 )
+  {
+    EXPECT_EQ( migrated->GetNumberOfCells(), 0 );
+    EXPECT_EQ( migrated->GetNumberOfPoints(), 0 );
+    return;
+  }
+
+  // 4 planes of 4 points, plus the 4 duplicated points at x = 2 (a geometric merge would keep 16 points)
+  ASSERT_EQ( migrated->GetNumberOfCells(), 3 );
+  ASSERT_EQ( migrated->GetNumberOfPoints(), 20 );
+
+  vtkDataArray * const cellIds = migrated->GetCellData()->GetGlobalIds();
+  ASSERT_NE( cellIds, nullptr );
+  std::set< vtkIdType > migratedCells;
+  for( vtkIdType c = 0; c < migrated->GetNumberOfCells(); ++c )
+  {
+    migratedCells.insert( static_cast< vtkIdType >( cellIds->GetTuple1( c ) ) );
+  }
+  EXPECT_EQ( migratedCells, ( std::set< vtkIdType >{ 0, 1, 2 } ) );
+
+  // each global point id is held by a single point, at the location of that id
+  vtkDataArray * const pointIds = migrated->GetPointData()->GetGlobalIds();
+  ASSERT_NE( pointIds, nullptr );
+  std::set< vtkIdType > migratedPoints;
+  for( vtkIdType p = 0; p < migrated->GetNumberOfPoints(); ++p )
+  {
+    vtkIdType const globalId = static_cast< vtkIdType >( pointIds->GetTuple1( p ) );
+    migratedPoints.insert( globalId );
+    double coords[3];
+    migrated->GetPoint( p, coords );
+    EXPECT_DOUBLE_EQ( coords[0], planeAbscissa[globalId / 4] );
+    EXPECT_DOUBLE_EQ( coords[1], globalId % 2 );
+    EXPECT_DOUBLE_EQ( coords[2], ( globalId / 2 ) % 2 );
+  }
+  EXPECT_EQ( migratedPoints.size(), std::size_t( 20 ) );
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
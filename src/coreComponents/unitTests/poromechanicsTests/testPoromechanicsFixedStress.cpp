@@ -0,0 +1,456 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+/**
+ * @brief Single-phase Terzaghi consolidation problem, with the coupling type of the poromechanics solver left to fill in.
+ * @param couplingType the coupling type of the poromechanics solver
+ * @return the input XML
+ */
+string singlePhaseXmlInput( string const & couplingType )
+{
+  return
+    "<Problem>\n"
+    "  <Solvers gravityVector=\"{ 0.0, 0.0, 0.0 }\">\n"
+    "    <SinglePhasePoromechanics name=\"poroSolver\"\n"
+    "                              solidSolverName=\"solidSolver\"\n"
+    "                              fluidSolverName=\"flowSolver\"\n"
+    "                              couplingType=\"" + couplingType + "\"\n"
+    "                              fixedStressTolerance=\"1.0e-10\"\n"
+    "                              maxFixedStressIterations=\"200\"\n"
+    "                              discretization=\"FE1\"\n"
+    "                              targetRegions=\"{ Domain }\">\n"
+    "      <NonlinearSolverParameters newtonTol=\"1.0e-10\"/>\n"
+    "      <LinearSolverParameters directParallel=\"0\"/>\n"
+    "    </SinglePhasePoromechanics>\n"
+    "    <SolidMechanicsLagrangianSSLE name=\"solidSolver\"\n"
+    "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+    "                                  discretization=\"FE1\"\n"
+    "                                  targetRegions=\"{ Domain }\">\n"
+    "      <NonlinearSolverParameters newtonTol=\"1.0e-10\"/>\n"
+    "      <LinearSolverParameters directParallel=\"0\"/>\n"
+    "    </SolidMechanicsLagrangianSSLE>\n"
+    "    <SinglePhaseFVM name=\"flowSolver\"\n"
+    "                    discretization=\"singlePhaseTPFA\"\n"
+    "                    targetRegions=\"{ Domain }\">\n"
+    "      <NonlinearSolverParameters newtonTol=\"1.0e-10\"/>\n"
+    "      <LinearSolverParameters directParallel=\"0\"/>\n"
+    "    </SinglePhaseFVM>\n"
+    "  </Solvers>\n"
+    "  <Mesh>\n"
+    "    <InternalMesh name=\"mesh\"\n"
+    "                  elementTypes=\"{ C3D8 }\"\n"
+    "                  xCoords=\"{ 0, 10 }\"\n"
+    "                  yCoords=\"{ 0, 1 }\"\n"
+    "                  zCoords=\"{ 0, 1 }\"\n"
+    "                  nx=\"{ 10 }\"\n"
+    "                  ny=\"{ 1 }\"\n"
+    "                  nz=\"{ 1 }\"\n"
+    "                  cellBlockNames=\"{ cb1 }\"/>\n"
+    "  </Mesh>\n"
+    "  <NumericalMethods>\n"
+    "    <FiniteElements>\n"
+    "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+    "    </FiniteElements>\n"
+    "    <FiniteVolume>\n"
+    "      <TwoPointFluxApproximation name=\"singlePhaseTPFA\"/>\n"
+    "    </FiniteVolume>\n"
+    "  </NumericalMethods>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion name=\"Domain\" cellBlocks=\"{ cb1 }\" materialList=\"{ fluid, porousRock }\"/>\n"
+    "  </ElementRegions>\n"
+    "  <Constitutive>\n"
+    "    <PorousElasticIsotropic name=\"porousRock\"\n"
+    "                            solidModelName=\"skeleton\"\n"
+    "                            porosityModelName=\"skeletonPorosity\"\n"
+    "                            permeabilityModelName=\"skeletonPerm\"/>\n"
+    "    <ElasticIsotropic name=\"skeleton\"\n"
+    "                      defaultDensity=\"0\"\n"
+    "                      defaultYoungModulus=\"1.0e4\"\n"
+    "                      defaultPoissonRatio=\"0.2\"/>\n"
+    "    <CompressibleSinglePhaseFluid name=\"fluid\"\n"
+    "                                  defaultDensity=\"1\"\n"
+    "                                  defaultViscosity=\"1.0\"\n"
+    "                                  referencePressure=\"0.0\"\n"
+    "                                  referenceDensity=\"1\"\n"
+    "                                  compressibility=\"0.0e0\"\n"
+    "                                  referenceViscosity=\"1\"\n"
+    "                                  viscosibility=\"0.0\"/>\n"
+    "    <BiotPorosity name=\"skeletonPorosity\"\n"
+    "                  grainBulkModulus=\"1.0e27\"\n"
+    "                  defaultReferencePorosity=\"0.3\"/>\n"
+    "    <ConstantPermeability name=\"skeletonPerm\"\n"
+    "                          permeabilityComponents=\"{ 1.0e-4, 1.0e-4, 1.0e-4 }\"/>\n"
+    "  </Constitutive>\n"
+    "  <FieldSpecifications>\n"
+    "    <FieldSpecification name=\"initialPressure\"\n"
+    "                        initialCondition=\"1\"\n"
+    "                        setNames=\"{ all }\"\n"
+    "                        objectPath=\"ElementRegions/Domain/cb1\"\n"
+    "                        fieldName=\"pressure\"\n"
+    "                        scale=\"0.0\"/>\n"
+    "    <FieldSpecification name=\"xconstraint\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"0\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{ xpos }\"/>\n"
+    "    <FieldSpecification name=\"yconstraint\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"1\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{ yneg, ypos }\"/>\n"
+    "    <FieldSpecification name=\"zconstraint\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"2\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{ zneg, zpos }\"/>\n"
+    "    <Traction name=\"xnegTraction\"\n"
+    "              objectPath=\"faceManager\"\n"
+    "              direction=\"{ 1, 0, 0 }\"\n"
+    "              scale=\"1.0e0\"\n"
+    "              setNames=\"{ xneg }\"\n"
+    "              functionName=\"timeFunction\"/>\n"
+    "    <FieldSpecification name=\"boundaryPressure\"\n"
+    "                        objectPath=\"faceManager\"\n"
+    "                        fieldName=\"pressure\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{ xneg }\"/>\n"
+    "  </FieldSpecifications>\n"
+    "  <Functions>\n"
+    "    <TableFunction name=\"timeFunction\"\n"
+    "                   inputVarNames=\"{ time }\"\n"
+    "                   coordinates=\"{ 0.0, 0.1e-09, 1e7 }\"\n"
+    "                   values=\"{ 0.0, 1.0, 1.0 }\"/>\n"
+    "  </Functions>\n"
+    "</Problem>";
+}
+
+/**
+ * @brief Oil-water consolidation problem drained by a cell at the loaded end,
+ *        with the coupling type of the poromechanics solver left to fill in.
+ * @param couplingType the coupling type of the poromechanics solver
+ * @return the input XML
+ */
+string multiphaseXmlInput( string const & couplingType )
+{
+  return
+    "<Problem>\n"
+    "  <Solvers gravityVector=\"{ 0.0, 0.0, 0.0 }\">\n"
+    "    <MultiphasePoromechanics name=\"poroSolver\"\n"
+    "                             solidSolverName=\"solidSolver\"\n"
+    "                             fluidSolverName=\"flowSolver\"\n"
+    "                             couplingType=\"" + couplingType + "\"\n"
+    "                             fixedStressTolerance=\"1.0e-10\"\n"
+    "                             maxFixedStressIterations=\"200\"\n"
+    "                             discretization=\"FE1\"\n"
+    "                             targetRegions=\"{ Domain }\">\n"
+    "      <NonlinearSolverParameters newtonTol=\"1.0e-10\"\n"
+    "                                 newtonMaxIter=\"20\"/>\n"
+    "      <LinearSolverParameters directParallel=\"0\"/>\n"
+    "    </MultiphasePoromechanics>\n"
+    "    <SolidMechanicsLagrangianSSLE name=\"solidSolver\"\n"
+    "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+    "                                  discretization=\"FE1\"\n"
+    "                                  targetRegions=\"{ Domain }\">\n"
+    "      <NonlinearSolverParameters newtonTol=\"1.0e-10\"/>\n"
+    "      <LinearSolverParameters directParallel=\"0\"/>\n"
+    "    </SolidMechanicsLagrangianSSLE>\n"
+    "    <CompositionalMultiphaseFVM name=\"flowSolver\"\n"
+    "                                discretization=\"fluidTPFA\"\n"
+    "                                targetRegions=\"{ Domain }\"\n"
+    "                                temperature=\"300\">\n"
+    "      <NonlinearSolverParameters newtonTol=\"1.0e-10\"\n"
+    "                                 newtonMaxIter=\"20\"/>\n"
+    "      <LinearSolverParameters directParallel=\"0\"/>\n"
+    "    </CompositionalMultiphaseFVM>\n"
+    "  </Solvers>\n"
+    "  <Mesh>\n"
+    "    <InternalMesh name=\"mesh\"\n"
+    "                  elementTypes=\"{ C3D8 }\"\n"
+    "                  xCoords=\"{ 0, 10 }\"\n"
+    "                  yCoords=\"{ 0, 1 }\"\n"
+    "                  zCoords=\"{ 0, 1 }\"\n"
+    "                  nx=\"{ 10 }\"\n"
+    "                  ny=\"{ 1 }\"\n"
+    "                  nz=\"{ 1 }\"\n"
+    "                  cellBlockNames=\"{ cb1 }\"/>\n"
+    "  </Mesh>\n"
+    "  <Geometry>\n"
+    "    <Box name=\"sink\" xMin=\"{ -0.01, -0.01, -0.01 }\" xMax=\"{ 1.01, 1.01, 1.01 }\"/>\n"
+    "  </Geometry>\n"
+    "  <NumericalMethods>\n"
+    "    <FiniteElements>\n"
+    "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+    "    </FiniteElements>\n"
+    "    <FiniteVolume>\n"
+    "      <TwoPointFluxApproximation name=\"fluidTPFA\"/>\n"
+    "    </FiniteVolume>\n"
+    "  </NumericalMethods>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion name=\"Domain\" cellBlocks=\"{ cb1 }\" materialList=\"{ fluid, relperm, porousRock }\"/>\n"
+    "  </ElementRegions>\n"
+    "  <Constitutive>\n"
+    "    <DeadOilFluid name=\"fluid\"\n"
+    "                  phaseNames=\"{ oil, water }\"\n"
+    "                  surfaceDensities=\"{ 800.0, 1022.0 }\"\n"
+    "                  componentMolarWeight=\"{ 114e-3, 18e-3 }\"\n"
+    "                  hydrocarbonFormationVolFactorTableNames=\"{ B_o_table }\"\n"
+    "                  hydrocarbonViscosityTableNames=\"{ visc_o_table }\"\n"
+    "                  waterReferencePressure=\"1.0e7\"\n"
+    "                  waterFormationVolumeFactor=\"1.03\"\n"
+    "                  waterCompressibility=\"4.1e-10\"\n"
+    "                  waterViscosity=\"0.0003\"/>\n"
+    "    <BrooksCoreyRelativePermeability name=\"relperm\"\n"
+    "                                     phaseNames=\"{ oil, water }\"\n"
+    "                                     phaseMinVolumeFraction=\"{ 0.0, 0.0 }\"\n"
+    "                                     phaseRelPermExponent=\"{ 2.0, 2.0 }\"\n"
+    "                                     phaseRelPermMaxValue=\"{ 1.0, 1.0 }\"/>\n"
+    "    <PorousElasticIsotropic name=\"porousRock\"\n"
+    "                            solidModelName=\"skeleton\"\n"
+    "                            porosityModelName=\"skeletonPorosity\"\n"
+    "                            permeabilityModelName=\"skeletonPerm\"/>\n"
+    "    <ElasticIsotropic name=\"skeleton\"\n"
+    "                      defaultDensity=\"0\"\n"
+    "                      defaultYoungModulus=\"1.0e9\"\n"
+    "                      defaultPoissonRatio=\"0.2\"/>\n"
+    "    <BiotPorosity name=\"skeletonPorosity\"\n"
+    "                  grainBulkModulus=\"1.0e27\"\n"
+    "                  defaultReferencePorosity=\"0.3\"/>\n"
+    "    <ConstantPermeability name=\"skeletonPerm\"\n"
+    "                          permeabilityComponents=\"{ 1.0e-13, 1.0e-13, 1.0e-13 }\"/>\n"
+    "  </Constitutive>\n"
+    "  <FieldSpecifications>\n"
+    "    <FieldSpecification name=\"initialPressure\"\n"
+    "                        initialCondition=\"1\"\n"
+    "                        setNames=\"{ all }\"\n"
+    "                        objectPath=\"ElementRegions/Domain/cb1\"\n"
+    "                        fieldName=\"pressure\"\n"
+    "                        scale=\"1.0e7\"/>\n"
+    "    <FieldSpecification name=\"initialComposition_oil\"\n"
+    "                        initialCondition=\"1\"\n"
+    "                        setNames=\"{ all }\"\n"
+    "                        objectPath=\"ElementRegions/Domain/cb1\"\n"
+    "                        fieldName=\"globalCompFraction\"\n"
+    "                        component=\"0\"\n"
+    "                        scale=\"0.6\"/>\n"
+    "    <FieldSpecification name=\"initialComposition_water\"\n"
+    "                        initialCondition=\"1\"\n"
+    "                        setNames=\"{ all }\"\n"
+    "                        objectPath=\"ElementRegions/Domain/cb1\"\n"
+    "                        fieldName=\"globalCompFraction\"\n"
+    "                        component=\"1\"\n"
+    "                        scale=\"0.4\"/>\n"
+    "    <FieldSpecification name=\"sinkPressure\"\n"
+    "                        setNames=\"{ sink }\"\n"
+    "                        objectPath=\"ElementRegions/Domain/cb1\"\n"
+    "                        fieldName=\"pressure\"\n"
+    "                        scale=\"1.0e7\"/>\n"
+    "    <FieldSpecification name=\"sinkComposition_oil\"\n"
+    "                        setNames=\"{ sink }\"\n"
+    "                        objectPath=\"ElementRegions/Domain/cb1\"\n"
+    "                        fieldName=\"globalCompFraction\"\n"
+    "                        component=\"0\"\n"
+    "                        scale=\"0.6\"/>\n"
+    "    <FieldSpecification name=\"sinkComposition_water\"\n"
+    "                        setNames=\"{ sink }\"\n"
+    "                        objectPath=\"ElementRegions/Domain/cb1\"\n"
+    "                        fieldName=\"globalCompFraction\"\n"
+    "                        component=\"1\"\n"
+    "                        scale=\"0.4\"/>\n"
+    "    <FieldSpecification name=\"xconstraint\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"0\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{ xpos }\"/>\n"
+    "    <FieldSpecification name=\"yconstraint\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"1\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{ yneg, ypos }\"/>\n"
+    "    <FieldSpecification name=\"zconstraint\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"2\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{ zneg, zpos }\"/>\n"
+    "    <Traction name=\"xnegTraction\"\n"
+    "              objectPath=\"faceManager\"\n"
+    "              direction=\"{ 1, 0, 0 }\"\n"
+    "              scale=\"1.0e6\"\n"
+    "              setNames=\"{ xneg }\"\n"
+    "              functionName=\"timeFunction\"/>\n"
+    "  </FieldSpecifications>\n"
+    "  <Functions>\n"
+    "    <TableFunction name=\"timeFunction\"\n"
+    "                   inputVarNames=\"{ time }\"\n"
+    "                   coordinates=\"{ 0.0, 0.1e-09, 1e7 }\"\n"
+    "                   values=\"{ 0.0, 1.0, 1.0 }\"/>\n"
+    "    <TableFunction name=\"B_o_table\"\n"
+    "                   coordinates=\"{ 1.0e6, 1.0e8 }\"\n"
+    "                   values=\"{ 1.02, 1.0 }\"/>\n"
+    "    <TableFunction name=\"visc_o_table\"\n"
+    "                   coordinates=\"{ 1.0e6, 1.0e8 }\"\n"
+    "                   values=\"{ 0.001, 0.001 }\"/>\n"
+    "  </Functions>\n"
+    "</Problem>";
+}
+
+/**
+ * @brief Pressure and displacement at the end of the simulation.
+ */
+struct PoromechanicsSolution
+{
+  array1d< real64 > pressure;
+  array2d< real64 > displacement;
+};
+
+/**
+ * @brief Run a few time steps of a consolidation problem and copy the solution.
+ * @param xmlInput the input XML of the problem
+ * @param dt the time step
+ * @return the pressure and displacement at the end of the last time step
+ */
+PoromechanicsSolution runConsolidation( string const & xmlInput, real64 const dt )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+
+  SolverBase & solver = state.getProblemManager().getPhysicsSolverManager().getGroup< SolverBase >( "poroSolver" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  integer const numSteps = 3;
+  for( integer cycle = 0; cycle < numSteps; ++cycle )
+  {
+    real64 const dtReturn = solver.solverStep( cycle * dt, dt, cycle, domain );
+    EXPECT_DOUBLE_EQ( dtReturn, dt );
+  }
+
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  ElementSubRegionBase & subRegion = mesh.getElemManager().getRegion( "Domain" ).getSubRegion( "cb1" );
+
+  arrayView1d< real64 const > const pressure = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const displacement = mesh.getNodeManager().totalDisplacement();
+
+  PoromechanicsSolution solution;
+  solution.pressure.resize( pressure.size() );
+  solution.displacement.resize( displacement.size( 0 ), 3 );
+
+  arrayView1d< real64 > const pressureCopy = solution.pressure.toView();
+  arrayView2d< real64 > const displacementCopy = solution.displacement.toView();
+  forAll< serialPolicy >( pressure.size(), [=] ( localIndex const ei )
+  {
+    pressureCopy[ei] = pressure[ei];
+  } );
+  forAll< serialPolicy >( displacement.size( 0 ), [=] ( localIndex const a )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      displacementCopy( a, i ) = displacement( a, i );
+    }
+  } );
+
+  return solution;
+}
+
+/**
+ * @brief Check that the fixed-stress solution matches the fully implicit solution.
+ * @param fixedStress the solution of the fixed-stress split
+ * @param fullyImplicit the solution of the fully implicit coupling
+ * @param initialPressure the uniform initial pressure, from which the pressure changes are measured
+ */
+void checkSameSolution( PoromechanicsSolution const & fixedStress,
+                        PoromechanicsSolution const & fullyImplicit,
+                        real64 const initialPressure )
+{
+  real64 const relTol = 1e-6;
+
+  ASSERT_EQ( fixedStress.pressure.size(), fullyImplicit.pressure.size() );
+  real64 maxPressureChange = 0.0;
+  for( localIndex ei = 0; ei < fullyImplicit.pressure.size(); ++ei )
+  {
+    maxPressureChange = std::max( maxPressureChange, std::fabs( fullyImplicit.pressure[ei] - initialPressure ) );
+  }
+  ASSERT_GT( maxPressureChange, 0.0 );
+  for( localIndex ei = 0; ei < fullyImplicit.pressure.size(); ++ei )
+  {
+    SCOPED_TRACE( "element " + std::to_string( ei ) );
+    EXPECT_NEAR( fixedStress.pressure[ei], fullyImplicit.pressure[ei], relTol * maxPressureChange );
+  }
+
+  ASSERT_EQ( fixedStress.displacement.size( 0 ), fullyImplicit.displacement.size( 0 ) );
+  real64 maxDisplacement = 0.0;
+  for( localIndex a = 0; a < fullyImplicit.displacement.size( 0 ); ++a )
+  {
+    maxDisplacement = std::max( maxDisplacement, std::fabs( fullyImplicit.displacement( a, 0 ) ) );
+  }
+  ASSERT_GT( maxDisplacement, 0.0 );
+  for( localIndex a = 0; a < fullyImplicit.displacement.size( 0 ); ++a )
+  {
+    SCOPED_TRACE( "node " + std::to_string( a ) );
+    for( integer i = 0; i < 3; ++i )
+    {
+      EXPECT_NEAR( fixedStress.displacement( a, i ), fullyImplicit.displacement( a, i ), relTol * maxDisplacement );
+    }
+  }
+}
+
+TEST( PoromechanicsFixedStressTest, convergesToFullyImplicitSolution )
+{
+  PoromechanicsSolution const fullyImplicit = runConsolidation( singlePhaseXmlInput( "FullyImplicit" ), 1.0 );
+  PoromechanicsSolution const fixedStress = runConsolidation( singlePhaseXmlInput( "FixedStress" ), 1.0 );
+
+  checkSameSolution( fixedStress, fullyImplicit, 0.0 );
+}
+
+TEST( PoromechanicsFixedStressTest, multiphaseConvergesToFullyImplicitSolution )
+{
+  PoromechanicsSolution const fullyImplicit = runConsolidation( multiphaseXmlInput( "FullyImplicit" ), 0.1 );
+  PoromechanicsSolution const fixedStress = runConsolidation( multiphaseXmlInput( "FixedStress" ), 0.1 );
+
+  checkSameSolution( fixedStress, fullyImplicit, 1.0e7 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -62,6 +62,9 @@
 /// Enables use of PETSc library (CMake option ENABLE_PETSC)
 #define GEOSX_USE_PETSC
 
+/// Enables use of ParMETIS library (CMake option ENABLE_PARMETIS)
+#define GEOSX_USE_PARMETIS
+
 /// Choice of global linear algebra interface (CMake option GEOSX_LA_INTERFACE)
 #define GEOSX_LA_INTERFACE Hypre
 /// Macro defined when Trilinos interface is selected
@@ -75,6 +78,9 @@
 /// Platform-dependent mangling of fortran function names (CMake option FORTRAN_MANGLE_NO_UNDERSCORE)
 #define FORTRAN_MANGLE_NO_UNDERSCORE
 
+/// Enables single-precision storage of multiphase fluid derivatives (CMake option GEOSX_ENABLE_MIXED_PRECISION_FLUID)
+#define GEOSX_USE_MIXED_PRECISION_FLUID
+
 /// USE OF SEPARATION COEFFICIENT IN FRACTURE FLOW
 #define GEOSX_USE_SEPARATION_COEFFICIENT
 
@@ -48,6 +48,8 @@ int main( int argc, char *argv[] )
         LVARRAY_WARNING_IF( state.getState() != State::COMPLETED, "Simulation exited early." );
       }
 
+      state.report();
+
       initTime = state.getInitTime();
       runTime = state.getRunTime();
     }
@@ -248,6 +248,7 @@ PyObject * finalize( PyObject * self, PyObject * args ) noexcept
     Py_RETURN_NONE;
   }
 
+  g_state->report();
   g_state = nullptr;
   basicCleanup();
   Py_RETURN_NONE;